@@ -0,0 +1,475 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     BatchRanker.cpp
+//
+// File Overview: Represents a Batch Ranker that streams hands of text, one
+//                per line, and writes the rank of each in input order
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Rank binary hand files
+//******************************************************************************
+
+#include "stdafx.h"
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <vector>
+#include "BatchRanker.h"
+#include "HandRange.h"
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize data members to input values
+// Notes    : Throw an exception if blockSize is less than MINBLOCKSIZE or
+//             more than INT_MAX, so the lines of a block fit an int
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+BatchRanker::BatchRanker(const size_t blockSize)
+   : threadPool(NULL),
+     blockSize(blockSize)
+{
+   if (blockSize < MINBLOCKSIZE || blockSize > INT_MAX)
+   {
+      throw exception("Invalid block size in BatchRanker::BatchRanker");
+   }
+} // end BatchRanker::BatchRanker
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+BatchRanker::~BatchRanker()
+{
+} // end BatchRanker::~BatchRanker
+
+//******************************************************************************
+// Function : appendResult
+// Process  : Append the digits of the value, a space, the type name, and a
+//             newline
+// Notes    : Formats the digits directly, no stream per line
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Use the hand type names
+//******************************************************************************
+void BatchRanker::appendResult(
+   const int               value,
+   const Hand::HandType    type,
+   string&                 output)
+{
+   char           digits[16];   // Digits of the value, lowest first
+   int            numDigits = 0;
+   unsigned int   remaining = static_cast<unsigned int>(value);
+
+   do
+   {
+      digits[numDigits++] = static_cast<char>('0' + remaining % 10);
+      remaining /= 10;
+   } while (remaining > 0);
+
+   while (numDigits > 0)
+   {
+      output += digits[--numDigits];
+   }
+
+   output += ' ';
+   output += Hand::getTypeName(type);
+   output += '\n';
+} // end BatchRanker::appendResult
+
+//******************************************************************************
+// Function : parseCards
+// Process  : For each card of the text, skipping spaces, tabs, and line
+//             ends
+//                Parse the card number, 10 or one character
+//                Parse the suit character
+//                Add the card, failing if it is the MAXCARDS + 1st
+//             Return false if a card is invalid or not followed by a space
+// Notes    : cards must hold MAXCARDS cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+bool BatchRanker::parseCards(
+   const char* first,
+   const char* last,
+   PackedCard  cards[],
+   int&        numCards)
+{
+   const char* next = first;
+
+   numCards = 0;
+
+   for (;;)
+   {
+      int rank = -1;
+      int suit = -1;
+
+      while (next != last &&
+             (*next == ' ' || *next == '\t' || *next == '\r' || *next == '\n'))
+      {
+         ++next;
+      }
+
+      if (next == last)
+      {
+         return true;
+      }
+
+      if (*next == '1' && last - next > 1 && next[1] == '0')
+      {
+         rank  = HandRange::parseRank('T');
+         next += 2;
+      }
+      else
+      {
+         rank = HandRange::parseRank(*next++);
+      }
+
+      if (next != last)
+      {
+         suit = HandRange::parseSuit(*next++);
+      }
+
+      if (rank < 0 || suit < 0 || numCards == MAXCARDS ||
+          (next != last && *next != ' ' && *next != '\t' &&
+           *next != '\r' && *next != '\n'))
+      {
+         return false;
+      }
+
+      cards[numCards++] =
+         PackedCard::fromIndex(rank * PackedCard::NUMSUITS + suit);
+   }
+} // end BatchRanker::parseCards
+
+//******************************************************************************
+// Function : rankFile
+// Process  : Open the hand file and create a result file of as many hands
+//             Check the threads and use the set pool, else a pool of
+//             numThreads for the file
+//             For each run of HANDSPERRUN hands
+//                Rank the hands in chunks of LINESPERCHUNK on the pool,
+//                writing their results in place
+// Notes    : Throw an exception if numThreads is negative, or a file cannot
+//             be opened or created
+//             Both files are mapped, so memory holds only the pages the
+//             workers touch, and each result is written to its own slot
+//             with no ordering or output buffer
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void BatchRanker::rankFile(
+   const char* handFileName,
+   const char* resultFileName,
+   const int   numThreads)
+{
+   HandFile    hands;
+   ResultFile  results;
+   int         threadCount = numThreads;
+
+   if (numThreads < 0)
+   {
+      throw exception("Invalid threads in BatchRanker::rankFile");
+   }
+
+   if (threadCount == 0)
+   {
+      threadCount = ThreadPool::getNumCores();
+   }
+
+   hands.open(handFileName);
+   results.create(resultFileName, hands.getNumHands());
+
+   ThreadPool  callPool(this->threadPool != NULL ? 1 : threadCount);
+   ThreadPool& pool = this->threadPool != NULL ? *this->threadPool :
+                                                 callPool;
+
+   for (unsigned long long first = 0;
+        first < hands.getNumHands();
+        first += HANDSPERRUN)
+   {
+      const unsigned long long remaining = hands.getNumHands() - first;
+      const int                numHands  =
+         remaining < HANDSPERRUN ? static_cast<int>(remaining) : HANDSPERRUN;
+
+      pool.run(numHands,
+               LINESPERCHUNK,
+               bind(&BatchRanker::rankHands,
+                    this,
+                    placeholders::_1,
+                    placeholders::_2,
+                    placeholders::_3,
+                    &hands,
+                    first,
+                    results.getWritableValues(),
+                    results.getWritableTypes()));
+   }
+} // end BatchRanker::rankFile
+
+//******************************************************************************
+// Function : rankHands
+// Process  : For each hand of the chunk
+//                Read its cards from their columns
+//                Rank them if they are all valid and unique
+//                Write the value and type, 0 and INVALIDHAND if not ranked
+// Notes    : Each hand has its own result, so the workers never share one
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void BatchRanker::rankHands(
+   const int                  firstHand,
+   const int                  lastHand,
+   const int                  /*worker*/,
+   const HandFile*            hands,
+   const unsigned long long   offset,
+   int                        values[],
+   unsigned char              types[]) const
+{
+   const int         numCards = hands->getNumCards();
+   const PackedCard* columns[MAXCARDS];
+
+   for (int card = 0; card < numCards; ++card)
+   {
+      columns[card] = hands->getColumn(card) + offset;
+   }
+
+   for (int hand = firstHand; hand < lastHand; ++hand)
+   {
+      CardSet        cardSet;
+      int            value    = 0;
+      Hand::HandType type     = Hand::INVALIDHAND;
+      int            card     = 0;
+
+      while (card < numCards && columns[card][hand].isValid())
+      {
+         cardSet.add(columns[card++][hand]);
+      }
+
+      if (card == numCards && cardSet.getCount() == numCards)
+      {
+         this->ranker.rankCards(cardSet, value, type);
+      }
+
+      values[offset + hand] = value;
+      types[offset + hand]  = static_cast<unsigned char>(type);
+   }
+} // end BatchRanker::rankHands
+
+//******************************************************************************
+// Function : rankLines
+// Process  : For each line of the chunk
+//                Parse its cards
+//                Rank them if there are five or seven unique cards
+//                Append the value and type, 0 and INVALIDHAND if not ranked
+// Notes    : Each chunk has its own output, so the workers never share one
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void BatchRanker::rankLines(
+   const int      firstLine,
+   const int      lastLine,
+   const int      /*worker*/,
+   const char*    text,
+   const size_t   lineStarts[],
+   string         outputs[]) const
+{
+   string& output = outputs[firstLine / LINESPERCHUNK];
+
+   for (int line = firstLine; line < lastLine; ++line)
+   {
+      PackedCard     cards[MAXCARDS];
+      int            numCards = 0;
+      CardSet        cardSet;
+      int            value    = 0;
+      Hand::HandType type     = Hand::INVALIDHAND;
+
+      if (BatchRanker::parseCards(text + lineStarts[line],
+                                  text + lineStarts[line + 1],
+                                  cards,
+                                  numCards) &&
+          (numCards == 5 || numCards == 7))
+      {
+         for (int card = 0; card < numCards; ++card)
+         {
+            cardSet.add(cards[card]);
+         }
+
+         if (cardSet.getCount() == numCards)
+         {
+            this->ranker.rankCards(cardSet, value, type);
+         }
+      }
+
+      BatchRanker::appendResult(value, type, output);
+   }
+} // end BatchRanker::rankLines
+
+//******************************************************************************
+// Function : rankStream
+// Process  : Check the threads and use the set pool, else a pool of
+//             numThreads for the stream
+//             Until the input ends
+//                Read a block after the partial line carried from the last
+//                Find the end of its last whole line, or of the input
+//                Find the start of each line up to it
+//                Rank the lines in chunks of LINESPERCHUNK on the pool
+//                Write the output of each chunk in order
+//                Carry the partial line to the front of the block
+// Notes    : Throw an exception if numThreads is negative, a line is longer
+//             than blockSize, or the input cannot be read or the output
+//             written
+//             The block, line starts, and outputs are reused, so memory
+//             stays the same however long the input is
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void BatchRanker::rankStream(
+   istream&    in,
+   ostream&    out,
+   const int   numThreads)
+{
+   vector<char>   block(this->blockSize);
+   vector<size_t> lineStarts;          // Start of each line, then the end
+   vector<string> outputs;             // Results of each chunk of lines
+   size_t         numCarried  = 0;     // Characters of the partial line
+   int            threadCount = numThreads;
+   bool           atEnd       = false;
+
+   if (numThreads < 0)
+   {
+      throw exception("Invalid threads in BatchRanker::rankStream");
+   }
+
+   if (threadCount == 0)
+   {
+      threadCount = ThreadPool::getNumCores();
+   }
+
+   ThreadPool  callPool(this->threadPool != NULL ? 1 : threadCount);
+   ThreadPool& pool = this->threadPool != NULL ? *this->threadPool :
+                                                 callPool;
+
+   while (!atEnd)
+   {
+      size_t   size      = 0;    // Characters in the block
+      size_t   end       = 0;    // End of the last whole line
+      int      numLines  = 0;
+      int      numChunks = 0;
+
+      in.read(&block[numCarried],
+              static_cast<streamsize>(this->blockSize - numCarried));
+      size  = numCarried + static_cast<size_t>(in.gcount());
+      atEnd = !in;
+
+      if (in.bad())
+      {
+         throw exception("Unable to read input in BatchRanker::rankStream");
+      }
+
+      end = size;
+
+      if (!atEnd)
+      {
+         while (end > 0 && block[end - 1] != '\n')
+         {
+            --end;
+         }
+
+         if (end == 0)
+         {
+            throw exception("Line too long in BatchRanker::rankStream");
+         }
+      }
+
+      lineStarts.clear();
+
+      for (size_t start = 0; start < end;)
+      {
+         const void* newline = memchr(&block[start], '\n', end - start);
+
+         lineStarts.push_back(start);
+         start = newline != NULL ?
+                    static_cast<const char*>(newline) - &block[0] + 1 : end;
+      }
+
+      lineStarts.push_back(end);
+
+      numLines  = static_cast<int>(lineStarts.size()) - 1;
+      numChunks = (numLines + LINESPERCHUNK - 1) / LINESPERCHUNK;
+
+      if (outputs.size() < static_cast<size_t>(numChunks))
+      {
+         outputs.resize(numChunks);
+      }
+
+      for (int chunk = 0; chunk < numChunks; ++chunk)
+      {
+         outputs[chunk].clear();
+      }
+
+      if (numLines > 0)
+      {
+         pool.run(numLines,
+                  LINESPERCHUNK,
+                  bind(&BatchRanker::rankLines,
+                       this,
+                       placeholders::_1,
+                       placeholders::_2,
+                       placeholders::_3,
+                       &block[0],
+                       &lineStarts[0],
+                       &outputs[0]));
+      }
+
+      for (int chunk = 0; chunk < numChunks; ++chunk)
+      {
+         out.write(outputs[chunk].data(),
+                   static_cast<streamsize>(outputs[chunk].size()));
+      }
+
+      numCarried = size - end;
+      memmove(&block[0], &block[0] + end, numCarried);
+   }
+
+   out.flush();
+
+   if (!out)
+   {
+      throw exception("Unable to write output in BatchRanker::rankStream");
+   }
+} // end BatchRanker::rankStream
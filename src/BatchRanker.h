@@ -0,0 +1,245 @@
+//******************************************************************************
+//
+// File Name:     BatchRanker.h
+//
+// File Overview: Represents a Batch Ranker that streams hands of text, one
+//                per line, and writes the rank of each in input order
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Rank binary hand files
+//******************************************************************************
+
+#ifndef BatchRanker_h
+#define BatchRanker_h
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include "CardSet.h"
+#include "EvaluationCache.h"
+#include "HandFile.h"
+#include "HandRanker.h"
+#include "PackedCard.h"
+#include "ThreadPool.h"
+
+//******************************************************************************
+//
+// Class:    BatchRanker
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Rank binary hand files
+//
+// Notes    : Each input line holds five or seven cards separated by
+//             spaces, such as "Ah Kd 7c 7s 2h", a card being a number 2 to
+//             9, T or 10, J, Q, K, or A, and a suit c, s, h, or d.  Each
+//             output line holds the hand value and type of the input line,
+//             such as "2468 ONEPAIR", or "0 INVALIDHAND" if the line does
+//             not hold five or seven unique valid cards, so output line n
+//             is always the result of input line n.
+//             rankStream reads the input a block of blockSize characters at
+//             a time.  The lines of each block are split into chunks of
+//             LINESPERCHUNK lines, ranked and formatted on a ThreadPool, and
+//             written in order before the next block is read.  The last,
+//             partial line of a block is carried to the front of the next,
+//             so memory holds a block, its line offsets, and its results
+//             however long the input is.
+//             rankFile ranks a HandFile into a ResultFile instead, both
+//             mapped, reading the cards from their columns and writing each
+//             result in place, with no parsing or formatting.
+//
+//******************************************************************************
+class BatchRanker
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Reads the input in blocks of blockSize characters
+   // Constraints : Throws an exception if blockSize is less than
+   //                MINBLOCKSIZE
+   //***************************************************************************
+   explicit BatchRanker(const size_t blockSize = DEFAULTBLOCKSIZE);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~BatchRanker();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : parseCards
+   // Description : Parses the cards of the text from first to last, such as
+   //                "Ah Kd 7c 7s 2h", into cards, and sets numCards
+   //                Returns false if a card is invalid or there are more
+   //                than MAXCARDS
+   // Constraints : cards must hold MAXCARDS cards
+   //                Does not check the cards are unique
+   //***************************************************************************
+   static bool parseCards(
+      const char* first,
+      const char* last,
+      PackedCard  cards[],
+      int&        numCards);
+
+   //***************************************************************************
+   // Function    : rankFile
+   // Description : Ranks each hand of the hand file and writes its result to
+   //                a result file of as many hands, over numThreads threads,
+   //                or one per core if numThreads is 0
+   // Constraints : Throws an exception if numThreads is negative or a file
+   //                cannot be opened or created
+   //                Runs on the thread pool if one is set
+   //***************************************************************************
+   void rankFile(
+      const char* handFileName,
+      const char* resultFileName,
+      const int   numThreads = 0);
+
+   //***************************************************************************
+   // Function    : rankStream
+   // Description : Ranks each line of the input and writes its result to
+   //                the output, in input order, over numThreads threads, or
+   //                one per core if numThreads is 0
+   // Constraints : Throws an exception if numThreads is negative or a line
+   //                is longer than blockSize
+   //                Runs on the thread pool if one is set
+   //***************************************************************************
+   void rankStream(
+      istream&    in,
+      ostream&    out,
+      const int   numThreads = 0);
+
+   //***************************************************************************
+   // Function    : setCache
+   // Description : Mutator for the cache of the ranker, NULL for none
+   // Constraints : The cache must outlive its use
+   //***************************************************************************
+   inline void setCache(HandValueCache* cache);
+
+   //***************************************************************************
+   // Function    : setThreadPool
+   // Description : Mutator for threadPool, the pool rankStream and rankFile
+   //                run on, NULL to start a pool of numThreads for each call
+   // Constraints : The pool must outlive its use
+   //***************************************************************************
+   inline void setThreadPool(ThreadPool* threadPool);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the sizes of the input and its chunks
+   enum BatchRankerSize
+   {
+      MAXCARDS          = 7,
+      LINESPERCHUNK     = 4096,
+      MINBLOCKSIZE      = 256,
+      DEFAULTBLOCKSIZE  = 1 << 22,  // 4 MB
+      HANDSPERRUN       = 1 << 24   // Hands of a file ranked per run
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : copy constructor
+   // Description : Not implemented
+   // Constraints : Private
+   //***************************************************************************
+   BatchRanker(const BatchRanker& ranker);
+
+   //***************************************************************************
+   // Function    : operator=
+   // Description : Not implemented
+   // Constraints : Private
+   //***************************************************************************
+   BatchRanker& operator=(const BatchRanker& ranker);
+
+   //***************************************************************************
+   // Function    : appendResult
+   // Description : Appends the value and type of a line to the output
+   // Constraints : Private
+   //***************************************************************************
+   static void appendResult(
+      const int               value,
+      const Hand::HandType    type,
+      string&                 output);
+
+   //***************************************************************************
+   // Function    : rankHands
+   // Description : Ranks the hands offset + firstHand to offset + lastHand - 1
+   //                of the hand file and writes their values and types
+   // Constraints : Private, run on the thread pool
+   //***************************************************************************
+   void rankHands(
+      const int                  firstHand,
+      const int                  lastHand,
+      const int                  worker,
+      const HandFile*            hands,
+      const unsigned long long   offset,
+      int                        values[],
+      unsigned char              types[]) const;
+
+   //***************************************************************************
+   // Function    : rankLines
+   // Description : Ranks the lines firstLine to lastLine - 1 of the text and
+   //                appends their results to the output of their chunk
+   // Constraints : Private, run on the thread pool, firstLine must start a
+   //                chunk of LINESPERCHUNK lines
+   //***************************************************************************
+   void rankLines(
+      const int      firstLine,
+      const int      lastLine,
+      const int      worker,
+      const char*    text,
+      const size_t   lineStarts[],
+      string         outputs[]) const;
+
+   HandRanker  ranker;        // Ranks the cards of each line
+   ThreadPool* threadPool;    // Optional pool rankStream and rankFile run
+                              // on, NULL if none
+   size_t      blockSize;     // Characters read at a time
+
+}; // end class BatchRanker
+
+//******************************************************************************
+// Function : setCache
+// Process  : Set the cache of the ranker
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void BatchRanker::setCache(HandValueCache* cache)
+{
+   this->ranker.setCache(cache);
+} // end BatchRanker::setCache
+
+//******************************************************************************
+// Function : setThreadPool
+// Process  : Mutator for threadPool
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void BatchRanker::setThreadPool(ThreadPool* threadPool)
+{
+   this->threadPool = threadPool;
+} // end BatchRanker::setThreadPool
+
+#endif // BatchRanker_h
@@ -0,0 +1,565 @@
+//******************************************************************************
+//
+// File Name:     CardSet.h
+//
+// File Overview: Represents a set of cards as a 52 bit mask
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef CardSet_h
+#define CardSet_h
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <type_traits>
+#include "Hand.h"
+#include "PackedCard.h"
+
+//******************************************************************************
+//
+// Class:    CardSet
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added class
+//
+// Notes    : Bit suit * NUMRANKS + rank is set for each card in the set, so
+//             each suit holds a 13 bit mask of card numbers from bit 0 for
+//             a two to bit 12 for an ace
+//             Flushes are detected with a popcount of each suit, straights
+//             by shifting and anding the mask of card numbers
+//
+//******************************************************************************
+class CardSet
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the set to empty
+   // Constraints : None
+   //***************************************************************************
+   inline CardSet();
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the set to the input mask
+   // Constraints : Only the low NUMCARDS bits may be set
+   //***************************************************************************
+   inline explicit CardSet(const unsigned long long mask);
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the set to the cards in the input hand
+   // Constraints : The hand's cards must be valid
+   //***************************************************************************
+   inline explicit CardSet(const Hand& hand);
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : add
+   // Description : Adds the card to the set
+   // Constraints : The card must be valid
+   //***************************************************************************
+   inline void add(const PackedCard card);
+
+   //***************************************************************************
+   // Function    : contains
+   // Description : Determines if the card is in the set
+   // Constraints : The card must be valid
+   //***************************************************************************
+   inline bool contains(const PackedCard card) const;
+
+   //***************************************************************************
+   // Function    : contains
+   // Description : Determines if every card of the input set is in the set
+   // Constraints : None
+   //***************************************************************************
+   inline bool contains(const CardSet& cards) const;
+
+   //***************************************************************************
+   // Function    : getCount
+   // Description : Returns the number of cards in the set
+   // Constraints : None
+   //***************************************************************************
+   inline int getCount() const;
+
+   //***************************************************************************
+   // Function    : getMask
+   // Description : Accessor for mask
+   // Constraints : None
+   //***************************************************************************
+   inline unsigned long long getMask() const;
+
+   //***************************************************************************
+   // Function    : getRankMask
+   // Description : Returns the 13 bit mask of card numbers held in any suit
+   // Constraints : None
+   //***************************************************************************
+   inline int getRankMask() const;
+
+   //***************************************************************************
+   // Function    : getSuitMask
+   // Description : Returns the 13 bit mask of card numbers held in the suit
+   // Constraints : suitIndex must be from 0 for a club to 3 for a diamond
+   //***************************************************************************
+   inline int getSuitMask(const int suitIndex) const;
+
+   //***************************************************************************
+   // Function    : intersects
+   // Description : Determines if any card of the input set is in the set
+   // Constraints : None
+   //***************************************************************************
+   inline bool intersects(const CardSet& cards) const;
+
+   //***************************************************************************
+   // Function    : isEmpty
+   // Description : Determines if the set holds no cards
+   // Constraints : None
+   //***************************************************************************
+   inline bool isEmpty() const;
+
+   //***************************************************************************
+   // Function    : isFlush
+   // Description : Determines if five or more cards share a suit
+   // Constraints : None
+   //***************************************************************************
+   inline bool isFlush() const;
+
+   //***************************************************************************
+   // Function    : isLowAceStraight
+   // Description : Determines if the set holds an A, 5, 4, 3, 2
+   // Constraints : None
+   //***************************************************************************
+   inline bool isLowAceStraight() const;
+
+   //***************************************************************************
+   // Function    : isStraight
+   // Description : Determines if the set holds five consecutive card numbers
+   //                including the low ace straight (A, 5, 4, 3, 2)
+   // Constraints : None
+   //***************************************************************************
+   inline bool isStraight() const;
+
+   //***************************************************************************
+   // Function    : remove
+   // Description : Removes the card from the set
+   // Constraints : The card must be valid
+   //***************************************************************************
+   inline void remove(const PackedCard card);
+
+   //***************************************************************************
+   // Function    : operator&
+   // Description : Returns the intersection of the sets
+   // Constraints : None
+   //***************************************************************************
+   inline CardSet operator&(const CardSet& a) const;
+
+   //***************************************************************************
+   // Function    : operator|
+   // Description : Returns the union of the sets
+   // Constraints : None
+   //***************************************************************************
+   inline CardSet operator|(const CardSet& a) const;
+
+   //***************************************************************************
+   // Function    : operator==
+   // Description : Overloads the == operator
+   // Constraints : None
+   //***************************************************************************
+   inline bool operator==(const CardSet& a) const;
+
+   //***************************************************************************
+   // Function    : operator!=
+   // Description : Overloads the != operator
+   // Constraints : None
+   //***************************************************************************
+   inline bool operator!=(const CardSet& a) const;
+
+   //***************************************************************************
+   // Function    : popCount
+   // Description : Returns the number of bits set in the input mask
+   // Constraints : None
+   //***************************************************************************
+   static inline int popCount(const unsigned long long mask);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the card set masks
+   enum CardSetMask
+   {
+      RANKMASK       = (1 << PackedCard::NUMRANKS) - 1,
+      LOWACESTRAIGHT = 0x100F
+   };
+
+private:
+   unsigned long long mask;   // Bit set for each card in the set
+
+}; // end class CardSet
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize the set to empty
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline CardSet::CardSet()
+   : mask(0)
+{
+} // end CardSet::CardSet
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize the set to the input mask
+// Notes    : Only the low NUMCARDS bits may be set
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline CardSet::CardSet(const unsigned long long mask)
+   : mask(mask)
+{
+} // end CardSet::CardSet
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize the set to empty then add each card in the hand
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline CardSet::CardSet(const Hand& hand)
+   : mask(0)
+{
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      this->add(hand.getPackedCard(cardIndex));
+   }
+} // end CardSet::CardSet
+
+//******************************************************************************
+// Function : add
+// Process  : Set the card's bit
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline void CardSet::add(const PackedCard card)
+{
+   this->mask |= 1ULL <<
+      (card.getSuitIndex() * PackedCard::NUMRANKS + card.getRank());
+} // end CardSet::add
+
+//******************************************************************************
+// Function : contains
+// Process  : Determine if the card's bit is set
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::contains(const PackedCard card) const
+{
+   return ((this->mask >>
+      (card.getSuitIndex() * PackedCard::NUMRANKS + card.getRank())) & 1) != 0;
+} // end CardSet::contains
+
+//******************************************************************************
+// Function : contains
+// Process  : Determine if every bit of the input set is set
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::contains(const CardSet& cards) const
+{
+   return (this->mask & cards.mask) == cards.mask;
+} // end CardSet::contains
+
+//******************************************************************************
+// Function : getCount
+// Process  : Return the popcount of the mask
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline int CardSet::getCount() const
+{
+   return CardSet::popCount(this->mask);
+} // end CardSet::getCount
+
+//******************************************************************************
+// Function : getMask
+// Process  : Accessor for mask
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long CardSet::getMask() const
+{
+   return this->mask;
+} // end CardSet::getMask
+
+//******************************************************************************
+// Function : getRankMask
+// Process  : Or the card numbers of each suit
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline int CardSet::getRankMask() const
+{
+   return this->getSuitMask(0) | this->getSuitMask(1) |
+          this->getSuitMask(2) | this->getSuitMask(3);
+} // end CardSet::getRankMask
+
+//******************************************************************************
+// Function : getSuitMask
+// Process  : Shift the suit's 13 bits down and mask them
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline int CardSet::getSuitMask(const int suitIndex) const
+{
+   return static_cast<int>(
+      (this->mask >> (suitIndex * PackedCard::NUMRANKS)) & RANKMASK);
+} // end CardSet::getSuitMask
+
+//******************************************************************************
+// Function : intersects
+// Process  : Determine if the masks share a bit
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::intersects(const CardSet& cards) const
+{
+   return (this->mask & cards.mask) != 0;
+} // end CardSet::intersects
+
+//******************************************************************************
+// Function : isEmpty
+// Process  : Determine if no bit is set
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::isEmpty() const
+{
+   return this->mask == 0;
+} // end CardSet::isEmpty
+
+//******************************************************************************
+// Function : isFlush
+// Process  : For each suit, popcount the suit's card numbers
+//                If five or more, we have a flush
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::isFlush() const
+{
+   bool isFlush = false;
+
+   for (int suitIndex = 0; suitIndex < PackedCard::NUMSUITS; ++suitIndex)
+   {
+      if (CardSet::popCount(this->getSuitMask(suitIndex)) >= Hand::MAXCARDS)
+      {
+         isFlush = true;
+         break;
+      }
+   }
+
+   return isFlush;
+} // end CardSet::isFlush
+
+//******************************************************************************
+// Function : isLowAceStraight
+// Process  : Determine if the A, 5, 4, 3 and 2 bits are all set
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::isLowAceStraight() const
+{
+   return (this->getRankMask() & LOWACESTRAIGHT) == LOWACESTRAIGHT;
+} // end CardSet::isLowAceStraight
+
+//******************************************************************************
+// Function : isStraight
+// Process  : And the mask of card numbers with itself shifted by one to
+//             four, a bit survives only at the low end of five consecutive
+//             card numbers
+//             Check if we have a low ace straight (A, 5, 4, 3, 2)
+// Notes    : Does not depend on the sort order of any hand
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::isStraight() const
+{
+   int rankMask = this->getRankMask();   // Card numbers in any suit
+
+   return (rankMask & (rankMask >> 1) & (rankMask >> 2) &
+           (rankMask >> 3) & (rankMask >> 4)) != 0 ||
+          this->isLowAceStraight();
+} // end CardSet::isStraight
+
+//******************************************************************************
+// Function : remove
+// Process  : Clear the card's bit
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline void CardSet::remove(const PackedCard card)
+{
+   this->mask &= ~(1ULL <<
+      (card.getSuitIndex() * PackedCard::NUMRANKS + card.getRank()));
+} // end CardSet::remove
+
+//******************************************************************************
+// Function : operator&
+// Process  : And the masks
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline CardSet CardSet::operator&(const CardSet& a) const
+{
+   return CardSet(this->mask & a.mask);
+} // end CardSet::operator&
+
+//******************************************************************************
+// Function : operator|
+// Process  : Or the masks
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline CardSet CardSet::operator|(const CardSet& a) const
+{
+   return CardSet(this->mask | a.mask);
+} // end CardSet::operator|
+
+//******************************************************************************
+// Function : operator==
+// Process  : Overload the == operator to work with the CardSet class
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::operator==(const CardSet& a) const
+{
+   return this->mask == a.mask;
+} // end CardSet::operator==
+
+//******************************************************************************
+// Function : operator!=
+// Process  : Overload the != operator to work with the CardSet class
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline bool CardSet::operator!=(const CardSet& a) const
+{
+   return this->mask != a.mask;
+} // end CardSet::operator!=
+
+//******************************************************************************
+// Function : popCount
+// Process  : Count the bits set in the mask with the compiler's popcount
+//             intrinsic
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline int CardSet::popCount(const unsigned long long mask)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+   return static_cast<int>(__popcnt64(mask));
+#elif defined(_MSC_VER)
+   return static_cast<int>(__popcnt(static_cast<unsigned int>(mask)) +
+                           __popcnt(static_cast<unsigned int>(mask >> 32)));
+#else
+   return __builtin_popcountll(mask);
+#endif
+} // end CardSet::popCount
+
+static_assert(is_trivially_copyable<CardSet>::value,
+              "CardSet must be trivially copyable");
+
+#endif // CardSet_h
@@ -0,0 +1,817 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     EquityCalculator.cpp
+//
+// File Overview: Represents an Equity Calculator to estimate the share of
+//                the pot each hold'em player wins
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Added exhaustive enumeration
+// 10.18.26       Donne Martin         Run on a work-stealing thread pool
+//******************************************************************************
+
+#include "stdafx.h"
+#include <climits>
+#include <functional>
+#include "EquityCalculator.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : None
+// Notes    : Need to add players before calculating
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         No thread pool by default
+//******************************************************************************
+EquityCalculator::EquityCalculator()
+   : numPlayers(0),
+     numBoardCards(0),
+     stateTable(NULL),
+     threadPool(NULL)
+{
+} // end EquityCalculator::EquityCalculator
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+EquityCalculator::~EquityCalculator()
+{
+} // end EquityCalculator::~EquityCalculator
+
+//******************************************************************************
+// Function : addDeadCard
+// Process  : Mark the card as held, so it is never dealt
+// Notes    : Throw an exception if the card is invalid or already held
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void EquityCalculator::addDeadCard(const PackedCard card)
+{
+   this->addUsedCard(card);
+} // end EquityCalculator::addDeadCard
+
+//******************************************************************************
+// Function : addPlayer
+// Process  : Mark the hole cards as held and add the player
+// Notes    : Throw an exception if the table is full or a card is invalid or
+//             already held
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void EquityCalculator::addPlayer(const PackedCard holeCards[])
+{
+   if (this->numPlayers >= MAXPLAYERS)
+   {
+      throw exception("Too many players in EquityCalculator::addPlayer");
+   }
+
+   if (holeCards[0] == holeCards[1])
+   {
+      throw exception("Duplicate card in EquityCalculator::addPlayer");
+   }
+
+   for (int card = 0; card < NUMHOLECARDS; ++card)
+   {
+      this->addUsedCard(holeCards[card]);
+      this->holeCards[this->numPlayers][card] = holeCards[card];
+   }
+
+   this->numPlayers++;
+} // end EquityCalculator::addPlayer
+
+//******************************************************************************
+// Function : addUsedCard
+// Process  : Add the card to the used cards
+// Notes    : Throw an exception if the card is invalid or already used
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void EquityCalculator::addUsedCard(const PackedCard card)
+{
+   if (!card.isValid())
+   {
+      throw exception("Invalid card in EquityCalculator");
+   }
+
+   if (this->usedCards.contains(card))
+   {
+      throw exception("Duplicate card in EquityCalculator");
+   }
+
+   this->usedCards.add(card);
+} // end EquityCalculator::addUsedCard
+
+//******************************************************************************
+// Function : calculateExhaustive
+// Process  : Check the players and the cards left to deal
+//             Count the chunks, one per combination of the top CHUNKCARDS
+//                cards dealt, or a single chunk if no card is dealt
+//             Use the thread pool if one is set, else start one of
+//                numThreads, at most one per chunk
+//             Run the chunks on the pool, each worker counting into its own
+//                results
+//             Merge the workers' results for each player
+//             Set each player's trials to the number of boards dealt
+// Notes    : Throw an exception if there are too few players or cards, or
+//             numThreads is negative
+//             The results do not depend on the number of threads
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Run the chunks on a thread pool
+//******************************************************************************
+void EquityCalculator::calculateExhaustive(const int numThreads)
+{
+   PackedCard           deck[NUMCARDS];
+   int                  deckSize    = this->getDeck(deck);
+   int                  numDealt    = NUMBOARDCARDS - this->numBoardCards;
+   int                  chunkCards  = numDealt < CHUNKCARDS ?
+                                         numDealt : CHUNKCARDS;
+   int                  numChunks   = 1;
+   unsigned long long   numBoards   = 1;
+   vector<Result>       workerResults;    // MAXPLAYERS results per worker
+   int                  threadCount = numThreads;
+
+   if (this->numPlayers < MINPLAYERS)
+   {
+      throw exception(
+         "Too few players in EquityCalculator::calculateExhaustive");
+   }
+
+   if (numThreads < 0)
+   {
+      throw exception(
+         "Invalid threads in EquityCalculator::calculateExhaustive");
+   }
+
+   if (deckSize < numDealt)
+   {
+      throw exception(
+         "Too few cards in EquityCalculator::calculateExhaustive");
+   }
+
+   for (int card = 0; card < numDealt; ++card)
+   {
+      numBoards = numBoards * (deckSize - card) / (card + 1);
+
+      if (card < chunkCards)
+      {
+         numChunks = numChunks * (deckSize - card) / (card + 1);
+      }
+   }
+
+   if (threadCount == 0)
+   {
+      threadCount = ThreadPool::getNumCores();
+   }
+
+   threadCount = threadCount < numChunks ? threadCount : numChunks;
+
+   // A pool of one starts no thread, so it costs nothing beside a set pool
+   ThreadPool  callPool(this->threadPool != NULL ? 1 : threadCount);
+   ThreadPool& pool = this->threadPool != NULL ? *this->threadPool :
+                                                 callPool;
+
+   workerResults.resize(pool.getNumThreads() * MAXPLAYERS);
+
+   pool.run(numChunks,
+            1,
+            bind(&EquityCalculator::runChunks,
+                 this,
+                 placeholders::_1,
+                 placeholders::_2,
+                 placeholders::_3,
+                 numChunks,
+                 &workerResults[0]));
+
+   this->results.assign(this->numPlayers, Result());
+
+   for (int player = 0; player < this->numPlayers; ++player)
+   {
+      for (int worker = 0; worker < pool.getNumThreads(); ++worker)
+      {
+         this->results[player].merge(
+            workerResults[worker * MAXPLAYERS + player]);
+      }
+
+      this->results[player].addTrials(numBoards);
+   }
+} // end EquityCalculator::calculateExhaustive
+
+//******************************************************************************
+// Function : calculateMonteCarlo
+// Process  : Check the players and the cards left to deal
+//             Split the trials into chunks of TRIALSPERCHUNK
+//             Jump the seeded generator once per chunk and keep a copy for
+//                each chunk
+//             Use the thread pool if one is set, else start one of
+//                numThreads, at most one per chunk
+//             Run the chunks on the pool, each worker counting into its own
+//                results
+//             Merge the workers' results for each player
+// Notes    : Throw an exception if there are too few players or cards,
+//             numThreads is negative, or there are too many chunks
+//             Each chunk has its own stream, so the results do not depend
+//             on the number of threads or on which worker runs a chunk
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Run chunks of trials on a thread pool
+//******************************************************************************
+void EquityCalculator::calculateMonteCarlo(
+   const unsigned long long   numTrials,
+   const int                  numThreads,
+   const unsigned long long   seed)
+{
+   RandomGenerator            random(seed);
+   unsigned long long         numChunks   =
+      (numTrials + TRIALSPERCHUNK - 1) / TRIALSPERCHUNK;
+   vector<RandomGenerator>    generators;       // Stream of each chunk
+   vector<Result>             workerResults;    // MAXPLAYERS results per
+                                                // worker
+   int                        threadCount = numThreads;
+
+   if (this->numPlayers < MINPLAYERS)
+   {
+      throw exception(
+         "Too few players in EquityCalculator::calculateMonteCarlo");
+   }
+
+   if (numThreads < 0)
+   {
+      throw exception(
+         "Invalid threads in EquityCalculator::calculateMonteCarlo");
+   }
+
+   if (NUMCARDS - this->usedCards.getCount() <
+       NUMBOARDCARDS - this->numBoardCards)
+   {
+      throw exception(
+         "Too few cards in EquityCalculator::calculateMonteCarlo");
+   }
+
+   if (numChunks > static_cast<unsigned long long>(INT_MAX))
+   {
+      throw exception(
+         "Too many trials in EquityCalculator::calculateMonteCarlo");
+   }
+
+   generators.reserve(static_cast<size_t>(numChunks));
+
+   for (unsigned long long chunk = 0; chunk < numChunks; ++chunk)
+   {
+      random.jump();
+      generators.push_back(random);
+   }
+
+   if (threadCount == 0)
+   {
+      threadCount = ThreadPool::getNumCores();
+   }
+
+   if (static_cast<unsigned long long>(threadCount) > numChunks)
+   {
+      threadCount = numChunks > 0 ? static_cast<int>(numChunks) : 1;
+   }
+
+   ThreadPool  callPool(this->threadPool != NULL ? 1 : threadCount);
+   ThreadPool& pool = this->threadPool != NULL ? *this->threadPool :
+                                                 callPool;
+
+   workerResults.resize(pool.getNumThreads() * MAXPLAYERS);
+
+   pool.run(static_cast<int>(numChunks),
+            1,
+            bind(&EquityCalculator::runTrials,
+                 this,
+                 placeholders::_1,
+                 placeholders::_2,
+                 placeholders::_3,
+                 numTrials,
+                 generators.data(),
+                 &workerResults[0]));
+
+   this->results.assign(this->numPlayers, Result());
+
+   for (int player = 0; player < this->numPlayers; ++player)
+   {
+      for (int worker = 0; worker < pool.getNumThreads(); ++worker)
+      {
+         this->results[player].merge(
+            workerResults[worker * MAXPLAYERS + player]);
+      }
+   }
+} // end EquityCalculator::calculateMonteCarlo
+
+//******************************************************************************
+// Function : clear
+// Process  : Remove the players, board, dead cards, and results
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void EquityCalculator::clear()
+{
+   this->numPlayers    = 0;
+   this->numBoardCards = 0;
+   this->usedCards     = CardSet();
+   this->results.clear();
+} // end EquityCalculator::clear
+
+//******************************************************************************
+// Function : enumerateBoards
+// Process  : If no card is left to deal, evaluate each hand and count the
+//             showdown
+//             Else for each card that leaves enough cards below it
+//                Add the card to a copy of each hand
+//                If it was the last card, evaluate each copy and count the
+//                   showdown, else enumerate the cards below it
+// Notes    : Deals in decreasing deck order, so the boards of a call are
+//             consecutive colex indexes
+//             The last card is evaluated in the loop rather than by another
+//             call, as most of the calls would be for it
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void EquityCalculator::enumerateBoards(
+   const PackedCard                    deck[],
+   const int                           numCards,
+   const int                           numLeft,
+   const HandEvaluator::Accumulator    hands[],
+   Result                              counts[]) const
+{
+   HandEvaluator::Accumulator dealtHands[MAXPLAYERS];   // Hands with the card
+   int                        values[MAXPLAYERS];       // Value of each player
+
+   if (numLeft == 0)
+   {
+      for (int player = 0; player < this->numPlayers; ++player)
+      {
+         values[player] = this->evaluator.evaluate(hands[player]);
+      }
+
+      this->countShowdown(values, counts);
+
+      return;
+   }
+
+   for (int card = numLeft - 1; card < numCards; ++card)
+   {
+      for (int player = 0; player < this->numPlayers; ++player)
+      {
+         dealtHands[player] = hands[player];
+         dealtHands[player].add(deck[card]);
+      }
+
+      if (numLeft == 1)
+      {
+         for (int player = 0; player < this->numPlayers; ++player)
+         {
+            values[player] = this->evaluator.evaluate(dealtHands[player]);
+         }
+
+         this->countShowdown(values, counts);
+      }
+      else
+      {
+         this->enumerateBoards(deck, card, numLeft - 1, dealtHands, counts);
+      }
+   }
+} // end EquityCalculator::enumerateBoards
+
+//******************************************************************************
+// Function : enumerateStates
+// Process  : For each card that leaves enough cards below it
+//                If it is the last card, evaluate it with each state and
+//                   count the showdown
+//                Else step a copy of each state by the card and enumerate
+//                   the cards below it
+// Notes    : Same order as enumerateBoards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void EquityCalculator::enumerateStates(
+   const PackedCard           deck[],
+   const int                  numCards,
+   const int                  numLeft,
+   const StateTable::State    states[],
+   Result                     counts[]) const
+{
+   StateTable::State dealtStates[MAXPLAYERS];   // States with the card
+   int               values[MAXPLAYERS];        // Value of each player
+
+   for (int card = numLeft - 1; card < numCards; ++card)
+   {
+      if (numLeft == 1)
+      {
+         for (int player = 0; player < this->numPlayers; ++player)
+         {
+            values[player] =
+               this->stateTable->evaluate(states[player], deck[card]);
+         }
+
+         this->countShowdown(values, counts);
+      }
+      else
+      {
+         for (int player = 0; player < this->numPlayers; ++player)
+         {
+            dealtStates[player] = states[player];
+            this->stateTable->addCard(dealtStates[player], deck[card]);
+         }
+
+         this->enumerateStates(deck, card, numLeft - 1, dealtStates, counts);
+      }
+   }
+} // end EquityCalculator::enumerateStates
+
+//******************************************************************************
+// Function : getDeck
+// Process  : Add each card not used to the deck, in index order
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int EquityCalculator::getDeck(PackedCard deck[]) const
+{
+   int deckSize = 0;
+
+   for (int cardIndex = 0; cardIndex < NUMCARDS; ++cardIndex)
+   {
+      PackedCard card = PackedCard::fromIndex(cardIndex);
+
+      if (!this->usedCards.contains(card))
+      {
+         deck[deckSize++] = card;
+      }
+   }
+
+   return deckSize;
+} // end EquityCalculator::getDeck
+
+//******************************************************************************
+// Function : getShowdownCount
+// Process  : With two players, the first wins the showdowns it won, the
+//             second those it won, and both tie the rest
+// Notes    : Throw an exception unless there are two players or the result
+//             is invalid
+//             Counts nothing until a calculation is run
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+unsigned long long EquityCalculator::getShowdownCount(
+   const HandRanker::CompareResult result) const
+{
+   unsigned long long count = 0;
+
+   if (this->numPlayers != MINPLAYERS)
+   {
+      throw exception(
+         "Not heads-up in EquityCalculator::getShowdownCount");
+   }
+
+   if (!this->results.empty())
+   {
+      switch (result)
+      {
+         case HandRanker::TIE:
+            count = this->results[0].getTies();
+            break;
+         case HandRanker::FIRSTWINNER:
+            count = this->results[0].getWins();
+            break;
+         case HandRanker::SECONDWINNER:
+            count = this->results[1].getWins();
+            break;
+         default:
+            throw exception(
+               "Invalid result in EquityCalculator::getShowdownCount");
+      }
+   }
+
+   return count;
+} // end EquityCalculator::getShowdownCount
+
+//******************************************************************************
+// Function : runChunks
+// Process  : Collect the cards left to deal and add the known board and
+//             hole cards to each player's hand, and state with a StateTable
+//             For each chunk taken, counting down from the last chunk, so
+//                the largest chunks go first
+//                Unrank the chunk into its top cards, the colex index of
+//                   the combination
+//                With a StateTable and a card left below them, step copies
+//                   of the states by the top cards and enumerate the rest
+//                   of the board below the lowest top card
+//                Else add the top cards to copies of the hands and
+//                   enumerate the rest of the board the same way
+//             Add the counts to the worker's results
+// Notes    : A chunk of pairs high > low has index C(high, 2) + low
+//             States hold at most six cards, so a board with no card left
+//             to deal after the top cards is counted with the hands
+//             Counts into local results, as runTrials does
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Run the chunks the thread pool takes
+//******************************************************************************
+void EquityCalculator::runChunks(
+   const int   firstTaken,
+   const int   lastTaken,
+   const int   worker,
+   const int   numChunks,
+   Result      workerResults[]) const
+{
+   PackedCard                 deck[NUMCARDS];      // Cards left to deal
+   int                        deckSize   = this->getDeck(deck);
+   int                        numDealt   = NUMBOARDCARDS - this->numBoardCards;
+   int                        chunkCards = numDealt < CHUNKCARDS ?
+                                              numDealt : CHUNKCARDS;
+   bool                       useStates  = this->stateTable != NULL &&
+                                           numDealt > chunkCards;
+   HandEvaluator::Accumulator hands[MAXPLAYERS];   // Known cards of each
+   StateTable::State          states[MAXPLAYERS];  // Known cards of each
+   Result                     counts[MAXPLAYERS];  // Local results
+
+   for (int player = 0; player < this->numPlayers; ++player)
+   {
+      for (int card = 0; card < this->numBoardCards; ++card)
+      {
+         hands[player].add(this->board[card]);
+      }
+
+      hands[player].add(this->holeCards[player][0]);
+      hands[player].add(this->holeCards[player][1]);
+
+      if (useStates)
+      {
+         for (int card = 0; card < this->numBoardCards; ++card)
+         {
+            this->stateTable->addCard(states[player], this->board[card]);
+         }
+
+         this->stateTable->addCard(states[player],
+                                   this->holeCards[player][0]);
+         this->stateTable->addCard(states[player],
+                                   this->holeCards[player][1]);
+      }
+   }
+
+   for (int taken = firstTaken; taken < lastTaken; ++taken)
+   {
+      HandEvaluator::Accumulator chunkHands[MAXPLAYERS];
+      StateTable::State          chunkStates[MAXPLAYERS];
+      PackedCard                 topCards[CHUNKCARDS];
+      int                        chunk   = numChunks - 1 - taken;
+      int                        lowCard = deckSize;   // Lowest top card
+
+      if (chunkCards == 2)
+      {
+         int highCard = 1;
+
+         while ((highCard + 1) * highCard / 2 <= chunk)
+         {
+            highCard++;
+         }
+
+         lowCard     = chunk - highCard * (highCard - 1) / 2;
+         topCards[0] = deck[highCard];
+         topCards[1] = deck[lowCard];
+      }
+      else if (chunkCards == 1)
+      {
+         lowCard     = chunk;
+         topCards[0] = deck[lowCard];
+      }
+
+      for (int player = 0; player < this->numPlayers; ++player)
+      {
+         chunkHands[player]  = hands[player];
+         chunkStates[player] = states[player];
+
+         for (int card = 0; card < chunkCards; ++card)
+         {
+            if (useStates)
+            {
+               this->stateTable->addCard(chunkStates[player],
+                                         topCards[card]);
+            }
+            else
+            {
+               chunkHands[player].add(topCards[card]);
+            }
+         }
+      }
+
+      if (useStates)
+      {
+         this->enumerateStates(deck,
+                               lowCard,
+                               numDealt - chunkCards,
+                               chunkStates,
+                               counts);
+      }
+      else
+      {
+         this->enumerateBoards(deck,
+                               lowCard,
+                               numDealt - chunkCards,
+                               chunkHands,
+                               counts);
+      }
+   }
+
+   for (int player = 0; player < this->numPlayers; ++player)
+   {
+      workerResults[worker * MAXPLAYERS + player].merge(counts[player]);
+   }
+} // end EquityCalculator::runChunks
+
+//******************************************************************************
+// Function : runTrials
+// Process  : Count the known board
+//             For each chunk
+//                Collect the cards left to deal and copy the chunk's
+//                   generator
+//                For each trial of the chunk
+//                   Deal the missing board cards by swapping a random card
+//                      left into each position, a partial Fisher-Yates
+//                      shuffle
+//                   Evaluate each player's hole cards with the board and
+//                      count the showdown
+//             Add the counts to the worker's results
+// Notes    : Counts into local results, so workers writing their results
+//             side by side never share a cache line while running
+//             The deck stays a permutation of the cards left after each
+//             trial, so it is shuffled in place without resetting, and is
+//             collected again for each chunk so a chunk deals the same
+//             boards whichever worker runs it
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Shared the deck and showdown counting
+// 10.18.26       Donne Martin         Run the chunks the thread pool takes
+//******************************************************************************
+void EquityCalculator::runTrials(
+   const int                  firstChunk,
+   const int                  lastChunk,
+   const int                  worker,
+   const unsigned long long   numTrials,
+   const RandomGenerator      generators[],
+   Result                     workerResults[]) const
+{
+   PackedCard                 deck[NUMCARDS];      // Cards left to deal
+   int                        numDealt = NUMBOARDCARDS - this->numBoardCards;
+   HandEvaluator::Accumulator knownBoard;           // Board cards known
+   Result                     counts[MAXPLAYERS];   // Local results
+   int                        values[MAXPLAYERS];   // Value of each player
+
+   for (int card = 0; card < this->numBoardCards; ++card)
+   {
+      knownBoard.add(this->board[card]);
+   }
+
+   for (int chunk = firstChunk; chunk < lastChunk; ++chunk)
+   {
+      int                  deckSize    = this->getDeck(deck);
+      RandomGenerator      random      = generators[chunk];
+      unsigned long long   firstTrial  =
+         static_cast<unsigned long long>(chunk) * TRIALSPERCHUNK;
+      unsigned long long   chunkTrials = numTrials - firstTrial;
+
+      if (chunkTrials > TRIALSPERCHUNK)
+      {
+         chunkTrials = TRIALSPERCHUNK;
+      }
+
+      for (unsigned long long trial = 0; trial < chunkTrials; ++trial)
+      {
+         HandEvaluator::Accumulator fullBoard = knownBoard;
+
+         for (int card = 0; card < numDealt; ++card)
+         {
+            int        pick = card + random.nextBelow(deckSize - card);
+            PackedCard held = deck[card];
+
+            deck[card] = deck[pick];
+            deck[pick] = held;
+
+            fullBoard.add(deck[card]);
+         }
+
+         for (int player = 0; player < this->numPlayers; ++player)
+         {
+            HandEvaluator::Accumulator hand = fullBoard;
+
+            hand.add(this->holeCards[player][0]);
+            hand.add(this->holeCards[player][1]);
+
+            values[player] = this->evaluator.evaluate(hand);
+         }
+
+         this->countShowdown(values, counts);
+      }
+
+      for (int player = 0; player < this->numPlayers; ++player)
+      {
+         counts[player].addTrials(chunkTrials);
+      }
+   }
+
+   for (int player = 0; player < this->numPlayers; ++player)
+   {
+      workerResults[worker * MAXPLAYERS + player].merge(counts[player]);
+   }
+} // end EquityCalculator::runTrials
+
+//******************************************************************************
+// Function : setBoard
+// Process  : Release the cards of the old board
+//             Mark each new board card as held and keep it
+// Notes    : Throw an exception if there are too many cards or a card is
+//             invalid or already held
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void EquityCalculator::setBoard(
+   const PackedCard  board[],
+   const int         numCards)
+{
+   if (numCards < 0 || numCards > NUMBOARDCARDS)
+   {
+      throw exception("Invalid board size in EquityCalculator::setBoard");
+   }
+
+   for (int card = 0; card < this->numBoardCards; ++card)
+   {
+      this->usedCards.remove(this->board[card]);
+   }
+
+   this->numBoardCards = 0;
+
+   for (int card = 0; card < numCards; ++card)
+   {
+      this->addUsedCard(board[card]);
+      this->board[card] = board[card];
+      this->numBoardCards++;
+   }
+} // end EquityCalculator::setBoard
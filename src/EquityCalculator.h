@@ -0,0 +1,725 @@
+//******************************************************************************
+//
+// File Name:     EquityCalculator.h
+//
+// File Overview: Represents an Equity Calculator to estimate the share of
+//                the pot each hold'em player wins
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Added exhaustive enumeration
+// 10.18.26       Donne Martin         Run on a work-stealing thread pool
+// 10.18.26       Donne Martin         Added EquityCache
+//******************************************************************************
+
+#ifndef EquityCalculator_h
+#define EquityCalculator_h
+
+#include <vector>
+#include "CardSet.h"
+#include "EvaluationCache.h"
+#include "HandEvaluator.h"
+#include "HandRanker.h"
+#include "PackedCard.h"
+#include "RandomGenerator.h"
+#include "StateTable.h"
+#include "ThreadPool.h"
+
+//******************************************************************************
+//
+// Class:    EquityCalculator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Added exhaustive enumeration
+// 10.18.26       Donne Martin         Run on a work-stealing thread pool
+//
+// Notes    : Holds the hole cards of two to ten players, a board of zero to
+//             five cards, and dead cards, then deals the rest of the board
+//             from the cards left and counts who wins each showdown
+//             Both calculations run on a ThreadPool, the one set by
+//             setThreadPool, else a pool of numThreads for the call.  Each
+//             worker counts into its own Results, merged once the run is
+//             done, so the workers share nothing while they run.
+//             calculateMonteCarlo splits the trials into chunks of
+//             TRIALSPERCHUNK.  Each chunk draws from its own RandomGenerator
+//             stream, jumped once per chunk from the seed, so the same seed
+//             gives the same results on any number of threads.
+//             A trial deals the missing board cards with a partial
+//             Fisher-Yates shuffle of the cards left, counts the board
+//             once in an Accumulator, and evaluates each player's copy
+//             with the two hole cards added.
+//             calculateExhaustive deals every board instead, split into
+//             chunks of consecutive colex indexes: each chunk fixes the top
+//             CHUNKCARDS cards dealt and enumerates the rest below them.
+//             The pool deals the chunks to its workers, largest first, and
+//             idle workers steal the rest.  Each card dealt is added to every player's hand
+//             once, by the nested loops, rather than once per board.  With
+//             a StateTable set, the hands are States, so a card dealt is one
+//             step and the last card one lookup.
+//
+//******************************************************************************
+class EquityCalculator
+{
+public:
+
+   class Result;
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, no players, board, or dead cards
+   // Constraints : Need to add players before calculating
+   //***************************************************************************
+   EquityCalculator();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~EquityCalculator();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : addDeadCard
+   // Description : Removes the card from the cards dealt to the board
+   // Constraints : Throws an exception if the card is invalid or already
+   //                held, by a player, the board, or the dead cards
+   //***************************************************************************
+   void addDeadCard(const PackedCard card);
+
+   //***************************************************************************
+   // Function    : addPlayer
+   // Description : Adds a player holding the two hole cards
+   // Constraints : Throws an exception if there are already MAXPLAYERS
+   //                players or a card is invalid or already held
+   //***************************************************************************
+   void addPlayer(const PackedCard holeCards[]);
+
+   //***************************************************************************
+   // Function    : calculateExhaustive
+   // Description : Deals every board from the cards left over numThreads
+   //                threads, or one per core if numThreads is 0, and sets
+   //                each player's exact result
+   //                Runs on the thread pool instead if one is set
+   // Constraints : Throws an exception if there are fewer than MINPLAYERS
+   //                players or numThreads is negative
+   //***************************************************************************
+   void calculateExhaustive(const int numThreads = 0);
+
+   //***************************************************************************
+   // Function    : calculateMonteCarlo
+   // Description : Deals numTrials random boards over numThreads threads,
+   //                or one per core if numThreads is 0, and sets each
+   //                player's result
+   //                Runs on the thread pool instead if one is set
+   // Constraints : Throws an exception if there are fewer than MINPLAYERS
+   //                players, numThreads is negative, or the trials need
+   //                more chunks than an int holds
+   //***************************************************************************
+   void calculateMonteCarlo(
+      const unsigned long long   numTrials,
+      const int                  numThreads = 0,
+      const unsigned long long   seed       = DEFAULTSEED);
+
+   //***************************************************************************
+   // Function    : clear
+   // Description : Removes the players, board, dead cards, and results
+   // Constraints : None
+   //***************************************************************************
+   void clear();
+
+   //***************************************************************************
+   // Function    : getNumPlayers
+   // Description : Accessor for numPlayers
+   // Constraints : None
+   //***************************************************************************
+   inline int getNumPlayers() const;
+
+   //***************************************************************************
+   // Function    : getShowdownCount
+   // Description : Returns the showdowns of the last calculation with the
+   //                result, as HandRanker::compareHandValues of the first
+   //                and second player's values would return
+   // Constraints : Throws an exception unless there are two players
+   //***************************************************************************
+   unsigned long long getShowdownCount(
+      const HandRanker::CompareResult result) const;
+
+   //***************************************************************************
+   // Function    : getResult
+   // Description : Returns the result of the player from the last
+   //                calculation
+   // Constraints : player must be 0 to getNumPlayers() - 1, results are
+   //                empty until a calculation
+   //***************************************************************************
+   inline const Result& getResult(const int player) const;
+
+   //***************************************************************************
+   // Function    : setBoard
+   // Description : Sets the known board cards, replacing any board
+   // Constraints : Throws an exception if there are more than NUMBOARDCARDS
+   //                cards or a card is invalid or already held
+   //***************************************************************************
+   void setBoard(
+      const PackedCard  board[],
+      const int         numCards);
+
+   //***************************************************************************
+   // Function    : setStateTable
+   // Description : Mutator for stateTable, the table calculateExhaustive
+   //                steps through, NULL to count each hand instead
+   // Constraints : The table must be loaded and outlive its use
+   //***************************************************************************
+   inline void setStateTable(const StateTable* stateTable);
+
+   //***************************************************************************
+   // Function    : setThreadPool
+   // Description : Mutator for threadPool, the pool the calculations run on,
+   //                NULL to start a pool of numThreads for each calculation
+   // Constraints : The pool must outlive its use
+   //***************************************************************************
+   inline void setThreadPool(ThreadPool* threadPool);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the limits of the calculator
+   enum EquityCalculatorSize
+   {
+      MINPLAYERS     = 2,
+      MAXPLAYERS     = 10,
+      NUMHOLECARDS   = HandEvaluator::NUMHOLECARDS,
+      NUMBOARDCARDS  = HandEvaluator::NUMBOARDCARDS,
+      NUMCARDS       = PackedCard::NUMCARDS,
+      SHAREUNITS     = 2520,  // Least common multiple of 1 to MAXPLAYERS, a
+                              // pot split any way is a whole number of units
+      CHUNKCARDS     = 2,     // Top cards dealt fixed by each chunk
+      TRIALSPERCHUNK = 16384, // Trials of each Monte Carlo chunk
+      DEFAULTSEED    = 1
+   };
+
+   //***************************************************************************
+   //
+   // Class:    Result
+   //
+   // Notes    : The showdowns a player won alone, tied, and the pot shares
+   //             won in units of 1 / SHAREUNITS of a pot, counted exactly
+   //             so results of different threads merge without rounding
+   //
+   //***************************************************************************
+   class Result
+   {
+   public:
+
+      //************************************************************************
+      // Function    : constructor
+      // Description : Default constructor, no trials
+      // Constraints : None
+      //************************************************************************
+      inline Result();
+
+      // Member functions in alphabetical order
+
+      //************************************************************************
+      // Function    : addTie
+      // Description : Counts a showdown split among numWinners players
+      // Constraints : numWinners must be 2 to MAXPLAYERS
+      //************************************************************************
+      inline void addTie(const int numWinners);
+
+      //************************************************************************
+      // Function    : addTrials
+      // Description : Adds to the number of showdowns played
+      // Constraints : None
+      //************************************************************************
+      inline void addTrials(const unsigned long long numTrials);
+
+      //************************************************************************
+      // Function    : addWin
+      // Description : Counts a showdown won alone
+      // Constraints : None
+      //************************************************************************
+      inline void addWin();
+
+      //************************************************************************
+      // Function    : getEquity
+      // Description : Returns the share of the pot won on average, from 0 to 1
+      // Constraints : Returns 0 if there were no trials
+      //************************************************************************
+      inline double getEquity() const;
+
+      //************************************************************************
+      // Function    : getLosses
+      // Description : Returns the showdowns neither won nor tied
+      // Constraints : None
+      //************************************************************************
+      inline unsigned long long getLosses() const;
+
+      //************************************************************************
+      // Function    : getShares
+      // Description : Accessor for shares, in units of 1 / SHAREUNITS pot
+      // Constraints : None
+      //************************************************************************
+      inline unsigned long long getShares() const;
+
+      //************************************************************************
+      // Function    : getTies
+      // Description : Accessor for ties
+      // Constraints : None
+      //************************************************************************
+      inline unsigned long long getTies() const;
+
+      //************************************************************************
+      // Function    : getTrials
+      // Description : Accessor for trials
+      // Constraints : None
+      //************************************************************************
+      inline unsigned long long getTrials() const;
+
+      //************************************************************************
+      // Function    : getWins
+      // Description : Accessor for wins
+      // Constraints : None
+      //************************************************************************
+      inline unsigned long long getWins() const;
+
+      //************************************************************************
+      // Function    : merge
+      // Description : Adds the counts of the input result
+      // Constraints : None
+      //************************************************************************
+      inline void merge(const Result& result);
+
+   private:
+
+      unsigned long long wins;     // Showdowns won alone
+      unsigned long long ties;     // Showdowns split
+      unsigned long long shares;   // Pot won, in 1 / SHAREUNITS units
+      unsigned long long trials;   // Showdowns played
+
+   }; // end class Result
+
+private:
+
+   //***************************************************************************
+   // Function    : addUsedCard
+   // Description : Marks the card as held
+   // Constraints : Private, throws an exception if the card is invalid or
+   //                already held
+   //***************************************************************************
+   void addUsedCard(const PackedCard card);
+
+   //***************************************************************************
+   // Function    : countShowdown
+   // Description : Counts a win for the single best value, else a tie for
+   //                each player holding it
+   // Constraints : Private, values and counts hold one per player
+   //***************************************************************************
+   inline void countShowdown(
+      const int   values[],
+      Result      counts[]) const;
+
+   //***************************************************************************
+   // Function    : enumerateBoards
+   // Description : Adds each combination of numLeft more cards from the
+   //                first numCards cards of the deck to the hands and counts
+   //                each showdown
+   // Constraints : Private, hands holds one accumulator per player
+   //***************************************************************************
+   void enumerateBoards(
+      const PackedCard                    deck[],
+      const int                           numCards,
+      const int                           numLeft,
+      const HandEvaluator::Accumulator    hands[],
+      Result                              counts[]) const;
+
+   //***************************************************************************
+   // Function    : enumerateStates
+   // Description : Steps the states through each combination of numLeft
+   //                more cards from the first numCards cards of the deck and
+   //                counts each showdown
+   // Constraints : Private, states holds one state per player, numLeft must
+   //                be positive and leave the states at most six cards
+   //***************************************************************************
+   void enumerateStates(
+      const PackedCard           deck[],
+      const int                  numCards,
+      const int                  numLeft,
+      const StateTable::State    states[],
+      Result                     counts[]) const;
+
+   //***************************************************************************
+   // Function    : getDeck
+   // Description : Writes the cards not held and returns how many
+   // Constraints : Private, deck must hold NUMCARDS cards
+   //***************************************************************************
+   int getDeck(PackedCard deck[]) const;
+
+   //***************************************************************************
+   // Function    : runChunks
+   // Description : Enumerates the boards of the chunks firstTaken to
+   //                lastTaken - 1 of numChunks, largest first, and adds
+   //                each showdown to the worker's results, MAXPLAYERS per
+   //                worker
+   // Constraints : Private, the task calculateExhaustive runs on the pool
+   //***************************************************************************
+   void runChunks(
+      const int   firstTaken,
+      const int   lastTaken,
+      const int   worker,
+      const int   numChunks,
+      Result      workerResults[]) const;
+
+   //***************************************************************************
+   // Function    : runTrials
+   // Description : Deals the random boards of the chunks firstChunk to
+   //                lastChunk - 1 of numTrials trials, each from its own
+   //                generator, and adds each showdown to the worker's
+   //                results, MAXPLAYERS per worker
+   // Constraints : Private, the task calculateMonteCarlo runs on the pool
+   //***************************************************************************
+   void runTrials(
+      const int                  firstChunk,
+      const int                  lastChunk,
+      const int                  worker,
+      const unsigned long long   numTrials,
+      const RandomGenerator      generators[],
+      Result                     workerResults[]) const;
+
+   HandEvaluator     evaluator;                    // Evaluates showdowns
+   PackedCard        holeCards[MAXPLAYERS][NUMHOLECARDS];
+   int               numPlayers;
+   PackedCard        board[NUMBOARDCARDS];         // Known board cards
+   int               numBoardCards;
+   CardSet           usedCards;                    // Held, board, and dead
+   vector<Result>    results;                      // Result of each player
+   const StateTable* stateTable;                   // NULL if none
+   ThreadPool*       threadPool;                   // NULL if none
+
+}; // end class EquityCalculator
+
+// Cache of the equity result of a card mask
+typedef EvaluationCache<EquityCalculator::Result> EquityCache;
+
+// Instantiated once, in EvaluationCache.cpp
+extern template class EvaluationCache<EquityCalculator::Result>;
+
+//******************************************************************************
+// Function : countShowdown
+// Process  : Heads-up, count a win for the higher value, else a tie for
+//                both
+//             Else find the best value and how many players hold it
+//                Count a win for a single best player, else a tie for each
+// Notes    : Heads-up is the common case, one comparison
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void EquityCalculator::countShowdown(
+   const int   values[],
+   Result      counts[]) const
+{
+   int bestValue  = 0;
+   int numWinners = 0;
+
+   if (this->numPlayers == MINPLAYERS)
+   {
+      if (values[0] > values[1])
+      {
+         counts[0].addWin();
+      }
+      else if (values[0] < values[1])
+      {
+         counts[1].addWin();
+      }
+      else
+      {
+         counts[0].addTie(MINPLAYERS);
+         counts[1].addTie(MINPLAYERS);
+      }
+
+      return;
+   }
+
+   for (int player = 0; player < this->numPlayers; ++player)
+   {
+      if (values[player] > bestValue)
+      {
+         bestValue  = values[player];
+         numWinners = 1;
+      }
+      else if (values[player] == bestValue)
+      {
+         numWinners++;
+      }
+   }
+
+   for (int player = 0; player < this->numPlayers; ++player)
+   {
+      if (values[player] == bestValue)
+      {
+         if (numWinners == 1)
+         {
+            counts[player].addWin();
+         }
+         else
+         {
+            counts[player].addTie(numWinners);
+         }
+      }
+   }
+} // end EquityCalculator::countShowdown
+
+//******************************************************************************
+// Function : getNumPlayers
+// Process  : Accessor for numPlayers
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int EquityCalculator::getNumPlayers() const
+{
+   return this->numPlayers;
+} // end EquityCalculator::getNumPlayers
+
+//******************************************************************************
+// Function : getResult
+// Process  : Accessor for the result of the player
+// Notes    : player must be 0 to getNumPlayers() - 1
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline const EquityCalculator::Result& EquityCalculator::getResult(
+   const int player) const
+{
+   return this->results[player];
+} // end EquityCalculator::getResult
+
+//******************************************************************************
+// Function : setStateTable
+// Process  : Mutator for stateTable
+// Notes    : NULL counts each hand in an Accumulator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void EquityCalculator::setStateTable(const StateTable* stateTable)
+{
+   this->stateTable = stateTable;
+} // end EquityCalculator::setStateTable
+
+//******************************************************************************
+// Function : setThreadPool
+// Process  : Mutator for threadPool
+// Notes    : NULL starts a pool for each calculation
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void EquityCalculator::setThreadPool(ThreadPool* threadPool)
+{
+   this->threadPool = threadPool;
+} // end EquityCalculator::setThreadPool
+
+//******************************************************************************
+// Function : constructor
+// Process  : Start every count at zero
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline EquityCalculator::Result::Result()
+   : wins(0),
+     ties(0),
+     shares(0),
+     trials(0)
+{
+} // end EquityCalculator::Result::Result
+
+//******************************************************************************
+// Function : addTie
+// Process  : Count the tie and the player's share of the split pot
+// Notes    : SHAREUNITS divides evenly by numWinners
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void EquityCalculator::Result::addTie(const int numWinners)
+{
+   this->ties++;
+   this->shares += SHAREUNITS / numWinners;
+} // end EquityCalculator::Result::addTie
+
+//******************************************************************************
+// Function : addTrials
+// Process  : Add to trials
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void EquityCalculator::Result::addTrials(
+   const unsigned long long numTrials)
+{
+   this->trials += numTrials;
+} // end EquityCalculator::Result::addTrials
+
+//******************************************************************************
+// Function : addWin
+// Process  : Count the win and the whole pot
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void EquityCalculator::Result::addWin()
+{
+   this->wins++;
+   this->shares += SHAREUNITS;
+} // end EquityCalculator::Result::addWin
+
+//******************************************************************************
+// Function : getEquity
+// Process  : Divide the shares by the pots played
+// Notes    : Returns 0 if there were no trials
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline double EquityCalculator::Result::getEquity() const
+{
+   if (this->trials == 0)
+   {
+      return 0.0;
+   }
+
+   return static_cast<double>(this->shares) /
+          (static_cast<double>(this->trials) * SHAREUNITS);
+} // end EquityCalculator::Result::getEquity
+
+//******************************************************************************
+// Function : getLosses
+// Process  : Subtract the wins and ties from the trials
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long EquityCalculator::Result::getLosses() const
+{
+   return this->trials - this->wins - this->ties;
+} // end EquityCalculator::Result::getLosses
+
+//******************************************************************************
+// Function : getShares
+// Process  : Accessor for shares
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long EquityCalculator::Result::getShares() const
+{
+   return this->shares;
+} // end EquityCalculator::Result::getShares
+
+//******************************************************************************
+// Function : getTies
+// Process  : Accessor for ties
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long EquityCalculator::Result::getTies() const
+{
+   return this->ties;
+} // end EquityCalculator::Result::getTies
+
+//******************************************************************************
+// Function : getTrials
+// Process  : Accessor for trials
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long EquityCalculator::Result::getTrials() const
+{
+   return this->trials;
+} // end EquityCalculator::Result::getTrials
+
+//******************************************************************************
+// Function : getWins
+// Process  : Accessor for wins
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long EquityCalculator::Result::getWins() const
+{
+   return this->wins;
+} // end EquityCalculator::Result::getWins
+
+//******************************************************************************
+// Function : merge
+// Process  : Add each count of the input result
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void EquityCalculator::Result::merge(const Result& result)
+{
+   this->wins   += result.wins;
+   this->ties   += result.ties;
+   this->shares += result.shares;
+   this->trials += result.trials;
+} // end EquityCalculator::Result::merge
+
+#endif // EquityCalculator_h
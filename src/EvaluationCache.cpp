@@ -0,0 +1,361 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     EvaluationCache.cpp
+//
+// File Overview: Represents a bounded, sharded, thread-safe cache of
+//                evaluation results keyed by the card mask
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Cache equity results
+//******************************************************************************
+
+#include "stdafx.h"
+#include <cstring>
+#include "EquityCalculator.h"
+#include "EvaluationCache.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : Round the shards and the buckets per shard up to powers of two
+//             Allocate the empty buckets and the shards
+// Notes    : Throw an exception if the sizes are not positive or the cache
+//             is too large
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+EvaluationCache<Value>::EvaluationCache(
+   const int numShards,
+   const int shardCapacity)
+   : buckets(NULL),
+     shards(NULL),
+     numBuckets(1),
+     numShards(1)
+{
+   unsigned long long shardBuckets = 1;   // Buckets of each shard
+
+   if (numShards < 1 || shardCapacity < 1 ||
+       static_cast<unsigned long long>(numShards) * shardCapacity >
+          MAXCAPACITY)
+   {
+      throw exception("Invalid size in EvaluationCache::EvaluationCache");
+   }
+
+   while (this->numShards < static_cast<unsigned long long>(numShards))
+   {
+      this->numShards <<= 1;
+   }
+
+   while (shardBuckets * NUMWAYS <
+          static_cast<unsigned long long>(shardCapacity))
+   {
+      shardBuckets <<= 1;
+   }
+
+   this->numBuckets = this->numShards * shardBuckets;
+   this->buckets    = new Bucket[this->numBuckets];
+   this->shards     = new Shard[this->numShards];
+} // end EvaluationCache::EvaluationCache
+
+//******************************************************************************
+// Function : destructor
+// Process  : Release the buckets and the shards
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+EvaluationCache<Value>::~EvaluationCache()
+{
+   delete [] this->buckets;
+   delete [] this->shards;
+} // end EvaluationCache::~EvaluationCache
+
+//******************************************************************************
+// Function : clear
+// Process  : For each bucket, under the lock of its shard
+//                Make the sequence number odd, empty every entry, and make
+//                the sequence number even again
+// Notes    : Finds racing the clear miss or see the entries before it
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+void EvaluationCache<Value>::clear()
+{
+   for (unsigned long long bucketIndex = 0;
+        bucketIndex < this->numBuckets;
+        ++bucketIndex)
+   {
+      Bucket&           bucket   = this->buckets[bucketIndex];
+      lock_guard<mutex> guard(this->getShard(bucketIndex).lock);
+      unsigned int      sequence = bucket.sequence.load(memory_order_relaxed);
+
+      bucket.sequence.store(sequence + 1, memory_order_relaxed);
+      atomic_thread_fence(memory_order_release);
+
+      for (int way = 0; way < NUMWAYS; ++way)
+      {
+         bucket.keys[way].store(0, memory_order_relaxed);
+         bucket.referenced[way].store(0, memory_order_relaxed);
+      }
+
+      bucket.hand = 0;
+      bucket.sequence.store(sequence + 2, memory_order_release);
+   }
+} // end EvaluationCache::clear
+
+//******************************************************************************
+// Function : find
+// Process  : Load the sequence number of the mask's bucket, retry if odd
+//             Copy the words of the entry whose key is the mask plus one
+//             Reload the sequence number, retry if it changed
+//             On a hit, set the entry's referenced bit and copy the words
+//                to the value
+//             Count the hit or the miss in the bucket's shard
+// Notes    : Takes no lock, gives up as a miss after MAXREADS reads of a
+//             bucket being written
+//             The acquire fence orders the entry loads before the reload,
+//             so an unchanged even number means no insert overlapped them
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+bool EvaluationCache<Value>::find(
+   const unsigned long long   mask,
+   Value&                     value) const
+{
+   unsigned long long bucketIndex = this->getBucketIndex(mask);
+   Bucket&            bucket      = this->buckets[bucketIndex];
+   Shard&             shard       = this->getShard(bucketIndex);
+   unsigned long long words[NUMWORDS];    // Words of the entry found
+
+   for (int read = 0; read < MAXREADS; ++read)
+   {
+      unsigned int sequence = bucket.sequence.load(memory_order_acquire);
+      int          foundWay = -1;
+
+      if (sequence & 1)
+      {
+         continue;
+      }
+
+      for (int way = 0; way < NUMWAYS; ++way)
+      {
+         if (bucket.keys[way].load(memory_order_relaxed) == mask + 1)
+         {
+            for (int word = 0; word < NUMWORDS; ++word)
+            {
+               words[word] =
+                  bucket.values[way][word].load(memory_order_relaxed);
+            }
+
+            foundWay = way;
+            break;
+         }
+      }
+
+      atomic_thread_fence(memory_order_acquire);
+
+      if (bucket.sequence.load(memory_order_relaxed) != sequence)
+      {
+         continue;
+      }
+
+      if (foundWay < 0)
+      {
+         break;
+      }
+
+      bucket.referenced[foundWay].store(1, memory_order_relaxed);
+      memcpy(&value, words, sizeof(Value));
+      shard.hits.fetch_add(1, memory_order_relaxed);
+
+      return true;
+   }
+
+   shard.misses.fetch_add(1, memory_order_relaxed);
+
+   return false;
+} // end EvaluationCache::find
+
+//******************************************************************************
+// Function : getEvictions
+// Process  : Sum the evictions of every shard
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+unsigned long long EvaluationCache<Value>::getEvictions() const
+{
+   unsigned long long evictions = 0;
+
+   for (unsigned long long shard = 0; shard < this->numShards; ++shard)
+   {
+      evictions += this->shards[shard].evictions.load(memory_order_relaxed);
+   }
+
+   return evictions;
+} // end EvaluationCache::getEvictions
+
+//******************************************************************************
+// Function : getHits
+// Process  : Sum the hits of every shard
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+unsigned long long EvaluationCache<Value>::getHits() const
+{
+   unsigned long long hits = 0;
+
+   for (unsigned long long shard = 0; shard < this->numShards; ++shard)
+   {
+      hits += this->shards[shard].hits.load(memory_order_relaxed);
+   }
+
+   return hits;
+} // end EvaluationCache::getHits
+
+//******************************************************************************
+// Function : getMisses
+// Process  : Sum the misses of every shard
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+unsigned long long EvaluationCache<Value>::getMisses() const
+{
+   unsigned long long misses = 0;
+
+   for (unsigned long long shard = 0; shard < this->numShards; ++shard)
+   {
+      misses += this->shards[shard].misses.load(memory_order_relaxed);
+   }
+
+   return misses;
+} // end EvaluationCache::getMisses
+
+//******************************************************************************
+// Function : insert
+// Process  : Lock the shard of the mask's bucket
+//             Pick the entry already holding the mask, else an empty entry,
+//                else sweep the CLOCK hand: clear each referenced bit and
+//                evict the first entry not referenced
+//             Make the sequence number odd, write the key and the value
+//                words, and make the sequence number even again
+//             Mark the entry referenced
+// Notes    : The release fence orders the odd number before the entry
+//             stores, the release store orders them before the even number
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+void EvaluationCache<Value>::insert(
+   const unsigned long long   mask,
+   const Value&               value)
+{
+   unsigned long long bucketIndex = this->getBucketIndex(mask);
+   Bucket&            bucket      = this->buckets[bucketIndex];
+   Shard&             shard       = this->getShard(bucketIndex);
+   lock_guard<mutex>  guard(shard.lock);
+   unsigned long long words[NUMWORDS] = {};   // Words of the value
+   unsigned int       sequence        = 0;
+   int                targetWay       = -1;   // Entry to write
+
+   memcpy(words, &value, sizeof(Value));
+
+   for (int way = 0; way < NUMWAYS && targetWay < 0; ++way)
+   {
+      if (bucket.keys[way].load(memory_order_relaxed) == mask + 1)
+      {
+         targetWay = way;
+      }
+   }
+
+   for (int way = 0; way < NUMWAYS && targetWay < 0; ++way)
+   {
+      if (bucket.keys[way].load(memory_order_relaxed) == 0)
+      {
+         targetWay = way;
+      }
+   }
+
+   while (targetWay < 0)
+   {
+      if (bucket.referenced[bucket.hand].load(memory_order_relaxed))
+      {
+         bucket.referenced[bucket.hand].store(0, memory_order_relaxed);
+      }
+      else
+      {
+         targetWay = bucket.hand;
+         shard.evictions.fetch_add(1, memory_order_relaxed);
+      }
+
+      bucket.hand = static_cast<unsigned char>((bucket.hand + 1) % NUMWAYS);
+   }
+
+   sequence = bucket.sequence.load(memory_order_relaxed);
+   bucket.sequence.store(sequence + 1, memory_order_relaxed);
+   atomic_thread_fence(memory_order_release);
+
+   bucket.keys[targetWay].store(mask + 1, memory_order_relaxed);
+
+   for (int word = 0; word < NUMWORDS; ++word)
+   {
+      bucket.values[targetWay][word].store(words[word],
+                                           memory_order_relaxed);
+   }
+
+   bucket.sequence.store(sequence + 2, memory_order_release);
+   bucket.referenced[targetWay].store(1, memory_order_relaxed);
+} // end EvaluationCache::insert
+
+//******************************************************************************
+// Explicit instantiations, the cache of each cached result
+//******************************************************************************
+
+template class EvaluationCache<int>;
+template class EvaluationCache<EquityCalculator::Result>;
@@ -0,0 +1,497 @@
+//******************************************************************************
+//
+// File Name:     EvaluationCache.h
+//
+// File Overview: Represents a bounded, sharded, thread-safe cache of
+//                evaluation results keyed by the card mask
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Cache equity results
+//******************************************************************************
+
+#ifndef EvaluationCache_h
+#define EvaluationCache_h
+
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include "CardSet.h"
+
+//******************************************************************************
+//
+// Class:    EvaluationCache
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Cache equity results
+//
+// Notes    : Maps a 52 bit card mask (see CardSet) to a Value, a trivially
+//             copyable result, a hand value for HandValueCache and an
+//             EquityCalculator::Result for EquityCache.  Instantiated for
+//             each in EvaluationCache.cpp, a new Value is instantiated
+//             there too.
+//             The cache is a fixed array of buckets of NUMWAYS entries, a
+//             mask hashes to one bucket and may be held by any of its
+//             entries.  When a bucket is full, an entry is evicted by
+//             CLOCK: a hand sweeps the entries, clearing the referenced bit
+//             set by each hit, and evicts the first entry not referenced.
+//             Reads take no lock.  Each bucket has a sequence number, odd
+//             while an insert writes the bucket, and a read retries if the
+//             number was odd or changed while it copied the entry.  Inserts
+//             lock the shard of the bucket, so writers of different shards
+//             never wait on each other.
+//             Each shard counts its hits, misses, and evictions, summed by
+//             the accessors.
+//             Not copyable, the buckets are released by the destructor
+//
+//******************************************************************************
+template <class Value>
+class EvaluationCache
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes an empty cache of about numShards *
+   //                shardCapacity entries
+   //                Rounds the shards and the buckets per shard up to
+   //                powers of two
+   // Constraints : Throws an exception if numShards or shardCapacity is not
+   //                positive or the cache is too large
+   //***************************************************************************
+   EvaluationCache(
+      const int numShards     = DEFAULTSHARDS,
+      const int shardCapacity = DEFAULTSHARDCAPACITY);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks, releases the buckets
+   // Constraints : No thread may be using the cache
+   //***************************************************************************
+   virtual ~EvaluationCache();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : clear
+   // Description : Removes every entry, the counters are kept
+   // Constraints : None
+   //***************************************************************************
+   void clear();
+
+   //***************************************************************************
+   // Function    : find
+   // Description : Looks up the mask without locking, copies its value and
+   //                returns true if it is cached
+   //                Returns false if it is not, or if inserts kept changing
+   //                its bucket
+   // Constraints : Safe to call from any thread
+   //***************************************************************************
+   bool find(
+      const unsigned long long   mask,
+      Value&                     value) const;
+
+   //***************************************************************************
+   // Function    : getCapacity
+   // Description : Returns the number of entries the cache can hold
+   // Constraints : None
+   //***************************************************************************
+   inline unsigned long long getCapacity() const;
+
+   //***************************************************************************
+   // Function    : getEvictions
+   // Description : Returns the number of entries evicted by inserts
+   // Constraints : Safe to call from any thread, may lag concurrent inserts
+   //***************************************************************************
+   unsigned long long getEvictions() const;
+
+   //***************************************************************************
+   // Function    : getHits
+   // Description : Returns the number of finds of a cached mask
+   // Constraints : Safe to call from any thread, may lag concurrent finds
+   //***************************************************************************
+   unsigned long long getHits() const;
+
+   //***************************************************************************
+   // Function    : getMisses
+   // Description : Returns the number of finds of a mask not cached
+   // Constraints : Safe to call from any thread, may lag concurrent finds
+   //***************************************************************************
+   unsigned long long getMisses() const;
+
+   //***************************************************************************
+   // Function    : insert
+   // Description : Caches the value of the mask, replacing its value if it
+   //                is already cached, else evicting an entry of its bucket
+   //                if the bucket is full
+   // Constraints : Safe to call from any thread
+   //***************************************************************************
+   void insert(
+      const unsigned long long   mask,
+      const Value&               value);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the layout of the cache
+   enum EvaluationCacheSize
+   {
+      NUMWAYS              = 8,        // Entries in each bucket
+      NUMWORDS             = (sizeof(Value) + 7) / 8,  // 64 bit words of a
+                                                       // value
+      MAXREADS             = 4,        // Reads of a changing bucket before
+                                       // a miss
+      DEFAULTSHARDS        = 64,
+      DEFAULTSHARDCAPACITY = 1 << 14,
+      MAXCAPACITY          = 1 << 30
+   };
+
+private:
+
+   //***************************************************************************
+   //
+   // Class:    Bucket
+   //
+   // Notes    : NUMWAYS entries, each a key of the mask plus one, zero if
+   //             empty, the value as 64 bit words, and the referenced bit
+   //             The sequence number and the keys and values are atomics
+   //             so reads racing an insert are defined, loaded relaxed and
+   //             ordered by fences.  The CLOCK hand is only read and written
+   //             under the lock of the shard.
+   //             Aligned to a cache line, so buckets never share one
+   //             Private, used by EvaluationCache only
+   //
+   //***************************************************************************
+   class alignas(64) Bucket
+   {
+   public:
+
+      //************************************************************************
+      // Function    : constructor
+      // Description : Initializes the bucket to empty
+      // Constraints : None
+      //************************************************************************
+      inline Bucket();
+
+      atomic<unsigned int>       sequence;                  // Odd if writing
+      atomic<unsigned char>      referenced[NUMWAYS];       // Hit since the
+                                                            // hand passed
+      unsigned char              hand;                      // Next entry the
+                                                            // CLOCK checks
+      atomic<unsigned long long> keys[NUMWAYS];             // Mask + 1
+      atomic<unsigned long long> values[NUMWAYS][NUMWORDS]; // Value words
+
+   }; // end class Bucket
+
+   //***************************************************************************
+   //
+   // Class:    Shard
+   //
+   // Notes    : The lock of the inserts to the shard's buckets and its
+   //             counters, aligned to a cache line so the counters of
+   //             different shards are not shared
+   //             Private, used by EvaluationCache only
+   //
+   //***************************************************************************
+   class alignas(64) Shard
+   {
+   public:
+
+      //************************************************************************
+      // Function    : constructor
+      // Description : Initializes the counters to zero
+      // Constraints : None
+      //************************************************************************
+      inline Shard();
+
+      mutex                      lock;       // Held by inserts
+      atomic<unsigned long long> hits;
+      atomic<unsigned long long> misses;
+      atomic<unsigned long long> evictions;
+
+   }; // end class Shard
+
+   //***************************************************************************
+   // Function    : copy constructor
+   // Description : Not implemented, the cache has one owner
+   // Constraints : Private
+   //***************************************************************************
+   EvaluationCache(const EvaluationCache& cache);
+
+   //***************************************************************************
+   // Function    : operator=
+   // Description : Not implemented, the cache has one owner
+   // Constraints : Private
+   //***************************************************************************
+   EvaluationCache& operator=(const EvaluationCache& cache);
+
+   //***************************************************************************
+   // Function    : getBucketIndex
+   // Description : Returns the bucket of the mask, from a 64 bit mix of the
+   //                mask so neighboring masks spread over the buckets
+   // Constraints : Private
+   //***************************************************************************
+   inline unsigned long long getBucketIndex(
+      const unsigned long long mask) const;
+
+   //***************************************************************************
+   // Function    : getShard
+   // Description : Returns the shard locking the bucket, the low bits of
+   //                its index
+   // Constraints : Private
+   //***************************************************************************
+   inline Shard& getShard(const unsigned long long bucketIndex) const;
+
+   static_assert(is_trivially_copyable<Value>::value,
+                 "Cached values are copied as words");
+
+   Bucket*              buckets;       // Entries, numBuckets buckets
+   Shard*               shards;        // Locks and counters, numShards
+   unsigned long long   numBuckets;    // Power of two
+   unsigned long long   numShards;     // Power of two, at most numBuckets
+
+}; // end class EvaluationCache
+
+// Cache of the hand value of a card mask
+typedef EvaluationCache<int> HandValueCache;
+
+// Instantiated once, in EvaluationCache.cpp, EquityCache is declared by
+// EquityCalculator.h
+extern template class EvaluationCache<int>;
+
+//******************************************************************************
+//
+// Class:    CachedEvaluator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Cache any value type
+//
+// Notes    : Puts an EvaluationCache in front of any evaluator with an
+//             evaluate(const CardSet&) member returning the Value, by
+//             default a HandValueCache in front of an evaluator of hand
+//             values such as HandEvaluator or ShortDeckEvaluator
+//             Holds references, the evaluator and the cache must outlive
+//             it, and one cache must only be shared by evaluators of the
+//             same deck and number of cards
+//             A cache pays off where the evaluator is slower than a cache
+//             line miss, such as long evaluations or large results
+//
+//******************************************************************************
+template <class Evaluator, class Value = int>
+class CachedEvaluator
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the evaluator and the cache in front of it
+   // Constraints : The evaluator and the cache must outlive the object
+   //***************************************************************************
+   inline CachedEvaluator(
+      const Evaluator&        evaluator,
+      EvaluationCache<Value>& cache);
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Returns the cached value of the cards, else evaluates
+   //                the cards and caches their value
+   // Constraints : Safe to call from any thread if the evaluator is
+   //***************************************************************************
+   inline Value evaluate(const CardSet& cards) const;
+
+   //***************************************************************************
+   // Function    : getCache
+   // Description : Accessor for cache, for its counters
+   // Constraints : None
+   //***************************************************************************
+   inline EvaluationCache<Value>& getCache() const;
+
+private:
+
+   const Evaluator&        evaluator;  // Backend evaluating the misses
+   EvaluationCache<Value>& cache;      // Values already evaluated
+
+}; // end class CachedEvaluator
+
+//******************************************************************************
+// Function : getCapacity
+// Process  : Return the entries of every bucket
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+inline unsigned long long EvaluationCache<Value>::getCapacity() const
+{
+   return this->numBuckets * NUMWAYS;
+} // end EvaluationCache::getCapacity
+
+//******************************************************************************
+// Function : getBucketIndex
+// Process  : Mix the mask with the SplitMix64 finalizer and keep the low
+//             bits
+// Notes    : numBuckets is a power of two
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+inline unsigned long long EvaluationCache<Value>::getBucketIndex(
+   const unsigned long long mask) const
+{
+   unsigned long long hash = mask;
+
+   hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+   hash =  hash ^ (hash >> 31);
+
+   return hash & (this->numBuckets - 1);
+} // end EvaluationCache::getBucketIndex
+
+//******************************************************************************
+// Function : getShard
+// Process  : Return the shard of the low bits of the bucket index
+// Notes    : numShards is a power of two
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+inline typename EvaluationCache<Value>::Shard&
+   EvaluationCache<Value>::getShard(const unsigned long long bucketIndex) const
+{
+   return this->shards[bucketIndex & (this->numShards - 1)];
+} // end EvaluationCache::getShard
+
+//******************************************************************************
+// Function : constructor
+// Process  : Start with every entry empty and the hand at the first entry
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+inline EvaluationCache<Value>::Bucket::Bucket()
+   : sequence(0),
+     hand(0)
+{
+   for (int way = 0; way < NUMWAYS; ++way)
+   {
+      this->referenced[way].store(0, memory_order_relaxed);
+      this->keys[way].store(0, memory_order_relaxed);
+
+      for (int word = 0; word < NUMWORDS; ++word)
+      {
+         this->values[way][word].store(0, memory_order_relaxed);
+      }
+   }
+} // end EvaluationCache::Bucket::Bucket
+
+//******************************************************************************
+// Function : constructor
+// Process  : Start the counters at zero
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+inline EvaluationCache<Value>::Shard::Shard()
+   : hits(0),
+     misses(0),
+     evictions(0)
+{
+} // end EvaluationCache::Shard::Shard
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize the evaluator and the cache
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Cache any value type
+//******************************************************************************
+template <class Evaluator, class Value>
+inline CachedEvaluator<Evaluator, Value>::CachedEvaluator(
+   const Evaluator&        evaluator,
+   EvaluationCache<Value>& cache)
+   : evaluator(evaluator),
+     cache(cache)
+{
+} // end CachedEvaluator::CachedEvaluator
+
+//******************************************************************************
+// Function : evaluate
+// Process  : If the cache holds the mask of the cards, return its value
+//             Else, evaluate the cards, cache the value, and return it
+// Notes    : Two threads missing the same cards both evaluate them, the
+//             second insert replaces the first with the same value
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Cache any value type
+//******************************************************************************
+template <class Evaluator, class Value>
+inline Value CachedEvaluator<Evaluator, Value>::evaluate(
+   const CardSet& cards) const
+{
+   Value value = Value();
+
+   if (!this->cache.find(cards.getMask(), value))
+   {
+      value = this->evaluator.evaluate(cards);
+      this->cache.insert(cards.getMask(), value);
+   }
+
+   return value;
+} // end CachedEvaluator::evaluate
+
+//******************************************************************************
+// Function : getCache
+// Process  : Accessor for cache
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Cache any value type
+//******************************************************************************
+template <class Evaluator, class Value>
+inline EvaluationCache<Value>& CachedEvaluator<Evaluator, Value>::getCache() 
+   const
+{
+   return this->cache;
+} // end CachedEvaluator::getCache
+
+#endif // EvaluationCache_h
@@ -1,201 +1,240 @@
-// COPYRIGHT  2011, Donne Martin
-// All Rights Reserved.
-//
-//******************************************************************************
-//
-// File Name:     Hand.cpp
-//
-// File Overview: Represents a Hand containing five cards
-//
-//******************************************************************************
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added class
-//******************************************************************************
-
-#include "stdafx.h"
-#include <iostream>
-#include "Hand.h"
-#include <algorithm>
-
-//******************************************************************************
-// File scope (static) variable definitions
-//******************************************************************************
-
-// None
-
-//******************************************************************************
-// Function : constructor                                   
-// Process  : None                    
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//******************************************************************************                    
-Hand::Hand()
-{
-
-} // end Hand::Hand
-   
-//***************************************************************************
-// Function : constructor                                   
-// Process  : Initialize data members to input cards             
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-Hand::Hand(
-   Card card0,
-   Card card1,
-   Card card2,
-   Card card3,
-   Card card4)
-{
-   vector<Card> cards(Hand::MAXCARDS); // Holds the hand of cards
-
-   cards.push_back(card0);
-   cards.push_back(card1);
-   cards.push_back(card2);
-   cards.push_back(card3);
-   cards.push_back(card4);
-
-   this->setCards(cards);
-}
-
-//******************************************************************************
-// Function : destructor                                   
-// Process  : None           
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//******************************************************************************
-Hand::~Hand()
-{
-} // end Hand::~Hand
-     
-//***************************************************************************
-// Function : getCardSafe                                
-// Process  : verifies index is valid
-//             Check if index is valid, return success, update card param
-// Notes    : Might be good to inline
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-bool Hand::getCardSafe(
-   const int index, 
-   Card& card) const
-{
-   bool success = false;   // determines if the function succeeded
-
-   if (this->isValidCardIndex(index)) {
-      card = this->cards[index];
-   }
-
-   return success;
-} // end Card::getCardSafe
-
-//***************************************************************************
-// Function : printHand                                   
-// Process  : Print the hand by calling each card's print method
-//             Print the hand type
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-void Hand::printHand() const
-{
-   Card card;  // Current card, used to iterate the hand and print each card
-
-   for (int cardIndex = 0; cardIndex < MAXCARDS; ++cardIndex)
-   {
-      this->getCard(cardIndex, card);
-      card.printCard();
-   }
-   
-   this->printType();
-}
-//***************************************************************************
-// Function : printType                                   
-// Process  : Print the hand type  (straight flush, full house, etc)  
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-void Hand::printType() const
-{
-   Hand::HandType type = this->getType();
-
-   switch (type)
-   {
-      case Hand::HIGHCARD:
-      {
-         cout << "(High Card)";
-         break;
-      }
-      case Hand::ONEPAIR:
-      {
-         cout << "(Pair)";
-         break;
-      }
-      case Hand::TWOPAIR:
-      {
-         cout << "(Two Pair)";
-         break;
-      }
-      case Hand::THREEOFAKIND:
-      {
-         cout << "(Three of a Kind)";
-         break;
-      }
-      case Hand::STRAIGHT:
-      {
-         cout << "(Straight)";
-         break;
-      }
-      case Hand::FLUSH:
-      {
-         cout << "(Flush)";
-         break;
-      }
-      case Hand::FULLHOUSE:
-      {
-         cout << "(Full House)";
-         break;
-      }
-      case Hand::FOUROFAKIND:
-      {
-         cout << "(Four of a Kind)";
-         break;
-      }
-      case Hand::STRAIGHTFLUSH:
-      {
-         cout << "(Straight Flush)";
-         break;
-      }
-      case Hand::INVALIDHAND:
-      default:
-      {
-         throw exception("Unexpected type in printType");
-         break;
-      }
-   }
-}
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     Hand.cpp
+//
+// File Overview: Represents a Hand containing five cards
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added class
+// 10.17.26       Donne Martin         Added hand value
+// 10.17.26       Donne Martin         Store cards and repetitions inline
+// 10.18.26       Donne Martin         Print hands to a stream
+// 10.18.26       Donne Martin         Added type names
+//******************************************************************************
+
+#include "stdafx.h"
+#include <iostream>
+#include "Hand.h"
+#include <algorithm>
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// Name of each Hand::HandType, by value
+static const char* const TYPENAMES[] =
+{
+   "INVALIDHAND",
+   "HIGHCARD",
+   "ONEPAIR",
+   "TWOPAIR",
+   "THREEOFAKIND",
+   "STRAIGHT",
+   "FLUSH",
+   "FULLHOUSE",
+   "FOUROFAKIND",
+   "STRAIGHTFLUSH"
+};
+
+//******************************************************************************
+// Function : constructor                                   
+// Process  : Initialize value to zero, the hand is not ranked yet
+//             Initialize type and the repetition lists to empty
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+// 10.17.26       Donne Martin         Initialize value
+// 10.17.26       Donne Martin         Initialize type and repetitions
+//******************************************************************************                    
+Hand::Hand()
+{
+   this->setType(Hand::INVALIDHAND);
+   this->setValue(0);
+   this->clearRepetitions();
+} // end Hand::Hand
+   
+//***************************************************************************
+// Function : constructor                                   
+// Process  : Initialize data members to input cards             
+//             Initialize value to zero, the hand is not ranked yet
+//             Initialize type and the repetition lists to empty
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+// 10.17.26       Donne Martin         Initialize value
+// 10.17.26       Donne Martin         Pack the cards without a vector
+//***************************************************************************
+Hand::Hand(
+   Card card0,
+   Card card1,
+   Card card2,
+   Card card3,
+   Card card4)
+{
+   // Holds the hand of cards
+   PackedCard cards[Hand::MAXCARDS] = 
+   {
+      PackedCard(card0),
+      PackedCard(card1),
+      PackedCard(card2),
+      PackedCard(card3),
+      PackedCard(card4)
+   };
+
+   this->setPackedCards(cards);
+   this->setType(Hand::INVALIDHAND);
+   this->setValue(0);
+   this->clearRepetitions();
+}
+
+//***************************************************************************
+// Function : getCardSafe                                
+// Process  : verifies index is valid
+//             Check if index is valid, return success, update card param
+// Notes    : Might be good to inline
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+bool Hand::getCardSafe(
+   const int index, 
+   Card& card) const
+{
+   bool success = false;   // determines if the function succeeded
+
+   if (this->isValidCardIndex(index)) {
+      card = this->cards[index].toCard();
+   }
+
+   return success;
+} // end Card::getCardSafe
+
+//***************************************************************************
+// Function : getTypeName
+// Process  : Look up the name of the type
+// Notes    : Throw an exception if the type is out of range
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+//***************************************************************************
+const char* Hand::getTypeName(const Hand::HandType type)
+{
+   if (type < Hand::INVALIDHAND || type > Hand::STRAIGHTFLUSH)
+   {
+      throw exception("Unexpected type in getTypeName");
+   }
+
+   return TYPENAMES[type];
+} // end Hand::getTypeName
+
+//***************************************************************************
+// Function : printHand                                   
+// Process  : Print the hand by calling each card's print method
+//             Print the hand type
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+// 10.18.26       Donne Martin         Print to the stream
+//***************************************************************************
+void Hand::printHand(ostream& out) const
+{
+   Card card;  // Current card, used to iterate the hand and print each card
+
+   for (int cardIndex = 0; cardIndex < MAXCARDS; ++cardIndex)
+   {
+      this->getCard(cardIndex, card);
+      card.printCard(out);
+   }
+   
+   this->printType(out);
+}
+//***************************************************************************
+// Function : printType                                   
+// Process  : Print the hand type  (straight flush, full house, etc)  
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+// 10.18.26       Donne Martin         Print to the stream
+//***************************************************************************
+void Hand::printType(ostream& out) const
+{
+   Hand::HandType type = this->getType();
+
+   switch (type)
+   {
+      case Hand::HIGHCARD:
+      {
+         out << "(High Card)";
+         break;
+      }
+      case Hand::ONEPAIR:
+      {
+         out << "(Pair)";
+         break;
+      }
+      case Hand::TWOPAIR:
+      {
+         out << "(Two Pair)";
+         break;
+      }
+      case Hand::THREEOFAKIND:
+      {
+         out << "(Three of a Kind)";
+         break;
+      }
+      case Hand::STRAIGHT:
+      {
+         out << "(Straight)";
+         break;
+      }
+      case Hand::FLUSH:
+      {
+         out << "(Flush)";
+         break;
+      }
+      case Hand::FULLHOUSE:
+      {
+         out << "(Full House)";
+         break;
+      }
+      case Hand::FOUROFAKIND:
+      {
+         out << "(Four of a Kind)";
+         break;
+      }
+      case Hand::STRAIGHTFLUSH:
+      {
+         out << "(Straight Flush)";
+         break;
+      }
+      case Hand::INVALIDHAND:
+      default:
+      {
+         throw exception("Unexpected type in printType");
+         break;
+      }
+   }
+}
@@ -1,789 +1,874 @@
-//******************************************************************************
-//
-// File Name:     Hand.h
-//
-// File Overview: Represents a Hand containing five cards
-//
-//******************************************************************************
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added class
-//******************************************************************************
-
-#ifndef Hand_h
-#define Hand_h
-
-#include <algorithm>
-#include <map>
-#include <vector>
-#include "Card.h"
-
-//******************************************************************************
-//
-// Class:    Hand
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added class 
-//
-// Notes    : None
-//
-//******************************************************************************
-class Hand
-{
-public:
-
-   // Forward declaration for Hand enum used in member function params
-   enum HandType;
-      
-   //***************************************************************************
-   // Function    : constructor                                   
-   // Description : None        
-   //                Not the recommended constructor        
-   // Constraints : Need to set cards afterwards
-   //***************************************************************************
-   Hand();
-   
-   //***************************************************************************
-   // Function    : constructor                                   
-   // Description : Initializes data members to input cards          
-   //                Recommended constructor        
-   // Constraints : None
-   //***************************************************************************
-   Hand(
-      Card card0,
-      Card card1,
-      Card card2,
-      Card card3,
-      Card card4);
-
-   //***************************************************************************
-   // Function    : destructor                                   
-   // Description : Performs cleanup tasks              
-   // Constraints : None
-   //***************************************************************************
-   virtual ~Hand();   
-
-   // Member functions in alphabetical order
-               
-   //***************************************************************************
-   // Function    : addToPairs                                   
-   // Description : Adds the number to the list of pairs
-   //                Used for optimized hand ranking
-   // Constraints : None
-   //***************************************************************************
-   inline void addToPairs(const Card::CardNumber cardNumber);
-
-   //***************************************************************************
-   // Function    : addToQuads                                   
-   // Description : Adds the number to the list of quads
-   //                Used for optimized hand ranking          
-   // Constraints : None
-   //***************************************************************************
-   inline void addToQuads(const Card::CardNumber cardNumber);
-
-   //***************************************************************************
-   // Function    : addToSingles                                   
-   // Description : Adds the number to the list of singles
-   //                Used for optimized hand ranking         
-   // Constraints : None
-   //***************************************************************************
-   inline void addToSingles(const Card::CardNumber cardNumber);
-
-   //***************************************************************************
-   // Function    : addToTrips                                   
-   // Description : Adds the number to the list of trips
-   //                Used for optimized hand ranking           
-   // Constraints : None
-   //***************************************************************************
-   inline void addToTrips(const Card::CardNumber cardNumber);
-
-   //***************************************************************************
-   // Function    : getCard                                
-   // Description : Accessor for cards
-   //                Does not check if index is valid
-   // Constraints : index must be valid
-   //***************************************************************************
-   inline void getCard(
-      const int index, 
-      Card& card) const;
-   
-   //***************************************************************************
-   // Function    : getCardNumber                                   
-   // Description : Accessor for card number     
-   //                Checks index for validity
-   // Constraints : None
-   //***************************************************************************
-   inline Card::CardNumber getCardNumber(const int index) const;
-
-   //***************************************************************************
-   // Function    : getCards                                
-   // Description : Accessor for cards
-   // Constraints : None
-   //***************************************************************************
-   inline void getCards(vector<Card>& cards) const;
-      
-   //***************************************************************************
-   // Function    : getCardSafe                                
-   // Description : Accessor for cards, verifies index is valid
-   //                Checks if index is valid, return success, update card param
-   // Constraints : None
-   //***************************************************************************
-   bool Hand::getCardSafe(
-      const int index, 
-      Card& card) const;
-   
-   //***************************************************************************
-   // Function    : getCardSuit                                   
-   // Description : Get the card suit associated with the card
-   //                Checks index for validity         
-   // Constraints : None
-   //***************************************************************************
-   inline Card::CardSuit getCardSuit(const int index) const;
-      
-   //***************************************************************************
-   // Function    : getPairs                                   
-   // Description : Accessor for the list of pairs    
-   //                Used for optimized hand ranking           
-   // Constraints : None
-   //***************************************************************************
-   inline void getPairs(vector<Card::CardNumber>& pairs) const;
-
-   //***************************************************************************
-   // Function    : getQuads                                   
-   // Description : Accessor for the list of quads    
-   //                Used for optimized hand ranking         
-   // Constraints : None
-   //***************************************************************************
-   inline void getQuads(vector<Card::CardNumber>& quads) const;
-
-   //***************************************************************************
-   // Function    : getSingles                                   
-   // Description : Accessor for the list of singles    
-   //                Used for optimized hand ranking            
-   // Constraints : None
-   //***************************************************************************
-   inline void getSingles(vector<Card::CardNumber>& singles) const;
-
-   //***************************************************************************
-   // Function    : getTrips                                   
-   // Description : Accessor for the list of trips    
-   //                Used for optimized hand ranking            
-   // Constraints : None
-   //***************************************************************************
-   inline void getTrips(vector<Card::CardNumber>& trips) const;
-   
-   //***************************************************************************
-   // Function    : getType                                 
-   // Description : Accessor for type              
-   // Constraints : None
-   //***************************************************************************
-   inline Hand::HandType getType() const;
-
-   //***************************************************************************
-   // Function    : hasPairs                                 
-   // Description : Determines if the hand has pairs      
-   //                Used for optimized hand ranking               
-   // Constraints : None
-   //***************************************************************************
-   inline bool hasPairs() const;
-
-   //***************************************************************************
-   // Function    : hasQuads                                 
-   // Description : Determines if the hand has quads      
-   //                Used for optimized hand ranking               
-   // Constraints : None
-   //***************************************************************************
-   inline bool hasQuads() const;
-
-   //***************************************************************************
-   // Function    : hasTrips                                 
-   // Description : Determines if the hand has trips      
-   //                Used for optimized hand ranking               
-   // Constraints : None
-   //***************************************************************************
-   inline bool hasTrips() const;
-
-   //***************************************************************************
-   // Function    : hasSingles                                 
-   // Description : Determines if the hand has singles      
-   //                Used for optimized hand ranking               
-   // Constraints : None
-   //***************************************************************************
-   inline bool hasSingles() const;
-
-   //***************************************************************************
-   // Function    : isValidCardIndex                                 
-   // Description : Determines if the card index is valid (within range)
-   // Constraints : None
-   //***************************************************************************
-   inline bool isValidCardIndex(const int index) const;
-
-   //***************************************************************************
-   // Function    : printHand                                 
-   // Description : Prints each card in the hand    
-   //                Prints the hand type
-   // Constraints : None
-   //***************************************************************************
-   void printHand() const;
-   
-   //***************************************************************************
-   // Function    : printType                                 
-   // Description : Prints the hand type (straight flush, full house, etc)             
-   // Constraints : None
-   //***************************************************************************
-   void Hand::printType() const;
-
-   //***************************************************************************
-   // Function    : setCards                                
-   // Description : Mutator for cards
-   //                Optionally sorts cards
-   // Constraints : None
-   //***************************************************************************
-   inline void setCards(const vector<Card>& cards, bool sort = true);
-   
-   //***************************************************************************
-   // Function    : setType                                   
-   // Description : Mutator for type             
-   // Constraints : None
-   //***************************************************************************
-   inline void setType(Hand::HandType type);
-
-   //***************************************************************************
-   // Function    : sortCards                                   
-   // Description : Cards utility function
-   //                Sorts the cards based on their CardNumber (low to high)             
-   // Constraints : None
-   //***************************************************************************
-   inline void sortCards();
-
-   //***************************************************************************
-   // Function    : sortPairs                                   
-   // Description : Sorts the list of pairs   
-   //                Used for optimized hand ranking             
-   // Constraints : None
-   //***************************************************************************
-   inline void sortPairs();
-
-   //***************************************************************************
-   // Function    : sortQuads                                   
-   // Description : Sorts the list of pairs   
-   //                Used for optimized hand ranking           
-   // Constraints : None
-   //***************************************************************************
-   inline void sortQuads();
-
-   //***************************************************************************
-   // Function    : sortSingles                                   
-   // Description : Sorts the list of pairs   
-   //                Used for optimized hand ranking           
-   // Constraints : None
-   //***************************************************************************
-   inline void sortSingles();
-
-   //***************************************************************************
-   // Function    : sortTrips                                   
-   // Description : Sorts the list of pairs   
-   //                Used for optimized hand ranking           
-   // Constraints : None
-   //***************************************************************************
-   inline void sortTrips();
-      
-   //***************************************************************************
-   // public Class Attributes.
-   //***************************************************************************
-      
-   // Represents the card's hand index from 0 to 4, max 5 cards
-   enum CardIndex
-   {
-      FIRSTCARDINDEX,
-      SECONDCARDINDEX,
-      THIRDCARDINDEX,
-      FOURTHCARDINDEX,
-      FIFTHCARDINDEX,
-      MAXCARDS
-   };
-   
-   // Represents the number of times a card appears in the hand
-   enum CardRepetition
-   {
-      SINGLES = 1,
-      PAIRS,
-      TRIPS,
-      QUADS
-   };
-
-   // Represents the hand type (poker hands)
-   enum HandType
-   {
-      INVALIDHAND,
-      HIGHCARD,
-      ONEPAIR,
-      TWOPAIR,
-      THREEOFAKIND,
-      STRAIGHT,
-      FLUSH,
-      FULLHOUSE,
-      FOUROFAKIND,
-      STRAIGHTFLUSH
-   };
-   
-private:   
-   vector<Card>                  cards;   // List of cards
-   HandType                      type;    // Hand type (poker hands)
-   
-   // The following data members are used for optimized hand ranking  
-   vector<Card::CardNumber>      pairs;   // List of pairs
-   vector<Card::CardNumber>      quads;   // List of quads
-   vector<Card::CardNumber>      singles; // List of singles
-   vector<Card::CardNumber>      trips;   // List of trips
-}; // end class Hand
-      
-//***************************************************************************
-// Function : addToPairs                                   
-// Process  : Add the number to the list of pairs
-//                Used for optimized hand ranking          
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::addToPairs(const Card::CardNumber cardNumber)
-{
-   this->pairs.push_back(cardNumber);
-} // end Card::addToPairs
-
-//***************************************************************************
-// Function : addToQuads                                   
-// Process  : Add the number to the list of quads
-//                Used for optimized hand ranking            
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::addToQuads(const Card::CardNumber cardNumber)
-{
-   this->quads.push_back(cardNumber);
-} // end Card::addToQuads
-
-//***************************************************************************
-// Function : addToSingles                                   
-// Process  : Add the number to the list of singles
-//                Used for optimized hand ranking                    
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::addToSingles(const Card::CardNumber cardNumber)
-{
-   this->singles.push_back(cardNumber);
-} // end Card::addToSingles
-
-//***************************************************************************
-// Function : addToTrips                                   
-// Process  : Add the number to the list of trips
-//                Used for optimized hand ranking               
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::addToTrips(const Card::CardNumber cardNumber)
-{
-   this->trips.push_back(cardNumber);
-} // end Card::addToTrips
-
-//***************************************************************************
-// Function : getCard                                
-// Process  : Accessor for cards
-//                Does not check if index
-// Notes    : index must be valid
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::getCard(
-   const int index, 
-   Card& card) const
-{
-   card = this->cards[index];
-} // end Card::getCard
-
-//***************************************************************************
-// Function : getCardNumber                                   
-// Process  : Get the card number associated with the card
-//             Checks index for validity
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline Card::CardNumber Hand::getCardNumber(const int index) const
-{
-   Card card;
-   this->getCardSafe(index, card);
-
-   return card.getNumber();
-} // end Card::getCardNumber
-
-//***************************************************************************
-// Function : getCards                                
-// Process  : Accessor for cards
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::getCards(vector<Card>& card) const
-{
-   card = this->cards;
-} // end Card::getCards
-
-//***************************************************************************
-// Function : getCardSuit                                   
-// Process  : Get the card suit associated with the card
-//             Checks index for validity
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline Card::CardSuit Hand::getCardSuit(const int index) const
-{
-   Card card;
-   this->getCardSafe(index, card);
-
-   return card.getSuit();
-} // end Card::getCardSuit
-
-//***************************************************************************
-// Function : getPairs                                   
-// Process  : Accessor for the list of pairs    
-//                Used for optimized hand ranking              
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::getPairs(vector<Card::CardNumber>& pairs) const
-{
-   pairs = this->pairs;
-} // end Card::getPairs
-
-//***************************************************************************
-// Function : getQuads                                   
-// Process  : Accessor for the list of quads    
-//                Used for optimized hand ranking              
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::getQuads(vector<Card::CardNumber>& quads) const
-{
-   quads = this->quads;
-} // end Card::getQuads
-
-//***************************************************************************
-// Function : getSingles                                   
-// Process  : Accessor for the list of singles    
-//                Used for optimized hand ranking              
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::getSingles(vector<Card::CardNumber>& singles) const
-{
-   singles = this->singles;
-} // end Card::getSingles
-
-//***************************************************************************
-// Function : getTrips                                   
-// Process  : Accessor for the list of trips    
-//                Used for optimized hand ranking                
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::getTrips(vector<Card::CardNumber>& trips) const
-{
-   trips = this->trips;
-} // end Card::getTrips
-
-//***************************************************************************
-// Function : getType                                 
-// Process  : Accessor for type               
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline Hand::HandType Hand::getType() const
-{
-   return this->type;
-} // end Card::getType
-
-//***************************************************************************
-// Function : hasPairs                                 
-// Process  : Determines if the hand has pairs      
-//                Used for optimized hand ranking            
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline bool Hand::hasPairs() const
-{
-   bool hasPairs = false;
-
-   if (this->pairs.size() > 0)
-   {
-      hasPairs = true;
-   }
-
-   return hasPairs;
-} // end Card::hasPairs
-
-//***************************************************************************
-// Function : hasQuads                                 
-// Process  : Determines if the hand has quads        
-//                Used for optimized hand ranking          
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline bool Hand::hasQuads() const
-{
-   bool hasQuads = false;
-
-   if (this->quads.size() > 0)
-   {
-      hasQuads = true;
-   }
-
-   return hasQuads;
-} // end Card::hasQuads
-
-//***************************************************************************
-// Function : hasTrips                                 
-// Process  : Determines if the hand has trips      
-//                Used for optimized hand ranking           
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline bool Hand::hasTrips() const
-{
-   bool hasTrips = false;
-
-   if (this->trips.size() > 0)
-   {
-      hasTrips = true;
-   }
-
-   return hasTrips;
-} // end Card::hasTrips
-
-//***************************************************************************
-// Function : hasSingles                                 
-// Process  : Determines if the hand has singles     
-//                Used for optimized hand ranking           
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline bool Hand::hasSingles() const
-{
-   bool hasSingles = false;
-
-   if (this->singles.size() > 0)
-   {
-      hasSingles = true;
-   }
-
-   return hasSingles;
-} // end Card::hasSingles
-
-//***************************************************************************
-// Function : isValidCardIndex                                 
-// Process  : Determine if the card index is valid (within range)
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline bool Hand::isValidCardIndex(const int index) const
-{
-   bool isValid = false;   // determines if the card is valid
-
-   if (index < Hand::MAXCARDS) 
-   {
-      isValid = true;
-   }
-
-   return isValid;
-} // end Card::isValidCardIndex
-
-//***************************************************************************
-// Function : setCards                                
-// Process  : Mutator for cards
-//             Optionally sorts the cards (default to true)
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::setCards(const vector<Card>& cards, bool sort)
-{
-   this->cards = cards;
-
-   if (sort)
-   {
-      this->sortCards();
-   }
-} // end Card::setCards
-  
-//***************************************************************************
-// Function : setType                                 
-// Process  : Mutator for type               
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::setType(Hand::HandType type)
-{
-   this->type = type;
-} // end Card::setType
-      
-//***************************************************************************
-// Function : sortCards                                   
-// Process  : Cards utility function
-//             Sort the cards based on their CardNumber (low to high)  
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::sortCards()
-{
-   sort(this->cards.begin(), this->cards.end());
-} // end Card::sortCards
-
-//***************************************************************************
-// Function : sortPairs                                   
-// Process  : Sort the list of pairs   
-//                Used for optimized hand ranking               
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::sortPairs()
-{
-   sort(this->pairs.begin(), this->pairs.end());
-} // end Card::sortPairs
-
-//***************************************************************************
-// Function : sortQuads                                   
-// Process  : Sort the list of pairs   
-//                Used for optimized hand ranking             
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::sortQuads()
-{
-   sort(this->quads.begin(), this->quads.end());
-} // end Card::sortQuads
-
-//***************************************************************************
-// Function : sortSingles                                   
-// Process  : Sort the list of pairs   
-//                Used for optimized hand ranking               
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::sortSingles()
-{
-   sort(this->singles.begin(), this->singles.end());
-} // end Card::sortSingles
-
-//***************************************************************************
-// Function : sortTrips                                   
-// Process  : Sort the list of pairs   
-//                Used for optimized hand ranking               
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void Hand::sortTrips()
-{
-   sort(this->trips.begin(), this->trips.end());
-} // end Card::sortTrips
-
+//******************************************************************************
+//
+// File Name:     Hand.h
+//
+// File Overview: Represents a Hand containing five cards
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added class
+// 10.17.26       Donne Martin         Added hand value
+// 10.17.26       Donne Martin         Store cards and repetitions inline
+// 10.18.26       Donne Martin         Print hands to a stream
+// 10.18.26       Donne Martin         Added type names
+//******************************************************************************
+
+#ifndef Hand_h
+#define Hand_h
+
+#include <type_traits>
+#include <vector>
+#include "Card.h"
+#include "PackedCard.h"
+
+//******************************************************************************
+//
+// Class:    Hand
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added class 
+// 10.17.26       Donne Martin         Store cards and repetitions inline
+// 10.18.26       Donne Martin         Print hands to a stream
+// 10.18.26       Donne Martin         Added type names
+//
+// Notes    : Holds no pointers and has no virtual destructor so it is
+//             trivially copyable, copying a hand is a memcpy and vectors
+//             of hands are contiguous
+//
+//******************************************************************************
+class Hand
+{
+public:
+
+   // Forward declaration for Hand enums used in member function params
+   enum CardRepetition;
+   enum HandType;
+      
+   //***************************************************************************
+   // Function    : constructor                                   
+   // Description : None        
+   //                Not the recommended constructor        
+   // Constraints : Need to set cards afterwards
+   //***************************************************************************
+   Hand();
+   
+   //***************************************************************************
+   // Function    : constructor                                   
+   // Description : Initializes data members to input cards          
+   //                Recommended constructor        
+   // Constraints : None
+   //***************************************************************************
+   Hand(
+      Card card0,
+      Card card1,
+      Card card2,
+      Card card3,
+      Card card4);
+
+   // Member functions in alphabetical order
+               
+   //***************************************************************************
+   // Function    : addToPairs                                   
+   // Description : Adds the number to the list of pairs
+   //                Used for optimized hand ranking
+   // Constraints : None
+   //***************************************************************************
+   inline void addToPairs(const Card::CardNumber cardNumber);
+
+   //***************************************************************************
+   // Function    : addToQuads                                   
+   // Description : Adds the number to the list of quads
+   //                Used for optimized hand ranking          
+   // Constraints : None
+   //***************************************************************************
+   inline void addToQuads(const Card::CardNumber cardNumber);
+
+   //***************************************************************************
+   // Function    : addToSingles                                   
+   // Description : Adds the number to the list of singles
+   //                Used for optimized hand ranking         
+   // Constraints : None
+   //***************************************************************************
+   inline void addToSingles(const Card::CardNumber cardNumber);
+
+   //***************************************************************************
+   // Function    : addToTrips                                   
+   // Description : Adds the number to the list of trips
+   //                Used for optimized hand ranking           
+   // Constraints : None
+   //***************************************************************************
+   inline void addToTrips(const Card::CardNumber cardNumber);
+
+   //***************************************************************************
+   // Function    : getCard                                
+   // Description : Accessor for cards
+   //                Does not check if index is valid
+   // Constraints : index must be valid
+   //***************************************************************************
+   inline void getCard(
+      const int index, 
+      Card& card) const;
+   
+   //***************************************************************************
+   // Function    : getCardNumber                                   
+   // Description : Accessor for card number     
+   //                Checks index for validity
+   // Constraints : None
+   //***************************************************************************
+   inline Card::CardNumber getCardNumber(const int index) const;
+
+   //***************************************************************************
+   // Function    : getCards                                
+   // Description : Accessor for cards
+   // Constraints : None
+   //***************************************************************************
+   inline void getCards(vector<Card>& cards) const;
+
+   //***************************************************************************
+   // Function    : getPackedCard                                
+   // Description : Accessor for the packed card
+   //                Does not check if index is valid
+   // Constraints : index must be valid
+   //***************************************************************************
+   inline PackedCard getPackedCard(const int index) const;
+
+   //***************************************************************************
+   // Function    : getPackedCards                                
+   // Description : Accessor for the packed cards
+   // Constraints : cards must hold MAXCARDS cards
+   //***************************************************************************
+   inline void getPackedCards(PackedCard cards[]) const;
+      
+   //***************************************************************************
+   // Function    : getCardSafe                                
+   // Description : Accessor for cards, verifies index is valid
+   //                Checks if index is valid, return success, update card param
+   // Constraints : None
+   //***************************************************************************
+   bool Hand::getCardSafe(
+      const int index, 
+      Card& card) const;
+   
+   //***************************************************************************
+   // Function    : getCardSuit                                   
+   // Description : Get the card suit associated with the card
+   //                Checks index for validity         
+   // Constraints : None
+   //***************************************************************************
+   inline Card::CardSuit getCardSuit(const int index) const;
+      
+   //***************************************************************************
+   // Function    : getRepetition                                   
+   // Description : Accessor for the lists of repetitions (singles, pairs, 
+   //                trips, quads), lists are sorted low to high
+   //                Used for optimized hand ranking           
+   // Constraints : index must be less than getRepetitionCount
+   //***************************************************************************
+   inline Card::CardNumber getRepetition(
+      const Hand::CardRepetition repetition,
+      const int index) const;
+
+   //***************************************************************************
+   // Function    : getRepetitionCount                                   
+   // Description : Accessor for the size of a list of repetitions
+   //                Used for optimized hand ranking           
+   // Constraints : None
+   //***************************************************************************
+   inline int getRepetitionCount(const Hand::CardRepetition repetition) const;
+   
+   //***************************************************************************
+   // Function    : getType                                 
+   // Description : Accessor for type              
+   // Constraints : None
+   //***************************************************************************
+   inline Hand::HandType getType() const;
+
+   //***************************************************************************
+   // Function    : getTypeName
+   // Description : Returns the name of the hand type, such as "ONEPAIR"
+   // Constraints : Throws an exception if the type is out of range
+   //***************************************************************************
+   static const char* getTypeName(const Hand::HandType type);
+
+   //***************************************************************************
+   // Function    : getValue                                 
+   // Description : Accessor for value, a larger value is a stronger hand
+   //                Two hands compare with a single integer comparison
+   // Constraints : None
+   //***************************************************************************
+   inline int getValue() const;
+
+   //***************************************************************************
+   // Function    : hasPairs                                 
+   // Description : Determines if the hand has pairs      
+   //                Used for optimized hand ranking               
+   // Constraints : None
+   //***************************************************************************
+   inline bool hasPairs() const;
+
+   //***************************************************************************
+   // Function    : hasQuads                                 
+   // Description : Determines if the hand has quads      
+   //                Used for optimized hand ranking               
+   // Constraints : None
+   //***************************************************************************
+   inline bool hasQuads() const;
+
+   //***************************************************************************
+   // Function    : hasTrips                                 
+   // Description : Determines if the hand has trips      
+   //                Used for optimized hand ranking               
+   // Constraints : None
+   //***************************************************************************
+   inline bool hasTrips() const;
+
+   //***************************************************************************
+   // Function    : hasSingles                                 
+   // Description : Determines if the hand has singles      
+   //                Used for optimized hand ranking               
+   // Constraints : None
+   //***************************************************************************
+   inline bool hasSingles() const;
+
+   //***************************************************************************
+   // Function    : clearRepetitions                                 
+   // Description : Empties the lists of repetitions
+   //                Used for optimized hand ranking               
+   // Constraints : None
+   //***************************************************************************
+   inline void clearRepetitions();
+
+   //***************************************************************************
+   // Function    : isValidCardIndex                                 
+   // Description : Determines if the card index is valid (within range)
+   // Constraints : None
+   //***************************************************************************
+   inline bool isValidCardIndex(const int index) const;
+
+   //***************************************************************************
+   // Function    : printHand                                 
+   // Description : Prints each card in the hand to the stream
+   //                Prints the hand type
+   // Constraints : None
+   //***************************************************************************
+   void printHand(ostream& out) const;
+   
+   //***************************************************************************
+   // Function    : printType                                 
+   // Description : Prints the hand type (straight flush, full house, etc)
+   //                to the stream
+   // Constraints : None
+   //***************************************************************************
+   void Hand::printType(ostream& out) const;
+
+   //***************************************************************************
+   // Function    : setCards                                
+   // Description : Mutator for cards
+   //                Optionally sorts cards
+   // Constraints : None
+   //***************************************************************************
+   inline void setCards(const vector<Card>& cards, bool sort = true);
+
+   //***************************************************************************
+   // Function    : setPackedCards                                
+   // Description : Mutator for cards from packed cards
+   //                Optionally sorts cards
+   // Constraints : cards must hold MAXCARDS cards
+   //***************************************************************************
+   inline void setPackedCards(const PackedCard cards[], bool sort = true);
+   
+   //***************************************************************************
+   // Function    : setType                                   
+   // Description : Mutator for type             
+   // Constraints : None
+   //***************************************************************************
+   inline void setType(Hand::HandType type);
+
+   //***************************************************************************
+   // Function    : setValue                                   
+   // Description : Mutator for value             
+   // Constraints : None
+   //***************************************************************************
+   inline void setValue(const int value);
+
+   //***************************************************************************
+   // Function    : sortCards                                   
+   // Description : Cards utility function
+   //                Sorts the cards based on their CardNumber (high to low)
+   // Constraints : None
+   //***************************************************************************
+   inline void sortCards();
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+      
+   // Represents the card's hand index from 0 to 4, max 5 cards
+   enum CardIndex
+   {
+      FIRSTCARDINDEX,
+      SECONDCARDINDEX,
+      THIRDCARDINDEX,
+      FOURTHCARDINDEX,
+      FIFTHCARDINDEX,
+      MAXCARDS
+   };
+   
+   // Represents the number of times a card appears in the hand
+   enum CardRepetition
+   {
+      SINGLES = 1,
+      PAIRS,
+      TRIPS,
+      QUADS
+   };
+
+   // Represents the hand type (poker hands)
+   enum HandType
+   {
+      INVALIDHAND,
+      HIGHCARD,
+      ONEPAIR,
+      TWOPAIR,
+      THREEOFAKIND,
+      STRAIGHT,
+      FLUSH,
+      FULLHOUSE,
+      FOUROFAKIND,
+      STRAIGHTFLUSH
+   };
+   
+private:   
+
+   //***************************************************************************
+   // Function    : addToRepetitions                                   
+   // Description : Adds the number to the list of repetitions
+   //                Used for optimized hand ranking
+   // Constraints : The list must not be full
+   //***************************************************************************
+   inline void addToRepetitions(
+      const Hand::CardRepetition repetition,
+      const Card::CardNumber     cardNumber);
+
+   PackedCard     cards[MAXCARDS];  // List of cards
+   HandType       type;             // Hand type (poker hands)
+   int            value;            // Hand value, larger is stronger
+   
+   // The following data members are used for optimized hand ranking  
+   // Lists of singles, pairs, trips and quads indexed by CardRepetition
+   unsigned char  numRepetitions[QUADS + 1];
+   unsigned char  repetitions[QUADS + 1][MAXCARDS];
+}; // end class Hand
+
+static_assert(is_trivially_copyable<Hand>::value,
+              "Hand must be trivially copyable");
+      
+//***************************************************************************
+// Function : addToPairs                                   
+// Process  : Add the number to the list of pairs
+//                Used for optimized hand ranking          
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void Hand::addToPairs(const Card::CardNumber cardNumber)
+{
+   this->addToRepetitions(Hand::PAIRS, cardNumber);
+} // end Card::addToPairs
+
+//***************************************************************************
+// Function : addToQuads                                   
+// Process  : Add the number to the list of quads
+//                Used for optimized hand ranking            
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void Hand::addToQuads(const Card::CardNumber cardNumber)
+{
+   this->addToRepetitions(Hand::QUADS, cardNumber);
+} // end Card::addToQuads
+
+//***************************************************************************
+// Function : addToSingles                                   
+// Process  : Add the number to the list of singles
+//                Used for optimized hand ranking                    
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void Hand::addToSingles(const Card::CardNumber cardNumber)
+{
+   this->addToRepetitions(Hand::SINGLES, cardNumber);
+} // end Card::addToSingles
+
+//***************************************************************************
+// Function : addToTrips                                   
+// Process  : Add the number to the list of trips
+//                Used for optimized hand ranking               
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void Hand::addToTrips(const Card::CardNumber cardNumber)
+{
+   this->addToRepetitions(Hand::TRIPS, cardNumber);
+} // end Card::addToTrips
+
+//***************************************************************************
+// Function : addToRepetitions                                   
+// Process  : Add the number to the end of the list of repetitions
+//                Used for optimized hand ranking               
+// Notes    : Private
+//             The list must not be full
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline void Hand::addToRepetitions(
+   const Hand::CardRepetition repetition,
+   const Card::CardNumber     cardNumber)
+{
+   int size = this->numRepetitions[repetition]; // Current size of the list
+
+   this->repetitions[repetition][size] = static_cast<unsigned char>(cardNumber);
+   this->numRepetitions[repetition]    = static_cast<unsigned char>(size + 1);
+} // end Hand::addToRepetitions
+
+//***************************************************************************
+// Function : getCard                                
+// Process  : Accessor for cards
+//                Does not check if index
+// Notes    : index must be valid
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void Hand::getCard(
+   const int index, 
+   Card& card) const
+{
+   card = this->cards[index].toCard();
+} // end Card::getCard
+
+//***************************************************************************
+// Function : getCardNumber                                   
+// Process  : Get the card number associated with the card
+//             Checks index for validity
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline Card::CardNumber Hand::getCardNumber(const int index) const
+{
+   Card card;
+   this->getCardSafe(index, card);
+
+   return card.getNumber();
+} // end Card::getCardNumber
+
+//***************************************************************************
+// Function : getCards                                
+// Process  : Accessor for cards
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void Hand::getCards(vector<Card>& card) const
+{
+   card.clear();
+
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      card.push_back(this->cards[cardIndex].toCard());
+   }
+} // end Card::getCards
+
+//***************************************************************************
+// Function : getCardSuit                                   
+// Process  : Get the card suit associated with the card
+//             Checks index for validity
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline Card::CardSuit Hand::getCardSuit(const int index) const
+{
+   Card card;
+   this->getCardSafe(index, card);
+
+   return card.getSuit();
+} // end Card::getCardSuit
+
+//***************************************************************************
+// Function : getPackedCard                                
+// Process  : Accessor for the packed card
+//                Does not check if index is valid
+// Notes    : index must be valid
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline PackedCard Hand::getPackedCard(const int index) const
+{
+   return this->cards[index];
+} // end Hand::getPackedCard
+
+//***************************************************************************
+// Function : getPackedCards                                
+// Process  : Accessor for the packed cards
+// Notes    : cards must hold MAXCARDS cards
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline void Hand::getPackedCards(PackedCard cards[]) const
+{
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      cards[cardIndex] = this->cards[cardIndex];
+   }
+} // end Hand::getPackedCards
+
+//***************************************************************************
+// Function : getRepetition                                   
+// Process  : Accessor for the lists of repetitions
+//                Used for optimized hand ranking              
+// Notes    : index must be less than getRepetitionCount
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline Card::CardNumber Hand::getRepetition(
+   const Hand::CardRepetition repetition,
+   const int index) const
+{
+   return static_cast<Card::CardNumber>(this->repetitions[repetition][index]);
+} // end Hand::getRepetition
+
+//***************************************************************************
+// Function : getRepetitionCount                                   
+// Process  : Accessor for the size of a list of repetitions
+//                Used for optimized hand ranking              
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline int Hand::getRepetitionCount(const Hand::CardRepetition repetition) const
+{
+   return this->numRepetitions[repetition];
+} // end Hand::getRepetitionCount
+
+//***************************************************************************
+// Function : getType                                 
+// Process  : Accessor for type               
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline Hand::HandType Hand::getType() const
+{
+   return this->type;
+} // end Card::getType
+
+//***************************************************************************
+// Function : getValue                                 
+// Process  : Accessor for value               
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline int Hand::getValue() const
+{
+   return this->value;
+} // end Hand::getValue
+
+//***************************************************************************
+// Function : hasPairs                                 
+// Process  : Determines if the hand has pairs      
+//                Used for optimized hand ranking            
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline bool Hand::hasPairs() const
+{
+   bool hasPairs = false;
+
+   if (this->numRepetitions[Hand::PAIRS] > 0)
+   {
+      hasPairs = true;
+   }
+
+   return hasPairs;
+} // end Card::hasPairs
+
+//***************************************************************************
+// Function : hasQuads                                 
+// Process  : Determines if the hand has quads        
+//                Used for optimized hand ranking          
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline bool Hand::hasQuads() const
+{
+   bool hasQuads = false;
+
+   if (this->numRepetitions[Hand::QUADS] > 0)
+   {
+      hasQuads = true;
+   }
+
+   return hasQuads;
+} // end Card::hasQuads
+
+//***************************************************************************
+// Function : hasTrips                                 
+// Process  : Determines if the hand has trips      
+//                Used for optimized hand ranking           
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline bool Hand::hasTrips() const
+{
+   bool hasTrips = false;
+
+   if (this->numRepetitions[Hand::TRIPS] > 0)
+   {
+      hasTrips = true;
+   }
+
+   return hasTrips;
+} // end Card::hasTrips
+
+//***************************************************************************
+// Function : hasSingles                                 
+// Process  : Determines if the hand has singles     
+//                Used for optimized hand ranking           
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline bool Hand::hasSingles() const
+{
+   bool hasSingles = false;
+
+   if (this->numRepetitions[Hand::SINGLES] > 0)
+   {
+      hasSingles = true;
+   }
+
+   return hasSingles;
+} // end Card::hasSingles
+
+//***************************************************************************
+// Function : clearRepetitions                                 
+// Process  : Empty the lists of repetitions
+//                Used for optimized hand ranking           
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline void Hand::clearRepetitions()
+{
+   for (int repetition = 0; repetition <= Hand::QUADS; ++repetition)
+   {
+      this->numRepetitions[repetition] = 0;
+   }
+} // end Hand::clearRepetitions
+
+//***************************************************************************
+// Function : isValidCardIndex                                 
+// Process  : Determine if the card index is valid (within range)
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline bool Hand::isValidCardIndex(const int index) const
+{
+   bool isValid = false;   // determines if the card is valid
+
+   if (index < Hand::MAXCARDS) 
+   {
+      isValid = true;
+   }
+
+   return isValid;
+} // end Card::isValidCardIndex
+
+//***************************************************************************
+// Function : setCards                                
+// Process  : Mutator for cards
+//             Optionally sorts the cards (default to true)
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void Hand::setCards(const vector<Card>& cards, bool sort)
+{
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      this->cards[cardIndex] = PackedCard(cards[cardIndex]);
+   }
+
+   if (sort)
+   {
+      this->sortCards();
+   }
+} // end Card::setCards
+
+//***************************************************************************
+// Function : setPackedCards                                
+// Process  : Mutator for cards from packed cards
+//             Optionally sorts the cards (default to true)
+// Notes    : cards must hold MAXCARDS cards
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline void Hand::setPackedCards(const PackedCard cards[], bool sort)
+{
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      this->cards[cardIndex] = cards[cardIndex];
+   }
+
+   if (sort)
+   {
+      this->sortCards();
+   }
+} // end Hand::setPackedCards
+  
+//***************************************************************************
+// Function : setType                                 
+// Process  : Mutator for type               
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void Hand::setType(Hand::HandType type)
+{
+   this->type = type;
+} // end Card::setType
+
+//***************************************************************************
+// Function : setValue                                 
+// Process  : Mutator for value               
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline void Hand::setValue(const int value)
+{
+   this->value = value;
+} // end Hand::setValue
+      
+//***************************************************************************
+// Function : sortCards                                   
+// Process  : Cards utility function
+//             Sort the cards based on their CardNumber (high to low)  
+//             Insertion sort, five cards do not need a general sort and
+//             cards with the same number keep their order
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+// 10.17.26       Donne Martin         Sort the packed cards in place
+//***************************************************************************
+inline void Hand::sortCards()
+{
+   for (int cardIndex = 1; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      PackedCard  card      = this->cards[cardIndex];  // Card to insert
+      int         insertAt  = cardIndex;               // Insert position
+
+      while (insertAt > 0 && 
+             this->cards[insertAt - 1].getRank() < card.getRank())
+      {
+         this->cards[insertAt] = this->cards[insertAt - 1];
+         --insertAt;
+      }
+
+      this->cards[insertAt] = card;
+   }
+} // end Card::sortCards
+
 #endif // Hand_h
\ No newline at end of file
@@ -0,0 +1,691 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     HandEvaluator.cpp
+//
+// File Overview: Represents a table-driven Hand Evaluator to rank a hand
+//                of cards with a handful of lookups and no allocations
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added class
+// 10.17.26       Donne Martin         Added seven card evaluation
+// 10.17.26       Donne Martin         Added batch evaluation
+// 10.17.26       Donne Martin         Build the tables at compile time
+// 10.18.26       Donne Martin         Added getHighestValue
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+// 10.18.26       Donne Martin         Build the tables at startup
+// 10.18.26       Donne Martin         Generate the tables offline
+//******************************************************************************
+
+#include "stdafx.h"
+#include <cstring>
+#include <fstream>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include <string>
+#include <vector>
+#include "HandEvaluator.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// Values written on each line of a generated table
+static const int VALUESPERLINE = 8;
+
+// Rule of stars written in a generated banner, after the comment slashes
+static const string BANNERRULE(78, '*');
+
+//******************************************************************************
+// Function : writeValues
+// Process  : Write the values in braces at the indent, VALUESPERLINE to a
+//             line, then the text ending the braces
+// Notes    : Used by BasicHandEvaluator::generate
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class Value>
+static void writeValues(
+   ostream&       out,
+   const Value    values[],
+   const int      numValues,
+   const int      indent,
+   const char*    ending)
+{
+   out << string(indent, ' ') << "{\n";
+
+   for (int value = 0; value < numValues; ++value)
+   {
+      if (value % VALUESPERLINE == 0)
+      {
+         out << string(indent + 3, ' ');
+      }
+
+      out << values[value];
+
+      if (value < numValues - 1)
+      {
+         out << (value % VALUESPERLINE == VALUESPERLINE - 1 ? ",\n" : ", ");
+      }
+   }
+
+   out << "\n" << string(indent, ' ') << "}" << ending << "\n";
+} // end writeValues
+
+//******************************************************************************
+// Function : constructor
+// Process  : None, the lookup tables are constant data written by generate
+//             Check the policy ranks the hand types from the high cards to
+//             the straight flushes
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Tables are built at compile time
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+// 10.18.26       Donne Martin         Tables are built at startup
+// 10.18.26       Donne Martin         Tables are generated offline
+//******************************************************************************
+template <class RankingPolicy>
+BasicHandEvaluator<RankingPolicy>::BasicHandEvaluator()
+{
+   static_assert(getValueOffset(Hand::STRAIGHTFLUSH) + 
+                 getTypeCount(Hand::STRAIGHTFLUSH) == MAXVALUE,
+                 "The straight flushes must hold the highest hand values");
+   static_assert(getValueOffset(Hand::HIGHCARD) == INVALIDVALUE,
+                 "The high cards must hold the lowest hand values");
+} // end BasicHandEvaluator::BasicHandEvaluator
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+BasicHandEvaluator<RankingPolicy>::~BasicHandEvaluator()
+{
+} // end BasicHandEvaluator::~BasicHandEvaluator
+
+//******************************************************************************
+// Function : buildTables
+// Process  : Build the flush, unique, hashed, and sorted lookup tables
+//             Count the number of ways the remaining card numbers can add
+//                up to each number of cards
+//             Build the hash offsets from these counts so each count of
+//                card numbers hashes to its lexicographic index, after the
+//                hashes of fewer cards
+//             For each mask of five unique card numbers
+//                Store the flush and the unique hand values
+//             For each mask of six or more card numbers
+//                Store the best flush held in the mask
+//             Build the sorted offsets
+//             Store the hand value of every other count of card numbers
+//             Store the best hand value of every count of six to eight cards
+// Notes    : Private, the tables must be zeroed
+//             Used by generate and verifyTables
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Added seven card tables
+// 10.17.26       Donne Martin         Added the sorted offsets
+// 10.17.26       Donne Martin         Build the tables at compile time
+// 10.18.26       Donne Martin         Added six and eight card hashes
+// 10.18.26       Donne Martin         Build the tables at startup
+// 10.18.26       Donne Martin         Build the tables offline
+// 10.18.26       Donne Martin         Generate the tables offline
+//******************************************************************************
+template <class RankingPolicy>
+void BasicHandEvaluator<RankingPolicy>::buildTables(LookupTables& lookupTables)
+{
+   // Number of ways n card numbers can add up to each number of cards
+   int numWays[NUMRANKS + 1][MAXHASHCARDS + 1] = { { 0 } };
+   int counts[NUMRANKS]                        = { 0 };
+
+   numWays[0][0] = 1;
+
+   for (int numRanks = 1; numRanks <= NUMRANKS; ++numRanks)
+   {
+      for (int sum = 0; sum <= MAXHASHCARDS; ++sum)
+      {
+         for (int count = 0; count <= MAXREPETITION && count <= sum; ++count)
+         {
+            numWays[numRanks][sum] += numWays[numRanks - 1][sum - count];
+         }
+      }
+   }
+
+   // A count skips every hash of the lower counts at the same card number
+   for (int rank = 0; rank < NUMRANKS; ++rank)
+   {
+      for (int sum = 0; sum <= MAXHASHCARDS; ++sum)
+      {
+         int offset = 0;   // Hashes skipped by the lower counts
+
+         for (int count = 0; count <= MAXREPETITION; ++count)
+         {
+            lookupTables.hashOffsets[rank][count][sum] = offset;
+
+            if (count <= sum)
+            {
+               offset += numWays[NUMRANKS - rank - 1][sum - count];
+            }
+         }
+      }
+   }
+
+   // Every hash starts at the lowest card number, so its offsets skip the
+   // hashes of fewer cards
+   for (int sum = Hand::MAXCARDS + 1, section = 0; sum <= MAXHASHCARDS; ++sum)
+   {
+      section += numWays[NUMRANKS][sum - 1];
+
+      for (int count = 0; count <= MAXREPETITION; ++count)
+      {
+         lookupTables.hashOffsets[0][count][sum] += section;
+      }
+   }
+
+   for (int mask = 0; mask < NUMRANKMASKS; ++mask)
+   {
+      int numRanks = 0; // Number of card numbers in the mask
+
+      for (int rank = 0; rank < NUMRANKS; ++rank)
+      {
+         counts[rank] = (mask >> rank) & 1;
+         numRanks    += counts[rank];
+      }
+
+      if (numRanks == Hand::MAXCARDS)
+      {
+         lookupTables.flushTable[mask]  = 
+            static_cast<unsigned short>(computeValue(counts, true));
+         lookupTables.uniqueTable[mask] = 
+            static_cast<unsigned short>(computeValue(counts, false));
+      }
+   }
+
+   // Masks of five numbers are stored, so the best flush of a larger mask
+   // is the best flush stored for the masks with one number removed
+   // Masks only grow, so the smaller masks are already complete
+   for (int mask = 0; mask < NUMRANKMASKS; ++mask)
+   {
+      if (lookupTables.flushTable[mask] == INVALIDVALUE)
+      {
+         for (int rank = 0; rank < NUMRANKS; ++rank)
+         {
+            int subMask = mask & ~(1 << rank);  // Mask without the number
+
+            if (subMask != mask &&
+                lookupTables.flushTable[subMask] > 
+                   lookupTables.flushTable[mask])
+            {
+               lookupTables.flushTable[mask] = lookupTables.flushTable[subMask];
+            }
+         }
+      }
+   }
+
+   // The nth lowest of five sorted card numbers r skips every way to
+   // choose n numbers among r + n - 1, as if each number were one higher
+   // than the number before it
+   for (int position = 0; position < Hand::MAXCARDS; ++position)
+   {
+      for (int rank = 0; rank < NUMRANKS; ++rank)
+      {
+         int ways = 1;  // Ways to choose position + 1 of rank + position
+
+         for (int chosen = 0; chosen <= position; ++chosen)
+         {
+            ways = ways * (rank + position - chosen) / (chosen + 1);
+         }
+
+         lookupTables.sortedOffsets[position][rank] = ways;
+      }
+   }
+
+   for (int rank = 0; rank < NUMRANKS; ++rank)
+   {
+      counts[rank] = 0;
+   }
+
+   for (int numCards = Hand::MAXCARDS; numCards <= MAXHASHCARDS; ++numCards)
+   {
+      fillHashedTable(lookupTables, counts, 0, numCards, numCards);
+   }
+} // end BasicHandEvaluator::buildTables
+
+//******************************************************************************
+// Function : evaluateBatch
+// Process  : Evaluate many five card hands and write each hand value
+//             With AVX2, for each group of eight hands, one hand per lane
+//                Transpose the card indexes so each vector holds one card
+//                   of every hand
+//                Build the number and suit masks with variable shifts
+//                Sort the card numbers of every lane with a sorting network
+//                Gather the sorted offsets and sum them
+//                Gather the flush and sorted table values
+//                Blend flush and sorted values by lane
+//             Evaluate the remaining hands one at a time
+// Notes    : cards must hold numHands * MAXCARDS valid cards, hand after
+//             hand, values must hold numHands values
+//             Without AVX2 (/arch:AVX2 or -mavx2), every hand is evaluated
+//             one at a time
+//             The tables hold 16 bit values, the gathers read 32 bits at a
+//             16 bit scale and mask off the high half
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+//******************************************************************************
+template <class RankingPolicy>
+void BasicHandEvaluator<RankingPolicy>::evaluateBatch(
+   const PackedCard  cards[],
+   const int         numHands,
+   int               values[]) const
+{
+   int handIndex = 0;   // First hand not yet evaluated
+
+#if defined(__AVX2__)
+   // Pairs of positions compared by the five card sorting network
+   static const int SORTPAIRS[][2] =
+   {
+      { 0, 1 }, { 3, 4 }, { 2, 4 }, { 2, 3 }, { 0, 3 },
+      { 0, 2 }, { 1, 4 }, { 1, 3 }, { 1, 2 }
+   };
+
+   const __m256i  zero      = _mm256_setzero_si256();
+   const __m256i  one       = _mm256_set1_epi32(1);
+   const __m256i  suitBits  = _mm256_set1_epi32(NUMSUITS - 1);
+   const __m256i  lowHalf   = _mm256_set1_epi32(0xFFFF);
+   const __m256i  lowest    = _mm256_set1_epi32(LOWESTRANK);
+
+   // Card indexes transposed so each row holds one card of every hand
+   int indexes[Hand::MAXCARDS][BATCHLANES];
+
+   for (; handIndex + BATCHLANES <= numHands; handIndex += BATCHLANES)
+   {
+      const PackedCard* batch = cards + handIndex * Hand::MAXCARDS;
+
+      __m256i ranks[Hand::MAXCARDS];   // Card number of each card, from 0
+      __m256i rankMask    = zero;      // Bit set for each card number
+      __m256i suitMask    = zero;      // Bit set for each suit
+      __m256i sortedIndex = zero;      // Sum of the sorted offsets
+
+      for (int lane = 0; lane < BATCHLANES; ++lane)
+      {
+         for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+         {
+            indexes[cardIndex][lane] = 
+               batch[lane * Hand::MAXCARDS + cardIndex].getIndex();
+         }
+      }
+
+      for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+      {
+         __m256i index = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(indexes[cardIndex]));
+
+         ranks[cardIndex] = _mm256_sub_epi32(
+            _mm256_srli_epi32(index, 2), lowest);
+         rankMask = _mm256_or_si256(rankMask, 
+            _mm256_sllv_epi32(one, ranks[cardIndex]));
+         suitMask = _mm256_or_si256(suitMask, 
+            _mm256_sllv_epi32(one, _mm256_and_si256(index, suitBits)));
+      }
+
+      // Sort the card numbers of every lane low to high
+      for (int pair = 0; 
+           pair < static_cast<int>(sizeof(SORTPAIRS) / sizeof(SORTPAIRS[0])); 
+           ++pair)
+      {
+         __m256i low  = ranks[SORTPAIRS[pair][0]];
+         __m256i high = ranks[SORTPAIRS[pair][1]];
+
+         ranks[SORTPAIRS[pair][0]] = _mm256_min_epi32(low, high);
+         ranks[SORTPAIRS[pair][1]] = _mm256_max_epi32(low, high);
+      }
+
+      for (int position = 0; position < Hand::MAXCARDS; ++position)
+      {
+         sortedIndex = _mm256_add_epi32(sortedIndex, 
+            _mm256_i32gather_epi32(
+               BasicHandEvaluator::tables.sortedOffsets[position], 
+               ranks[position], 4));
+      }
+
+      // A single suit bit means every card has the same suit
+      __m256i isFlush = _mm256_cmpeq_epi32(zero, 
+         _mm256_and_si256(suitMask, _mm256_sub_epi32(suitMask, one)));
+
+      __m256i flushValues = _mm256_and_si256(lowHalf, 
+         _mm256_i32gather_epi32(
+            reinterpret_cast<const int*>(
+               BasicHandEvaluator::tables.flushTable), 
+            rankMask, 2));
+
+      __m256i sortedValues = _mm256_and_si256(lowHalf, 
+         _mm256_i32gather_epi32(
+            reinterpret_cast<const int*>(
+               BasicHandEvaluator::tables.sortedTable), 
+            sortedIndex, 2));
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + handIndex), 
+         _mm256_blendv_epi8(sortedValues, flushValues, isFlush));
+   }
+#endif
+
+   for (; handIndex < numHands; ++handIndex)
+   {
+      values[handIndex] = this->evaluate(cards + handIndex * Hand::MAXCARDS);
+   }
+} // end BasicHandEvaluator::evaluateBatch
+
+//******************************************************************************
+// Function : fillHashedTable
+// Process  : Recursively enumerate every count of card numbers that adds up
+//             to numCards and store its hand value
+//             Once every card number has a count, if every card is
+//             accounted for
+//                Store the hand value of five cards, by hashRanks and
+//                by the sorted card numbers
+//                Store the best five card hand value of six to eight cards
+//             Else, try each count for the current card number
+// Notes    : Private, called by buildTables
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Added seven card tables
+// 10.17.26       Donne Martin         Added the sorted table
+// 10.17.26       Donne Martin         Compute seven cards directly
+// 10.18.26       Donne Martin         Added six and eight cards
+// 10.18.26       Donne Martin         Build the tables at startup
+// 10.18.26       Donne Martin         Build the tables offline
+// 10.18.26       Donne Martin         Generate the tables offline
+//******************************************************************************
+template <class RankingPolicy>
+void BasicHandEvaluator<RankingPolicy>::fillHashedTable(
+   LookupTables&  lookupTables,
+   int            counts[],
+   const int      rank,
+   const int      remaining,
+   const int      numCards)
+{
+   if (rank == NUMRANKS)
+   {
+      if (remaining == 0)
+      {
+         unsigned char hashCounts[NUMRANKS] = { 0 }; // Counts, hashed form
+
+         for (int hashRank = 0; hashRank < NUMRANKS; ++hashRank)
+         {
+            hashCounts[hashRank] = static_cast<unsigned char>(counts[hashRank]);
+         }
+
+         int hash = lookupTables.hashRanks(hashCounts, numCards);
+
+         if (numCards == Hand::MAXCARDS)
+         {
+            int value       = computeValue(counts, false);
+            int sortedIndex = 0;    // Sum of the sorted offsets
+            int position    = 0;    // Position among the sorted numbers
+
+            for (int hashRank = 0; hashRank < NUMRANKS; ++hashRank)
+            {
+               for (int count = 0; count < counts[hashRank]; ++count)
+               {
+                  sortedIndex += 
+                     lookupTables.sortedOffsets[position++][hashRank];
+               }
+            }
+
+            lookupTables.hashedTable[hash]        = 
+               static_cast<unsigned short>(value);
+            lookupTables.sortedTable[sortedIndex] = 
+               static_cast<unsigned short>(value);
+         }
+         else
+         {
+            lookupTables.hashedTable[hash] = 
+               static_cast<unsigned short>(computeBestValue(counts));
+         }
+      }
+   }
+   else
+   {
+      for (int count = 0;
+           count <= MAXREPETITION && count <= remaining;
+           ++count)
+      {
+         counts[rank] = count;
+         fillHashedTable(lookupTables, 
+                         counts, 
+                         rank + 1, 
+                         remaining - count, 
+                         numCards);
+      }
+
+      counts[rank] = 0;
+   }
+} // end BasicHandEvaluator::fillHashedTable
+
+//******************************************************************************
+// Function : generate
+// Process  : Build the lookup tables
+//             Write the banner of the source file, then the definition of
+//                the tables of evaluatorName, each table in the order of
+//                LookupTables
+// Notes    : Throws an exception if the file cannot be written
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+void BasicHandEvaluator<RankingPolicy>::generate(
+   const char* fileName,
+   const char* evaluatorName)
+{
+   vector<LookupTables> built(1);  // Zeroed tables to build
+   ofstream             file;
+
+   buildTables(built[0]);
+
+   file.open(fileName, ios::out | ios::trunc);
+
+   file << "// COPYRIGHT \xA9 2011, Donne Martin\n"
+        << "// All Rights Reserved.\n"
+        << "//\n"
+        << "//" << BANNERRULE << "\n"
+        << "//\n"
+        << "// File Name:     " << evaluatorName << "Tables.cpp\n"
+        << "//\n"
+        << "// File Overview: Lookup tables of the " << evaluatorName 
+        << ", written by\n"
+        << "//                " << evaluatorName 
+        << "::generate, do not edit\n"
+        << "//\n"
+        << "//" << BANNERRULE << "\n"
+        << "\n"
+        << "#include \"stdafx.h\"\n"
+        << "#include \"HandEvaluator.h\"\n"
+        << "\n"
+        << "template <>\n"
+        << "const " << evaluatorName << "::LookupTables " 
+        << evaluatorName << "::tables =\n"
+        << "{\n";
+
+   writeValues(file, built[0].flushTable, NUMRANKMASKS, 3, ",");
+   writeValues(file, built[0].uniqueTable, NUMRANKMASKS, 3, ",");
+   writeValues(file, built[0].hashedTable, NUMHASHES, 3, ",");
+
+   file << "   {\n";
+
+   for (int rank = 0; rank < NUMRANKS; ++rank)
+   {
+      file << "      {\n";
+
+      for (int count = 0; count <= MAXREPETITION; ++count)
+      {
+         writeValues(file, 
+                     built[0].hashOffsets[rank][count], 
+                     MAXHASHCARDS + 1, 
+                     9, 
+                     count < MAXREPETITION ? "," : "");
+      }
+
+      file << "      }" << (rank < NUMRANKS - 1 ? "," : "") << "\n";
+   }
+
+   file << "   },\n";
+
+   writeValues(file, 
+               built[0].sortedTable, 
+               NUMSORTEDINDEXES + GATHERPADDING, 
+               3, 
+               ",");
+
+   file << "   {\n";
+
+   for (int position = 0; position < Hand::MAXCARDS; ++position)
+   {
+      writeValues(file, 
+                  built[0].sortedOffsets[position], 
+                  NUMRANKS, 
+                  6, 
+                  position < Hand::MAXCARDS - 1 ? "," : "");
+   }
+
+   file << "   }\n"
+        << "};\n";
+
+   if (!file)
+   {
+      throw exception("Unable to write file in BasicHandEvaluator::generate");
+   }
+} // end BasicHandEvaluator::generate
+
+//******************************************************************************
+// Function : getHandType
+// Process  : Determine the hand type (straight, flush, etc) of the hand value
+//             Find the hand type whose range of values holds the value
+// Notes    : Returns INVALIDHAND if the value is out of range
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+//******************************************************************************
+template <class RankingPolicy>
+Hand::HandType BasicHandEvaluator<RankingPolicy>::getHandType(
+   const int value) const
+{
+   Hand::HandType type      = Hand::INVALIDHAND;
+   Hand::HandType candidate = Hand::INVALIDHAND;   // Hand type being tried
+
+   if (value >= MINVALUE && value <= MAXVALUE)
+   {
+      for (int typeIndex = Hand::HIGHCARD; 
+           typeIndex <= Hand::STRAIGHTFLUSH; 
+           ++typeIndex)
+      {
+         candidate = static_cast<Hand::HandType>(typeIndex);
+
+         if (value >  getValueOffset(candidate) &&
+             value <= getValueOffset(candidate) + getTypeCount(candidate))
+         {
+            type = candidate;
+         }
+      }
+   }
+
+   return type;
+} // end BasicHandEvaluator::getHandType
+
+//******************************************************************************
+// Function : getHighestValue
+// Process  : Return the highest hand value of the hand type, its number of
+//             hand values above the hand types ranked below it
+// Notes    : Returns INVALIDVALUE for INVALIDHAND
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+//******************************************************************************
+template <class RankingPolicy>
+int BasicHandEvaluator<RankingPolicy>::getHighestValue(
+   const Hand::HandType type) const
+{
+   return getValueOffset(type) + getTypeCount(type);
+} // end BasicHandEvaluator::getHighestValue
+
+//******************************************************************************
+// Function : verifyTables
+// Process  : Build the lookup tables
+//             Compare each table with the table written by generate
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+bool BasicHandEvaluator<RankingPolicy>::verifyTables()
+{
+   vector<LookupTables> built(1);  // Zeroed tables to build
+
+   buildTables(built[0]);
+
+   return memcmp(built[0].flushTable, 
+                 tables.flushTable, 
+                 sizeof(tables.flushTable)) == 0 &&
+          memcmp(built[0].uniqueTable, 
+                 tables.uniqueTable, 
+                 sizeof(tables.uniqueTable)) == 0 &&
+          memcmp(built[0].hashedTable, 
+                 tables.hashedTable, 
+                 sizeof(tables.hashedTable)) == 0 &&
+          memcmp(built[0].hashOffsets, 
+                 tables.hashOffsets, 
+                 sizeof(tables.hashOffsets)) == 0 &&
+          memcmp(built[0].sortedTable, 
+                 tables.sortedTable, 
+                 sizeof(tables.sortedTable)) == 0 &&
+          memcmp(built[0].sortedOffsets, 
+                 tables.sortedOffsets, 
+                 sizeof(tables.sortedOffsets)) == 0;
+} // end BasicHandEvaluator::verifyTables
+
+//******************************************************************************
+// Explicit instantiations, the evaluator of each ranking policy
+//******************************************************************************
+
+template class BasicHandEvaluator<StandardRanking>;
+template class BasicHandEvaluator<ShortDeckRanking>;
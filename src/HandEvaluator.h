@@ -0,0 +1,1541 @@
+//******************************************************************************
+//
+// File Name:     HandEvaluator.h
+//
+// File Overview: Represents a table-driven Hand Evaluator to rank a hand
+//                of cards with a handful of lookups and no allocations
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added class
+// 10.17.26       Donne Martin         Added seven card evaluation
+// 10.17.26       Donne Martin         Evaluate packed cards
+// 10.17.26       Donne Martin         Evaluate card sets
+// 10.17.26       Donne Martin         Added batch evaluation
+// 10.17.26       Donne Martin         Build the tables at compile time
+// 10.18.26       Donne Martin         Added getHighestValue
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+// 10.18.26       Donne Martin         Added best of five to eight cards
+// 10.18.26       Donne Martin         Build the tables at startup
+// 10.18.26       Donne Martin         Generate the tables offline
+//******************************************************************************
+
+#ifndef HandEvaluator_h
+#define HandEvaluator_h
+
+#include "CardSet.h"
+#include "Hand.h"
+#include "PackedCard.h"
+#include "RankingPolicy.h"
+
+//******************************************************************************
+//
+// Class:    BasicHandEvaluator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added class
+// 10.17.26       Donne Martin         Added seven card evaluation
+// 10.17.26       Donne Martin         Evaluate packed cards
+// 10.17.26       Donne Martin         Evaluate card sets
+// 10.17.26       Donne Martin         Added batch evaluation
+// 10.17.26       Donne Martin         Build the tables at compile time
+// 10.18.26       Donne Martin         Added getHighestValue
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+// 10.18.26       Donne Martin         Added best of five to eight cards
+// 10.18.26       Donne Martin         Build the tables at startup
+// 10.18.26       Donne Martin         Generate the tables offline
+//
+// Notes    : The RankingPolicy (see RankingPolicy.h) gives the card numbers
+//             of the deck and the order of the hand types, so each deck
+//             gets its own fully specialized evaluator and tables sized for
+//             its card numbers.  HandEvaluator is the standard evaluator and
+//             ShortDeckEvaluator the short deck (6+) evaluator.
+//             Hand values are dense, from 1 (7 5 4 3 2 high card) to 7462
+//             (royal flush) for the standard deck, from 1 (9 8 7 6 J high
+//             card) to 1404 (royal flush) for the short deck.  A larger
+//             value is always a stronger hand.
+//             Six, seven, or eight cards are valued as the best five card
+//             hand they hold, with one hash of the count of each card
+//             number rather than trying every five card hand.  Cards can be
+//             added to an Accumulator one at a time, so a shared board is
+//             counted once and copied for each player.
+//             The lookup tables are shared by every evaluator.  They are
+//             written offline by generate into HandEvaluatorTables.cpp and
+//             ShortDeckEvaluatorTables.cpp as constant data, so the program
+//             builds no table when it starts and there is no first call
+//             race or static initialization order to depend on.
+//             verifyTables, run by -selftest, checks the written tables
+//             against the tables built from the hand values.
+//
+//******************************************************************************
+template <class RankingPolicy>
+class BasicHandEvaluator
+{
+public:
+
+   class Accumulator;
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, the lookup tables are constant
+   //                data written by generate
+   // Constraints : None
+   //***************************************************************************
+   BasicHandEvaluator();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~BasicHandEvaluator();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the five cards and returns the hand value
+   // Constraints : The cards must be valid, cards must hold five cards
+   //***************************************************************************
+   inline int evaluate(const Card cards[]) const;
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the five packed cards and returns the hand value
+   //                Flushes use the flush table, five unique numbers use
+   //                the unique table, all other hands are hashed by the
+   //                count of each card number
+   // Constraints : The cards must be valid, cards must hold five cards
+   //***************************************************************************
+   inline int evaluate(const PackedCard cards[]) const;
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the hand and returns the hand value
+   // Constraints : The hand must hold five valid cards
+   //***************************************************************************
+   inline int evaluate(const Hand& hand) const;
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the set of cards and returns the hand value of
+   //                the best five card hand
+   // Constraints : The set must hold five to eight cards
+   //***************************************************************************
+   inline int evaluate(const CardSet& cards) const;
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the accumulated cards and returns the hand
+   //                value of the best five card hand
+   // Constraints : The accumulator must hold five to eight valid and unique
+   //                cards
+   //***************************************************************************
+   inline int evaluate(const Accumulator& cards) const;
+
+   //***************************************************************************
+   // Function    : evaluateBatch
+   // Description : Evaluates many five card hands and writes each hand value
+   //                With AVX2, evaluates eight hands at a time with gathers
+   //                from the lookup tables and no branches per hand
+   //                Else, evaluates one hand at a time
+   // Constraints : cards must hold numHands * MAXCARDS valid cards, hand
+   //                after hand, values must hold numHands values
+   //***************************************************************************
+   void evaluateBatch(
+      const PackedCard  cards[],
+      const int         numHands,
+      int               values[]) const;
+
+   //***************************************************************************
+   // Function    : evaluateBest
+   // Description : Evaluates NUMCARDS packed cards and returns the hand value
+   //                of the best five card hand
+   //                The card count is a compile-time constant, so the loop
+   //                over the cards is unrolled
+   // Constraints : NUMCARDS must be five to eight, checked at compile time
+   //                The cards must be valid and unique
+   //***************************************************************************
+   template <int NUMCARDS>
+   inline int evaluateBest(const PackedCard cards[]) const;
+
+   //***************************************************************************
+   // Function    : evaluateHoldem
+   // Description : Evaluates two hole cards and a five card board and returns
+   //                the hand value of the best five card hand
+   // Constraints : The cards must be valid and unique
+   //***************************************************************************
+   inline int evaluateHoldem(
+      const Card holeCards[],
+      const Card board[]) const;
+
+   //***************************************************************************
+   // Function    : evaluateHoldem
+   // Description : Evaluates two packed hole cards and a five card packed
+   //                board and returns the hand value of the best five cards
+   // Constraints : The cards must be valid and unique
+   //***************************************************************************
+   inline int evaluateHoldem(
+      const PackedCard holeCards[],
+      const PackedCard board[]) const;
+
+   //***************************************************************************
+   // Function    : evaluateSeven
+   // Description : Evaluates the seven cards and returns the hand value of
+   //                the best five card hand
+   // Constraints : The cards must be valid and unique, cards must hold
+   //                seven cards
+   //***************************************************************************
+   inline int evaluateSeven(const Card cards[]) const;
+
+   //***************************************************************************
+   // Function    : evaluateSeven
+   // Description : Evaluates the seven packed cards and returns the hand
+   //                value of the best five card hand, see evaluateBest
+   // Constraints : The cards must be valid and unique, cards must hold
+   //                seven cards
+   //***************************************************************************
+   inline int evaluateSeven(const PackedCard cards[]) const;
+
+   //***************************************************************************
+   // Function    : generate
+   // Description : Builds the lookup tables and writes them as the source
+   //                file defining the tables of evaluatorName, the typedef
+   //                of this evaluator such as HandEvaluator
+   // Constraints : Run offline, the file replaces the one in the tree
+   //                Throws an exception if the file cannot be written
+   //***************************************************************************
+   static void generate(
+      const char* fileName,
+      const char* evaluatorName);
+
+   //***************************************************************************
+   // Function    : getHandType
+   // Description : Determines the hand type (straight, flush, etc) of the
+   //                input hand value
+   // Constraints : None
+   //***************************************************************************
+   Hand::HandType getHandType(const int value) const;
+
+   //***************************************************************************
+   // Function    : getHighestValue
+   // Description : Returns the highest hand value of the input hand type
+   //                Used as an upper bound to skip hands that cannot win
+   // Constraints : Returns INVALIDVALUE for INVALIDHAND
+   //***************************************************************************
+   int getHighestValue(const Hand::HandType type) const;
+
+   //***************************************************************************
+   // Function    : verifyTables
+   // Description : Builds the lookup tables and returns whether they match
+   //                the tables written by generate
+   // Constraints : None
+   //***************************************************************************
+   static bool verifyTables();
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the number of hand values of each hand type
+   // High cards and flushes are the masks of five card numbers that are not
+   // straights, straights and straight flushes run from the low ace straight
+   enum HandTypeCount
+   {
+      NUMSTRAIGHTS      = RankingPolicy::NUMRANKS - 3,
+      NUMHIGHCARDS      = RankingPolicy::NUMRANKS * 
+                          (RankingPolicy::NUMRANKS - 1) * 
+                          (RankingPolicy::NUMRANKS - 2) * 
+                          (RankingPolicy::NUMRANKS - 3) * 
+                          (RankingPolicy::NUMRANKS - 4) / 120 - NUMSTRAIGHTS,
+      NUMONEPAIRS       = RankingPolicy::NUMRANKS * 
+                          (RankingPolicy::NUMRANKS - 1) * 
+                          (RankingPolicy::NUMRANKS - 2) * 
+                          (RankingPolicy::NUMRANKS - 3) / 6,
+      NUMTWOPAIRS       = RankingPolicy::NUMRANKS * 
+                          (RankingPolicy::NUMRANKS - 1) / 2 * 
+                          (RankingPolicy::NUMRANKS - 2),
+      NUMTHREEOFAKINDS  = RankingPolicy::NUMRANKS * 
+                          (RankingPolicy::NUMRANKS - 1) * 
+                          (RankingPolicy::NUMRANKS - 2) / 2,
+      NUMFULLHOUSES     = RankingPolicy::NUMRANKS * 
+                          (RankingPolicy::NUMRANKS - 1),
+      NUMFOUROFAKINDS   = NUMFULLHOUSES
+   };
+
+   // Represents the range of hand values
+   enum HandValueRange
+   {
+      INVALIDVALUE,
+      MINVALUE,
+      MAXVALUE = 2 * NUMHIGHCARDS + NUMONEPAIRS + NUMTWOPAIRS + 
+                 NUMTHREEOFAKINDS + 2 * NUMSTRAIGHTS + NUMFULLHOUSES + 
+                 NUMFOUROFAKINDS
+   };
+
+   // Represents the number of cards in a Texas Hold'em hand
+   enum HoldemCardCount
+   {
+      NUMHOLECARDS   = 2,
+      NUMBOARDCARDS  = 5,
+      NUMHOLDEMCARDS = NUMHOLECARDS + NUMBOARDCARDS
+   };
+
+   // Represents the number of cards the best five card hand is chosen from
+   enum BestCardCount
+   {
+      MINBESTCARDS   = Hand::MAXCARDS,
+      MAXBESTCARDS   = 8
+   };
+
+   // Represents the sizes and sentinels used to build the lookup tables
+   enum TableSize
+   {
+      NOSTRAIGHT       = -1,
+      NUMSUITS         = 4,
+      LOWESTRANK       = RankingPolicy::LOWESTRANK,
+      NUMRANKS         = RankingPolicy::NUMRANKS,
+      LOWACESTRAIGHT   = (1 << (NUMRANKS - 1)) | 0xF,
+      MAXREPETITION    = Hand::QUADS,
+      MAXHASHCARDS     = MAXBESTCARDS,
+      NUMRANKMASKS     = 1 << NUMRANKS,
+
+      // Multisets of five card numbers
+      NUMSORTEDINDEXES = (NUMRANKS + 4) * (NUMRANKS + 3) * 
+                         (NUMRANKS + 2) * (NUMRANKS + 1) * NUMRANKS / 120,
+
+      // Multisets of five to eight card numbers, without five or more of
+      // one number, each built from the multisets of one card fewer
+      NUMFIVEHASHES    = NUMSORTEDINDEXES - NUMRANKS,
+      NUMSIXHASHES     = NUMSORTEDINDEXES * (NUMRANKS + 5) / 6 -
+                         NUMRANKS * NUMRANKS,
+      NUMSEVENHASHES   = NUMSORTEDINDEXES * (NUMRANKS + 5) / 6 * 
+                         (NUMRANKS + 6) / 7 -
+                         NUMRANKS * (NUMRANKS + 1) * NUMRANKS / 2,
+      NUMEIGHTHASHES   = NUMSORTEDINDEXES * (NUMRANKS + 5) / 6 * 
+                         (NUMRANKS + 6) / 7 * (NUMRANKS + 7) / 8 -
+                         NUMRANKS * (NUMRANKS + 2) * 
+                         (NUMRANKS + 1) * NUMRANKS / 6,
+      NUMHASHES        = NUMFIVEHASHES + NUMSIXHASHES + 
+                         NUMSEVENHASHES + NUMEIGHTHASHES,
+      GATHERPADDING    = 1,
+      BATCHLANES       = 8
+   };
+
+   //***************************************************************************
+   //
+   // Class:    Accumulator
+   //
+   // Notes    : Counts each card number and each suit of the cards added,
+   //             all the evaluator needs to find the best five card hand
+   //             Copy an accumulator holding the shared cards, such as a
+   //             board, then add each player's cards to the copy
+   //
+   //***************************************************************************
+   class Accumulator
+   {
+   public:
+
+      //************************************************************************
+      // Function    : constructor
+      // Description : Default constructor, holds no cards
+      // Constraints : None
+      //************************************************************************
+      inline Accumulator();
+
+      // Member functions in alphabetical order
+
+      //************************************************************************
+      // Function    : add
+      // Description : Adds the card to the counts
+      // Constraints : The card must be valid and not already added, at most
+      //                MAXBESTCARDS cards can be added
+      //************************************************************************
+      inline void add(const PackedCard card);
+
+      //************************************************************************
+      // Function    : getCount
+      // Description : Returns the number of cards added
+      // Constraints : None
+      //************************************************************************
+      inline int getCount() const;
+
+      //************************************************************************
+      // Function    : getRankCounts
+      // Description : Returns the count of each card number, from 0 for the
+      //                lowest card number of the deck
+      // Constraints : None
+      //************************************************************************
+      inline const unsigned char* getRankCounts() const;
+
+      //************************************************************************
+      // Function    : getSuitCount
+      // Description : Returns the number of cards of the suit
+      // Constraints : suitIndex must be 0 to 3
+      //************************************************************************
+      inline int getSuitCount(const int suitIndex) const;
+
+      //************************************************************************
+      // Function    : getSuitMask
+      // Description : Returns the mask of card numbers of the suit, from bit
+      //                0 for the lowest card number of the deck
+      // Constraints : suitIndex must be 0 to 3
+      //************************************************************************
+      inline int getSuitMask(const int suitIndex) const;
+
+   private:
+
+      unsigned char  counts[NUMRANKS];     // Count of each card number
+      int            suitCounts[NUMSUITS]; // Count of each suit
+      int            suitMasks[NUMSUITS];  // Card numbers of each suit
+      int            numCards;             // Number of cards added
+
+   }; // end class Accumulator
+
+private:
+
+   //***************************************************************************
+   //
+   // Class:    LookupTables
+   //
+   // Notes    : Holds the lookup tables, built by buildTables
+   //             An aggregate, so the tables written by generate are
+   //             constant initialized into read-only data
+   //             Private, read through BasicHandEvaluator::tables
+   //
+   //***************************************************************************
+   class LookupTables
+   {
+   public:
+
+      //************************************************************************
+      // Function    : hashRanks
+      // Description : Perfect hash of the count of each card number
+      //                Returns a dense index into hashedTable, unique for
+      //                each count
+      // Constraints : The counts must add up to numCards
+      //************************************************************************
+      inline constexpr int hashRanks(
+         const unsigned char  counts[],
+         const int            numCards) const;
+
+      // Hand value of the best flush held in each mask of card numbers
+      unsigned short flushTable[NUMRANKMASKS];
+
+      // Hand value of each five unique card numbers, indexed by the mask of
+      // card numbers, zero if the mask does not hold five card numbers
+      unsigned short uniqueTable[NUMRANKMASKS];
+
+      // Best hand value of each count of five to eight card numbers,
+      // ignoring flushes, indexed by hashRanks
+      // The five card hashes come first, then the six, seven, and eight
+      unsigned short hashedTable[NUMHASHES];
+
+      // Offsets summed by hashRanks, indexed by rank, count and remaining
+      // cards
+      int            hashOffsets[NUMRANKS]
+                                [MAXREPETITION + 1]
+                                [MAXHASHCARDS + 1];
+
+      // Hand value of five cards without a flush, indexed by the sum of
+      // sortedOffsets over the card numbers sorted low to high
+      // Padded since evaluateBatch gathers 32 bits for each 16 bit value
+      unsigned short sortedTable[NUMSORTEDINDEXES + GATHERPADDING];
+
+      // Offsets summed over the sorted card numbers, indexed by position and
+      // rank, the ways to choose position + 1 of rank + position numbers
+      int            sortedOffsets[Hand::MAXCARDS][NUMRANKS];
+
+   }; // end class LookupTables
+
+   //***************************************************************************
+   // Function    : buildTables
+   // Description : Builds the flush, unique, hashed, and sorted tables
+   // Constraints : Private, the tables must be zeroed
+   //***************************************************************************
+   static void buildTables(LookupTables& lookupTables);
+
+   //***************************************************************************
+   // Function    : computeBestValue
+   // Description : Computes the best five card hand value of six to eight
+   //                cards without a flush from the count of each card number
+   // Constraints : Private, the counts must add up to six, seven, or eight
+   //***************************************************************************
+   static inline constexpr int computeBestValue(const int counts[]);
+
+   //***************************************************************************
+   // Function    : computeValue
+   // Description : Computes the hand value of five cards from the count of
+   //                each card number, the slow path used to fill the tables
+   // Constraints : Private, the counts must add up to five
+   //***************************************************************************
+   static inline constexpr int computeValue(
+      const int   counts[], 
+      const bool  isFlush);
+
+   //***************************************************************************
+   // Function    : fillHashedTable
+   // Description : Recursively enumerates every count of card numbers that
+   //                adds up to numCards and stores its hand value
+   //                Six to eight card hands store their best five card
+   //                hand value
+   // Constraints : Private, called by buildTables after the hash offsets
+   //***************************************************************************
+   static void fillHashedTable(
+      LookupTables&  lookupTables,
+      int            counts[],
+      const int      rank,
+      const int      remaining,
+      const int      numCards);
+
+   //***************************************************************************
+   // Function    : getCombinationIndex
+   // Description : Returns the index of the mask of card numbers among all
+   //                masks with as many card numbers, in increasing order
+   // Constraints : Private, used to build the tables
+   //***************************************************************************
+   static inline constexpr int getCombinationIndex(const int mask);
+
+   //***************************************************************************
+   // Function    : getHighestRank
+   // Description : Returns the highest card number in the mask, from 0 for
+   //                a two
+   // Constraints : Private, used to build the tables, mask must not be zero
+   //***************************************************************************
+   static inline constexpr int getHighestRank(const int mask);
+
+   //***************************************************************************
+   // Function    : getLowestRank
+   // Description : Returns the lowest card number in the mask, from 0 for a two
+   // Constraints : Private, used to build the tables, mask must not be zero
+   //***************************************************************************
+   static inline constexpr int getLowestRank(const int mask);
+
+   //***************************************************************************
+   // Function    : getStraightIndex
+   // Description : Returns the index of the straight held in the mask of card
+   //                numbers, from 0 for a low ace straight (5 to A)
+   //                Returns NOSTRAIGHT if the mask is not a straight
+   // Constraints : Private, used to build the tables
+   //***************************************************************************
+   static inline constexpr int getStraightIndex(const int mask);
+
+   //***************************************************************************
+   // Function    : getTypeCount
+   // Description : Returns the number of hand values of the hand type
+   // Constraints : Private, 0 for INVALIDHAND
+   //***************************************************************************
+   static inline constexpr int getTypeCount(const Hand::HandType type);
+
+   //***************************************************************************
+   // Function    : getValueOffset
+   // Description : Returns the highest hand value of the hand types the
+   //                policy ranks below the hand type
+   // Constraints : Private
+   //***************************************************************************
+   static inline constexpr int getValueOffset(const Hand::HandType type);
+
+   //***************************************************************************
+   // Function    : removeRank
+   // Description : Removes the card number from the mask and shifts the
+   //                higher card numbers down, used to index kickers
+   // Constraints : Private, used to build the tables
+   //***************************************************************************
+   static inline constexpr int removeRank(
+      const int mask,
+      const int rank);
+
+   // Lookup tables shared by every evaluator, constant data written
+   // offline by generate
+   static const LookupTables tables;
+
+}; // end class BasicHandEvaluator
+
+// Evaluator of the standard 52 card deck
+typedef BasicHandEvaluator<StandardRanking>  HandEvaluator;
+
+// Evaluator of the 36 card short deck (6+)
+typedef BasicHandEvaluator<ShortDeckRanking> ShortDeckEvaluator;
+
+// Lookup tables of each evaluator, defined in HandEvaluatorTables.cpp and
+// ShortDeckEvaluatorTables.cpp
+template <>
+const HandEvaluator::LookupTables HandEvaluator::tables;
+template <>
+const ShortDeckEvaluator::LookupTables ShortDeckEvaluator::tables;
+
+// Instantiated once, in HandEvaluator.cpp
+extern template class BasicHandEvaluator<StandardRanking>;
+extern template class BasicHandEvaluator<ShortDeckRanking>;
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Pack the five cards then evaluate them
+// Notes    : The cards must be valid, cards must hold five cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Evaluate packed cards
+// 10.17.26       Donne Martin         Evaluate card sets
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluate(const Card cards[]) const
+{
+   PackedCard packedCards[Hand::MAXCARDS]; // Packed copy of the cards
+
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      packedCards[cardIndex] = PackedCard(cards[cardIndex]);
+   }
+
+   return this->evaluate(packedCards);
+} // end BasicHandEvaluator::evaluate
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Evaluate the five packed cards and return the hand value
+//             For each card, count its number and build the number and
+//             suit masks
+//             If every card has the same suit, look up the flush table
+//             If the numbers are unique, look up the unique table
+//             Else, hash the number counts and look up the hashed table
+// Notes    : The cards must be valid, cards must hold five cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluate(
+   const PackedCard cards[]) const
+{
+   unsigned char  counts[NUMRANKS] = { 0 }; // Count of each card number
+   int            rankMask         = 0;     // Bit set for each card number
+   int            suitMask         = 0;     // Bit set for each suit
+   int            rank             = 0;     // Card number, from 0 for a two
+
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      rank = cards[cardIndex].getRank() - LOWESTRANK;
+
+      counts[rank]++;
+      rankMask |= 1 << rank;
+      suitMask |= 1 << cards[cardIndex].getSuitIndex();
+   }
+
+   // A single suit bit means every card has the same suit
+   if ((suitMask & (suitMask - 1)) == 0)
+   {
+      return BasicHandEvaluator::tables.flushTable[rankMask];
+   }
+
+   // Straights and high cards, zero if a card number repeats
+   if (BasicHandEvaluator::tables.uniqueTable[rankMask] != INVALIDVALUE)
+   {
+      return BasicHandEvaluator::tables.uniqueTable[rankMask];
+   }
+
+   return BasicHandEvaluator::tables.hashedTable[
+      BasicHandEvaluator::tables.hashRanks(counts, Hand::MAXCARDS)];
+} // end BasicHandEvaluator::evaluate
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Copy the hand's packed cards then evaluate them
+// Notes    : The hand must hold five valid cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Copy the packed cards
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluate(const Hand& hand) const
+{
+   PackedCard cards[Hand::MAXCARDS];   // Cards in the hand
+
+   hand.getPackedCards(cards);
+
+   return this->evaluate(cards);
+} // end BasicHandEvaluator::evaluate
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Evaluate the set of cards and return the best hand value
+//             If a suit is held five or more times, look up the flush table
+//                Eight cards can also hold a better full house or quads
+//             Count each card number across the four suits
+//             If five cards have unique numbers, look up the unique table
+//             Else, hash the number counts and look up the hashed table
+// Notes    : The set must hold five to eight cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+// 10.18.26       Donne Martin         Added six and eight cards
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluate(
+   const CardSet& cards) const
+{
+   unsigned char  counts[NUMRANKS] = { 0 };         // Count of each number
+   int            numCards         = cards.getCount();
+   int            rankMask         = cards.getRankMask() >> LOWESTRANK;
+   int            suitMask         = 0;             // Numbers of one suit
+   int            flushValue       = INVALIDVALUE;  // Best flush held
+   int            value            = INVALIDVALUE;
+
+   if (numCards < MINBESTCARDS || numCards > MAXBESTCARDS)
+   {
+      throw exception("Unexpected number of cards in evaluate");
+   }
+
+   for (int suit = 0; suit < NUMSUITS; ++suit)
+   {
+      suitMask = cards.getSuitMask(suit) >> LOWESTRANK;
+
+      if (CardSet::popCount(suitMask) >= Hand::MAXCARDS)
+      {
+         flushValue = BasicHandEvaluator::tables.flushTable[suitMask];
+      }
+
+      for (int rank = 0; rank < NUMRANKS; ++rank)
+      {
+         counts[rank] += (suitMask >> rank) & 1;
+      }
+   }
+
+   // Up to seven cards cannot hold a flush and a better hand
+   if (flushValue != INVALIDVALUE && numCards <= NUMHOLDEMCARDS)
+   {
+      return flushValue;
+   }
+
+   // Straights and high cards, zero if a card number repeats
+   if (numCards == Hand::MAXCARDS &&
+       BasicHandEvaluator::tables.uniqueTable[rankMask] != INVALIDVALUE)
+   {
+      return BasicHandEvaluator::tables.uniqueTable[rankMask];
+   }
+
+   value = BasicHandEvaluator::tables.hashedTable[
+      BasicHandEvaluator::tables.hashRanks(counts, numCards)];
+
+   return value > flushValue ? value : flushValue;
+} // end BasicHandEvaluator::evaluate
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Evaluate the accumulated cards and return the best hand value
+//             If a suit is held five or more times, look up the flush table
+//                Eight cards can also hold a better full house or quads
+//             Hash the number counts and look up the hashed table
+// Notes    : The accumulator must hold five to eight valid and unique cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluate(
+   const Accumulator& cards) const
+{
+   int flushValue = INVALIDVALUE;   // Best flush held
+   int value      = INVALIDVALUE;
+
+   for (int suit = 0; suit < NUMSUITS; ++suit)
+   {
+      if (cards.getSuitCount(suit) >= Hand::MAXCARDS)
+      {
+         flushValue = 
+            BasicHandEvaluator::tables.flushTable[cards.getSuitMask(suit)];
+      }
+   }
+
+   // Up to seven cards cannot hold a flush and a better hand
+   if (flushValue != INVALIDVALUE && cards.getCount() <= NUMHOLDEMCARDS)
+   {
+      return flushValue;
+   }
+
+   value = BasicHandEvaluator::tables.hashedTable[
+      BasicHandEvaluator::tables.hashRanks(
+         cards.getRankCounts(), cards.getCount())];
+
+   return value > flushValue ? value : flushValue;
+} // end BasicHandEvaluator::evaluate
+
+//******************************************************************************
+// Function : evaluateBest
+// Process  : Add each card to an accumulator then evaluate it
+// Notes    : NUMCARDS must be five to eight, the cards must be valid and
+//             unique
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+template <int NUMCARDS>
+inline int BasicHandEvaluator<RankingPolicy>::evaluateBest(
+   const PackedCard cards[]) const
+{
+   static_assert(NUMCARDS >= MINBESTCARDS && NUMCARDS <= MAXBESTCARDS,
+                 "evaluateBest takes five to eight cards");
+
+   Accumulator accumulator;   // Counts of the cards
+
+   for (int cardIndex = 0; cardIndex < NUMCARDS; ++cardIndex)
+   {
+      accumulator.add(cards[cardIndex]);
+   }
+
+   return this->evaluate(accumulator);
+} // end BasicHandEvaluator::evaluateBest
+
+//******************************************************************************
+// Function : evaluateHoldem
+// Process  : Pack the hole cards and the board then evaluate the seven cards
+// Notes    : The cards must be valid and unique
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Evaluate packed cards
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluateHoldem(
+   const Card holeCards[],
+   const Card board[]) const
+{
+   PackedCard cards[NUMHOLDEMCARDS];   // Hole cards followed by the board
+
+   cards[0] = PackedCard(holeCards[0]);
+   cards[1] = PackedCard(holeCards[1]);
+
+   for (int boardIndex = 0; boardIndex < NUMBOARDCARDS; ++boardIndex)
+   {
+      cards[NUMHOLECARDS + boardIndex] = PackedCard(board[boardIndex]);
+   }
+
+   return this->evaluateSeven(cards);
+} // end BasicHandEvaluator::evaluateHoldem
+
+//******************************************************************************
+// Function : evaluateHoldem
+// Process  : Copy the packed hole cards and board then evaluate them
+// Notes    : The cards must be valid and unique
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluateHoldem(
+   const PackedCard holeCards[],
+   const PackedCard board[]) const
+{
+   PackedCard cards[NUMHOLDEMCARDS];   // Hole cards followed by the board
+
+   cards[0] = holeCards[0];
+   cards[1] = holeCards[1];
+
+   for (int boardIndex = 0; boardIndex < NUMBOARDCARDS; ++boardIndex)
+   {
+      cards[NUMHOLECARDS + boardIndex] = board[boardIndex];
+   }
+
+   return this->evaluateSeven(cards);
+} // end BasicHandEvaluator::evaluateHoldem
+
+//******************************************************************************
+// Function : evaluateSeven
+// Process  : Pack the seven cards then evaluate them
+// Notes    : The cards must be valid and unique, cards must hold seven cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluateSeven(
+   const Card cards[]) const
+{
+   PackedCard packedCards[NUMHOLDEMCARDS]; // Packed copy of the cards
+
+   for (int cardIndex = 0; cardIndex < NUMHOLDEMCARDS; ++cardIndex)
+   {
+      packedCards[cardIndex] = PackedCard(cards[cardIndex]);
+   }
+
+   return this->evaluateSeven(packedCards);
+} // end BasicHandEvaluator::evaluateSeven
+
+//******************************************************************************
+// Function : evaluateSeven
+// Process  : Evaluate the best five of the seven packed cards
+// Notes    : The cards must be valid and unique, cards must hold seven cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+// 10.18.26       Donne Martin         Evaluate through evaluateBest
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::evaluateSeven(
+   const PackedCard cards[]) const
+{
+   return this->evaluateBest<NUMHOLDEMCARDS>(cards);
+} // end BasicHandEvaluator::evaluateSeven
+
+//******************************************************************************
+// Function : constructor
+// Process  : Clear the counts
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline BasicHandEvaluator<RankingPolicy>::Accumulator::Accumulator()
+   : counts(),
+     suitCounts(),
+     suitMasks(),
+     numCards(0)
+{
+} // end BasicHandEvaluator::Accumulator::Accumulator
+
+//******************************************************************************
+// Function : add
+// Process  : Count the card's number and suit and add its number to the
+//             mask of its suit
+// Notes    : The card must be valid and not already added
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline void BasicHandEvaluator<RankingPolicy>::Accumulator::add(
+   const PackedCard card)
+{
+   int rank = card.getRank() - LOWESTRANK;   // Card number, from 0
+   int suit = card.getSuitIndex();           // Suit, from 0
+
+   this->counts[rank]++;
+   this->suitCounts[suit]++;
+   this->suitMasks[suit] |= 1 << rank;
+   this->numCards++;
+} // end BasicHandEvaluator::Accumulator::add
+
+//******************************************************************************
+// Function : getCount
+// Process  : Accessor for numCards
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::Accumulator::getCount() const
+{
+   return this->numCards;
+} // end BasicHandEvaluator::Accumulator::getCount
+
+//******************************************************************************
+// Function : getRankCounts
+// Process  : Accessor for counts
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline const unsigned char* 
+BasicHandEvaluator<RankingPolicy>::Accumulator::getRankCounts() const
+{
+   return this->counts;
+} // end BasicHandEvaluator::Accumulator::getRankCounts
+
+//******************************************************************************
+// Function : getSuitCount
+// Process  : Accessor for the count of the suit
+// Notes    : suitIndex must be 0 to 3
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::Accumulator::getSuitCount(
+   const int suitIndex) const
+{
+   return this->suitCounts[suitIndex];
+} // end BasicHandEvaluator::Accumulator::getSuitCount
+
+//******************************************************************************
+// Function : getSuitMask
+// Process  : Accessor for the mask of card numbers of the suit
+// Notes    : suitIndex must be 0 to 3
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline int BasicHandEvaluator<RankingPolicy>::Accumulator::getSuitMask(
+   const int suitIndex) const
+{
+   return this->suitMasks[suitIndex];
+} // end BasicHandEvaluator::Accumulator::getSuitMask
+
+//******************************************************************************
+// Function : hashRanks
+// Process  : Perfect hash of the count of each card number
+//             For each card number, add the offset of its count given the
+//             number of cards remaining
+//             Stop once every card is accounted for
+// Notes    : The counts must add up to numCards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Moved to LookupTables
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::LookupTables::hashRanks(
+   const unsigned char  counts[],
+   const int            numCards) const
+{
+   int hash      = 0;          // Dense index of the counts
+   int remaining = numCards;   // Cards not yet accounted for
+
+   for (int rank = 0; rank < NUMRANKS && remaining > 0; ++rank)
+   {
+      hash      += this->hashOffsets[rank][counts[rank]][remaining];
+      remaining -= counts[rank];
+   }
+
+   return hash;
+} // end BasicHandEvaluator::LookupTables::hashRanks
+
+//******************************************************************************
+// Function : computeBestValue
+// Process  : Compute the best five card hand value of six to eight cards
+//             without a flush, keeping the five cards the best hand type
+//             would keep
+//             Build the mask of card numbers held once, twice, three and
+//             four times
+//             If we have quads, keep them and the highest other number
+//             If we have trips and another trips or a pair, keep the
+//                highest trips and the highest other trips or pair
+//             If we have trips, keep them and the two highest singles
+//             If we have two pair, keep the two highest pairs and the
+//                highest other number
+//             If we have a pair, keep it and the three highest singles
+//             Else, keep the five highest singles
+//             Compute the hand value of the five cards kept
+//             If we have a straight, compute the hand value of its highest
+//                five numbers, keep the higher of the two values
+// Notes    : Private, the counts must add up to six, seven, or eight
+//             Replaces trying each of the 6 to 56 five card hands, which
+//             takes too many steps for the compiler
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+// 10.18.26       Donne Martin         Added six and eight cards
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::computeBestValue(
+   const int counts[])
+{
+   const int   STRAIGHT                   = 0x1F;    // Run of five numbers
+   int         masks[MAXREPETITION + 1]   = { 0 };   // Numbers by repetition
+   int         kept[NUMRANKS]             = { 0 };   // Counts of cards kept
+   int         held                       = 0;       // Numbers held
+   int         straight                   = 0;       // Highest straight held
+   int         straightValue              = INVALIDVALUE;
+   int         numKickers                 = 0;       // Singles to keep
+
+   for (int rank = 0; rank < NUMRANKS; ++rank)
+   {
+      masks[counts[rank]] |= 1 << rank;
+   }
+
+   held = masks[Hand::SINGLES] | masks[Hand::PAIRS] | 
+          masks[Hand::TRIPS] | masks[Hand::QUADS];
+
+   for (int lowRank = 0; lowRank + Hand::MAXCARDS <= NUMRANKS; ++lowRank)
+   {
+      if ((held & (STRAIGHT << lowRank)) == (STRAIGHT << lowRank))
+      {
+         straight = STRAIGHT << lowRank;
+      }
+   }
+
+   if (straight == 0 && (held & LOWACESTRAIGHT) == LOWACESTRAIGHT)
+   {
+      straight = LOWACESTRAIGHT;
+   }
+
+   if (straight != 0)
+   {
+      int straightCounts[NUMRANKS] = { 0 };  // One of each straight number
+
+      for (int rank = 0; rank < NUMRANKS; ++rank)
+      {
+         straightCounts[rank] = (straight >> rank) & 1;
+      }
+
+      straightValue = computeValue(straightCounts, false);
+   }
+
+   if (masks[Hand::QUADS] != 0)
+   {
+      int quad = getHighestRank(masks[Hand::QUADS]);
+
+      kept[quad] = Hand::QUADS;
+      numKickers = 1;
+   }
+   else if (masks[Hand::TRIPS] != 0 && 
+            ((masks[Hand::TRIPS] & (masks[Hand::TRIPS] - 1)) | 
+             masks[Hand::PAIRS]) != 0)
+   {
+      int trip = getHighestRank(masks[Hand::TRIPS]);
+
+      kept[trip] = Hand::TRIPS;
+      kept[getHighestRank((masks[Hand::TRIPS] & ~(1 << trip)) | 
+                          masks[Hand::PAIRS])] = Hand::PAIRS;
+   }
+   else if (masks[Hand::TRIPS] != 0)
+   {
+      kept[getHighestRank(masks[Hand::TRIPS])] = Hand::TRIPS;
+      numKickers = 2;
+   }
+   else if (masks[Hand::PAIRS] != 0)
+   {
+      int highPair = getHighestRank(masks[Hand::PAIRS]);
+
+      kept[highPair] = Hand::PAIRS;
+      numKickers     = 3;
+
+      if ((masks[Hand::PAIRS] & ~(1 << highPair)) != 0)
+      {
+         kept[getHighestRank(masks[Hand::PAIRS] & ~(1 << highPair))] = 
+            Hand::PAIRS;
+         numKickers = 1;
+      }
+   }
+   else
+   {
+      numKickers = Hand::MAXCARDS;
+   }
+
+   // Keep the highest numbers not kept yet, a third pair can be a kicker
+   for (int rank = NUMRANKS - 1; rank >= 0 && numKickers > 0; --rank)
+   {
+      if (kept[rank] == 0 && counts[rank] > 0)
+      {
+         kept[rank] = 1;
+         --numKickers;
+      }
+   }
+
+   // The policy decides whether the straight beats the repeated numbers
+   int value = computeValue(kept, false);
+
+   return value > straightValue ? value : straightValue;
+} // end BasicHandEvaluator::computeBestValue
+
+//******************************************************************************
+// Function : computeValue
+// Process  : Compute the hand value of five cards from the count of each
+//             card number
+//             Build a mask of card numbers for each repetition
+//             Determine the hand type from the repetition masks
+//             Index the hand within its type, most significant cards first
+//                Kickers are indexed with the repeated numbers removed
+//             Add the index to the highest value of the hand type below
+// Notes    : Private, the counts must add up to five
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Made constexpr
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::computeValue(
+   const int   counts[], 
+   const bool  isFlush)
+{
+   int            masks[MAXREPETITION + 1] = { 0 };  // Numbers by repetition
+   int            index                    = 0;      // Index within type
+   int            straight                 = NOSTRAIGHT;
+   Hand::HandType type                     = Hand::INVALIDHAND;
+
+   for (int rank = 0; rank < NUMRANKS; ++rank)
+   {
+      masks[counts[rank]] |= 1 << rank;
+   }
+
+   int singles = masks[Hand::SINGLES];
+   int pairs   = masks[Hand::PAIRS];
+   int trips   = masks[Hand::TRIPS];
+   int quads   = masks[Hand::QUADS];
+
+   if (quads != 0)
+   {
+      int quad = getLowestRank(quads);
+
+      type  = Hand::FOUROFAKIND;
+      index = quad * (NUMRANKS - 1) +
+              getCombinationIndex(removeRank(singles, quad));
+   }
+   else if (trips != 0 && pairs != 0)
+   {
+      int trip = getLowestRank(trips);
+
+      type  = Hand::FULLHOUSE;
+      index = trip * (NUMRANKS - 1) +
+              getCombinationIndex(removeRank(pairs, trip));
+   }
+   else if (trips != 0)
+   {
+      const int NUMKICKERS = NUMTHREEOFAKINDS / NUMRANKS;  // Two kickers
+      int trip = getLowestRank(trips);
+
+      type  = Hand::THREEOFAKIND;
+      index = trip * NUMKICKERS +
+              getCombinationIndex(removeRank(singles, trip));
+   }
+   else if (pairs != 0 && (pairs & (pairs - 1)) != 0)
+   {
+      const int NUMKICKERS = NUMRANKS - 2; // One kicker
+      int lowPair  = getLowestRank(pairs);
+      int highPair = getLowestRank(pairs & ~(1 << lowPair));
+
+      // Remove the high pair first so the low pair keeps its position
+      type  = Hand::TWOPAIR;
+      index = getCombinationIndex(pairs) * NUMKICKERS +
+              getCombinationIndex(
+                 removeRank(removeRank(singles, highPair), lowPair));
+   }
+   else if (pairs != 0)
+   {
+      const int NUMKICKERS = NUMONEPAIRS / NUMRANKS;  // Three kickers
+      int pair = getLowestRank(pairs);
+
+      type  = Hand::ONEPAIR;
+      index = pair * NUMKICKERS +
+              getCombinationIndex(removeRank(singles, pair));
+   }
+   else if ((straight = getStraightIndex(singles)) != NOSTRAIGHT)
+   {
+      type  = isFlush ? Hand::STRAIGHTFLUSH : Hand::STRAIGHT;
+      index = straight;
+   }
+   else
+   {
+      type  = isFlush ? Hand::FLUSH : Hand::HIGHCARD;
+      index = getCombinationIndex(singles);
+
+      // Skip the lower straights, they are ranked as their own hand type
+      if (LOWACESTRAIGHT < singles)
+      {
+         --index;
+      }
+
+      for (int lowRank = 0; lowRank + Hand::MAXCARDS <= NUMRANKS; ++lowRank)
+      {
+         if ((0x1F << lowRank) < singles)
+         {
+            --index;
+         }
+      }
+   }
+
+   return getValueOffset(type) + index + MINVALUE;
+} // end BasicHandEvaluator::computeValue
+
+//******************************************************************************
+// Function : getCombinationIndex
+// Process  : Return the index of the mask among all masks with as many
+//             card numbers, in increasing order
+//             For the nth lowest card number r in the mask, add the number of
+//                ways to choose n card numbers below r
+// Notes    : Private, used to build the tables
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Made constexpr
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::getCombinationIndex(
+   const int mask)
+{
+   int index = 0;   // Index of the mask
+   int nth   = 0;   // Number of card numbers seen so far
+
+   for (int rank = 0; rank < NUMRANKS; ++rank)
+   {
+      if (mask & (1 << rank))
+      {
+         ++nth;
+
+         // Number of ways to choose nth card numbers among rank numbers
+         int ways = 1;
+
+         for (int chosen = 0; chosen < nth; ++chosen)
+         {
+            ways = ways * (rank - chosen) / (chosen + 1);
+         }
+
+         index += ways;
+      }
+   }
+
+   return index;
+} // end BasicHandEvaluator::getCombinationIndex
+
+//******************************************************************************
+// Function : getHighestRank
+// Process  : Return the highest card number in the mask, from 0 for a two
+// Notes    : Private, used to build the tables, mask must not be zero
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::getHighestRank(
+   const int mask)
+{
+   int rank = NUMRANKS - 1;
+
+   while ((mask & (1 << rank)) == 0)
+   {
+      --rank;
+   }
+
+   return rank;
+} // end BasicHandEvaluator::getHighestRank
+
+//******************************************************************************
+// Function : getLowestRank
+// Process  : Return the lowest card number in the mask, from 0 for a two
+// Notes    : Private, used to build the tables, mask must not be zero
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Made constexpr
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::getLowestRank(
+   const int mask)
+{
+   int rank = 0;
+
+   while ((mask & (1 << rank)) == 0)
+   {
+      ++rank;
+   }
+
+   return rank;
+} // end BasicHandEvaluator::getLowestRank
+
+//******************************************************************************
+// Function : getStraightIndex
+// Process  : Return the index of the straight held in the mask
+//             The low ace straight (5 to A) is index 0
+//             A run of five starting at card number r is index r + 1
+//             Else, return NOSTRAIGHT
+// Notes    : Private, used to build the tables
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Made constexpr
+// 10.18.26       Donne Martin         Rank by a compile-time policy
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::getStraightIndex(
+   const int mask)
+{
+   const int STRAIGHT = 0x1F;  // Run of five card numbers
+   int       index    = NOSTRAIGHT;
+
+   if (mask == LOWACESTRAIGHT)
+   {
+      index = 0;
+   }
+   else
+   {
+      for (int lowRank = 0; lowRank + Hand::MAXCARDS <= NUMRANKS; ++lowRank)
+      {
+         if (mask == STRAIGHT << lowRank)
+         {
+            index = lowRank + 1;
+         }
+      }
+   }
+
+   return index;
+} // end BasicHandEvaluator::getStraightIndex
+
+//******************************************************************************
+// Function : getTypeCount
+// Process  : Return the number of hand values of the hand type
+// Notes    : Private, 0 for INVALIDHAND
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::getTypeCount(
+   const Hand::HandType type)
+{
+   int count = 0;
+
+   switch (type)
+   {
+      case Hand::STRAIGHTFLUSH:
+      case Hand::STRAIGHT:
+      {
+         count = NUMSTRAIGHTS;
+         break;
+      }
+      case Hand::FLUSH:
+      case Hand::HIGHCARD:
+      {
+         count = NUMHIGHCARDS;
+         break;
+      }
+      case Hand::FOUROFAKIND:
+      {
+         count = NUMFOUROFAKINDS;
+         break;
+      }
+      case Hand::FULLHOUSE:
+      {
+         count = NUMFULLHOUSES;
+         break;
+      }
+      case Hand::THREEOFAKIND:
+      {
+         count = NUMTHREEOFAKINDS;
+         break;
+      }
+      case Hand::TWOPAIR:
+      {
+         count = NUMTWOPAIRS;
+         break;
+      }
+      case Hand::ONEPAIR:
+      {
+         count = NUMONEPAIRS;
+         break;
+      }
+      case Hand::INVALIDHAND:
+      default:
+      {
+         break;
+      }
+   }
+
+   return count;
+} // end BasicHandEvaluator::getTypeCount
+
+//******************************************************************************
+// Function : getValueOffset
+// Process  : Add up the hand values of every hand type the policy ranks
+//             below the hand type
+// Notes    : Private
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::getValueOffset(
+   const Hand::HandType type)
+{
+   int offset = 0;   // Hand values of the lower hand types
+
+   for (int lower = Hand::HIGHCARD; lower <= Hand::STRAIGHTFLUSH; ++lower)
+   {
+      if (RankingPolicy::getTypeOrder(static_cast<Hand::HandType>(lower)) <
+          RankingPolicy::getTypeOrder(type))
+      {
+         offset += getTypeCount(static_cast<Hand::HandType>(lower));
+      }
+   }
+
+   return offset;
+} // end BasicHandEvaluator::getValueOffset
+
+//******************************************************************************
+// Function : removeRank
+// Process  : Remove the card number from the mask
+//             Shift the higher card numbers down into its place
+// Notes    : Private, used to build the tables
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+// 10.17.26       Donne Martin         Made constexpr
+//******************************************************************************
+template <class RankingPolicy>
+inline constexpr int BasicHandEvaluator<RankingPolicy>::removeRank(
+   const int mask,
+   const int rank)
+{
+   int lowMask = (1 << rank) - 1;   // Card numbers below the removed number
+
+   return (mask & lowMask) | ((mask >> (rank + 1)) << rank);
+} // end BasicHandEvaluator::removeRank
+
+#endif // HandEvaluator_h
@@ -0,0 +1,534 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     HandFile.cpp
+//
+// File Overview: Represents the binary columnar files of hands and of their
+//                ranks, mapped into memory
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added classes
+//******************************************************************************
+
+#include "stdafx.h"
+#include <fstream>
+#include <string>
+#include "BatchRanker.h"
+#include "CardSet.h"
+#include "HandFile.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// Character of each card rank and suit index, as read by HandRange
+static const char RANKCHARACTERS[] = "23456789TJQKA";
+static const char SUITCHARACTERS[] = "cshd";
+
+// Characters of text written at a time
+static const size_t TEXTBUFFERSIZE = 1 << 16;
+
+//******************************************************************************
+// Function : readHeader
+// Process  : Check the mapping holds a header, and its magic and version
+//             Set the cards and hands it holds
+// Notes    : Returns false if the mapping does not hold the header
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+static bool readHeader(
+   const MappedFile&    mappedFile,
+   const unsigned int   magic,
+   const unsigned int   version,
+   int&                 numCards,
+   unsigned long long&  numHands)
+{
+   const unsigned int* words =
+      static_cast<const unsigned int*>(mappedFile.getData());
+
+   if (mappedFile.getSize() < HandFile::HEADERBYTES ||
+       words[0] != magic ||
+       words[1] != version)
+   {
+      return false;
+   }
+
+   numCards = static_cast<int>(words[2]);
+   numHands = words[4] | static_cast<unsigned long long>(words[5]) << 32;
+
+   return true;
+} // end readHeader
+
+//******************************************************************************
+// Function : writeHeader
+// Process  : Write the magic, version, cards, and hands of the file
+// Notes    : The mapping must be writable and hold the header
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+static void writeHeader(
+   const MappedFile&          mappedFile,
+   const unsigned int         magic,
+   const unsigned int         version,
+   const int                  numCards,
+   const unsigned long long   numHands)
+{
+   unsigned int* words =
+      static_cast<unsigned int*>(mappedFile.getWritableData());
+
+   for (int word = 0; word < HandFile::HEADERSIZE; ++word)
+   {
+      words[word] = 0;
+   }
+
+   words[0] = magic;
+   words[1] = version;
+   words[2] = static_cast<unsigned int>(numCards);
+   words[4] = static_cast<unsigned int>(numHands & 0xFFFFFFFF);
+   words[5] = static_cast<unsigned int>(numHands >> 32);
+} // end writeHeader
+
+//******************************************************************************
+// Function : writeText
+// Process  : Write the text to the output and clear it
+// Notes    : Throws an exception if the output cannot be written
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+static void writeText(
+   ostream& out,
+   string&  text)
+{
+   out.write(text.data(), static_cast<streamsize>(text.size()));
+   text.clear();
+
+   if (!out)
+   {
+      throw exception("Unable to write output in writeText");
+   }
+} // end writeText
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize data members to no file
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HandFile::HandFile()
+   : columns(NULL),
+     numCards(0),
+     numHands(0)
+{
+} // end HandFile::HandFile
+
+//******************************************************************************
+// Function : destructor
+// Process  : Close the file
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HandFile::~HandFile()
+{
+   this->close();
+} // end HandFile::~HandFile
+
+//******************************************************************************
+// Function : close
+// Process  : Unmap the file and reset the columns
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandFile::close()
+{
+   this->mappedFile.close();
+   this->columns  = NULL;
+   this->numCards = 0;
+   this->numHands = 0;
+} // end HandFile::close
+
+//******************************************************************************
+// Function : fromText
+// Process  : Count the lines of the text
+//             Create the file at its full size and write the header
+//             For each line
+//                Parse its cards
+//                Check there are numCards unique cards
+//                Write each card to its column, INVALIDCARD if not valid
+// Notes    : Throws an exception if numCards is not 5 or 7, the text cannot
+//             be read, or the file cannot be created
+//             The text is read twice so the file is sized once, and the
+//             columns written in place
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandFile::fromText(
+   const char* textName,
+   const char* fileName,
+   const int   numCards)
+{
+   ifstream             text(textName);
+   string               line;
+   unsigned long long   numHands = 0;
+   MappedFile           mappedFile;
+   PackedCard*          columns  = NULL;
+
+   if (numCards != 5 && numCards != 7)
+   {
+      throw exception("Invalid cards in HandFile::fromText");
+   }
+
+   if (!text)
+   {
+      throw exception("Unable to open text in HandFile::fromText");
+   }
+
+   while (getline(text, line))
+   {
+      ++numHands;
+   }
+
+   if (text.bad() ||
+       numHands > (static_cast<size_t>(-1) - HEADERBYTES) / numCards)
+   {
+      throw exception("Unable to read text in HandFile::fromText");
+   }
+
+   mappedFile.create(fileName,
+                     HEADERBYTES + static_cast<size_t>(numHands) * numCards);
+   writeHeader(mappedFile, MAGIC, VERSION, numCards, numHands);
+   columns = reinterpret_cast<PackedCard*>(
+                static_cast<char*>(mappedFile.getWritableData()) +
+                HEADERBYTES);
+
+   text.clear();
+   text.seekg(0);
+
+   for (unsigned long long hand = 0; hand < numHands; ++hand)
+   {
+      PackedCard  cards[BatchRanker::MAXCARDS];
+      int         numParsed = 0;
+      CardSet     cardSet;
+      bool        isValid   = false;
+
+      if (!getline(text, line))
+      {
+         throw exception("Unable to read text in HandFile::fromText");
+      }
+
+      if (BatchRanker::parseCards(line.data(),
+                                  line.data() + line.size(),
+                                  cards,
+                                  numParsed) &&
+          numParsed == numCards)
+      {
+         for (int card = 0; card < numCards; ++card)
+         {
+            cardSet.add(cards[card]);
+         }
+
+         isValid = cardSet.getCount() == numCards;
+      }
+
+      for (int card = 0; card < numCards; ++card)
+      {
+         columns[card * numHands + hand] = isValid ? cards[card] :
+                                                     PackedCard();
+      }
+   }
+} // end HandFile::fromText
+
+//******************************************************************************
+// Function : open
+// Process  : Map the file and read its header
+//             Check the cards, and that the size holds every column
+//             Point the columns after the header
+// Notes    : Throws an exception, closing the file, if it does not hold
+//             hands of this layout
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandFile::open(const char* fileName)
+{
+   int                  fileCards = 0;
+   unsigned long long   fileHands = 0;
+
+   this->close();
+   this->mappedFile.open(fileName);
+
+   if (!readHeader(this->mappedFile, MAGIC, VERSION, fileCards, fileHands) ||
+       (fileCards != 5 && fileCards != 7) ||
+       (this->mappedFile.getSize() - HEADERBYTES) % fileCards != 0 ||
+       (this->mappedFile.getSize() - HEADERBYTES) / fileCards != fileHands)
+   {
+      this->close();
+      throw exception("Invalid hand file in HandFile::open");
+   }
+
+   this->numCards = fileCards;
+   this->numHands = fileHands;
+   this->columns  = reinterpret_cast<const PackedCard*>(
+                       static_cast<const char*>(this->mappedFile.getData()) +
+                       HEADERBYTES);
+} // end HandFile::open
+
+//******************************************************************************
+// Function : toText
+// Process  : For each hand
+//                Append the rank and suit of each card, separated by spaces,
+//                nothing if the hand is invalid, and a newline
+//                Write the text once it fills its buffer
+//             Write the rest of the text
+// Notes    : Throws an exception if the output cannot be written
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandFile::toText(ostream& out) const
+{
+   string text;
+
+   text.reserve(TEXTBUFFERSIZE + 3 * BatchRanker::MAXCARDS + 1);
+
+   for (unsigned long long hand = 0; hand < this->numHands; ++hand)
+   {
+      if (this->getColumn(0)[hand].isValid())
+      {
+         for (int card = 0; card < this->numCards; ++card)
+         {
+            const PackedCard packedCard = this->getColumn(card)[hand];
+
+            if (card > 0)
+            {
+               text += ' ';
+            }
+
+            text += RANKCHARACTERS[packedCard.getRank()];
+            text += SUITCHARACTERS[packedCard.getSuitIndex()];
+         }
+      }
+
+      text += '\n';
+
+      if (text.size() >= TEXTBUFFERSIZE)
+      {
+         writeText(out, text);
+      }
+   }
+
+   writeText(out, text);
+} // end HandFile::toText
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize data members to no file
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+ResultFile::ResultFile()
+   : values(NULL),
+     types(NULL),
+     numHands(0)
+{
+} // end ResultFile::ResultFile
+
+//******************************************************************************
+// Function : destructor
+// Process  : Close the file
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+ResultFile::~ResultFile()
+{
+   this->close();
+} // end ResultFile::~ResultFile
+
+//******************************************************************************
+// Function : close
+// Process  : Unmap the file and reset the columns
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ResultFile::close()
+{
+   this->mappedFile.close();
+   this->values   = NULL;
+   this->types    = NULL;
+   this->numHands = 0;
+} // end ResultFile::close
+
+//******************************************************************************
+// Function : create
+// Process  : Check the columns fit in memory
+//             Create the file at its full size, write the header, and point
+//             the columns into it
+// Notes    : Throws an exception if the file cannot be created
+//             The system zeroes the new file, so every value is 0 and every
+//             type INVALIDHAND until written
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ResultFile::create(
+   const char*                fileName,
+   const unsigned long long   numHands)
+{
+   const size_t handBytes = sizeof(int) + sizeof(unsigned char);
+
+   this->close();
+
+   if (numHands > (static_cast<size_t>(-1) - HandFile::HEADERBYTES) /
+                  handBytes)
+   {
+      throw exception("Too many hands in ResultFile::create");
+   }
+
+   this->mappedFile.create(fileName,
+                           HandFile::HEADERBYTES +
+                           static_cast<size_t>(numHands) * handBytes);
+   writeHeader(this->mappedFile, MAGIC, VERSION, 0, numHands);
+   this->setColumns(numHands);
+} // end ResultFile::create
+
+//******************************************************************************
+// Function : open
+// Process  : Map the file and read its header
+//             Check the size holds both columns, and point them into it
+// Notes    : Throws an exception, closing the file, if it does not hold
+//             results of this layout
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ResultFile::open(const char* fileName)
+{
+   const size_t         handBytes = sizeof(int) + sizeof(unsigned char);
+   int                  fileCards = 0;
+   unsigned long long   fileHands = 0;
+
+   this->close();
+   this->mappedFile.open(fileName);
+
+   if (!readHeader(this->mappedFile, MAGIC, VERSION, fileCards, fileHands) ||
+       fileCards != 0 ||
+       (this->mappedFile.getSize() - HandFile::HEADERBYTES) % handBytes != 0 ||
+       (this->mappedFile.getSize() - HandFile::HEADERBYTES) / handBytes !=
+          fileHands)
+   {
+      this->close();
+      throw exception("Invalid result file in ResultFile::open");
+   }
+
+   this->setColumns(fileHands);
+} // end ResultFile::open
+
+//******************************************************************************
+// Function : setColumns
+// Process  : Point the values after the header, and the types after the
+//             values
+// Notes    : The columns are written only through the getWritable
+//             accessors, so a read-only mapping is never written
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ResultFile::setColumns(const unsigned long long numHands)
+{
+   char* data = static_cast<char*>(
+                   const_cast<void*>(this->mappedFile.getData()));
+
+   this->numHands = numHands;
+   this->values   = reinterpret_cast<int*>(data + HandFile::HEADERBYTES);
+   this->types    = reinterpret_cast<unsigned char*>(
+                       data + HandFile::HEADERBYTES + numHands * sizeof(int));
+} // end ResultFile::setColumns
+
+//******************************************************************************
+// Function : toText
+// Process  : For each hand
+//                Append its value and type name, separated by a space, and a
+//                newline
+//                Write the text once it fills its buffer
+//             Write the rest of the text
+// Notes    : Throws an exception if a type is out of range or the output
+//             cannot be written
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ResultFile::toText(ostream& out) const
+{
+   string text;
+
+   text.reserve(2 * TEXTBUFFERSIZE);
+
+   for (unsigned long long hand = 0; hand < this->numHands; ++hand)
+   {
+      text += to_string(this->values[hand]);
+      text += ' ';
+      text += Hand::getTypeName(
+                 static_cast<Hand::HandType>(this->types[hand]));
+      text += '\n';
+
+      if (text.size() >= TEXTBUFFERSIZE)
+      {
+         writeText(out, text);
+      }
+   }
+
+   writeText(out, text);
+} // end ResultFile::toText
@@ -0,0 +1,480 @@
+//******************************************************************************
+//
+// File Name:     HandFile.h
+//
+// File Overview: Represents the binary columnar files of hands and of their
+//                ranks, mapped into memory
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added classes
+//******************************************************************************
+
+#ifndef HandFile_h
+#define HandFile_h
+
+#include <ostream>
+#include "Hand.h"
+#include "MappedFile.h"
+#include "PackedCard.h"
+
+//******************************************************************************
+//
+// Class:    HandFile
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : A hand file holds numHands hands of numCards cards, five or
+//             seven, stored by column: a header of HEADERSIZE native 32 bit
+//             words, then column 0 holding the first card of every hand,
+//             column 1 the second, and so on.  Each card is a PackedCard,
+//             one byte, so a column is read in place with no per-hand
+//             parsing, and a hand the text held invalid has INVALIDCARD in
+//             every column.
+//             The header holds MAGIC, VERSION, numCards, 0, then numHands
+//             as a low and a high word, and two words of 0, so the columns
+//             start 32 bytes into the file.
+//             fromText writes the file from the hand text format read by
+//             BatchRanker, toText writes it back.
+//
+//******************************************************************************
+class HandFile
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, no file is open
+   // Constraints : Need to open a file before reading hands
+   //***************************************************************************
+   HandFile();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks, unmaps the file
+   // Constraints : None
+   //***************************************************************************
+   virtual ~HandFile();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : close
+   // Description : Unmaps the file, if one is open
+   // Constraints : Columns returned by getColumn are no longer valid
+   //***************************************************************************
+   void close();
+
+   //***************************************************************************
+   // Function    : fromText
+   // Description : Writes a hand file of numCards cards per hand from the
+   //                lines of the text file, a hand per line, such as
+   //                "Ah Kd 7c 7s 2h"
+   //                A line not holding numCards unique valid cards is
+   //                stored as an invalid hand, so hand n is line n
+   // Constraints : Throws an exception if numCards is not 5 or 7, or a file
+   //                cannot be read or written
+   //***************************************************************************
+   static void fromText(
+      const char* textName,
+      const char* fileName,
+      const int   numCards);
+
+   //***************************************************************************
+   // Function    : getColumn
+   // Description : Returns the cards at cardIndex of every hand, numHands
+   //                cards
+   // Constraints : A file must be open, cardIndex must be 0 to numCards - 1
+   //***************************************************************************
+   inline const PackedCard* getColumn(const int cardIndex) const;
+
+   //***************************************************************************
+   // Function    : getNumCards
+   // Description : Accessor for numCards, the cards of each hand
+   // Constraints : Returns 0 if no file is open
+   //***************************************************************************
+   inline int getNumCards() const;
+
+   //***************************************************************************
+   // Function    : getNumHands
+   // Description : Accessor for numHands
+   // Constraints : Returns 0 if no file is open
+   //***************************************************************************
+   inline unsigned long long getNumHands() const;
+
+   //***************************************************************************
+   // Function    : isOpen
+   // Description : Returns whether a file is open
+   // Constraints : None
+   //***************************************************************************
+   inline bool isOpen() const;
+
+   //***************************************************************************
+   // Function    : open
+   // Description : Maps the hand file read-only
+   // Constraints : Throws an exception if the file cannot be mapped or does
+   //                not hold hands of this layout
+   //***************************************************************************
+   void open(const char* fileName);
+
+   //***************************************************************************
+   // Function    : toText
+   // Description : Writes each hand as a line of text, such as
+   //                "Ah Kd 7c 7s 2h", an empty line for an invalid hand
+   // Constraints : A file must be open
+   //                Throws an exception if the output cannot be written
+   //***************************************************************************
+   void toText(ostream& out) const;
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the layout of the hand file
+   enum HandFileLayout
+   {
+      MAGIC          = 0x53444E48,  // "HNDS"
+      VERSION        = 1,
+      HEADERSIZE     = 8,           // Words of the header
+      HEADERBYTES    = HEADERSIZE * 4,
+      INVALIDCARD    = PackedCard::INVALIDINDEX
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : copy constructor
+   // Description : Not implemented, the mapping has one owner
+   // Constraints : Private
+   //***************************************************************************
+   HandFile(const HandFile& handFile);
+
+   //***************************************************************************
+   // Function    : operator=
+   // Description : Not implemented, the mapping has one owner
+   // Constraints : Private
+   //***************************************************************************
+   HandFile& operator=(const HandFile& handFile);
+
+   MappedFile           mappedFile;    // Mapping of the hand file
+   const PackedCard*    columns;       // First column, NULL if not open
+   int                  numCards;      // Cards of each hand, columns
+   unsigned long long   numHands;      // Hands, cards of each column
+
+}; // end class HandFile
+
+//******************************************************************************
+//
+// Class:    ResultFile
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : A result file holds the hand value and type of each hand of a
+//             hand file, stored by column: the header, as in a hand file
+//             with numCards 0 and MAGIC of its own, then the 32 bit value
+//             of every hand, then the one byte Hand::HandType of every
+//             hand.
+//             create sizes the whole file up front and maps it writable, so
+//             the ranker writes each result in place, from any thread, and
+//             the system writes the pages back.
+//             toText writes the result text format written by BatchRanker.
+//
+//******************************************************************************
+class ResultFile
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, no file is open
+   // Constraints : Need to create or open a file before using results
+   //***************************************************************************
+   ResultFile();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks, unmaps the file
+   // Constraints : None
+   //***************************************************************************
+   virtual ~ResultFile();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : close
+   // Description : Unmaps the file, if one is open
+   // Constraints : Columns returned by the accessors are no longer valid
+   //***************************************************************************
+   void close();
+
+   //***************************************************************************
+   // Function    : create
+   // Description : Creates a result file of numHands hands, every value 0
+   //                and type INVALIDHAND, and maps it writable
+   // Constraints : Throws an exception if the file cannot be created
+   //***************************************************************************
+   void create(
+      const char*                fileName,
+      const unsigned long long   numHands);
+
+   //***************************************************************************
+   // Function    : getNumHands
+   // Description : Accessor for numHands
+   // Constraints : Returns 0 if no file is open
+   //***************************************************************************
+   inline unsigned long long getNumHands() const;
+
+   //***************************************************************************
+   // Function    : getTypes
+   // Description : Returns the Hand::HandType of every hand, numHands bytes
+   // Constraints : A file must be open
+   //***************************************************************************
+   inline const unsigned char* getTypes() const;
+
+   //***************************************************************************
+   // Function    : getValues
+   // Description : Returns the hand value of every hand, numHands values
+   // Constraints : A file must be open
+   //***************************************************************************
+   inline const int* getValues() const;
+
+   //***************************************************************************
+   // Function    : getWritableTypes
+   // Description : Returns the types of every hand, to write to
+   // Constraints : Returns NULL unless the file was created
+   //***************************************************************************
+   inline unsigned char* getWritableTypes() const;
+
+   //***************************************************************************
+   // Function    : getWritableValues
+   // Description : Returns the values of every hand, to write to
+   // Constraints : Returns NULL unless the file was created
+   //***************************************************************************
+   inline int* getWritableValues() const;
+
+   //***************************************************************************
+   // Function    : isOpen
+   // Description : Returns whether a file is open
+   // Constraints : None
+   //***************************************************************************
+   inline bool isOpen() const;
+
+   //***************************************************************************
+   // Function    : open
+   // Description : Maps the result file read-only
+   // Constraints : Throws an exception if the file cannot be mapped or does
+   //                not hold results of this layout
+   //***************************************************************************
+   void open(const char* fileName);
+
+   //***************************************************************************
+   // Function    : toText
+   // Description : Writes the value and type of each hand as a line of
+   //                text, such as "2468 ONEPAIR"
+   // Constraints : A file must be open
+   //                Throws an exception if a type is out of range or the
+   //                output cannot be written
+   //***************************************************************************
+   void toText(ostream& out) const;
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the layout of the result file
+   enum ResultFileLayout
+   {
+      MAGIC          = 0x53544C52,  // "RLTS"
+      VERSION        = 1
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : copy constructor
+   // Description : Not implemented, the mapping has one owner
+   // Constraints : Private
+   //***************************************************************************
+   ResultFile(const ResultFile& resultFile);
+
+   //***************************************************************************
+   // Function    : operator=
+   // Description : Not implemented, the mapping has one owner
+   // Constraints : Private
+   //***************************************************************************
+   ResultFile& operator=(const ResultFile& resultFile);
+
+   //***************************************************************************
+   // Function    : setColumns
+   // Description : Points the columns into the mapping of numHands hands
+   // Constraints : Private
+   //***************************************************************************
+   void setColumns(const unsigned long long numHands);
+
+   MappedFile           mappedFile;    // Mapping of the result file
+   int*                 values;        // Value column, NULL if not open
+   unsigned char*       types;         // Type column, NULL if not open
+   unsigned long long   numHands;      // Hands of each column
+
+}; // end class ResultFile
+
+//******************************************************************************
+// Function : getColumn
+// Process  : Return the column, numHands cards after the one before
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline const PackedCard* HandFile::getColumn(const int cardIndex) const
+{
+   return this->columns + cardIndex * this->numHands;
+} // end HandFile::getColumn
+
+//******************************************************************************
+// Function : getNumCards
+// Process  : Accessor for numCards
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int HandFile::getNumCards() const
+{
+   return this->numCards;
+} // end HandFile::getNumCards
+
+//******************************************************************************
+// Function : getNumHands
+// Process  : Accessor for numHands
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long HandFile::getNumHands() const
+{
+   return this->numHands;
+} // end HandFile::getNumHands
+
+//******************************************************************************
+// Function : isOpen
+// Process  : Return whether the columns point at a mapped file
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline bool HandFile::isOpen() const
+{
+   return this->columns != NULL;
+} // end HandFile::isOpen
+
+//******************************************************************************
+// Function : getNumHands
+// Process  : Accessor for numHands
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long ResultFile::getNumHands() const
+{
+   return this->numHands;
+} // end ResultFile::getNumHands
+
+//******************************************************************************
+// Function : getTypes
+// Process  : Accessor for types
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline const unsigned char* ResultFile::getTypes() const
+{
+   return this->types;
+} // end ResultFile::getTypes
+
+//******************************************************************************
+// Function : getValues
+// Process  : Accessor for values
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline const int* ResultFile::getValues() const
+{
+   return this->values;
+} // end ResultFile::getValues
+
+//******************************************************************************
+// Function : getWritableTypes
+// Process  : Return types if the mapping is writable, else NULL
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned char* ResultFile::getWritableTypes() const
+{
+   return this->mappedFile.getWritableData() != NULL ? this->types : NULL;
+} // end ResultFile::getWritableTypes
+
+//******************************************************************************
+// Function : getWritableValues
+// Process  : Return values if the mapping is writable, else NULL
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int* ResultFile::getWritableValues() const
+{
+   return this->mappedFile.getWritableData() != NULL ? this->values : NULL;
+} // end ResultFile::getWritableValues
+
+//******************************************************************************
+// Function : isOpen
+// Process  : Return whether the columns point at a mapped file
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline bool ResultFile::isOpen() const
+{
+   return this->values != NULL;
+} // end ResultFile::isOpen
+
+#endif // HandFile_h
@@ -0,0 +1,558 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     HandIndexer.cpp
+//
+// File Overview: Represents a Hand Indexer that maps cards to a canonical
+//                form and a dense index, the same for every permutation of
+//                the suits
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#include "stdafx.h"
+#include <algorithm>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+#include "CardSet.h"
+#include "HandIndexer.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : Check and copy the group sizes
+//             Fill the binomials of card numbers and the colex index of each
+//                mask of card numbers
+//             Enumerate every sorted tuple of suit configurations holding the
+//                cards of each group and sort the tuple keys
+//             For each tuple, in key order, its offset is the sum of the
+//                sizes of the tuples before it
+//                The size of a tuple is the product, over each run of suits
+//                of the same configuration, of the number of multisets of
+//                that many suit indexes
+// Notes    : Throw an exception if the group sizes are not supported
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HandIndexer::HandIndexer(
+   const int groupSizes[],
+   const int numGroups)
+   : groupSizes(),
+     numGroups(numGroups),
+     numCards(0),
+     size(0),
+     rankBinomials(),
+     colexIndexes()
+{
+   int configurations[NUMSUITS] = {};  // Configuration of each suit
+
+   if (numGroups < 1 || numGroups > MAXGROUPS)
+   {
+      throw exception("Invalid number of groups in HandIndexer::HandIndexer");
+   }
+
+   for (int group = 0; group < numGroups; ++group)
+   {
+      if (groupSizes[group] < 1)
+      {
+         throw exception("Invalid group size in HandIndexer::HandIndexer");
+      }
+
+      this->groupSizes[group] = groupSizes[group];
+      this->numCards         += groupSizes[group];
+   }
+
+   if (this->numCards > MAXCARDS)
+   {
+      throw exception("Invalid number of cards in HandIndexer::HandIndexer");
+   }
+
+   for (int n = 0; n <= NUMRANKS; ++n)
+   {
+      for (int k = 0; k <= NUMRANKS; ++k)
+      {
+         this->rankBinomials[n][k] = HandIndexer::choose(n, k);
+      }
+   }
+
+   for (int mask = 0; mask < NUMMASKS; ++mask)
+   {
+      int position = 0;
+
+      for (int rank = 0; rank < NUMRANKS; ++rank)
+      {
+         if (mask & (1 << rank))
+         {
+            ++position;
+            this->colexIndexes[mask] += static_cast<unsigned short>(
+               this->rankBinomials[rank][position]);
+         }
+      }
+   }
+
+   this->addConfigurations(0,
+                           this->groupSizes,
+                           (1 << (MAXGROUPS * GROUPBITS)) - 1,
+                           0);
+
+   sort(this->tupleKeys.begin(), this->tupleKeys.end());
+
+   for (size_t tuple = 0; tuple < this->tupleKeys.size(); ++tuple)
+   {
+      const int          CONFIGURATIONBITS = MAXGROUPS * GROUPBITS;
+      const int          CONFIGURATIONMASK = (1 << CONFIGURATIONBITS) - 1;
+      unsigned long long tupleSize         = 1;
+      int                suit              = 0;
+
+      for (suit = 0; suit < NUMSUITS; ++suit)
+      {
+         configurations[suit] = static_cast<int>(
+            (this->tupleKeys[tuple] >>
+             ((NUMSUITS - 1 - suit) * CONFIGURATIONBITS)) &
+            CONFIGURATIONMASK);
+      }
+
+      for (suit = 0; suit < NUMSUITS;)
+      {
+         int runEnd = suit;   // One past the last suit of the same
+                              // configuration
+
+         while (runEnd < NUMSUITS &&
+                configurations[runEnd] == configurations[suit])
+         {
+            ++runEnd;
+         }
+
+         tupleSize *= HandIndexer::choose(
+            this->getConfigurationSize(configurations[suit]) +
+               (runEnd - suit) - 1,
+            runEnd - suit);
+
+         suit = runEnd;
+      }
+
+      this->tupleOffsets.push_back(this->size);
+      this->size += tupleSize;
+   }
+} // end HandIndexer::HandIndexer
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HandIndexer::~HandIndexer()
+{
+} // end HandIndexer::~HandIndexer
+
+//******************************************************************************
+// Function : addConfigurations
+// Process  : If every suit has a configuration
+//                If every card is placed, add the tuple key
+//             Else, for each configuration no greater than the previous
+//                suit's that fits the remaining cards and the card numbers
+//                of a suit, recurse to the next suit without those cards
+// Notes    : Configurations are non-increasing by suit, so each tuple is
+//             added once
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandIndexer::addConfigurations(
+   const int                  suit,
+   const int                  remaining[],
+   const int                  maxConfiguration,
+   const unsigned long long   tupleKey)
+{
+   const int CONFIGURATIONBITS = MAXGROUPS * GROUPBITS;
+   const int COUNTMASK         = (1 << GROUPBITS) - 1;
+   int       nextRemaining[MAXGROUPS] = {};   // Cards left after this suit
+
+   if (suit == NUMSUITS)
+   {
+      for (int group = 0; group < this->numGroups; ++group)
+      {
+         if (remaining[group] != 0)
+         {
+            return;
+         }
+      }
+
+      this->tupleKeys.push_back(tupleKey);
+      return;
+   }
+
+   for (int configuration = 0;
+        configuration <= maxConfiguration;
+        ++configuration)
+   {
+      int  suitCards = 0;     // Cards of this suit in every group
+      bool fits      = true;  // Whether the configuration fits
+
+      for (int group = 0; group < MAXGROUPS && fits; ++group)
+      {
+         int count = (configuration >>
+                      ((MAXGROUPS - 1 - group) * GROUPBITS)) & COUNTMASK;
+
+         if (group >= this->numGroups)
+         {
+            fits = count == 0;
+         }
+         else
+         {
+            fits                 = count <= remaining[group];
+            nextRemaining[group] = remaining[group] - count;
+            suitCards           += count;
+         }
+      }
+
+      if (fits && suitCards <= NUMRANKS)
+      {
+         this->addConfigurations(
+            suit + 1,
+            nextRemaining,
+            configuration,
+            tupleKey | (static_cast<unsigned long long>(configuration) <<
+                        ((NUMSUITS - 1 - suit) * CONFIGURATIONBITS)));
+      }
+   }
+} // end HandIndexer::addConfigurations
+
+//******************************************************************************
+// Function : canonicalize
+// Process  : Sort the suits into the canonical order
+//             The suit at each position of the order becomes the suit of
+//                that index
+//             Copy each group with the suits mapped and sort it by card index
+//                from highest to lowest
+// Notes    : The cards must be valid and unique
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandIndexer::canonicalize(
+   const PackedCard  cards[],
+   PackedCard        canonicalCards[]) const
+{
+   unsigned long long suitKeys[NUMSUITS];        // Suits in canonical order
+   int                canonicalSuits[NUMSUITS];  // New suit of each suit
+   int                groupStart = 0;            // First card of the group
+
+   this->sortSuits(cards, suitKeys);
+
+   for (int position = 0; position < NUMSUITS; ++position)
+   {
+      canonicalSuits[suitKeys[position] & (NUMSUITS - 1)] = position;
+   }
+
+   for (int group = 0; group < this->numGroups; ++group)
+   {
+      int groupEnd = groupStart + this->groupSizes[group];
+
+      for (int card = groupStart; card < groupEnd; ++card)
+      {
+         int cardIndex = cards[card].getRank() * NUMSUITS +
+                         canonicalSuits[cards[card].getSuitIndex()];
+
+         // Insert the card, keeping the group sorted high to low
+         int position = card;
+
+         for (; position > groupStart &&
+                canonicalCards[position - 1].getIndex() < cardIndex;
+              --position)
+         {
+            canonicalCards[position] = canonicalCards[position - 1];
+         }
+
+         canonicalCards[position] = PackedCard::fromIndex(cardIndex);
+      }
+
+      groupStart = groupEnd;
+   }
+} // end HandIndexer::canonicalize
+
+//******************************************************************************
+// Function : choose
+// Process  : Multiply in (n - i) / (i + 1) for i from 0 to k - 1, each
+//             partial product is itself a binomial so the division is exact
+// Notes    : Return 0 if k is negative or greater than n
+//             Up to four of fewer than 2^16 is one product, without the
+//             divisions of the loop
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+unsigned long long HandIndexer::choose(
+   const long long   n,
+   const int         k)
+{
+   unsigned long long result = 1;
+
+   if (k < 0 || k > n)
+   {
+      return 0;
+   }
+
+   // Small k, as in every run of suits of the same configuration, is a
+   // product divided by a constant, which compiles to a multiply
+   // n below 2^16 keeps the product of four within 64 bits
+   if (n < SMALLCHOOSELIMIT)
+   {
+      unsigned long long value = static_cast<unsigned long long>(n);
+
+      switch (k)
+      {
+         case 0:
+            return 1;
+         case 1:
+            return value;
+         case 2:
+            return value * (value - 1) / 2;
+         case 3:
+            return value * (value - 1) * (value - 2) / 6;
+         case 4:
+            return value * (value - 1) * (value - 2) * (value - 3) / 24;
+         default:
+            break;
+      }
+   }
+
+   for (int i = 0; i < k; ++i)
+   {
+      result = result * static_cast<unsigned long long>(n - i) / (i + 1);
+   }
+
+   return result;
+} // end HandIndexer::choose
+
+//******************************************************************************
+// Function : getConfigurationSize
+// Process  : Multiply the number of ways to choose each group's count of
+//             card numbers among those not used by the earlier groups
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+unsigned long long HandIndexer::getConfigurationSize(
+   const int configuration) const
+{
+   const int          COUNTMASK = (1 << GROUPBITS) - 1;
+   unsigned long long result    = 1;
+   int                used      = 0;  // Card numbers in the earlier groups
+
+   for (int group = 0; group < this->numGroups; ++group)
+   {
+      int count = (configuration >> ((MAXGROUPS - 1 - group) * GROUPBITS)) &
+                  COUNTMASK;
+
+      result *= this->rankBinomials[NUMRANKS - used][count];
+      used   += count;
+   }
+
+   return result;
+} // end HandIndexer::getConfigurationSize
+
+//******************************************************************************
+// Function : getIndex
+// Process  : Sort the suits into the canonical order
+//             Find the offset of the tuple of their configurations
+//             For each run of suits of the same configuration, with suit
+//                indexes sorted high to low, index the multiset as the sum of
+//                C(index + run - 1 - k, run - k) over its k-th index
+//             Combine the multiset indexes in mixed radix, each radix the
+//                number of multisets of its run, and add the offset
+// Notes    : The cards must be valid and unique
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+unsigned long long HandIndexer::getIndex(const PackedCard cards[]) const
+{
+   const int          CONFIGURATIONBITS = MAXGROUPS * GROUPBITS;
+   unsigned long long suitKeys[NUMSUITS];  // Suits in canonical order
+   unsigned long long tupleKey   = 0;
+   unsigned long long index      = 0;
+   unsigned long long multiplier = 1;
+
+   this->sortSuits(cards, suitKeys);
+
+   for (int position = 0; position < NUMSUITS; ++position)
+   {
+      tupleKey |= (suitKeys[position] >> CONFIGURATIONSHIFT) <<
+                  ((NUMSUITS - 1 - position) * CONFIGURATIONBITS);
+   }
+
+   for (int position = 0; position < NUMSUITS;)
+   {
+      int                configuration = static_cast<int>(
+                                            suitKeys[position] >>
+                                            CONFIGURATIONSHIFT);
+      int                runEnd        = position + 1;
+      int                runSize       = 0;
+      unsigned long long runIndex      = 0;   // Index of the multiset
+
+      while (runEnd < NUMSUITS &&
+             (suitKeys[runEnd] >> CONFIGURATIONSHIFT) ==
+                static_cast<unsigned long long>(configuration))
+      {
+         ++runEnd;
+      }
+
+      runSize = runEnd - position;
+
+      for (int k = 0; k < runSize; ++k)
+      {
+         unsigned int suitIndex = static_cast<unsigned int>(
+                                     suitKeys[position + k] >>
+                                     SUITINDEXSHIFT);
+
+         runIndex += HandIndexer::choose(
+            static_cast<long long>(suitIndex) + runSize - 1 - k,
+            runSize - k);
+      }
+
+      index      += multiplier * runIndex;
+      multiplier *= HandIndexer::choose(
+         this->getConfigurationSize(configuration) + runSize - 1, runSize);
+
+      position = runEnd;
+   }
+
+   return this->tupleOffsets[lower_bound(this->tupleKeys.begin(),
+                                         this->tupleKeys.end(),
+                                         tupleKey) -
+                             this->tupleKeys.begin()] + index;
+} // end HandIndexer::getIndex
+
+//******************************************************************************
+// Function : sortSuits
+// Process  : Build the mask of card numbers of each suit in each group
+//             For each suit, for each group
+//                Count its cards into the configuration
+//                Remove the card numbers used by the earlier groups from
+//                   its mask and look up the colex index of the rest
+//                Add the group index in mixed radix to the suit index
+//             Pack the configuration, suit index, and suit into a key
+//             Sort the keys from highest to lowest with a sorting network
+// Notes    : The cards must be valid and unique
+//             Removing the used card numbers is one PEXT where the compiler
+//             targets BMI2, else a step per used card number
+//             The sorting network compiles to conditional moves, the order
+//             of the suits is random so branches would mispredict
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandIndexer::sortSuits(
+   const PackedCard     cards[],
+   unsigned long long   suitKeys[]) const
+{
+   // Pairs of positions compared by the four suit sorting network
+   static const int SORTPAIRS[][2] =
+   {
+      { 0, 1 }, { 2, 3 }, { 0, 2 }, { 1, 3 }, { 1, 2 }
+   };
+
+   const int NUMPAIRS = sizeof(SORTPAIRS) / sizeof(SORTPAIRS[0]);
+   int       masks[MAXGROUPS][NUMSUITS] = {};   // Card numbers of each group
+                                                // and suit
+   int       card                       = 0;
+
+   for (int group = 0; group < this->numGroups; ++group)
+   {
+      for (int groupCard = 0; groupCard < this->groupSizes[group]; ++groupCard)
+      {
+         masks[group][cards[card].getSuitIndex()] |=
+            1 << cards[card].getRank();
+         ++card;
+      }
+   }
+
+   for (int suit = 0; suit < NUMSUITS; ++suit)
+   {
+      int                used          = 0;  // Card numbers in earlier groups
+      int                numUsed       = 0;
+      int                configuration = 0;
+      unsigned long long suitIndex     = 0;
+      unsigned long long multiplier    = 1;
+
+      for (int group = 0; group < this->numGroups; ++group)
+      {
+         int mask       = masks[group][suit];
+         int count      = CardSet::popCount(mask);
+         int compressed = mask;   // Mask without the used card numbers
+
+#if defined(__BMI2__)
+         compressed = static_cast<int>(_pext_u32(mask, ~used));
+#else
+         int removed    = 0;
+
+         // Remove each used card number, low to high, shifting the card
+         // numbers above it down one
+         for (int usedBits = used; usedBits != 0; usedBits &= usedBits - 1)
+         {
+            int low = (1 << (CardSet::popCount((usedBits & -usedBits) - 1) -
+                             removed)) - 1;
+
+            compressed = (compressed & low) | ((compressed >> 1) & ~low);
+            ++removed;
+         }
+#endif
+
+         configuration |= count << ((MAXGROUPS - 1 - group) * GROUPBITS);
+         suitIndex     += multiplier * this->colexIndexes[compressed];
+         multiplier    *= this->rankBinomials[NUMRANKS - numUsed][count];
+         used          |= mask;
+         numUsed       += count;
+      }
+
+      suitKeys[suit] =
+         (static_cast<unsigned long long>(configuration) <<
+          CONFIGURATIONSHIFT) |
+         (suitIndex << SUITINDEXSHIFT) |
+         static_cast<unsigned long long>(suit);
+   }
+
+   for (int pair = 0; pair < NUMPAIRS; ++pair)
+   {
+      unsigned long long high = suitKeys[SORTPAIRS[pair][0]];
+      unsigned long long low  = suitKeys[SORTPAIRS[pair][1]];
+
+      suitKeys[SORTPAIRS[pair][0]] = high > low ? high : low;
+      suitKeys[SORTPAIRS[pair][1]] = high > low ? low : high;
+   }
+} // end HandIndexer::sortSuits
@@ -0,0 +1,227 @@
+//******************************************************************************
+//
+// File Name:     HandIndexer.h
+//
+// File Overview: Represents a Hand Indexer that maps cards to a canonical
+//                form and a dense index, the same for every permutation of
+//                the suits
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef HandIndexer_h
+#define HandIndexer_h
+
+#include <vector>
+#include "PackedCard.h"
+
+//******************************************************************************
+//
+// Class:    HandIndexer
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : The cards are split into groups, such as the hole cards then
+//             the board, the order of cards within a group does not matter
+//             and the order of the groups does.  Two hands are isomorphic
+//             if a permutation of the suits maps one to the other.
+//             For each suit, its configuration is the count of its cards in
+//             each group and its suit index numbers its card numbers among
+//             all those of its configuration, each group indexed among the
+//             numbers not used by the earlier groups.
+//             The suits are sorted by configuration then suit index, which
+//             is the canonical suit order.  Suits of the same configuration
+//             form a multiset of suit indexes, indexed in colex order, and
+//             each sorted tuple of configurations starts at an offset, so
+//             the index is dense from 0 to getSize() - 1.
+//             Two hole cards: 169 indexes, with a three, four, and five
+//             card board: 1286792, 13960050, and 123156254 indexes.
+//
+//******************************************************************************
+class HandIndexer
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the indexer for the input number of cards in
+   //                each group and builds the configuration offsets
+   // Constraints : Throws an exception if there are no groups, more than
+   //                MAXGROUPS groups, a group without cards, or more than
+   //                MAXCARDS cards
+   //***************************************************************************
+   HandIndexer(
+      const int groupSizes[],
+      const int numGroups);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~HandIndexer();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : canonicalize
+   // Description : Writes the cards with their suits permuted to the
+   //                canonical order, each group sorted by card index from
+   //                highest to lowest
+   //                Isomorphic hands have the same canonical cards
+   // Constraints : cards and canonicalCards must hold getNumCards() cards,
+   //                group after group, the cards must be valid and unique
+   //***************************************************************************
+   void canonicalize(
+      const PackedCard  cards[],
+      PackedCard        canonicalCards[]) const;
+
+   //***************************************************************************
+   // Function    : getIndex
+   // Description : Returns the dense index of the cards, from 0 to
+   //                getSize() - 1, the same for isomorphic hands
+   // Constraints : cards must hold getNumCards() cards, group after group,
+   //                the cards must be valid and unique
+   //***************************************************************************
+   unsigned long long getIndex(const PackedCard cards[]) const;
+
+   //***************************************************************************
+   // Function    : getNumCards
+   // Description : Accessor for numCards, the cards in all groups
+   // Constraints : None
+   //***************************************************************************
+   inline int getNumCards() const;
+
+   //***************************************************************************
+   // Function    : getSize
+   // Description : Accessor for size, the number of hands up to
+   //                isomorphism
+   // Constraints : None
+   //***************************************************************************
+   inline unsigned long long getSize() const;
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the limits of the indexer
+   enum HandIndexerSize
+   {
+      MAXGROUPS         = 4,
+      MAXCARDS          = 8,
+      NUMSUITS          = PackedCard::NUMSUITS,
+      NUMRANKS          = PackedCard::NUMRANKS,
+      NUMMASKS          = 1 << NUMRANKS,
+      SMALLCHOOSELIMIT  = 1 << 16,  // Limit of n to choose without dividing
+      GROUPBITS         = 4         // Bits of each group count in a
+                                    // configuration
+   };
+
+   // Represents the layout of a suit key: the suit in the low bits, the
+   // suit index above it, then the configuration
+   enum SuitKeyLayout
+   {
+      SUITINDEXSHIFT       = 2,
+      CONFIGURATIONSHIFT   = SUITINDEXSHIFT + 32
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : addConfigurations
+   // Description : Recursively enumerates every sorted tuple of suit
+   //                configurations that holds the remaining cards and adds
+   //                its key
+   // Constraints : Private, called by the constructor
+   //***************************************************************************
+   void addConfigurations(
+      const int                  suit,
+      const int                  remaining[],
+      const int                  maxConfiguration,
+      const unsigned long long   tupleKey);
+
+   //***************************************************************************
+   // Function    : choose
+   // Description : Returns the number of ways to choose k of n
+   // Constraints : Private, returns 0 if k is negative or greater than n
+   //***************************************************************************
+   static unsigned long long choose(
+      const long long   n,
+      const int         k);
+
+   //***************************************************************************
+   // Function    : getConfigurationSize
+   // Description : Returns the number of suit indexes of the configuration
+   // Constraints : Private
+   //***************************************************************************
+   unsigned long long getConfigurationSize(const int configuration) const;
+
+   //***************************************************************************
+   // Function    : sortSuits
+   // Description : Computes the key of each suit, its configuration then
+   //                suit index then suit, and sorts the keys from highest to
+   //                lowest, the canonical order
+   // Constraints : Private, the cards must be valid and unique
+   //***************************************************************************
+   void sortSuits(
+      const PackedCard     cards[],
+      unsigned long long   suitKeys[]) const;
+
+   int                        groupSizes[MAXGROUPS];  // Cards in each group
+   int                        numGroups;              // Number of groups
+   int                        numCards;               // Cards in all groups
+   unsigned long long         size;                   // Number of indexes
+
+   // C(n, k) for n and k up to the number of card numbers, and the colex
+   // index of each mask of card numbers, the sum of C(rank, position) over
+   // its card numbers, filled by the constructor so per suit indexing is
+   // lookups
+   unsigned long long         rankBinomials[NUMRANKS + 1][NUMRANKS + 1];
+   unsigned short             colexIndexes[NUMMASKS];
+
+   // Sorted keys of the tuples of suit configurations and the first index
+   // of each tuple, searched by getIndex
+   vector<unsigned long long> tupleKeys;
+   vector<unsigned long long> tupleOffsets;
+
+}; // end class HandIndexer
+
+//******************************************************************************
+// Function : getNumCards
+// Process  : Accessor for numCards
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int HandIndexer::getNumCards() const
+{
+   return this->numCards;
+} // end HandIndexer::getNumCards
+
+//******************************************************************************
+// Function : getSize
+// Process  : Accessor for size
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long HandIndexer::getSize() const
+{
+   return this->size;
+} // end HandIndexer::getSize
+
+#endif // HandIndexer_h
@@ -0,0 +1,508 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     HandRange.cpp
+//
+// File Overview: Represents a Hand Range, a weight for each of the 1326
+//                combinations of two hole cards, parsed from range notation
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Made the card character parsers public
+//******************************************************************************
+
+#include "stdafx.h"
+#include <algorithm>
+#include <cstdlib>
+#include "HandRange.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// Card number characters by rank, and suit characters by suit index
+static const string RANKCHARACTERS = "23456789TJQKA";
+static const string SUITCHARACTERS = "cshd";
+
+// Characters between the items and the weight of an item
+static const string SPACECHARACTERS = " \t";
+
+//******************************************************************************
+// Function : constructor
+// Process  : Start every weight at zero
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HandRange::HandRange()
+   : weights(NUMCOMBOS, 0.0)
+{
+} // end HandRange::HandRange
+
+//******************************************************************************
+// Function : constructor
+// Process  : Start every weight at zero and add the notation
+// Notes    : Throw an exception if the notation is invalid
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HandRange::HandRange(const string& notation)
+   : weights(NUMCOMBOS, 0.0)
+{
+   this->add(notation);
+} // end HandRange::HandRange
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HandRange::~HandRange()
+{
+} // end HandRange::~HandRange
+
+//******************************************************************************
+// Function : add
+// Process  : Split the notation at each comma and add each item
+// Notes    : Skip empty items, such as after a trailing comma
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandRange::add(const string& notation)
+{
+   string::size_type start = 0;   // Start of the item
+
+   while (start <= notation.size())
+   {
+      string::size_type end = notation.find(',', start);
+
+      if (end == string::npos)
+      {
+         end = notation.size();
+      }
+
+      string item = notation.substr(start, end - start);
+
+      if (item.find_first_not_of(SPACECHARACTERS) != string::npos)
+      {
+         this->addItem(item);
+      }
+
+      start = end + 1;
+   }
+} // end HandRange::add
+
+//******************************************************************************
+// Function : addCombos
+// Process  : For each pair of suits, add the combo if it has the suits:
+//             a pair takes each two suits once, suited the same suit, and
+//             offsuit two different suits
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandRange::addCombos(
+   const int         firstRank,
+   const int         secondRank,
+   const ComboSuits  suits,
+   const double      weight)
+{
+   for (int firstSuit = 0; firstSuit < PackedCard::NUMSUITS; ++firstSuit)
+   {
+      for (int secondSuit = 0;
+           secondSuit < PackedCard::NUMSUITS;
+           ++secondSuit)
+      {
+         bool added = false;   // Whether the suits make a combo
+
+         if (firstRank == secondRank)
+         {
+            added = firstSuit < secondSuit;
+         }
+         else if (suits == SUITED)
+         {
+            added = firstSuit == secondSuit;
+         }
+         else if (suits == OFFSUIT)
+         {
+            added = firstSuit != secondSuit;
+         }
+         else
+         {
+            added = true;
+         }
+
+         if (added)
+         {
+            this->weights[HandRange::getComboIndex(
+               PackedCard::fromIndex(
+                  firstRank * PackedCard::NUMSUITS + firstSuit),
+               PackedCard::fromIndex(
+                  secondRank * PackedCard::NUMSUITS + secondSuit))] = weight;
+         }
+      }
+   }
+} // end HandRange::addCombos
+
+//******************************************************************************
+// Function : addItem
+// Process  : Trim the item and split off a trailing percent weight
+//             A card number and suit, twice, is a single combo
+//             Else with a dash, add each pair between the two pairs, or each
+//                hand between the two hands with the same high card or the
+//                same gap
+//             Else with a plus, add the pair and each higher pair, or the
+//                hand and each higher kicker below the high card
+//             Else add the hand
+// Notes    : Throw an exception if the item is invalid
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandRange::addItem(const string& item)
+{
+   string::size_type first  = item.find_first_not_of(SPACECHARACTERS);
+   string::size_type last   = item.find_last_not_of(SPACECHARACTERS);
+   string            hands  = item.substr(first, last - first + 1);
+   double            weight = 1.0;
+   int               highRank;
+   int               lowRank;
+   ComboSuits        suits;
+
+   if (hands[hands.size() - 1] == '%')
+   {
+      string::size_type space  = hands.find_last_of(SPACECHARACTERS);
+      char*             end    = NULL;
+
+      if (space == string::npos)
+      {
+         throw exception("Invalid weight in HandRange::addItem");
+      }
+
+      string percent = hands.substr(space + 1, hands.size() - space - 2);
+
+      weight = strtod(percent.c_str(), &end) / 100.0;
+
+      if (percent.empty() || *end != '\0' || weight < 0.0 || weight > 1.0)
+      {
+         throw exception("Invalid weight in HandRange::addItem");
+      }
+
+      last  = hands.find_last_not_of(SPACECHARACTERS, space);
+      hands = hands.substr(0, last + 1);
+   }
+
+   if (hands.find_first_of(SPACECHARACTERS) != string::npos)
+   {
+      throw exception("Invalid range in HandRange::addItem");
+   }
+
+   if (hands.size() == 4 &&
+       HandRange::parseSuit(hands[1]) >= 0 &&
+       HandRange::parseSuit(hands[3]) >= 0)
+   {
+      int firstRank  = HandRange::parseRank(hands[0]);
+      int secondRank = HandRange::parseRank(hands[2]);
+
+      if (firstRank < 0 || secondRank < 0 || hands.substr(0, 2) ==
+          hands.substr(2, 2))
+      {
+         throw exception("Invalid combo in HandRange::addItem");
+      }
+
+      this->weights[HandRange::getComboIndex(
+         PackedCard::fromIndex(firstRank * PackedCard::NUMSUITS +
+                               HandRange::parseSuit(hands[1])),
+         PackedCard::fromIndex(secondRank * PackedCard::NUMSUITS +
+                               HandRange::parseSuit(hands[3])))] = weight;
+   }
+   else if (hands.find('-') != string::npos)
+   {
+      string::size_type dash = hands.find('-');
+      int               endHighRank;
+      int               endLowRank;
+      ComboSuits        endSuits;
+
+      HandRange::parseHand(hands.substr(0, dash),
+                           highRank,
+                           lowRank,
+                           suits);
+      HandRange::parseHand(hands.substr(dash + 1),
+                           endHighRank,
+                           endLowRank,
+                           endSuits);
+
+      if (suits != endSuits)
+      {
+         throw exception("Invalid range in HandRange::addItem");
+      }
+
+      if (highRank == lowRank && endHighRank == endLowRank)
+      {
+         for (int rank = min(highRank, endHighRank);
+              rank <= max(highRank, endHighRank);
+              ++rank)
+         {
+            this->addCombos(rank, rank, suits, weight);
+         }
+      }
+      else if (highRank != lowRank && highRank == endHighRank)
+      {
+         for (int rank = min(lowRank, endLowRank);
+              rank <= max(lowRank, endLowRank);
+              ++rank)
+         {
+            this->addCombos(highRank, rank, suits, weight);
+         }
+      }
+      else if (highRank != lowRank &&
+               highRank - lowRank == endHighRank - endLowRank)
+      {
+         for (int rank = min(lowRank, endLowRank);
+              rank <= max(lowRank, endLowRank);
+              ++rank)
+         {
+            this->addCombos(rank + highRank - lowRank, rank, suits, weight);
+         }
+      }
+      else
+      {
+         throw exception("Invalid range in HandRange::addItem");
+      }
+   }
+   else if (hands[hands.size() - 1] == '+')
+   {
+      HandRange::parseHand(hands.substr(0, hands.size() - 1),
+                           highRank,
+                           lowRank,
+                           suits);
+
+      if (highRank == lowRank)
+      {
+         for (int rank = highRank; rank < PackedCard::NUMRANKS; ++rank)
+         {
+            this->addCombos(rank, rank, suits, weight);
+         }
+      }
+      else
+      {
+         for (int rank = lowRank; rank < highRank; ++rank)
+         {
+            this->addCombos(highRank, rank, suits, weight);
+         }
+      }
+   }
+   else
+   {
+      HandRange::parseHand(hands, highRank, lowRank, suits);
+      this->addCombos(highRank, lowRank, suits, weight);
+   }
+} // end HandRange::addItem
+
+//******************************************************************************
+// Function : clear
+// Process  : Set every weight to zero
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandRange::clear()
+{
+   this->weights.assign(NUMCOMBOS, 0.0);
+} // end HandRange::clear
+
+//******************************************************************************
+// Function : getComboCards
+// Process  : Find the highest card index with C(high, 2) at most the combo
+//             index, the rest of the index is the low card index
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandRange::getComboCards(
+   const int   comboIndex,
+   PackedCard  cards[])
+{
+   int high = 1;
+
+   while ((high + 1) * high / 2 <= comboIndex)
+   {
+      high++;
+   }
+
+   cards[0] = PackedCard::fromIndex(high);
+   cards[1] = PackedCard::fromIndex(comboIndex - high * (high - 1) / 2);
+} // end HandRange::getComboCards
+
+//******************************************************************************
+// Function : getNumCombos
+// Process  : Count the positive weights
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int HandRange::getNumCombos() const
+{
+   int numCombos = 0;
+
+   for (int combo = 0; combo < NUMCOMBOS; ++combo)
+   {
+      if (this->weights[combo] > 0.0)
+      {
+         numCombos++;
+      }
+   }
+
+   return numCombos;
+} // end HandRange::getNumCombos
+
+//******************************************************************************
+// Function : parseHand
+// Process  : Parse the two card numbers, then an s for suited or o for
+//             offsuit, else both
+//             Order the ranks highest first
+// Notes    : Throw an exception if the text is invalid or a pair is suited
+//             or offsuit
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandRange::parseHand(
+   const string&  text,
+   int&           highRank,
+   int&           lowRank,
+   ComboSuits&    suits)
+{
+   if (text.size() < 2 || text.size() > 3)
+   {
+      throw exception("Invalid hand in HandRange::parseHand");
+   }
+
+   highRank = HandRange::parseRank(text[0]);
+   lowRank  = HandRange::parseRank(text[1]);
+   suits    = ANYSUITS;
+
+   if (text.size() == 3)
+   {
+      if (text[2] == 's')
+      {
+         suits = SUITED;
+      }
+      else if (text[2] == 'o')
+      {
+         suits = OFFSUIT;
+      }
+      else
+      {
+         throw exception("Invalid hand in HandRange::parseHand");
+      }
+   }
+
+   if (highRank < 0 || lowRank < 0 ||
+       (highRank == lowRank && suits != ANYSUITS))
+   {
+      throw exception("Invalid hand in HandRange::parseHand");
+   }
+
+   if (lowRank > highRank)
+   {
+      swap(highRank, lowRank);
+   }
+} // end HandRange::parseHand
+
+//******************************************************************************
+// Function : parseRank
+// Process  : Find the character among the card number characters
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int HandRange::parseRank(const char character)
+{
+   string::size_type rank = RANKCHARACTERS.find(character);
+
+   return rank == string::npos ? -1 : static_cast<int>(rank);
+} // end HandRange::parseRank
+
+//******************************************************************************
+// Function : parseSuit
+// Process  : Find the character among the suit characters
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int HandRange::parseSuit(const char character)
+{
+   string::size_type suit = SUITCHARACTERS.find(character);
+
+   return suit == string::npos ? -1 : static_cast<int>(suit);
+} // end HandRange::parseSuit
+
+//******************************************************************************
+// Function : setWeight
+// Process  : Check the combo index and weight, then set the weight
+// Notes    : Throw an exception if the combo index or weight is invalid
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HandRange::setWeight(
+   const int      comboIndex,
+   const double   weight)
+{
+   if (comboIndex < 0 || comboIndex >= NUMCOMBOS)
+   {
+      throw exception("Invalid combo in HandRange::setWeight");
+   }
+
+   if (weight < 0.0 || weight > 1.0)
+   {
+      throw exception("Invalid weight in HandRange::setWeight");
+   }
+
+   this->weights[comboIndex] = weight;
+} // end HandRange::setWeight
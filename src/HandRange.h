@@ -0,0 +1,304 @@
+//******************************************************************************
+//
+// File Name:     HandRange.h
+//
+// File Overview: Represents a Hand Range, a weight for each of the 1326
+//                combinations of two hole cards, parsed from range notation
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Made the card character parsers public
+//******************************************************************************
+
+#ifndef HandRange_h
+#define HandRange_h
+
+#include <string>
+#include <vector>
+#include "CardSet.h"
+#include "PackedCard.h"
+
+//******************************************************************************
+//
+// Class:    HandRange
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Made the card character parsers public
+//
+// Notes    : Each combination of two hole cards, a combo, has an index from
+//             0 to NUMCOMBOS - 1, the colex index of its two card indexes:
+//             C(high, 2) + low.  A range holds a weight from 0 to 1 for
+//             each combo, 0 if not in the range.
+//             Notation is a comma separated list of items, each optionally
+//             followed by a percent weight, such as
+//             "QQ+, AKs, T9s-65s, AJo+ 50%":
+//                QQ, AKs, AKo, AK     a pair, suited, offsuit, or both
+//                QQ+, AJo+            the pair and each higher pair, or the
+//                                     kicker and each higher kicker
+//                QQ-99, T9s-65s       each pair, or each hand with the same
+//                A5s-A2s              gap or the same high card, between
+//                AhKh                 a single combo
+//             A later item sets the weight of a combo listed again.
+//
+//******************************************************************************
+class HandRange
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, an empty range
+   // Constraints : None
+   //***************************************************************************
+   HandRange();
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Parses the notation into a range
+   // Constraints : Throws an exception if the notation is invalid
+   //***************************************************************************
+   explicit HandRange(const string& notation);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~HandRange();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : add
+   // Description : Parses the notation and sets the weight of each combo
+   //                it lists
+   // Constraints : Throws an exception if the notation is invalid, leaving
+   //                the items before the invalid one added
+   //***************************************************************************
+   void add(const string& notation);
+
+   //***************************************************************************
+   // Function    : clear
+   // Description : Removes every combo
+   // Constraints : None
+   //***************************************************************************
+   void clear();
+
+   //***************************************************************************
+   // Function    : getComboCards
+   // Description : Writes the two cards of the combo, highest index first
+   // Constraints : comboIndex must be 0 to NUMCOMBOS - 1, cards must hold
+   //                two cards
+   //***************************************************************************
+   static void getComboCards(
+      const int   comboIndex,
+      PackedCard  cards[]);
+
+   //***************************************************************************
+   // Function    : getComboIndex
+   // Description : Returns the index of the combo of the two cards, in
+   //                either order
+   // Constraints : The cards must be valid and different
+   //***************************************************************************
+   static inline int getComboIndex(
+      const PackedCard first,
+      const PackedCard second);
+
+   //***************************************************************************
+   // Function    : getComboMask
+   // Description : Returns the set of the two cards of the combo
+   // Constraints : comboIndex must be 0 to NUMCOMBOS - 1
+   //***************************************************************************
+   static inline CardSet getComboMask(const int comboIndex);
+
+   //***************************************************************************
+   // Function    : getNumCombos
+   // Description : Returns the number of combos with a positive weight
+   // Constraints : None
+   //***************************************************************************
+   int getNumCombos() const;
+
+   //***************************************************************************
+   // Function    : getWeight
+   // Description : Accessor for the weight of the combo
+   // Constraints : comboIndex must be 0 to NUMCOMBOS - 1
+   //***************************************************************************
+   inline double getWeight(const int comboIndex) const;
+
+   //***************************************************************************
+   // Function    : getWeights
+   // Description : Accessor for weights, NUMCOMBOS weights by combo index
+   // Constraints : None
+   //***************************************************************************
+   inline const vector<double>& getWeights() const;
+
+   //***************************************************************************
+   // Function    : parseRank
+   // Description : Returns the rank of the card number character, such as T,
+   //                or -1 if it is not one
+   // Constraints : None
+   //***************************************************************************
+   static int parseRank(const char character);
+
+   //***************************************************************************
+   // Function    : parseSuit
+   // Description : Returns the suit index of the suit character, c, s, h,
+   //                or d, or -1 if it is not one
+   // Constraints : None
+   //***************************************************************************
+   static int parseSuit(const char character);
+
+   //***************************************************************************
+   // Function    : setWeight
+   // Description : Mutator for the weight of the combo
+   // Constraints : Throws an exception if the combo index or the weight is
+   //                invalid
+   //***************************************************************************
+   void setWeight(
+      const int      comboIndex,
+      const double   weight);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the size of a range
+   enum HandRangeSize
+   {
+      NUMCOMBOS   = 1326,
+      NUMCARDS    = PackedCard::NUMCARDS
+   };
+
+   // Represents the suits of the combos of two card numbers
+   enum ComboSuits
+   {
+      ANYSUITS,
+      SUITED,
+      OFFSUIT
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : addCombos
+   // Description : Sets the weight of each combo of the two card numbers with
+   //                the suits
+   // Constraints : Private, ranks must be 0 to NUMRANKS - 1, suited combos
+   //                need two different ranks
+   //***************************************************************************
+   void addCombos(
+      const int         firstRank,
+      const int         secondRank,
+      const ComboSuits  suits,
+      const double      weight);
+
+   //***************************************************************************
+   // Function    : addItem
+   // Description : Parses one item of the notation and sets the weight of
+   //                each combo it lists
+   // Constraints : Private, throws an exception if the item is invalid
+   //***************************************************************************
+   void addItem(const string& item);
+
+   //***************************************************************************
+   // Function    : parseHand
+   // Description : Parses two card numbers and an optional s or o, such as
+   //                AKs, into the ranks, highest first, and the suits
+   // Constraints : Private, throws an exception if the text is invalid
+   //***************************************************************************
+   static void parseHand(
+      const string&  text,
+      int&           highRank,
+      int&           lowRank,
+      ComboSuits&    suits);
+
+   vector<double> weights;    // Weight of each combo
+
+}; // end class HandRange
+
+//******************************************************************************
+// Function : getComboIndex
+// Process  : Order the card indexes and return C(high, 2) + low
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int HandRange::getComboIndex(
+   const PackedCard first,
+   const PackedCard second)
+{
+   int high = first.getIndex();
+   int low  = second.getIndex();
+
+   if (low > high)
+   {
+      high = second.getIndex();
+      low  = first.getIndex();
+   }
+
+   return high * (high - 1) / 2 + low;
+} // end HandRange::getComboIndex
+
+//******************************************************************************
+// Function : getComboMask
+// Process  : Add the two cards of the combo to an empty set
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline CardSet HandRange::getComboMask(const int comboIndex)
+{
+   PackedCard  cards[2];
+   CardSet     mask;
+
+   HandRange::getComboCards(comboIndex, cards);
+   mask.add(cards[0]);
+   mask.add(cards[1]);
+
+   return mask;
+} // end HandRange::getComboMask
+
+//******************************************************************************
+// Function : getWeight
+// Process  : Accessor for the weight of the combo
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline double HandRange::getWeight(const int comboIndex) const
+{
+   return this->weights[comboIndex];
+} // end HandRange::getWeight
+
+//******************************************************************************
+// Function : getWeights
+// Process  : Accessor for weights
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline const vector<double>& HandRange::getWeights() const
+{
+   return this->weights;
+} // end HandRange::getWeights
+
+#endif // HandRange_h
@@ -1,406 +1,611 @@
-//******************************************************************************
-//
-// File Name:     HandRanker.h
-//
-// File Overview: Represents a Hand Ranker to rank a hand of cards
-//
-//******************************************************************************
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added class
-//******************************************************************************
-
-#ifndef HandRanker_h
-#define HandRanker_h
-
-#include "Hand.h"
-
-//******************************************************************************
-//
-// Class:    HandRanker
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added class         
-//
-// Notes    : Relies on the hands to be sorted from highest to lowest
-//
-//******************************************************************************
-class HandRanker
-{
-public:
-
-   // Forward declaration for Hand enum used in member function params
-   enum CompareResult;
-
-   //***************************************************************************
-   // Function    : constructor                                   
-   // Description : None    
-   //                Not the recommended constructor        
-   // Constraints : Need to set hands afterwards
-   //***************************************************************************
-   HandRanker();
-
-   //***************************************************************************
-   // Function    : constructor                                   
-   // Description : Initializes hands to input value      
-   //                Recommended constructor       
-   // Constraints : None
-   //***************************************************************************
-   HandRanker(const vector<Hand>& hands);
-
-   //***************************************************************************
-   // Function    : destructor                                   
-   // Description : Performs cleanup tasks              
-   // Constraints : None
-   //***************************************************************************
-   virtual ~HandRanker();   
-
-   // Member functions in alphabetical order
-   
-   //***************************************************************************
-   // Function    : addHand                                   
-   // Description : Adds the specified hand to list of hands to be ranked            
-   // Constraints : None
-   //***************************************************************************
-   inline void addHand(const Hand& hand);
-   
-   //***************************************************************************
-   // Function    : compareAllHands                                 
-   // Description : Compares hands, [i vs i + 1], [i + 2 vs i + 3], etc
-   //                Consider changing this algorithm to make it cleaner
-   // Constraints : None
-   //***************************************************************************
-   void compareAllHands() const;
-   
-   //***************************************************************************
-   // Function    : compareCardHandNumbers                                 
-   // Description : Compares the input card hand's numbers  
-   //                Determines which is larger             
-   // Constraints : None
-   //***************************************************************************
-   HandRanker::CompareResult compareCardHandNumbers(
-      const Hand& firstHand,
-      const Hand& secondHand,
-      const int   cardIndex) const;
-   
-   //***************************************************************************
-   // Function    : compareCardNumbers                                 
-   // Description : Compares the input card numbers
-   //                Determines which is larger             
-   // Constraints : None
-   //***************************************************************************
-   HandRanker::CompareResult HandRanker::compareCardNumbers(
-      const Card::CardNumber firstCardNumber,
-      const Card::CardNumber secondCardNumber) const;
-   
-   //***************************************************************************
-   // Function    : compareFourOfAKind                                 
-   // Description : Compares the two four of a kind hands             
-   // Constraints : The input hands must be four of a kind hands
-   //***************************************************************************
-   HandRanker::CompareResult compareFourOfAKind(
-      const Hand& firstHand, 
-      const Hand& secondHand) const;
-   
-   //***************************************************************************
-   // Function    : compareFullHouse                                 
-   // Description : Compares the two full house hands             
-   // Constraints : The input hands must be full house hands
-   //***************************************************************************
-   HandRanker::CompareResult compareFullHouse(
-      const Hand& firstHand, 
-      const Hand& secondHand) const;
-
-   //***************************************************************************
-   // Function    : compareHands                                 
-   // Description : Compares the hands       
-   // Constraints : None
-   //***************************************************************************
-   void compareHands(
-      const Hand& firstHand, 
-      const Hand& secondHand) const;
-   
-   //***************************************************************************
-   // Function    : compareHandsOfSameType                                 
-   // Description : Compares hands of same type (ie straight vs straight)             
-   // Constraints : The input hands must be of the same type
-   //***************************************************************************
-   HandRanker::CompareResult compareHandsOfSameType(
-      const Hand& firstHand, 
-      const Hand& secondHand) const;
-   
-   //***************************************************************************
-   // Function    : compareHighCards                                 
-   // Description : Compares the hands by determining the high cards     
-   //                Called when comparing straight flush, straight,
-   //                flush, and high card types
-   // Constraints : None
-   //***************************************************************************
-   HandRanker::CompareResult compareHighCards(
-      const Hand& firstHand, 
-      const Hand& secondHand) const;
-   
-   //***************************************************************************
-   // Function    : compareOneOrTwoPair                                 
-   // Description : Compares the hands by determining the pairs then high cards  
-   //                Called when comparing pair or two pair types              
-   // Constraints : The input hands must be pair or two pair hands
-   //***************************************************************************
-   HandRanker::CompareResult compareOneOrTwoPair(
-      const Hand& firstHand, 
-      const Hand& secondHand) const;
-   
-   //***************************************************************************
-   // Function    : compareThreeOfAKind                                 
-   // Description : Compares the two three of a kind hands             
-   // Constraints : The input hands must be three of a kind hands
-   //***************************************************************************
-   HandRanker::CompareResult compareThreeOfAKind(
-      const Hand& firstHand, 
-      const Hand& secondHand) const;
-   
-   //***************************************************************************
-   // Function    : fixSortOrderIfLowAce                                 
-   // Description : Calls isLowAceStraight
-   //                Calls fixLowAceStraightSort if needed            
-   // Constraints : Consider making private
-   //***************************************************************************
-   void fixSortOrderIfLowAce(Hand& hand) const;
-   
-   //***************************************************************************
-   // Function    : getHand                                   
-   // Description : Accessor for hand            
-   // Constraints : None
-   //***************************************************************************
-   inline void getHand(const int index, Hand& hand) const;
-   
-   //***************************************************************************
-   // Function    : getHands                                   
-   // Description : Accessor for hands            
-   // Constraints : None
-   //***************************************************************************
-   inline void getHands(vector<Hand>& hands) const;
-      
-   //***************************************************************************
-   // Function    : getHandsSize                                   
-   // Description : Retrieves the size of Hands            
-   // Constraints : None
-   //***************************************************************************
-   inline int getHandsSize() const;
-   
-   //***************************************************************************
-   // Function    : isFlush                                   
-   // Description : Determines if the input hand is a flush            
-   // Constraints : None
-   //***************************************************************************
-   bool isFlush(const Hand& hand) const;
-   
-   //***************************************************************************
-   // Function    : isLowAceStraight                                 
-   // Description : Determines if the input hand is a low ace straight (5 to A)             
-   // Constraints : None
-   //***************************************************************************
-   bool isLowAceStraight(const Hand& hand) const;
-   
-   //***************************************************************************
-   // Function    : isStraight                                   
-   // Description : Determines if the input hand is a straight              
-   // Constraints : None
-   //***************************************************************************
-   bool isStraight(const Hand& hand) const;
-   
-   //***************************************************************************
-   // Function    : isStraightFlush                                   
-   // Description : Determines if the input hand is a straight flush              
-   // Constraints : None
-   //***************************************************************************
-   bool isStraightFlush(const Hand& hand) const;
-   
-   //***************************************************************************
-   // Function    : printHandComparisonHeader                                   
-   // Description : Prints the header showing hand vs hand           
-   // Constraints : None
-   //***************************************************************************
-   void printHandComparisonHeader(
-      const Hand& firstHand, 
-      const Hand& secondHand) const;
-   
-   //***************************************************************************
-   // Function    : printWinningHand                                 
-   // Description : Prints the winning hand based on the result parameter             
-   // Constraints : None
-   //***************************************************************************
-   void printWinningHand(
-      const Hand& firstHand,
-      const Hand& secondHand,
-      const HandRanker::CompareResult result) const;
-      
-   //***************************************************************************
-   // Function    : rankHand                                   
-   // Description : Ranks the hand to determine its type (ie Straight)            
-   // Constraints : None
-   //***************************************************************************
-   void rankHand(Hand& hand) const;
-      
-   //***************************************************************************
-   // Function    : rankHands                                   
-   // Description : Ranks all hands in the data member hands            
-   // Constraints : None
-   //***************************************************************************
-   void rankHands();
-   
-   //***************************************************************************
-   // Function    : setHands                                   
-   // Description : Mutator for hands            
-   // Constraints : None
-   //***************************************************************************
-   inline void setHands(const vector<Hand>& hands);
-   
-   //***************************************************************************
-   // public Class Attributes.
-   //***************************************************************************
-
-   // Represents the result of hand comparison
-   enum CompareResult
-   {
-      TIE,
-      FIRSTWINNER,
-      SECONDWINNER,
-      INVALIDRESULT
-   };   
-
-private:   
-   //***************************************************************************
-   // Function    : buildHandRepetitionLists                                 
-   // Description : Builds the hand's repetition lists which include
-   //                singles, pairs, trips, and quads
-   //                Returns the number of unique card numbers in the hand
-   // Constraints : Private, called by rankHand
-   //***************************************************************************
-   int HandRanker::buildHandRepetitionLists(Hand& hand) const;
-
-   //***************************************************************************
-   // Function    : fixLowAceStraightSort                                 
-   // Description : Puts the Ace at low end if we have a low straight             
-   //                For example: 5, 4, 3, 2, 1 since the Ace = 14
-   // Constraints : Does not determine if the input hand is a low straight
-   //                Private, call fixSortOrderIfLowAce instead
-   //***************************************************************************
-   void fixLowAceStraightSort(Hand& hand) const;
-
-   //***************************************************************************
-   // Function    : rankHandRepetitions                                   
-   // Description : Ranks the input hands based on the input card repetitions   
-   //                Calls rankHandRepetitions
-   //                Used for optimized hand ranking
-   // Constraints : Private 
-   //                Call the appropriate comparison function instead
-   //                based on your hand and your needs, for example:
-   //                   -compareHands
-   //                   -compareHandsOfSameType
-   //                   -compareFourOfAKind
-   //***************************************************************************
-   HandRanker::CompareResult HandRanker::rankHandRepetitions(
-      const Hand& firstHand, 
-      const Hand& secondHand,
-      const Hand::CardRepetition repetition) const;
-   
-   //***************************************************************************
-   // Function    : rankHandRepetitionVectors                                 
-   // Description : Ranks the input hands based on the input card repetitions
-   //                Called by rankHandRepetitions
-   //                Used for optimized hand ranking
-   // Constraints : Private 
-   //                Call the appropriate comparison function instead
-   //                based on your hand and your needs, for example:
-   //                   -compareHands
-   //                   -compareHandsOfSameType
-   //                   -compareFourOfAKind
-   //***************************************************************************
-   HandRanker::CompareResult HandRanker::rankHandRepetitionVectors(
-      const vector<Card::CardNumber>& firstVector,
-      const vector<Card::CardNumber>& secondVector) const;
-
-   vector<Hand>  hands; // List of hands to be ranked
-}; // end class HandRanker
-   
-//***************************************************************************
-// Function : addHand                                   
-// Process  : Adds the specified hand to list of hands to be ranked   
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void HandRanker::addHand(const Hand& hand)
-{
-   this->hands.push_back(hand);
-} // end HandRanker::addHand
-
-//***************************************************************************
-// Function : getHand                                   
-// Process  : Accessor for hand
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void HandRanker::getHand(const int index, Hand& hand) const
-{
-   hand = this->hands.at(index);
-} // end HandRanker::getHand
-
-//***************************************************************************
-// Function : getHands                                   
-// Process  : Accessor for hands
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void HandRanker::getHands(vector<Hand>& hands) const
-{
-   hands = this->hands;
-} // end HandRanker::getHands
-
-//***************************************************************************
-// Function : getHandsSize                                   
-// Process  : Retrieves the size of hands
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline int HandRanker::getHandsSize() const
-{
-   return this->hands.size();
-} // end HandRanker::getHandsSize
-
-//***************************************************************************
-// Function : setHands                                   
-// Process  : Mutator for hands
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-inline void HandRanker::setHands(const vector<Hand>& hands)
-{
-   this->hands = hands;
-} // end HandRanker::setHands
-
+//******************************************************************************
+//
+// File Name:     HandRanker.h
+//
+// File Overview: Represents a Hand Ranker to rank a hand of cards
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added class
+// 10.17.26       Donne Martin         Rank with the table-driven evaluator
+// 10.17.26       Donne Martin         Compare hands by hand value
+// 10.17.26       Donne Martin         Use the inline hand repetition lists
+// 10.17.26       Donne Martin         Classify and rank card sets
+// 10.17.26       Donne Martin         Rank all hands with batch evaluation
+// 10.18.26       Donne Martin         Added an optional evaluation cache
+// 10.18.26       Donne Martin         Added an optional thread pool
+// 10.18.26       Donne Martin         Added an optional result reporter
+// 10.18.26       Donne Martin         Rank the low ace straight lowest
+//******************************************************************************
+
+#ifndef HandRanker_h
+#define HandRanker_h
+
+#include "CardSet.h"
+#include "EvaluationCache.h"
+#include "Hand.h"
+#include "HandEvaluator.h"
+#include "ThreadPool.h"
+
+class ResultReporter;
+
+//******************************************************************************
+//
+// Class:    HandRanker
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added class         
+// 10.18.26       Donne Martin         Added an optional evaluation cache
+// 10.18.26       Donne Martin         Added an optional thread pool
+// 10.18.26       Donne Martin         Added an optional result reporter
+// 10.18.26       Donne Martin         Rank the low ace straight lowest
+//
+// Notes    : Relies on the hands to be sorted from highest to lowest
+//             rankHand and rankCards look up a HandValueCache first, if one
+//             is set, and cache the values they evaluate
+//             rankHands and compareAllHands split the hands into chunks of
+//             HANDSPERCHUNK run on a ThreadPool, if one is set, else rank
+//             and compare them on the calling thread.  compareAllHands
+//             reports the comparisons in order once they are all done.
+//             Comparisons are reported to a ResultReporter, if one is set,
+//             else nothing is printed or formatted.
+//
+//******************************************************************************
+class HandRanker
+{
+public:
+
+   // Forward declaration for Hand enum used in member function params
+   enum CompareResult;
+
+   //***************************************************************************
+   // Function    : constructor                                   
+   // Description : None    
+   //                Not the recommended constructor        
+   // Constraints : Need to set hands afterwards
+   //***************************************************************************
+   HandRanker();
+
+   //***************************************************************************
+   // Function    : constructor                                   
+   // Description : Initializes hands to input value      
+   //                Recommended constructor       
+   // Constraints : None
+   //***************************************************************************
+   HandRanker(const vector<Hand>& hands);
+
+   //***************************************************************************
+   // Function    : destructor                                   
+   // Description : Performs cleanup tasks              
+   // Constraints : None
+   //***************************************************************************
+   virtual ~HandRanker();   
+
+   // Member functions in alphabetical order
+   
+   //***************************************************************************
+   // Function    : addHand                                   
+   // Description : Adds the specified hand to list of hands to be ranked            
+   // Constraints : None
+   //***************************************************************************
+   inline void addHand(const Hand& hand);
+   
+   //***************************************************************************
+   // Function    : compareAllHands                                 
+   // Description : Compares hands, [i vs i + 1], [i + 2 vs i + 3], etc
+   //                Consider changing this algorithm to make it cleaner
+   // Constraints : The hands must be ranked by rankHand
+   //                An odd last hand is not compared
+   //***************************************************************************
+   void compareAllHands() const;
+   
+   //***************************************************************************
+   // Function    : compareCardHandNumbers                                 
+   // Description : Compares the input card hand's numbers  
+   //                Determines which is larger             
+   // Constraints : None
+   //***************************************************************************
+   HandRanker::CompareResult compareCardHandNumbers(
+      const Hand& firstHand,
+      const Hand& secondHand,
+      const int   cardIndex) const;
+   
+   //***************************************************************************
+   // Function    : compareCardNumbers                                 
+   // Description : Compares the input card numbers
+   //                Determines which is larger             
+   // Constraints : None
+   //***************************************************************************
+   HandRanker::CompareResult HandRanker::compareCardNumbers(
+      const Card::CardNumber firstCardNumber,
+      const Card::CardNumber secondCardNumber) const;
+   
+   //***************************************************************************
+   // Function    : compareFourOfAKind                                 
+   // Description : Compares the two four of a kind hands             
+   // Constraints : The input hands must be four of a kind hands
+   //***************************************************************************
+   HandRanker::CompareResult compareFourOfAKind(
+      const Hand& firstHand, 
+      const Hand& secondHand) const;
+   
+   //***************************************************************************
+   // Function    : compareFullHouse                                 
+   // Description : Compares the two full house hands             
+   // Constraints : The input hands must be full house hands
+   //***************************************************************************
+   HandRanker::CompareResult compareFullHouse(
+      const Hand& firstHand, 
+      const Hand& secondHand) const;
+
+   //***************************************************************************
+   // Function    : compareHands                                 
+   // Description : Compares the hands by their hand values
+   // Constraints : The input hands must be ranked by rankHand
+   //***************************************************************************
+   void compareHands(
+      const Hand& firstHand, 
+      const Hand& secondHand) const;
+   
+   //***************************************************************************
+   // Function    : compareHandsOfSameType                                 
+   // Description : Compares hands of same type (ie straight vs straight)             
+   //                Step by step reference for comparing hand values
+   // Constraints : The input hands must be of the same type
+   //                The input hands must be ranked by rankHandReference
+   //***************************************************************************
+   HandRanker::CompareResult compareHandsOfSameType(
+      const Hand& firstHand, 
+      const Hand& secondHand) const;
+   
+   //***************************************************************************
+   // Function    : compareHandValues
+   // Description : Compares the input hand values with a single comparison
+   //                Determines which is larger
+   // Constraints : None
+   //***************************************************************************
+   inline HandRanker::CompareResult compareHandValues(
+      const int firstValue,
+      const int secondValue) const;
+
+   //***************************************************************************
+   // Function    : compareHighCards                                 
+   // Description : Compares the hands by determining the high cards     
+   //                Called when comparing straight flush, straight,
+   //                flush, and high card types
+   // Constraints : None
+   //***************************************************************************
+   HandRanker::CompareResult compareHighCards(
+      const Hand& firstHand, 
+      const Hand& secondHand) const;
+   
+   //***************************************************************************
+   // Function    : compareOneOrTwoPair                                 
+   // Description : Compares the hands by determining the pairs then high cards  
+   //                Called when comparing pair or two pair types              
+   // Constraints : The input hands must be pair or two pair hands
+   //***************************************************************************
+   HandRanker::CompareResult compareOneOrTwoPair(
+      const Hand& firstHand, 
+      const Hand& secondHand) const;
+
+   //***************************************************************************
+   // Function    : compareStraights
+   // Description : Compares the hands by the highest card of each straight
+   //                The low ace straight (5 4 3 2 A) is five high
+   //                Called when comparing straight flush and straight types
+   // Constraints : The input hands must be straight or straight flush hands
+   //***************************************************************************
+   HandRanker::CompareResult compareStraights(
+      const Hand& firstHand, 
+      const Hand& secondHand) const;
+   
+   //***************************************************************************
+   // Function    : compareThreeOfAKind                                 
+   // Description : Compares the two three of a kind hands             
+   // Constraints : The input hands must be three of a kind hands
+   //***************************************************************************
+   HandRanker::CompareResult compareThreeOfAKind(
+      const Hand& firstHand, 
+      const Hand& secondHand) const;
+   
+   //***************************************************************************
+   // Function    : findWinners
+   // Description : Finds the hands with the highest hand value
+   //                Updates winners with their indexes, more than one on a tie
+   // Constraints : The hands must be ranked by rankHand
+   //***************************************************************************
+   void findWinners(vector<int>& winners) const;
+
+   //***************************************************************************
+   // Function    : fixSortOrderIfLowAce                                 
+   // Description : Calls isLowAceStraight
+   //                Calls fixLowAceStraightSort if needed            
+   // Constraints : Consider making private
+   //***************************************************************************
+   void fixSortOrderIfLowAce(Hand& hand) const;
+   
+   //***************************************************************************
+   // Function    : getHand                                   
+   // Description : Accessor for hand            
+   // Constraints : None
+   //***************************************************************************
+   inline void getHand(const int index, Hand& hand) const;
+   
+   //***************************************************************************
+   // Function    : getHands                                   
+   // Description : Accessor for hands            
+   // Constraints : None
+   //***************************************************************************
+   inline void getHands(vector<Hand>& hands) const;
+      
+   //***************************************************************************
+   // Function    : getHandsSize                                   
+   // Description : Retrieves the size of Hands            
+   // Constraints : None
+   //***************************************************************************
+   inline int getHandsSize() const;
+   
+   //***************************************************************************
+   // Function    : isFlush                                   
+   // Description : Determines if the input hand is a flush            
+   //                Uses the hand's CardSet
+   // Constraints : None
+   //***************************************************************************
+   bool isFlush(const Hand& hand) const;
+   
+   //***************************************************************************
+   // Function    : isLowAceStraight                                 
+   // Description : Determines if the input hand is a low ace straight (5 to A)             
+   //                Uses the hand's CardSet
+   // Constraints : None
+   //***************************************************************************
+   bool isLowAceStraight(const Hand& hand) const;
+   
+   //***************************************************************************
+   // Function    : isStraight                                   
+   // Description : Determines if the input hand is a straight              
+   //                Uses the hand's CardSet, does not depend on sort order
+   // Constraints : None
+   //***************************************************************************
+   bool isStraight(const Hand& hand) const;
+   
+   //***************************************************************************
+   // Function    : isStraightFlush                                   
+   // Description : Determines if the input hand is a straight flush              
+   // Constraints : None
+   //***************************************************************************
+   bool isStraightFlush(const Hand& hand) const;
+      
+   //***************************************************************************
+   // Function    : rankCards                                   
+   // Description : Ranks the set of cards to determine the type and the
+   //                hand value of its best five card hand
+   //                Does not need a Hand, for callers holding card masks
+   // Constraints : The set must hold five or seven cards
+   //***************************************************************************
+   void rankCards(
+      const CardSet&    cards,
+      int&              value,
+      Hand::HandType&   type) const;
+
+   //***************************************************************************
+   // Function    : rankHand                                   
+   // Description : Ranks the hand to determine its type (ie Straight)            
+   //                and its hand value using the table-driven HandEvaluator
+   // Constraints : None
+   //***************************************************************************
+   void rankHand(Hand& hand) const;
+
+   //***************************************************************************
+   // Function    : rankHandReference
+   // Description : Ranks the hand to determine its type (ie Straight)
+   //                Step by step reference for the table-driven rankHand
+   //                Builds the repetition lists used by compareHandsOfSameType
+   // Constraints : Does not set the hand value
+   //***************************************************************************
+   void rankHandReference(Hand& hand) const;
+      
+   //***************************************************************************
+   // Function    : rankHands                                   
+   // Description : Ranks all hands in the data member hands            
+   //                Evaluates the hands in batches of HANDSPERCHUNK, on the
+   //                thread pool if one is set
+   // Constraints : None
+   //***************************************************************************
+   void rankHands();
+   
+   //***************************************************************************
+   // Function    : setCache
+   // Description : Mutator for cache, the hand values looked up before
+   //                evaluating, NULL for none
+   // Constraints : The cache must outlive its use, and only hold values of
+   //                the standard deck
+   //***************************************************************************
+   inline void setCache(HandValueCache* cache);
+
+   //***************************************************************************
+   // Function    : setHands                                   
+   // Description : Mutator for hands            
+   // Constraints : None
+   //***************************************************************************
+   inline void setHands(const vector<Hand>& hands);
+
+   //***************************************************************************
+   // Function    : setReporter
+   // Description : Sets the reporter of the comparisons, NULL for none
+   //                A reporter that is not enabled is kept as NULL
+   // Constraints : The reporter must outlive its use, and is called from
+   //                the calling thread only
+   //***************************************************************************
+   void setReporter(ResultReporter* reporter);
+
+   //***************************************************************************
+   // Function    : setThreadPool
+   // Description : Mutator for threadPool, the pool rankHands and
+   //                compareAllHands run on, NULL for the calling thread
+   // Constraints : The pool must outlive its use
+   //***************************************************************************
+   inline void setThreadPool(ThreadPool* threadPool);
+
+   //***************************************************************************
+   // Function    : sortHands
+   // Description : Sorts the hands from the highest to the lowest hand value
+   // Constraints : The hands must be ranked by rankHand
+   //***************************************************************************
+   void sortHands();
+   
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the result of hand comparison
+   enum CompareResult
+   {
+      TIE,
+      FIRSTWINNER,
+      SECONDWINNER,
+      INVALIDRESULT
+   };   
+
+   // Represents the hands of each chunk run on the thread pool
+   enum HandRankerSize
+   {
+      HANDSPERCHUNK = 1024
+   };
+
+private:   
+   //***************************************************************************
+   // Function    : buildHandRepetitionLists                                 
+   // Description : Builds the hand's repetition lists which include
+   //                singles, pairs, trips, and quads
+   //                Returns the number of unique card numbers in the hand
+   // Constraints : Private, called by rankHandReference
+   //***************************************************************************
+   int HandRanker::buildHandRepetitionLists(Hand& hand) const;
+
+   //***************************************************************************
+   // Function    : compareHandPairs
+   // Description : Compares the hand values of the pairs firstPair to
+   //                lastPair - 1, [2 * pair vs 2 * pair + 1], into results
+   // Constraints : Private, the task compareAllHands runs on the pool
+   //***************************************************************************
+   void compareHandPairs(
+      const int                  firstPair,
+      const int                  lastPair,
+      const int                  worker,
+      HandRanker::CompareResult  results[]) const;
+
+   //***************************************************************************
+   // Function    : fixLowAceStraightSort                                 
+   // Description : Puts the Ace at low end if we have a low straight             
+   //                For example: 5, 4, 3, 2, 1 since the Ace = 14
+   // Constraints : Does not determine if the input hand is a low straight
+   //                Private, call fixSortOrderIfLowAce instead
+   //***************************************************************************
+   void fixLowAceStraightSort(Hand& hand) const;
+
+   //***************************************************************************
+   // Function    : isStrongerHand
+   // Description : Determines if the first hand has a higher hand value
+   //                Used to sort the hands
+   // Constraints : Private, call sortHands instead
+   //***************************************************************************
+   static bool isStrongerHand(
+      const Hand& firstHand,
+      const Hand& secondHand);
+
+   //***************************************************************************
+   // Function    : rankHandChunk
+   // Description : Ranks the hands firstHand to lastHand - 1 in one batch
+   // Constraints : Private, the task rankHands runs on the pool
+   //***************************************************************************
+   void rankHandChunk(
+      const int firstHand,
+      const int lastHand,
+      const int worker);
+
+   //***************************************************************************
+   // Function    : rankHandRepetitions                                   
+   // Description : Ranks the input hands based on the input card repetitions   
+   //                Used for optimized hand ranking
+   // Constraints : Private 
+   //                Call the appropriate comparison function instead
+   //                based on your hand and your needs, for example:
+   //                   -compareHands
+   //                   -compareHandsOfSameType
+   //                   -compareFourOfAKind
+   //***************************************************************************
+   HandRanker::CompareResult HandRanker::rankHandRepetitions(
+      const Hand& firstHand, 
+      const Hand& secondHand,
+      const Hand::CardRepetition repetition) const;
+
+   //***************************************************************************
+   // Function    : setHandRank                                   
+   // Description : Sets the hand's type and value from its hand value
+   //                Fixes the sort order of a low ace straight
+   // Constraints : Private, called by rankHand and rankHands
+   //***************************************************************************
+   void setHandRank(
+      Hand&       hand,
+      const int   value) const;
+   
+   //***************************************************************************
+   // Function    : evaluateCards
+   // Description : Returns the hand value of the cards, from the cache if
+   //                one is set
+   // Constraints : Private, called by rankHand and rankCards
+   //***************************************************************************
+   int evaluateCards(const CardSet& cards) const;
+
+   HandEvaluator     evaluator;  // Table-driven evaluator used by rankHand
+   HandValueCache*   cache;      // Optional cache in front of the evaluator,
+                                 // NULL if none
+   vector<Hand>      hands;      // List of hands to be ranked
+   ThreadPool*       threadPool; // Optional pool rankHands and
+                                 // compareAllHands run on, NULL if none
+   ResultReporter*   reporter;   // Optional reporter of the comparisons,
+                                 // NULL if none
+}; // end class HandRanker
+   
+//***************************************************************************
+// Function : addHand                                   
+// Process  : Adds the specified hand to list of hands to be ranked   
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void HandRanker::addHand(const Hand& hand)
+{
+   this->hands.push_back(hand);
+} // end HandRanker::addHand
+
+//***************************************************************************
+// Function : compareHandValues
+// Process  : Compare the input hand values
+//             Determine which value is greater
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.17.26       Donne Martin         Added function
+//***************************************************************************
+inline HandRanker::CompareResult HandRanker::compareHandValues(
+   const int firstValue,
+   const int secondValue) const
+{
+   HandRanker::CompareResult result = HandRanker::TIE;
+
+   if (firstValue > secondValue)
+   {
+      result = HandRanker::FIRSTWINNER;
+   }
+   else if (firstValue < secondValue)
+   {
+      result = HandRanker::SECONDWINNER;
+   }
+
+   return result;
+} // end HandRanker::compareHandValues
+
+//***************************************************************************
+// Function : getHand                                   
+// Process  : Accessor for hand
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void HandRanker::getHand(const int index, Hand& hand) const
+{
+   hand = this->hands.at(index);
+} // end HandRanker::getHand
+
+//***************************************************************************
+// Function : getHands                                   
+// Process  : Accessor for hands
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void HandRanker::getHands(vector<Hand>& hands) const
+{
+   hands = this->hands;
+} // end HandRanker::getHands
+
+//***************************************************************************
+// Function : getHandsSize                                   
+// Process  : Retrieves the size of hands
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline int HandRanker::getHandsSize() const
+{
+   return this->hands.size();
+} // end HandRanker::getHandsSize
+
+//***************************************************************************
+// Function : setCache
+// Process  : Mutator for cache
+// Notes    : NULL evaluates every hand
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//***************************************************************************
+inline void HandRanker::setCache(HandValueCache* cache)
+{
+   this->cache = cache;
+} // end HandRanker::setCache
+
+//***************************************************************************
+// Function : setHands                                   
+// Process  : Mutator for hands
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+inline void HandRanker::setHands(const vector<Hand>& hands)
+{
+   this->hands = hands;
+} // end HandRanker::setHands
+
+//***************************************************************************
+// Function : setThreadPool
+// Process  : Mutator for threadPool
+// Notes    : NULL ranks and compares on the calling thread
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//***************************************************************************
+inline void HandRanker::setThreadPool(ThreadPool* threadPool)
+{
+   this->threadPool = threadPool;
+} // end HandRanker::setThreadPool
+
 #endif // HandRanker_h
\ No newline at end of file
@@ -0,0 +1,384 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     HiLoEvaluator.cpp
+//
+// File Overview: Represents a Hi/Lo Evaluator to rank the high hand and the
+//                eight or better low hand of Omaha-8 and Stud-8 in one pass
+//                and split the pot between them
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#include "stdafx.h"
+#include "HiLoEvaluator.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : Build the table of low values
+//             For each mask of low card numbers
+//                Keep its five lowest numbers, the best low it holds
+//                Number the five numbers as LowballEvaluator does, by the
+//                   index of their mask among all masks of five numbers
+//                   in increasing order
+// Notes    : Need to set the board before evaluating Omaha
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HiLoEvaluator::HiLoEvaluator()
+   : isBoardSet(false)
+{
+   int lowMask = 0;  // Five lowest numbers of the mask
+   int index   = 0;  // Index of the five numbers among all masks of five
+   int ways    = 0;  // Masks of position + 1 numbers below the number
+   int rank    = 0;  // Number being indexed
+
+   for (int mask = 0; mask < NUMLOWMASKS; ++mask)
+   {
+      this->lowTable[mask] = NOLOW;
+
+      if (CardSet::popCount(mask) < Hand::MAXCARDS)
+      {
+         continue;
+      }
+
+      // Clear the highest number until five are left
+      lowMask = mask;
+
+      while (CardSet::popCount(lowMask) > Hand::MAXCARDS)
+      {
+         rank = NUMLOWRANKS - 1;
+
+         while ((lowMask & (1 << rank)) == 0)
+         {
+            --rank;
+         }
+
+         lowMask &= ~(1 << rank);
+      }
+
+      // Sum the ways to choose position + 1 of the numbers below each one
+      index = 0;
+      rank  = 0;
+
+      for (int position = 0; position < Hand::MAXCARDS; ++position)
+      {
+         while ((lowMask & (1 << rank)) == 0)
+         {
+            ++rank;
+         }
+
+         ways = 1;
+
+         for (int chosen = 0; chosen <= position; ++chosen)
+         {
+            ways = ways * (rank - chosen) / (chosen + 1);
+         }
+
+         index += ways;
+         ++rank;
+      }
+
+      this->lowTable[mask] = static_cast<unsigned short>(
+         LowballEvaluator::MAXACETOFIVEVALUE - index);
+   }
+} // end HiLoEvaluator::HiLoEvaluator
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+HiLoEvaluator::~HiLoEvaluator()
+{
+} // end HiLoEvaluator::~HiLoEvaluator
+
+//******************************************************************************
+// Function : evaluateOmaha
+// Process  : Evaluate the hole cards against the board in one pass
+//             For each pair of hole cards
+//                Build the low mask of the pair, if two unique low numbers
+//                For each board combination
+//                   Evaluate the high value of the five cards
+//                   If the pair and the combination hold five unique low
+//                      numbers, look up the low value
+//                   Keep the best high value and the best low value
+// Notes    : Throw an exception if the board is not set or the number of
+//             hole cards is not four, five, or six
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HiLoEvaluator::evaluateOmaha(
+   const PackedCard  holeCards[],
+   const int         numHoleCards,
+   int&              highValue,
+   int&              lowValue) const
+{
+   PackedCard  cards[Hand::MAXCARDS];  // Two hole cards then the board cards
+   int         holeLowMask = 0;        // Low mask of the two hole cards
+   int         value       = HandEvaluator::INVALIDVALUE;
+
+   if (!this->isBoardSet)
+   {
+      throw exception("Board not set in evaluateOmaha");
+   }
+
+   if (numHoleCards < OmahaEvaluator::MINHOLECARDS ||
+       numHoleCards > OmahaEvaluator::MAXHOLECARDS)
+   {
+      throw exception("Unexpected number of hole cards in evaluateOmaha");
+   }
+
+   highValue = HandEvaluator::INVALIDVALUE;
+   lowValue  = NOLOW;
+
+   for (int first = 0; first < numHoleCards - 1; ++first)
+   {
+      cards[0] = holeCards[first];
+
+      for (int second = first + 1; second < numHoleCards; ++second)
+      {
+         cards[1]    = holeCards[second];
+         holeLowMask = HiLoEvaluator::getLowMask(
+            cards, OmahaEvaluator::NUMUSEDHOLECARDS);
+
+         if (CardSet::popCount(holeLowMask) <
+             OmahaEvaluator::NUMUSEDHOLECARDS)
+         {
+            holeLowMask = 0;
+         }
+
+         for (int combination = 0;
+              combination < OmahaEvaluator::NUMBOARDCOMBINATIONS;
+              ++combination)
+         {
+            for (int boardIndex = 0;
+                 boardIndex < OmahaEvaluator::NUMUSEDBOARDCARDS;
+                 ++boardIndex)
+            {
+               cards[OmahaEvaluator::NUMUSEDHOLECARDS + boardIndex] =
+                  this->boardCombinations[combination][boardIndex];
+            }
+
+            value = this->evaluator.evaluate(cards);
+
+            if (value > highValue)
+            {
+               highValue = value;
+            }
+
+            // Five unique low numbers only if the masks do not overlap
+            if (holeLowMask != 0 &&
+                this->boardLowMasks[combination] != 0 &&
+                (holeLowMask & this->boardLowMasks[combination]) == 0)
+            {
+               value = this->lowTable[
+                  holeLowMask | this->boardLowMasks[combination]];
+
+               if (value > lowValue)
+               {
+                  lowValue = value;
+               }
+            }
+         }
+      }
+   }
+} // end HiLoEvaluator::evaluateOmaha
+
+//******************************************************************************
+// Function : evaluateStud
+// Process  : Evaluate the best high value of the seven cards
+//             Look up the low value of their low mask, the five lowest
+//             unique low numbers among them
+// Notes    : The cards must be valid and unique, cards must hold seven cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HiLoEvaluator::evaluateStud(
+   const PackedCard  cards[],
+   int&              highValue,
+   int&              lowValue) const
+{
+   highValue = this->evaluator.evaluateSeven(cards);
+   lowValue  = this->lowTable[HiLoEvaluator::getLowMask(cards, NUMSTUDCARDS)];
+} // end HiLoEvaluator::evaluateStud
+
+//******************************************************************************
+// Function : setBoard
+// Process  : Build the ten three card board combinations
+//             Store the low mask of each combination holding three unique
+//             low numbers, else zero
+// Notes    : The board must hold five valid and unique cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HiLoEvaluator::setBoard(const PackedCard board[])
+{
+   int combination = 0; // Index of the next board combination
+   int lowMask     = 0; // Low mask of the combination
+
+   for (int first = 0; first < HandEvaluator::NUMBOARDCARDS; ++first)
+   {
+      for (int second = first + 1;
+           second < HandEvaluator::NUMBOARDCARDS;
+           ++second)
+      {
+         for (int third = second + 1;
+              third < HandEvaluator::NUMBOARDCARDS;
+              ++third)
+         {
+            this->boardCombinations[combination][0] = board[first];
+            this->boardCombinations[combination][1] = board[second];
+            this->boardCombinations[combination][2] = board[third];
+
+            lowMask = HiLoEvaluator::getLowMask(
+               this->boardCombinations[combination],
+               OmahaEvaluator::NUMUSEDBOARDCARDS);
+
+            if (CardSet::popCount(lowMask) <
+                OmahaEvaluator::NUMUSEDBOARDCARDS)
+            {
+               lowMask = 0;
+            }
+
+            this->boardLowMasks[combination] = lowMask;
+
+            ++combination;
+         }
+      }
+   }
+
+   this->isBoardSet = true;
+} // end HiLoEvaluator::setBoard
+
+//******************************************************************************
+// Function : splitPot
+// Process  : Clear the shares
+//             If any player holds a low, split the pot in half, the odd chip
+//                to the high half, and split the low half between the best
+//                lows
+//             Split the high half, or the whole pot, between the best highs
+// Notes    : A player winning the high and tying the low takes three
+//             quarters, the other low takes a quarter
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HiLoEvaluator::splitPot(
+   const int         highValues[],
+   const int         lowValues[],
+   const int         numPlayers,
+   const int         pot,
+   int               shares[])
+{
+   bool  hasLow  = false;  // Whether any player holds a low
+   int   highPot = pot;    // Amount split between the best highs
+
+   for (int player = 0; player < numPlayers; ++player)
+   {
+      shares[player] = 0;
+
+      if (lowValues[player] != NOLOW)
+      {
+         hasLow = true;
+      }
+   }
+
+   if (hasLow)
+   {
+      highPot = pot - pot / 2;
+
+      HiLoEvaluator::splitShare(lowValues, numPlayers, pot / 2, shares);
+   }
+
+   HiLoEvaluator::splitShare(highValues, numPlayers, highPot, shares);
+} // end HiLoEvaluator::splitPot
+
+//******************************************************************************
+// Function : splitShare
+// Process  : Find the best value and count the players holding it
+//             Give each of them an even part of the amount
+//             Give the odd chips one at a time in seat order
+// Notes    : Private, called by splitPot
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void HiLoEvaluator::splitShare(
+   const int         values[],
+   const int         numPlayers,
+   const int         amount,
+   int               shares[])
+{
+   int bestValue  = HandEvaluator::INVALIDVALUE;
+   int numWinners = 0;  // Players holding the best value
+   int oddChips   = 0;  // Chips left after the even split
+
+   for (int player = 0; player < numPlayers; ++player)
+   {
+      if (values[player] > bestValue)
+      {
+         bestValue  = values[player];
+         numWinners = 1;
+      }
+      else if (values[player] == bestValue)
+      {
+         ++numWinners;
+      }
+   }
+
+   if (numWinners == 0)
+   {
+      return;
+   }
+
+   oddChips = amount % numWinners;
+
+   for (int player = 0; player < numPlayers; ++player)
+   {
+      if (values[player] == bestValue)
+      {
+         shares[player] += amount / numWinners;
+
+         if (oddChips > 0)
+         {
+            ++shares[player];
+            --oddChips;
+         }
+      }
+   }
+} // end HiLoEvaluator::splitShare
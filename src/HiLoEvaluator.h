@@ -0,0 +1,198 @@
+//******************************************************************************
+//
+// File Name:     HiLoEvaluator.h
+//
+// File Overview: Represents a Hi/Lo Evaluator to rank the high hand and the
+//                eight or better low hand of Omaha-8 and Stud-8 in one pass
+//                and split the pot between them
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef HiLoEvaluator_h
+#define HiLoEvaluator_h
+
+#include "LowballEvaluator.h"
+#include "OmahaEvaluator.h"
+
+//******************************************************************************
+//
+// Class:    HiLoEvaluator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : High values are HandEvaluator values.  Low values are ace to
+//             five LowballEvaluator values, a larger value is a better low,
+//             and NOLOW when no five unique numbers of eight or lower can
+//             be made.
+//             The low of a set of cards only depends on the mask of its
+//             unique numbers of eight or lower, ace low, so it is looked up
+//             in a table of the 256 masks while the high hand is evaluated.
+//
+//******************************************************************************
+class HiLoEvaluator
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Builds the table of low values, without a board
+   // Constraints : Need to set the board before evaluating Omaha
+   //***************************************************************************
+   HiLoEvaluator();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~HiLoEvaluator();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : evaluateOmaha
+   // Description : Evaluates the hole cards against the board and returns
+   //                the best high value and the best low value, each made
+   //                of two hole cards and three board cards
+   // Constraints : Throws an exception if the board is not set or the
+   //                number of hole cards is not four, five, or six
+   //                The cards must be valid and unique
+   //***************************************************************************
+   void evaluateOmaha(
+      const PackedCard  holeCards[],
+      const int         numHoleCards,
+      int&              highValue,
+      int&              lowValue) const;
+
+   //***************************************************************************
+   // Function    : evaluateStud
+   // Description : Evaluates the seven cards and returns the best high value
+   //                and the best low value of any five of them
+   // Constraints : The cards must be valid and unique, cards must hold
+   //                seven cards
+   //***************************************************************************
+   void evaluateStud(
+      const PackedCard  cards[],
+      int&              highValue,
+      int&              lowValue) const;
+
+   //***************************************************************************
+   // Function    : setBoard
+   // Description : Builds the three card board combinations and their low
+   //                masks, shared by every player
+   // Constraints : The board must hold five valid and unique cards
+   //***************************************************************************
+   void setBoard(const PackedCard board[]);
+
+   //***************************************************************************
+   // Function    : splitPot
+   // Description : Splits the pot between the best high hands and the best
+   //                low hands, quartering it on ties
+   //                With no low, the high hands take the whole pot
+   //                The odd chip of a split goes to the high half, then to
+   //                the winners in seat order
+   // Constraints : highValues, lowValues, and shares must hold numPlayers
+   //                values
+   //***************************************************************************
+   static void splitPot(
+      const int         highValues[],
+      const int         lowValues[],
+      const int         numPlayers,
+      const int         pot,
+      int               shares[]);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the eight or better low qualifier
+   enum LowQualifier
+   {
+      NOLOW          = HandEvaluator::INVALIDVALUE,
+      NUMLOWRANKS    = 8,
+      NUMLOWMASKS    = 1 << NUMLOWRANKS,
+      NUMSTUDCARDS   = HandEvaluator::NUMHOLDEMCARDS
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : getLowMask
+   // Description : Returns the mask of the unique card numbers of eight or
+   //                lower, from bit 0 for an ace to bit 7 for an eight
+   // Constraints : Private
+   //***************************************************************************
+   static inline int getLowMask(
+      const PackedCard  cards[],
+      const int         numCards);
+
+   //***************************************************************************
+   // Function    : splitShare
+   // Description : Splits the amount between the players holding the best
+   //                value and adds it to their shares
+   // Constraints : Private, called by splitPot
+   //***************************************************************************
+   static void splitShare(
+      const int         values[],
+      const int         numPlayers,
+      const int         amount,
+      int               shares[]);
+
+   HandEvaluator  evaluator;  // Evaluates each high hand
+   bool           isBoardSet; // Whether setBoard has been called
+
+   // Three card board combinations
+   PackedCard     boardCombinations[OmahaEvaluator::NUMBOARDCOMBINATIONS]
+                                   [OmahaEvaluator::NUMUSEDBOARDCARDS];
+
+   // Low mask of each board combination, zero if its cards cannot be part
+   // of a low
+   int            boardLowMasks[OmahaEvaluator::NUMBOARDCOMBINATIONS];
+
+   // Low value of the five lowest numbers of each low mask, NOLOW if the
+   // mask holds fewer than five numbers
+   unsigned short lowTable[NUMLOWMASKS];
+
+}; // end class HiLoEvaluator
+
+//******************************************************************************
+// Function : getLowMask
+// Process  : Set the bit of each card number of eight or lower, rotated so
+//             the ace is bit 0
+// Notes    : Private
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int HiLoEvaluator::getLowMask(
+   const PackedCard  cards[],
+   const int         numCards)
+{
+   int lowMask = 0;  // Bit set for each low card number
+   int rank    = 0;  // Rotated card number, from 0 for an ace
+
+   for (int cardIndex = 0; cardIndex < numCards; ++cardIndex)
+   {
+      rank = (cards[cardIndex].getRank() + 1) % PackedCard::NUMRANKS;
+
+      if (rank < NUMLOWRANKS)
+      {
+         lowMask |= 1 << rank;
+      }
+   }
+
+   return lowMask;
+} // end HiLoEvaluator::getLowMask
+
+#endif // HiLoEvaluator_h
@@ -0,0 +1,284 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     LowballEvaluator.cpp
+//
+// File Overview: Represents a table-driven Lowball Evaluator to rank a hand
+//                of cards under the ace to five or deuce to seven rules
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#include "stdafx.h"
+#include "LowballEvaluator.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : Build the table from high hand value to lowball value
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+LowballEvaluator::LowballEvaluator(const LowballRule rule)
+   : rule(rule)
+{
+   for (int value = 0; value <= HandEvaluator::MAXVALUE; ++value)
+   {
+      this->lowTable[value] = HandEvaluator::INVALIDVALUE;
+   }
+
+   if (this->rule == ACETOFIVE)
+   {
+      this->buildAceToFiveTable();
+   }
+   else
+   {
+      this->buildDeuceToSevenTable();
+   }
+} // end LowballEvaluator::LowballEvaluator
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+LowballEvaluator::~LowballEvaluator()
+{
+} // end LowballEvaluator::~LowballEvaluator
+
+//******************************************************************************
+// Function : buildAceToFiveTable
+// Process  : Number each mask of five unique rotated card numbers in
+//             increasing order, straights included, as the high cards
+//             Place every repeated hand above the high cards, in the order
+//             of its high hand value
+//             Store each ace to five value, the best low being the highest
+// Notes    : Private, called by the constructor
+//             The rotated cards never hold a flush, so the flush and
+//             straight flush values are never looked up
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void LowballEvaluator::buildAceToFiveTable()
+{
+   int numHighCards = 0;   // Masks of five unique numbers numbered so far
+
+   for (int mask = 0; mask < HandEvaluator::NUMRANKMASKS; ++mask)
+   {
+      if (CardSet::popCount(mask) == Hand::MAXCARDS)
+      {
+         ++numHighCards;
+
+         this->lowTable[this->evaluateMask(mask, false)] =
+            static_cast<unsigned short>(
+               MAXACETOFIVEVALUE + 1 - numHighCards);
+      }
+   }
+
+   for (int value = this->evaluator.getHighestValue(Hand::HIGHCARD) + 1;
+        value <= this->evaluator.getHighestValue(Hand::THREEOFAKIND);
+        ++value)
+   {
+      this->lowTable[value] = static_cast<unsigned short>(
+         MAXACETOFIVEVALUE + 1 -
+         (value - this->evaluator.getHighestValue(Hand::HIGHCARD) +
+          numHighCards));
+   }
+
+   for (int value = this->evaluator.getHighestValue(Hand::FLUSH) + 1;
+        value <= this->evaluator.getHighestValue(Hand::FOUROFAKIND);
+        ++value)
+   {
+      this->lowTable[value] = static_cast<unsigned short>(
+         MAXACETOFIVEVALUE + 1 -
+         (value - this->evaluator.getHighestValue(Hand::HIGHCARD) -
+          (this->evaluator.getHighestValue(Hand::FLUSH) -
+           this->evaluator.getHighestValue(Hand::THREEOFAKIND)) +
+          numHighCards));
+   }
+} // end LowballEvaluator::buildAceToFiveTable
+
+//******************************************************************************
+// Function : buildDeuceToSevenTable
+// Process  : Rank every hand as a high hand where the low ace straight
+//             (5 4 3 2 A) is an ace high card
+//                Straights and straight flushes keep their high hand value,
+//                   one fewer straight below and one more high card
+//                Every other repeated hand moves up by one
+//                High cards and flushes are numbered by mask in increasing
+//                   order, skipping the straights
+//             Store each deuce to seven value, the best low being the highest
+// Notes    : Private, called by the constructor
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void LowballEvaluator::buildDeuceToSevenTable()
+{
+   const int      STRAIGHTMASK = (1 << Hand::MAXCARDS) - 1; // Five numbers
+   const int      FLUSHOFFSET  =      // Deuce to seven values below flushes
+      this->evaluator.getHighestValue(Hand::STRAIGHT);
+   Hand::HandType type         = Hand::INVALIDHAND;
+   int            highValue    = HandEvaluator::INVALIDVALUE;
+   int            numHighCards = 0;   // Masks numbered so far
+   bool           isStraight   = false;
+
+   for (int value = HandEvaluator::MINVALUE;
+        value <= HandEvaluator::MAXVALUE;
+        ++value)
+   {
+      type      = this->evaluator.getHandType(value);
+      highValue = value + 1;
+
+      if (type == Hand::STRAIGHT || type == Hand::STRAIGHTFLUSH)
+      {
+         highValue = value;
+      }
+
+      this->lowTable[value] = static_cast<unsigned short>(
+         HandEvaluator::MAXVALUE + 1 - highValue);
+   }
+
+   for (int mask = 0; mask < HandEvaluator::NUMRANKMASKS; ++mask)
+   {
+      if (CardSet::popCount(mask) != Hand::MAXCARDS)
+      {
+         continue;
+      }
+
+      isStraight = false;
+
+      for (int lowRank = 0;
+           lowRank + Hand::MAXCARDS <= PackedCard::NUMRANKS;
+           ++lowRank)
+      {
+         if (mask == STRAIGHTMASK << lowRank)
+         {
+            isStraight = true;
+         }
+      }
+
+      if (!isStraight)
+      {
+         ++numHighCards;
+
+         this->lowTable[this->evaluateMask(mask, false)] =
+            static_cast<unsigned short>(
+               HandEvaluator::MAXVALUE + 1 - numHighCards);
+         this->lowTable[this->evaluateMask(mask, true)] =
+            static_cast<unsigned short>(
+               HandEvaluator::MAXVALUE + 1 - FLUSHOFFSET - numHighCards);
+      }
+   }
+} // end LowballEvaluator::buildDeuceToSevenTable
+
+//******************************************************************************
+// Function : evaluateBatch
+// Process  : Evaluate many five card hands and write each lowball value
+//             For ace to five, rotate the cards of up to BATCHHANDS hands at
+//                a time and batch evaluate them
+//             Else, batch evaluate the cards as they are
+//             Look up the lowball value of each high hand value
+// Notes    : cards must hold numHands * MAXCARDS valid cards, hand after
+//             hand, values must hold numHands values
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void LowballEvaluator::evaluateBatch(
+   const PackedCard  cards[],
+   const int         numHands,
+   int               values[]) const
+{
+   PackedCard  rotatedCards[BATCHHANDS * Hand::MAXCARDS]; // Ace low copies
+   int         numBatchHands = 0;   // Hands in the current batch
+
+   if (this->rule == ACETOFIVE)
+   {
+      for (int handIndex = 0; handIndex < numHands; handIndex += BATCHHANDS)
+      {
+         numBatchHands = numHands - handIndex;
+
+         if (numBatchHands > BATCHHANDS)
+         {
+            numBatchHands = BATCHHANDS;
+         }
+
+         LowballEvaluator::rotateCards(
+            cards + handIndex * Hand::MAXCARDS,
+            numBatchHands * Hand::MAXCARDS,
+            rotatedCards);
+
+         this->evaluator.evaluateBatch(
+            rotatedCards, numBatchHands, values + handIndex);
+      }
+   }
+   else
+   {
+      this->evaluator.evaluateBatch(cards, numHands, values);
+   }
+
+   for (int handIndex = 0; handIndex < numHands; ++handIndex)
+   {
+      values[handIndex] = this->lowTable[values[handIndex]];
+   }
+} // end LowballEvaluator::evaluateBatch
+
+//******************************************************************************
+// Function : evaluateMask
+// Process  : Build one card of each number in the mask, each in the next
+//             suit, or all clubs if isFlush, then evaluate them
+// Notes    : Private, the mask must hold five card numbers
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int LowballEvaluator::evaluateMask(const int mask, const bool isFlush) const
+{
+   PackedCard  cards[Hand::MAXCARDS];  // One card of each number
+   int         cardIndex = 0;          // Next card to build
+
+   for (int rank = 0; rank < PackedCard::NUMRANKS; ++rank)
+   {
+      if (mask & (1 << rank))
+      {
+         cards[cardIndex] = PackedCard::fromIndex(
+            rank * PackedCard::NUMSUITS +
+            (isFlush ? 0 : cardIndex % PackedCard::NUMSUITS));
+
+         ++cardIndex;
+      }
+   }
+
+   return this->evaluator.evaluate(cards);
+} // end LowballEvaluator::evaluateMask
@@ -0,0 +1,315 @@
+//******************************************************************************
+//
+// File Name:     LowballEvaluator.h
+//
+// File Overview: Represents a table-driven Lowball Evaluator to rank a hand
+//                of cards under the ace to five or deuce to seven rules
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef LowballEvaluator_h
+#define LowballEvaluator_h
+
+#include "HandEvaluator.h"
+
+//******************************************************************************
+//
+// Class:    LowballEvaluator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : Lowball values are dense and, as with HandEvaluator, a larger
+//             value is always a stronger (lower) hand.
+//             Ace to five: straights and flushes are ignored and the ace is
+//             low, from 1 (K K K K Q) to 6175 (5 4 3 2 A).
+//             Deuce to seven: straights and flushes count against the hand
+//             and the ace is high, from 1 (royal flush) to 7462 (7 5 4 3 2).
+//             Each hand is evaluated by HandEvaluator then mapped through a
+//             table from the high hand value to the lowball value, built
+//             once by the constructor.  For ace to five, the card numbers
+//             are rotated so the ace is lowest and the suits are spread so
+//             no flush is seen.
+//
+//******************************************************************************
+class LowballEvaluator
+{
+public:
+
+   enum LowballRule;
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Builds the table from high hand value to lowball value
+   //                for the input rule
+   // Constraints : None
+   //***************************************************************************
+   LowballEvaluator(const LowballRule rule);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~LowballEvaluator();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the five cards and returns the lowball value
+   // Constraints : The cards must be valid, cards must hold five cards
+   //***************************************************************************
+   inline int evaluate(const Card cards[]) const;
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the five packed cards and returns the lowball
+   //                value
+   // Constraints : The cards must be valid, cards must hold five cards
+   //***************************************************************************
+   inline int evaluate(const PackedCard cards[]) const;
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the hand and returns the lowball value
+   // Constraints : The hand must hold five valid cards
+   //***************************************************************************
+   inline int evaluate(const Hand& hand) const;
+
+   //***************************************************************************
+   // Function    : evaluateBatch
+   // Description : Evaluates many five card hands and writes each lowball
+   //                value, with the HandEvaluator batch evaluation
+   // Constraints : cards must hold numHands * MAXCARDS valid cards, hand
+   //                after hand, values must hold numHands values
+   //***************************************************************************
+   void evaluateBatch(
+      const PackedCard  cards[],
+      const int         numHands,
+      int               values[]) const;
+
+   //***************************************************************************
+   // Function    : getMaxValue
+   // Description : Returns the lowball value of the best hand of the rule
+   // Constraints : None
+   //***************************************************************************
+   inline int getMaxValue() const;
+
+   //***************************************************************************
+   // Function    : getRule
+   // Description : Accessor for rule
+   // Constraints : None
+   //***************************************************************************
+   inline LowballRule getRule() const;
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the lowball rules
+   enum LowballRule
+   {
+      ACETOFIVE,
+      DEUCETOSEVEN
+   };
+
+   // Represents the range of lowball values
+   enum LowballValueRange
+   {
+      MAXACETOFIVEVALUE    = 6175,
+      MAXDEUCETOSEVENVALUE = HandEvaluator::MAXVALUE
+   };
+
+   // Represents the number of hands rotated at a time by evaluateBatch
+   enum LowballBatchSize
+   {
+      BATCHHANDS = 256
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : buildAceToFiveTable
+   // Description : Builds the table from the high hand value of the rotated
+   //                card numbers to the ace to five value
+   // Constraints : Private, called by the constructor
+   //***************************************************************************
+   void buildAceToFiveTable();
+
+   //***************************************************************************
+   // Function    : buildDeuceToSevenTable
+   // Description : Builds the table from the high hand value to the deuce
+   //                to seven value
+   // Constraints : Private, called by the constructor
+   //***************************************************************************
+   void buildDeuceToSevenTable();
+
+   //***************************************************************************
+   // Function    : evaluateMask
+   // Description : Returns the high hand value of five unique card numbers
+   //                with the suits spread, or all one suit if isFlush
+   // Constraints : Private, the mask must hold five card numbers
+   //***************************************************************************
+   int evaluateMask(const int mask, const bool isFlush) const;
+
+   //***************************************************************************
+   // Function    : rotateCards
+   // Description : Copies the cards with the ace as the lowest card number
+   //                and each card of the hand in a different suit
+   // Constraints : Private, used by ace to five
+   //***************************************************************************
+   static inline void rotateCards(
+      const PackedCard  cards[],
+      const int         numCards,
+      PackedCard        rotatedCards[]);
+
+   HandEvaluator  evaluator;  // Evaluates the high hand value
+   LowballRule    rule;       // Lowball rule to evaluate
+
+   // Lowball value of each high hand value
+   unsigned short lowTable[HandEvaluator::MAXVALUE + 1];
+
+}; // end class LowballEvaluator
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Pack the five cards then evaluate them
+// Notes    : The cards must be valid, cards must hold five cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int LowballEvaluator::evaluate(const Card cards[]) const
+{
+   PackedCard packedCards[Hand::MAXCARDS]; // Packed copy of the cards
+
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      packedCards[cardIndex] = PackedCard(cards[cardIndex]);
+   }
+
+   return this->evaluate(packedCards);
+} // end LowballEvaluator::evaluate
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Evaluate the five packed cards and return the lowball value
+//             For ace to five, rotate the cards first
+//             Evaluate the high hand value and look up the lowball value
+// Notes    : The cards must be valid, cards must hold five cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int LowballEvaluator::evaluate(const PackedCard cards[]) const
+{
+   PackedCard rotatedCards[Hand::MAXCARDS];  // Ace low copy of the cards
+
+   if (this->rule == ACETOFIVE)
+   {
+      LowballEvaluator::rotateCards(cards, Hand::MAXCARDS, rotatedCards);
+
+      return this->lowTable[this->evaluator.evaluate(rotatedCards)];
+   }
+
+   return this->lowTable[this->evaluator.evaluate(cards)];
+} // end LowballEvaluator::evaluate
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Copy the hand's packed cards then evaluate them
+// Notes    : The hand must hold five valid cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int LowballEvaluator::evaluate(const Hand& hand) const
+{
+   PackedCard cards[Hand::MAXCARDS];   // Cards in the hand
+
+   hand.getPackedCards(cards);
+
+   return this->evaluate(cards);
+} // end LowballEvaluator::evaluate
+
+//******************************************************************************
+// Function : getMaxValue
+// Process  : Return the lowball value of the best hand of the rule
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int LowballEvaluator::getMaxValue() const
+{
+   if (this->rule == ACETOFIVE)
+   {
+      return MAXACETOFIVEVALUE;
+   }
+
+   return MAXDEUCETOSEVENVALUE;
+} // end LowballEvaluator::getMaxValue
+
+//******************************************************************************
+// Function : getRule
+// Process  : Accessor for rule
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline LowballEvaluator::LowballRule LowballEvaluator::getRule() const
+{
+   return this->rule;
+} // end LowballEvaluator::getRule
+
+//******************************************************************************
+// Function : rotateCards
+// Process  : Copy each card with its number rotated one up, so the ace
+//             becomes the lowest number and the two the second lowest
+//             Give each card of the hand the next suit so five cards never
+//             share one suit
+// Notes    : Private, the suits of a lowball hand do not matter for ace to
+//             five, the copies may repeat a card which the evaluator allows
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void LowballEvaluator::rotateCards(
+   const PackedCard  cards[],
+   const int         numCards,
+   PackedCard        rotatedCards[])
+{
+   int rank = 0;  // Rotated card number, from 0 for an ace
+
+   for (int cardIndex = 0; cardIndex < numCards; ++cardIndex)
+   {
+      rank = (cards[cardIndex].getRank() + 1) % PackedCard::NUMRANKS;
+
+      rotatedCards[cardIndex] = PackedCard::fromIndex(
+         rank * PackedCard::NUMSUITS + cardIndex % PackedCard::NUMSUITS);
+   }
+} // end LowballEvaluator::rotateCards
+
+#endif // LowballEvaluator_h
@@ -0,0 +1,313 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     MappedFile.cpp
+//
+// File Overview: Represents a file mapped into memory, read-only or created
+//                writable
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Added huge pages
+// 10.18.26       Donne Martin         Added writable mappings
+//******************************************************************************
+
+#include "stdafx.h"
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "MappedFile.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : None
+// Notes    : Need to open a file before reading data
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Added writable mappings
+//******************************************************************************
+MappedFile::MappedFile()
+   : data(NULL),
+     size(0),
+     writable(false)
+{
+} // end MappedFile::MappedFile
+
+//******************************************************************************
+// Function : destructor
+// Process  : Close the mapping
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+MappedFile::~MappedFile()
+{
+   this->close();
+} // end MappedFile::~MappedFile
+
+//******************************************************************************
+// Function : close
+// Process  : Unmap the view of the file, if one is mapped
+// Notes    : The system writes back the pages of a writable mapping
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Added writable mappings
+//******************************************************************************
+void MappedFile::close()
+{
+   if (this->data == NULL)
+   {
+      return;
+   }
+
+#if defined(_WIN32)
+   UnmapViewOfFile(this->data);
+#else
+   munmap(const_cast<void*>(this->data), this->size);
+#endif
+
+   this->data     = NULL;
+   this->size     = 0;
+   this->writable = false;
+} // end MappedFile::close
+
+//******************************************************************************
+// Function : create
+// Process  : Close any file already mapped
+//             Create or truncate the file for reading and writing
+//             Size it and map it whole, writable and shared
+//             Close the file, the mapping keeps it open
+// Notes    : Throw an exception if size is 0 or the file cannot be created,
+//             sized, or mapped
+//             On Windows, creating the mapping sizes the file
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void MappedFile::create(
+   const char*    fileName,
+   const size_t   size)
+{
+   this->close();
+
+   if (size == 0)
+   {
+      throw exception("Invalid size in MappedFile::create");
+   }
+
+#if defined(_WIN32)
+   HANDLE         file     = INVALID_HANDLE_VALUE; // Created file
+   HANDLE         mapping  = NULL;                 // Mapping of the file
+   ULARGE_INTEGER fileSize;                        // Size of the file
+
+   fileSize.QuadPart = size;
+
+   file = CreateFileA(fileName,
+                      GENERIC_READ | GENERIC_WRITE,
+                      0,
+                      NULL,
+                      CREATE_ALWAYS,
+                      FILE_ATTRIBUTE_NORMAL,
+                      NULL);
+
+   if (file == INVALID_HANDLE_VALUE)
+   {
+      throw exception("Unable to create file in MappedFile::create");
+   }
+
+   mapping = CreateFileMappingA(file,
+                                NULL,
+                                PAGE_READWRITE,
+                                fileSize.HighPart,
+                                fileSize.LowPart,
+                                NULL);
+
+   if (mapping != NULL)
+   {
+      this->data = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0);
+   }
+
+   // The view keeps the file and the mapping open
+   if (mapping != NULL)
+   {
+      CloseHandle(mapping);
+   }
+
+   CloseHandle(file);
+
+   if (this->data == NULL)
+   {
+      throw exception("Unable to map file in MappedFile::create");
+   }
+#else
+   int   file     = ::open(fileName, O_RDWR | O_CREAT | O_TRUNC, 0644);
+   void* mapping  = MAP_FAILED;                 // Mapping of the file
+
+   if (file < 0)
+   {
+      throw exception("Unable to create file in MappedFile::create");
+   }
+
+   if (ftruncate(file, static_cast<off_t>(size)) != 0)
+   {
+      ::close(file);
+      throw exception("Unable to size file in MappedFile::create");
+   }
+
+   mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+
+   // The mapping keeps the file open
+   ::close(file);
+
+   if (mapping == MAP_FAILED)
+   {
+      throw exception("Unable to map file in MappedFile::create");
+   }
+
+   this->data = mapping;
+#endif
+
+   this->size     = size;
+   this->writable = true;
+} // end MappedFile::create
+
+//******************************************************************************
+// Function : open
+// Process  : Close any file already mapped
+//             Open the file for reading and get its size
+//             Map the whole file read-only and shared
+//             Close the file, the mapping keeps it open
+//             If useHugePages, advise huge pages where supported
+// Notes    : Throw an exception if the file cannot be opened or mapped, or
+//             is empty
+//             Windows file mappings cannot use large pages, so useHugePages
+//             is ignored there
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Added huge pages
+//******************************************************************************
+void MappedFile::open(
+   const char* fileName,
+   const bool  useHugePages)
+{
+   this->close();
+
+#if defined(_WIN32)
+   HANDLE         file     = INVALID_HANDLE_VALUE; // Open file
+   HANDLE         mapping  = NULL;                 // Mapping of the file
+   LARGE_INTEGER  fileSize;                        // Size of the file
+
+   file = CreateFileA(fileName,
+                      GENERIC_READ,
+                      FILE_SHARE_READ,
+                      NULL,
+                      OPEN_EXISTING,
+                      FILE_ATTRIBUTE_NORMAL,
+                      NULL);
+
+   if (file == INVALID_HANDLE_VALUE)
+   {
+      throw exception("Unable to open file in MappedFile::open");
+   }
+
+   if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+   {
+      CloseHandle(file);
+      throw exception("Unable to size file in MappedFile::open");
+   }
+
+   mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+   if (mapping != NULL)
+   {
+      this->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+   }
+
+   // The view keeps the file and the mapping open
+   if (mapping != NULL)
+   {
+      CloseHandle(mapping);
+   }
+
+   CloseHandle(file);
+
+   if (this->data == NULL)
+   {
+      throw exception("Unable to map file in MappedFile::open");
+   }
+
+   this->size = static_cast<size_t>(fileSize.QuadPart);
+#else
+   int         file     = ::open(fileName, O_RDONLY);  // Open file
+   struct stat fileStat;                               // Size of the file
+   void*       mapping  = MAP_FAILED;                  // Mapping of the file
+
+   if (file < 0)
+   {
+      throw exception("Unable to open file in MappedFile::open");
+   }
+
+   if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+   {
+      ::close(file);
+      throw exception("Unable to size file in MappedFile::open");
+   }
+
+   mapping = mmap(NULL,
+                  static_cast<size_t>(fileStat.st_size),
+                  PROT_READ,
+                  MAP_SHARED,
+                  file,
+                  0);
+
+   // The mapping keeps the file open
+   ::close(file);
+
+   if (mapping == MAP_FAILED)
+   {
+      throw exception("Unable to map file in MappedFile::open");
+   }
+
+   this->data = mapping;
+   this->size = static_cast<size_t>(fileStat.st_size);
+
+#if defined(MADV_HUGEPAGE)
+   // Advice only, the mapping works the same if it is not taken
+   if (useHugePages)
+   {
+      madvise(mapping, this->size, MADV_HUGEPAGE);
+   }
+#endif
+#endif
+} // end MappedFile::open
@@ -0,0 +1,210 @@
+//******************************************************************************
+//
+// File Name:     MappedFile.h
+//
+// File Overview: Represents a file mapped into memory, read-only or created
+//                writable
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Added huge pages
+// 10.18.26       Donne Martin         Added writable mappings
+//******************************************************************************
+
+#ifndef MappedFile_h
+#define MappedFile_h
+
+#include <cstddef>
+
+//******************************************************************************
+//
+// Class:    MappedFile
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Added huge pages
+// 10.18.26       Donne Martin         Added writable mappings
+//
+// Notes    : The whole file is mapped read-only and shared, so every process
+//             mapping the same file reads the same page cache copy and
+//             opening it costs no reads up front
+//             Uses file mappings on Windows and mmap elsewhere
+//             Huge pages are only advice, taken on Linux where the kernel
+//             backs the file's page cache with huge pages, such as tmpfs
+//             mounted with huge=within_size, and ignored on Windows where
+//             file mappings cannot use large pages
+//             create makes a new file of a fixed size and maps it writable
+//             and shared, so the bytes written through getWritableData are
+//             the file's contents, written back by the system
+//             Not copyable, the mapping is released by the destructor
+//
+//******************************************************************************
+class MappedFile
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, maps no file
+   // Constraints : Need to open a file before reading data
+   //***************************************************************************
+   MappedFile();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Closes the mapping
+   // Constraints : None
+   //***************************************************************************
+   virtual ~MappedFile();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : close
+   // Description : Unmaps the file, if one is mapped
+   // Constraints : Pointers returned by getData are no longer valid
+   //***************************************************************************
+   void close();
+
+   //***************************************************************************
+   // Function    : create
+   // Description : Creates the file, or truncates it, at size bytes and maps
+   //                it writable, closing any file already mapped
+   // Constraints : Throws an exception if size is 0 or the file cannot be
+   //                created, sized, or mapped
+   //***************************************************************************
+   void create(
+      const char*    fileName,
+      const size_t   size);
+
+   //***************************************************************************
+   // Function    : getData
+   // Description : Returns the first byte of the mapped file
+   // Constraints : Returns NULL if no file is mapped
+   //***************************************************************************
+   inline const void* getData() const;
+
+   //***************************************************************************
+   // Function    : getSize
+   // Description : Returns the size of the mapped file in bytes
+   // Constraints : Returns 0 if no file is mapped
+   //***************************************************************************
+   inline size_t getSize() const;
+
+   //***************************************************************************
+   // Function    : getWritableData
+   // Description : Returns the first byte of the mapped file, to write to
+   // Constraints : Returns NULL if no file is mapped or it was mapped
+   //                read-only by open
+   //***************************************************************************
+   inline void* getWritableData() const;
+
+   //***************************************************************************
+   // Function    : isOpen
+   // Description : Returns whether a file is mapped
+   // Constraints : None
+   //***************************************************************************
+   inline bool isOpen() const;
+
+   //***************************************************************************
+   // Function    : open
+   // Description : Maps the whole file read-only, closing any file already
+   //                mapped
+   //                If useHugePages, advises the system to back the mapping
+   //                with huge pages where it can
+   // Constraints : Throws an exception if the file cannot be opened or
+   //                mapped, or is empty
+   //***************************************************************************
+   void open(
+      const char* fileName,
+      const bool  useHugePages = false);
+
+private:
+
+   //***************************************************************************
+   // Function    : copy constructor
+   // Description : Not implemented, a mapping has one owner
+   // Constraints : Private
+   //***************************************************************************
+   MappedFile(const MappedFile& mappedFile);
+
+   //***************************************************************************
+   // Function    : operator=
+   // Description : Not implemented, a mapping has one owner
+   // Constraints : Private
+   //***************************************************************************
+   MappedFile& operator=(const MappedFile& mappedFile);
+
+   const void* data;       // First byte of the mapping, NULL if not open
+   size_t      size;       // Size of the mapping in bytes
+   bool        writable;   // Mapped writable by create
+
+}; // end class MappedFile
+
+//******************************************************************************
+// Function : getData
+// Process  : Accessor for data
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline const void* MappedFile::getData() const
+{
+   return this->data;
+} // end MappedFile::getData
+
+//******************************************************************************
+// Function : getSize
+// Process  : Accessor for size
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline size_t MappedFile::getSize() const
+{
+   return this->size;
+} // end MappedFile::getSize
+
+//******************************************************************************
+// Function : getWritableData
+// Process  : Return data if the mapping is writable, else NULL
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void* MappedFile::getWritableData() const
+{
+   return this->writable ? const_cast<void*>(this->data) : NULL;
+} // end MappedFile::getWritableData
+
+//******************************************************************************
+// Function : isOpen
+// Process  : Return whether data points at a mapping
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline bool MappedFile::isOpen() const
+{
+   return this->data != NULL;
+} // end MappedFile::isOpen
+
+#endif // MappedFile_h
@@ -0,0 +1,309 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     OmahaEvaluator.cpp
+//
+// File Overview: Represents an Omaha Evaluator to rank four, five, or six
+//                hole cards against a five card board, using exactly two
+//                hole cards and three board cards
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#include "stdafx.h"
+#include <utility>
+#include "OmahaEvaluator.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize the evaluator without a board
+// Notes    : Need to set the board before evaluating
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+OmahaEvaluator::OmahaEvaluator()
+   : isBoardSet(false)
+{
+   for (int combination = 0;
+        combination < NUMBOARDCOMBINATIONS;
+        ++combination)
+   {
+      this->highestValues[combination] = HandEvaluator::INVALIDVALUE;
+   }
+} // end OmahaEvaluator::OmahaEvaluator
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+OmahaEvaluator::~OmahaEvaluator()
+{
+} // end OmahaEvaluator::~OmahaEvaluator
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Evaluate the hole cards against the board
+//             For each board combination, highest possible value first
+//                Stop if the combination cannot beat the best hand found
+//                For each pair of hole cards
+//                   Evaluate the two hole cards and three board cards
+//                   Keep the best hand value
+//                   Stop this combination once it reaches its highest
+//                      possible value
+// Notes    : Throw an exception if the board is not set or the number of
+//             hole cards is not four, five, or six
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int OmahaEvaluator::evaluate(
+   const PackedCard  holeCards[],
+   const int         numHoleCards) const
+{
+   PackedCard  cards[Hand::MAXCARDS];  // Two hole cards then the board cards
+   int         bestValue = HandEvaluator::INVALIDVALUE;
+   int         value     = HandEvaluator::INVALIDVALUE;
+
+   if (!this->isBoardSet)
+   {
+      throw exception("Board not set in evaluate");
+   }
+
+   if (numHoleCards < MINHOLECARDS || numHoleCards > MAXHOLECARDS)
+   {
+      throw exception("Unexpected number of hole cards in evaluate");
+   }
+
+   for (int combination = 0;
+        combination < NUMBOARDCOMBINATIONS &&
+           this->highestValues[combination] > bestValue;
+        ++combination)
+   {
+      for (int boardIndex = 0; boardIndex < NUMUSEDBOARDCARDS; ++boardIndex)
+      {
+         cards[NUMUSEDHOLECARDS + boardIndex] =
+            this->boardCombinations[combination][boardIndex];
+      }
+
+      for (int first = 0;
+           first < numHoleCards - 1 &&
+              bestValue < this->highestValues[combination];
+           ++first)
+      {
+         cards[0] = holeCards[first];
+
+         for (int second = first + 1;
+              second < numHoleCards &&
+                 bestValue < this->highestValues[combination];
+              ++second)
+         {
+            cards[1] = holeCards[second];
+            value    = this->evaluator.evaluate(cards);
+
+            if (value > bestValue)
+            {
+               bestValue = value;
+            }
+         }
+      }
+   }
+
+   return bestValue;
+} // end OmahaEvaluator::evaluate
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Pack the hole cards then evaluate them
+// Notes    : Throw an exception if the number of hole cards is not four,
+//             five, or six
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int OmahaEvaluator::evaluate(
+   const Card  holeCards[],
+   const int   numHoleCards) const
+{
+   PackedCard packedCards[MAXHOLECARDS];  // Packed copy of the hole cards
+
+   if (numHoleCards < MINHOLECARDS || numHoleCards > MAXHOLECARDS)
+   {
+      throw exception("Unexpected number of hole cards in evaluate");
+   }
+
+   for (int cardIndex = 0; cardIndex < numHoleCards; ++cardIndex)
+   {
+      packedCards[cardIndex] = PackedCard(holeCards[cardIndex]);
+   }
+
+   return this->evaluate(packedCards, numHoleCards);
+} // end OmahaEvaluator::evaluate
+
+//******************************************************************************
+// Function : getHighestType
+// Process  : Determine the highest hand type the three cards could make
+//             with any two other cards
+//             A repeated number can make a full house or four of a kind
+//             Else, three unique numbers make at best three of a kind,
+//                unless they fit in a straight or share a suit
+// Notes    : Private, called by setBoard
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+Hand::HandType OmahaEvaluator::getHighestType(const PackedCard cards[])
+{
+   const int   STRAIGHTMASK = (1 << Hand::MAXCARDS) - 1; // Five numbers
+   int         rankMask     = 0;     // Bit set for each card number
+   int         suitMask     = 0;     // Bit set for each suit
+   bool        isFlush      = false;
+   bool        isStraight   = false;
+
+   for (int cardIndex = 0; cardIndex < NUMUSEDBOARDCARDS; ++cardIndex)
+   {
+      rankMask |= 1 << cards[cardIndex].getRank();
+      suitMask |= 1 << cards[cardIndex].getSuitIndex();
+   }
+
+   if (CardSet::popCount(rankMask) < NUMUSEDBOARDCARDS)
+   {
+      return Hand::FOUROFAKIND;
+   }
+
+   // A single suit bit means every card has the same suit
+   isFlush    = (suitMask & (suitMask - 1)) == 0;
+   isStraight = (rankMask & ~CardSet::LOWACESTRAIGHT) == 0;
+
+   for (int lowRank = 0;
+        lowRank + Hand::MAXCARDS <= PackedCard::NUMRANKS;
+        ++lowRank)
+   {
+      if ((rankMask & ~(STRAIGHTMASK << lowRank)) == 0)
+      {
+         isStraight = true;
+      }
+   }
+
+   if (isFlush && isStraight)
+   {
+      return Hand::STRAIGHTFLUSH;
+   }
+   else if (isFlush)
+   {
+      return Hand::FLUSH;
+   }
+   else if (isStraight)
+   {
+      return Hand::STRAIGHT;
+   }
+
+   return Hand::THREEOFAKIND;
+} // end OmahaEvaluator::getHighestType
+
+//******************************************************************************
+// Function : setBoard
+// Process  : Build the ten three card board combinations
+//             Store the highest hand value of each combination
+//             Sort the combinations from the highest value down
+// Notes    : The board must hold five valid and unique cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void OmahaEvaluator::setBoard(const PackedCard board[])
+{
+   int combination = 0; // Index of the next board combination
+
+   for (int first = 0; first < HandEvaluator::NUMBOARDCARDS; ++first)
+   {
+      for (int second = first + 1;
+           second < HandEvaluator::NUMBOARDCARDS;
+           ++second)
+      {
+         for (int third = second + 1;
+              third < HandEvaluator::NUMBOARDCARDS;
+              ++third)
+         {
+            this->boardCombinations[combination][0] = board[first];
+            this->boardCombinations[combination][1] = board[second];
+            this->boardCombinations[combination][2] = board[third];
+
+            this->highestValues[combination] =
+               this->evaluator.getHighestValue(OmahaEvaluator::getHighestType(
+                  this->boardCombinations[combination]));
+
+            ++combination;
+         }
+      }
+   }
+
+   // Insertion sort, highest value first
+   for (int sorted = 1; sorted < NUMBOARDCOMBINATIONS; ++sorted)
+   {
+      for (int index = sorted;
+           index > 0 &&
+              this->highestValues[index] > this->highestValues[index - 1];
+           --index)
+      {
+         swap(this->highestValues[index], this->highestValues[index - 1]);
+         swap(this->boardCombinations[index],
+              this->boardCombinations[index - 1]);
+      }
+   }
+
+   this->isBoardSet = true;
+} // end OmahaEvaluator::setBoard
+
+//******************************************************************************
+// Function : setBoard
+// Process  : Pack the board then set it
+// Notes    : The board must hold five valid and unique cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void OmahaEvaluator::setBoard(const Card board[])
+{
+   PackedCard packedBoard[HandEvaluator::NUMBOARDCARDS]; // Packed copy
+
+   for (int cardIndex = 0;
+        cardIndex < HandEvaluator::NUMBOARDCARDS;
+        ++cardIndex)
+   {
+      packedBoard[cardIndex] = PackedCard(board[cardIndex]);
+   }
+
+   this->setBoard(packedBoard);
+} // end OmahaEvaluator::setBoard
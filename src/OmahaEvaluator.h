@@ -0,0 +1,132 @@
+//******************************************************************************
+//
+// File Name:     OmahaEvaluator.h
+//
+// File Overview: Represents an Omaha Evaluator to rank four, five, or six
+//                hole cards against a five card board, using exactly two
+//                hole cards and three board cards
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef OmahaEvaluator_h
+#define OmahaEvaluator_h
+
+#include "HandEvaluator.h"
+
+//******************************************************************************
+//
+// Class:    OmahaEvaluator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : Set the board once, then evaluate every player at the table.
+//             The ten three card board combinations are built by setBoard
+//             and shared by every player.  Each combination stores the
+//             highest hand value it could make with any two hole cards,
+//             and the combinations are kept from the highest bound down,
+//             so a player stops as soon as no combination left can beat
+//             the best hand found.
+//
+//******************************************************************************
+class OmahaEvaluator
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the evaluator without a board
+   // Constraints : Need to set the board before evaluating
+   //***************************************************************************
+   OmahaEvaluator();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~OmahaEvaluator();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Evaluates the hole cards against the board and returns
+   //                the hand value of the best five card hand made of two
+   //                hole cards and three board cards
+   // Constraints : Throws an exception if the board is not set or the
+   //                number of hole cards is not four, five, or six
+   //                The cards must be valid and unique
+   //***************************************************************************
+   int evaluate(
+      const PackedCard  holeCards[],
+      const int         numHoleCards) const;
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Packs the hole cards then evaluates them
+   // Constraints : See the packed card evaluate
+   //***************************************************************************
+   int evaluate(
+      const Card        holeCards[],
+      const int         numHoleCards) const;
+
+   //***************************************************************************
+   // Function    : setBoard
+   // Description : Builds the three card board combinations shared by every
+   //                player and their highest possible hand values
+   // Constraints : The board must hold five valid and unique cards
+   //***************************************************************************
+   void setBoard(const PackedCard board[]);
+
+   //***************************************************************************
+   // Function    : setBoard
+   // Description : Packs the board then sets it
+   // Constraints : The board must hold five valid and unique cards
+   //***************************************************************************
+   void setBoard(const Card board[]);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the number of cards in an Omaha hand
+   enum OmahaCardCount
+   {
+      NUMUSEDHOLECARDS     = 2,
+      NUMUSEDBOARDCARDS    = 3,
+      MINHOLECARDS         = 4,
+      MAXHOLECARDS         = 6,
+      NUMBOARDCOMBINATIONS = 10
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : getHighestType
+   // Description : Returns the highest hand type the three board cards could
+   //                make with any two other cards
+   // Constraints : Private, called by setBoard
+   //***************************************************************************
+   static Hand::HandType getHighestType(const PackedCard cards[]);
+
+   HandEvaluator  evaluator;  // Evaluates each five card hand
+   bool           isBoardSet; // Whether setBoard has been called
+
+   // Three card board combinations, highest possible hand value first
+   PackedCard     boardCombinations[NUMBOARDCOMBINATIONS][NUMUSEDBOARDCARDS];
+
+   // Highest hand value each board combination could make
+   int            highestValues[NUMBOARDCOMBINATIONS];
+
+}; // end class OmahaEvaluator
+
+#endif // OmahaEvaluator_h
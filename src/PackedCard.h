@@ -0,0 +1,364 @@
+//******************************************************************************
+//
+// File Name:     PackedCard.h
+//
+// File Overview: Represents a Card packed into a single byte index
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef PackedCard_h
+#define PackedCard_h
+
+#include <type_traits>
+#include "Card.h"
+
+//******************************************************************************
+//
+// Class:    PackedCard
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added class
+//
+// Notes    : The index is (number - TWO) * NUMSUITS + (suit - CLUB), from 0 for
+//             the two of clubs to 51 for the ace of diamonds
+//             Has no virtual destructor so it stays one trivially copyable
+//             byte, arrays of packed cards can be copied with memcpy
+//
+//******************************************************************************
+class PackedCard
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the index to an invalid value
+   //                Not the recommended constructor
+   // Constraints : Need to set the index afterwards
+   //***************************************************************************
+   inline constexpr PackedCard();
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the index from the input number and suit
+   //                Recommended constructor
+   // Constraints : The number and suit must be valid
+   //***************************************************************************
+   inline constexpr PackedCard(
+      const Card::CardNumber  number,
+      const Card::CardSuit    suit);
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Initializes the index from the input card
+   // Constraints : The card must be valid
+   //***************************************************************************
+   inline explicit PackedCard(const Card& card);
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : fromIndex
+   // Description : Returns the packed card with the input index
+   // Constraints : The index must be from 0 to NUMCARDS - 1
+   //***************************************************************************
+   static inline constexpr PackedCard fromIndex(const int index);
+
+   //***************************************************************************
+   // Function    : getIndex
+   // Description : Accessor for index, from 0 to NUMCARDS - 1
+   // Constraints : None
+   //***************************************************************************
+   inline constexpr int getIndex() const;
+
+   //***************************************************************************
+   // Function    : getNumber
+   // Description : Returns the card number
+   // Constraints : None
+   //***************************************************************************
+   inline constexpr Card::CardNumber getNumber() const;
+
+   //***************************************************************************
+   // Function    : getRank
+   // Description : Returns the card number from 0 for a two to 12 for an ace
+   //                Used to index lookup tables
+   // Constraints : None
+   //***************************************************************************
+   inline constexpr int getRank() const;
+
+   //***************************************************************************
+   // Function    : getSuit
+   // Description : Returns the card suit
+   // Constraints : None
+   //***************************************************************************
+   inline constexpr Card::CardSuit getSuit() const;
+
+   //***************************************************************************
+   // Function    : getSuitIndex
+   // Description : Returns the card suit from 0 for a club to 3 for a diamond
+   //                Used to index lookup tables
+   // Constraints : None
+   //***************************************************************************
+   inline constexpr int getSuitIndex() const;
+
+   //***************************************************************************
+   // Function    : isValid
+   // Description : Determines if the index is a valid card
+   // Constraints : None
+   //***************************************************************************
+   inline constexpr bool isValid() const;
+
+   //***************************************************************************
+   // Function    : toCard
+   // Description : Returns the unpacked card
+   // Constraints : None
+   //***************************************************************************
+   inline Card toCard() const;
+
+   //***************************************************************************
+   // Function    : operator==
+   // Description : Overloads the == operator
+   // Constraints : None
+   //***************************************************************************
+   inline constexpr bool operator==(const PackedCard& a) const;
+
+   //***************************************************************************
+   // Function    : operator!=
+   // Description : Overloads the != operator
+   // Constraints : None
+   //***************************************************************************
+   inline constexpr bool operator!=(const PackedCard& a) const;
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the packed card sizes
+   enum PackedCardSize
+   {
+      NUMSUITS       = Card::DIAMOND - Card::CLUB + 1,
+      NUMRANKS       = Card::ACE - Card::TWO + 1,
+      NUMCARDS       = NUMSUITS * NUMRANKS,
+      INVALIDINDEX   = 0xFF
+   };
+
+private:
+   unsigned char index; // Card index, from 0 to NUMCARDS - 1
+
+}; // end class PackedCard
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize the index to an invalid value
+// Notes    : Not the recommended constructor
+//             Need to set the index afterwards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr PackedCard::PackedCard()
+   : index(INVALIDINDEX)
+{
+} // end PackedCard::PackedCard
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize the index from the input number and suit
+// Notes    : Recommended constructor
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr PackedCard::PackedCard(
+   const Card::CardNumber  number,
+   const Card::CardSuit    suit)
+   : index(static_cast<unsigned char>(
+        (number - Card::TWO) * NUMSUITS + (suit - Card::CLUB)))
+{
+} // end PackedCard::PackedCard
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize the index from the input card
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline PackedCard::PackedCard(const Card& card)
+   : index(static_cast<unsigned char>(
+        (card.getNumber() - Card::TWO) * NUMSUITS +
+        (card.getSuit() - Card::CLUB)))
+{
+} // end PackedCard::PackedCard
+
+//******************************************************************************
+// Function : fromIndex
+// Process  : Return the packed card with the input index
+// Notes    : The index must be from 0 to NUMCARDS - 1
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr PackedCard PackedCard::fromIndex(const int index)
+{
+   return PackedCard(
+      static_cast<Card::CardNumber>(index / NUMSUITS + Card::TWO),
+      static_cast<Card::CardSuit>(index % NUMSUITS + Card::CLUB));
+} // end PackedCard::fromIndex
+
+//******************************************************************************
+// Function : getIndex
+// Process  : Accessor for index
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr int PackedCard::getIndex() const
+{
+   return this->index;
+} // end PackedCard::getIndex
+
+//******************************************************************************
+// Function : getNumber
+// Process  : Return the card number
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr Card::CardNumber PackedCard::getNumber() const
+{
+   return static_cast<Card::CardNumber>(this->getRank() + Card::TWO);
+} // end PackedCard::getNumber
+
+//******************************************************************************
+// Function : getRank
+// Process  : Return the card number from 0 for a two to 12 for an ace
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr int PackedCard::getRank() const
+{
+   return this->index / NUMSUITS;
+} // end PackedCard::getRank
+
+//******************************************************************************
+// Function : getSuit
+// Process  : Return the card suit
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr Card::CardSuit PackedCard::getSuit() const
+{
+   return static_cast<Card::CardSuit>(this->getSuitIndex() + Card::CLUB);
+} // end PackedCard::getSuit
+
+//******************************************************************************
+// Function : getSuitIndex
+// Process  : Return the card suit from 0 for a club to 3 for a diamond
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr int PackedCard::getSuitIndex() const
+{
+   return this->index % NUMSUITS;
+} // end PackedCard::getSuitIndex
+
+//******************************************************************************
+// Function : isValid
+// Process  : Determine if the index is a valid card
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr bool PackedCard::isValid() const
+{
+   return this->index < NUMCARDS;
+} // end PackedCard::isValid
+
+//******************************************************************************
+// Function : toCard
+// Process  : Return the unpacked card
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline Card PackedCard::toCard() const
+{
+   return Card(this->getNumber(), this->getSuit());
+} // end PackedCard::toCard
+
+//******************************************************************************
+// Function : operator==
+// Process  : Overload the == operator to work with the PackedCard class
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr bool PackedCard::operator==(const PackedCard& a) const
+{
+   return this->index == a.index;
+} // end PackedCard::operator==
+
+//******************************************************************************
+// Function : operator!=
+// Process  : Overload the != operator to work with the PackedCard class
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.17.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr bool PackedCard::operator!=(const PackedCard& a) const
+{
+   return this->index != a.index;
+} // end PackedCard::operator!=
+
+static_assert(sizeof(PackedCard) == 1, "PackedCard must be one byte");
+static_assert(is_trivially_copyable<PackedCard>::value,
+              "PackedCard must be trivially copyable");
+
+#endif // PackedCard_h
@@ -1,144 +1,531 @@
-// COPYRIGHT  2011, Donne Martin
-// All Rights Reserved.
-//
-//******************************************************************************
-//
-// File Name:     Poker.cpp
-//
-// File Overview: Represents Poker that generates and ranks hands
-//
-//******************************************************************************
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added class
-//******************************************************************************
-
-#include "stdafx.h"
-#include <exception>
-#include <iostream>
-#include "Poker.h"
-
-//******************************************************************************
-// File scope (static) variable definitions
-//******************************************************************************
-
-// None
-
-//******************************************************************************
-// Function : main             
-// Process  : Runs Poker                                                    
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//******************************************************************************   
-int _tmain(int argc, _TCHAR* argv[])
-{
-   Poker poker;
-   poker.runPoker();
-   
-	return 0;
-} // end _tmain
-
-//******************************************************************************
-// Function : constructor                                   
-// Process  : None                   
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//******************************************************************************                    
-Poker::Poker() 
-{
-
-} // end Poker::Poker
-
-//******************************************************************************
-// Function : destructor                                   
-// Process  : None           
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//******************************************************************************
-Poker::~Poker()
-{
-} // end Poker::~Poker
-
-//***************************************************************************
-// Function : outputCardNumbers                                   
-// Process  : Output the card number values of each hand (ie Ace = 14)
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-void Poker::outputCardNumbers() const
-{
-   cout << "---Card Number Values For Comparing Hands---" << endl;
-   cout << Card::TWO    << "  Two "    << endl;
-   cout << Card::THREE  << "  Three "  << endl;
-   cout << Card::FOUR   << "  Four "   << endl;
-   cout << Card::FIVE   << "  Five "   << endl;
-   cout << Card::SIX    << "  Six "    << endl;
-   cout << Card::SEVEN  << "  Seven "  << endl;
-   cout << Card::EIGHT  << "  Eight "  << endl;
-   cout << Card::NINE   << "  Nine "   << endl;
-   cout << Card::TEN    << " Ten "     << endl;
-   cout << Card::JACK   << " Jack "    << endl;
-   cout << Card::QUEEN  << " Queen "   << endl;
-   cout << Card::KING   << " King "    << endl;
-   cout << Card::ACE    << " Ace "     << endl << endl;
-}
-
-//***************************************************************************
-// Function : runPoker                                   
-// Process  : Run the poker program
-//             Generate the set of hands and output them
-//             Output the card number legend for ranking
-//             Create the poker ranker
-//             Rank the hands and output the results
-// Notes    : None
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added function
-//***************************************************************************
-void Poker::runPoker() const
-{
-   // Generate the set of hands and ouputs each hand
-   HandGenerator generator;
-   generator.generateHands();
-
-   // Output our legend for card numbers
-   this->outputCardNumbers();
-
-   // Obtain the hands for use
-   vector<Hand> hands;
-   generator.getHands(hands);
-
-   // Create our ranker and set its hands
-   HandRanker ranker(hands);
-
-   // Rank each hand
-   ranker.rankHands();
-
-   // Compare hands and output results
-   ranker.compareAllHands();
-   
-   // Don't let the game terminate by itself
-   char pauseBeforeTerminate = ' '; 
-   cin >> pauseBeforeTerminate;
-}
-      
\ No newline at end of file
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     Poker.cpp
+//
+// File Overview: Represents Poker that generates and ranks hands
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added class
+// 10.18.26       Donne Martin         Generate the state table
+// 10.18.26       Donne Martin         Generate the rank table
+// 10.18.26       Donne Martin         Generate the preflop matrix
+// 10.18.26       Donne Martin         Report through a text reporter
+// 10.18.26       Donne Martin         Rank hand files with -rank
+// 10.18.26       Donne Martin         Pack and rank binary hand files
+// 10.18.26       Donne Martin         Check the evaluator with -selftest
+//******************************************************************************
+
+#include "stdafx.h"
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Poker.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+//******************************************************************************
+// Function : toFileName
+// Process  : Copy each character of the argument to a narrow file name
+// Notes    : The hand files are named in ASCII, as MappedFile opens them
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+static string toFileName(const _TCHAR* argument)
+{
+   return string(argument, argument + _tcslen(argument));
+} // end toFileName
+
+//******************************************************************************
+// Function : main             
+// Process  : Runs Poker                                                    
+//             With -generate, writes the lookup tables instead
+//             With -rank, ranks the hand files that follow, or stdin
+//             With -pack, -rankpacked, -unpack, or -unpackresults, converts
+//             or ranks the binary hand files that follow
+//             With -selftest, checks the evaluator against the reference
+// Notes    : Throws an exception if a binary hand file command does not
+//             have its files
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+// 10.18.26       Donne Martin         Added -generate
+// 10.18.26       Donne Martin         Added -rank
+// 10.18.26       Donne Martin         Added the binary hand file commands
+// 10.18.26       Donne Martin         Added -selftest
+//******************************************************************************   
+int _tmain(int argc, _TCHAR* argv[])
+{
+   Poker poker;
+
+   if (argc > 1 && _tcscmp(argv[1], _T("-generate")) == 0)
+   {
+      poker.generateTables();
+   }
+   else if (argc > 1 && _tcscmp(argv[1], _T("-rank")) == 0)
+   {
+      poker.rankHandFiles(argc - 2, argv + 2);
+   }
+   else if (argc > 1 && _tcscmp(argv[1], _T("-pack")) == 0)
+   {
+      if (argc != 5)
+      {
+         throw exception("Invalid -pack arguments in _tmain");
+      }
+
+      poker.packHandFile(_ttoi(argv[2]), argv[3], argv[4]);
+   }
+   else if (argc > 1 && _tcscmp(argv[1], _T("-rankpacked")) == 0)
+   {
+      if (argc != 4)
+      {
+         throw exception("Invalid -rankpacked arguments in _tmain");
+      }
+
+      poker.rankPackedFile(argv[2], argv[3]);
+   }
+   else if (argc > 1 && _tcscmp(argv[1], _T("-unpack")) == 0)
+   {
+      if (argc != 3)
+      {
+         throw exception("Invalid -unpack arguments in _tmain");
+      }
+
+      poker.unpackHandFile(argv[2]);
+   }
+   else if (argc > 1 && _tcscmp(argv[1], _T("-unpackresults")) == 0)
+   {
+      if (argc != 3)
+      {
+         throw exception("Invalid -unpackresults arguments in _tmain");
+      }
+
+      poker.unpackResultFile(argv[2]);
+   }
+   else if (argc > 1 && _tcscmp(argv[1], _T("-selftest")) == 0)
+   {
+      poker.runSelfTest();
+   }
+   else
+   {
+      poker.runPoker();
+   }
+   
+	return 0;
+} // end _tmain
+
+//******************************************************************************
+// Function : constructor                                   
+// Process  : None                   
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//******************************************************************************                    
+Poker::Poker() 
+{
+
+} // end Poker::Poker
+
+//******************************************************************************
+// Function : destructor                                   
+// Process  : None           
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//******************************************************************************
+Poker::~Poker()
+{
+} // end Poker::~Poker
+
+//***************************************************************************
+// Function : generateTables                                   
+// Process  : Generate each lookup table file and report it
+//             Enumerate the preflop matrix with the generated state table
+//             Write the source files of the evaluator lookup tables
+// Notes    : Throws an exception if a file cannot be written
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Generate the rank table
+// 10.18.26       Donne Martin         Generate the preflop matrix
+// 10.18.26       Donne Martin         Generate the evaluator tables
+//***************************************************************************
+void Poker::generateTables() const
+{
+   StateTable stateTable;  // Speeds up enumerating the preflop matrix
+
+   StateTable::generate("StateTable.dat");
+   cout << "Generated StateTable.dat" << endl;
+
+   RankTable::generate("RankTable.dat");
+   cout << "Generated RankTable.dat" << endl;
+
+   stateTable.load("StateTable.dat");
+   PreflopMatrix::generate("PreflopMatrix.dat", &stateTable);
+   cout << "Generated PreflopMatrix.dat" << endl;
+
+   HandEvaluator::generate("HandEvaluatorTables.cpp", "HandEvaluator");
+   cout << "Generated HandEvaluatorTables.cpp" << endl;
+
+   ShortDeckEvaluator::generate("ShortDeckEvaluatorTables.cpp", 
+                                "ShortDeckEvaluator");
+   cout << "Generated ShortDeckEvaluatorTables.cpp" << endl;
+}
+
+//***************************************************************************
+// Function : outputCardNumbers                                   
+// Process  : Output the card number values of each hand (ie Ace = 14)
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+//***************************************************************************
+void Poker::outputCardNumbers() const
+{
+   cout << "---Card Number Values For Comparing Hands---" << endl;
+   cout << Card::TWO    << "  Two "    << endl;
+   cout << Card::THREE  << "  Three "  << endl;
+   cout << Card::FOUR   << "  Four "   << endl;
+   cout << Card::FIVE   << "  Five "   << endl;
+   cout << Card::SIX    << "  Six "    << endl;
+   cout << Card::SEVEN  << "  Seven "  << endl;
+   cout << Card::EIGHT  << "  Eight "  << endl;
+   cout << Card::NINE   << "  Nine "   << endl;
+   cout << Card::TEN    << " Ten "     << endl;
+   cout << Card::JACK   << " Jack "    << endl;
+   cout << Card::QUEEN  << " Queen "   << endl;
+   cout << Card::KING   << " King "    << endl;
+   cout << Card::ACE    << " Ace "     << endl << endl;
+}
+
+//***************************************************************************
+// Function : packHandFile
+// Process  : Write the hand file from the text file
+// Notes    : Throws an exception if numCards is not 5 or 7, or a file
+//             cannot be read or written
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+//***************************************************************************
+void Poker::packHandFile(
+   const int      numCards,
+   const _TCHAR*  textName,
+   const _TCHAR*  fileName) const
+{
+   HandFile::fromText(toFileName(textName).c_str(),
+                      toFileName(fileName).c_str(),
+                      numCards);
+}
+
+//***************************************************************************
+// Function : rankHandFiles
+// Process  : Rank the lines of stdin if there are no files
+//             Else rank the lines of each file in turn
+//             Write the results to stdout, one line per input line
+// Notes    : Throws an exception if a file cannot be opened or read
+//             The files are read in binary, a carriage return is a space
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+//***************************************************************************
+void Poker::rankHandFiles(
+   const int   numFiles,
+   _TCHAR*     fileNames[]) const
+{
+   BatchRanker ranker;  // Reused by every file
+
+   if (numFiles == 0)
+   {
+      ranker.rankStream(cin, cout);
+   }
+
+   for (int fileIndex = 0; fileIndex < numFiles; ++fileIndex)
+   {
+      ifstream file(fileNames[fileIndex], ios::in | ios::binary);
+
+      if (!file)
+      {
+         throw exception("Unable to open file in Poker::rankHandFiles");
+      }
+
+      ranker.rankStream(file, cout);
+   }
+}
+
+//***************************************************************************
+// Function : rankPackedFile
+// Process  : Rank the hand file into the result file
+// Notes    : Throws an exception if a file cannot be opened or created
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+//***************************************************************************
+void Poker::rankPackedFile(
+   const _TCHAR*  handName,
+   const _TCHAR*  resultName) const
+{
+   BatchRanker ranker;
+
+   ranker.rankFile(toFileName(handName).c_str(),
+                   toFileName(resultName).c_str());
+}
+
+//***************************************************************************
+// Function : runPoker                                   
+// Process  : Run the poker program
+//             Generate the set of hands and report them
+//             Output the card number legend for ranking
+//             Create the poker ranker
+//             Rank the hands and report the results
+// Notes    : The reporter is flushed before writing to cout directly and
+//             before pausing, so the output stays in order
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added function
+// 10.18.26       Donne Martin         Report through a text reporter
+//***************************************************************************
+void Poker::runPoker() const
+{
+   // Reports the hands and the results as text to cout
+   TextReporter reporter(cout);
+
+   // Generate the set of hands and reports each hand
+   HandGenerator generator;
+   generator.setReporter(&reporter);
+   generator.generateHands();
+   reporter.flush();
+
+   // Output our legend for card numbers
+   this->outputCardNumbers();
+
+   // Obtain the hands for use
+   vector<Hand> hands;
+   generator.getHands(hands);
+
+   // Create our ranker and set its hands
+   HandRanker ranker(hands);
+   ranker.setReporter(&reporter);
+
+   // Rank each hand
+   ranker.rankHands();
+
+   // Compare hands and report results
+   ranker.compareAllHands();
+   reporter.flush();
+   
+   // Don't let the game terminate by itself
+   char pauseBeforeTerminate = ' '; 
+   cin >> pauseBeforeTerminate;
+}
+
+//***************************************************************************
+// Function : runSelfTest
+// Process  : Check the evaluator lookup tables match the tables built
+//                from the hand values
+//             For each five card hand of the deck
+//                Rank it with rankHandReference and evaluate it
+//                Check the value is valid and of the reference type
+//                Count the hand under its type
+//                Keep the first hand of each value, else check the hand
+//                ties the kept hand
+//             Check every value has a hand and each type its hands
+//             For each value, check its hand beats the hand of the value
+//                below, by type, else by compareHandsOfSameType
+//             Report the hands and values checked
+// Notes    : Throws an exception naming the first check that fails
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Check the generated tables
+//***************************************************************************
+void Poker::runSelfTest() const
+{
+   // Five card hands of each type, by Hand::HandType
+   static const int TYPECOUNTS[Hand::STRAIGHTFLUSH + 1] =
+   {
+      0, 1302540, 1098240, 123552, 54912, 10200, 5108, 3744, 624, 40
+   };
+
+   const int      numCards = PackedCard::NUMRANKS * PackedCard::NUMSUITS;
+   HandEvaluator  evaluator;
+   HandRanker     ranker;
+   Hand           hand;
+   vector<Hand>   valueHands(HandEvaluator::MAXVALUE + 1);   // By value
+   vector<bool>   hasValue(HandEvaluator::MAXVALUE + 1, false);
+   int            typeCounts[Hand::STRAIGHTFLUSH + 1] = { 0 };
+   int            indexes[Hand::MAXCARDS];   // Card indexes
+   int            position  = 0;             // Card being moved
+   int            numHands  = 0;
+   int            numValues = 0;
+
+   if (!HandEvaluator::verifyTables() || !ShortDeckEvaluator::verifyTables())
+   {
+      throw exception("Lookup tables out of date in Poker::runSelfTest");
+   }
+
+   // Start at 0 1 2 3 4, then move the highest card that can move up and
+   // reset the cards after it
+   for (position = 0; position < Hand::MAXCARDS; ++position)
+   {
+      indexes[position] = position;
+   }
+
+   while (position >= 0)
+   {
+      int value = 0;
+
+      hand = Hand(PackedCard::fromIndex(indexes[0]).toCard(),
+                  PackedCard::fromIndex(indexes[1]).toCard(),
+                  PackedCard::fromIndex(indexes[2]).toCard(),
+                  PackedCard::fromIndex(indexes[3]).toCard(),
+                  PackedCard::fromIndex(indexes[4]).toCard());
+
+      ranker.rankHandReference(hand);
+      value = evaluator.evaluate(hand);
+
+      if (value < HandEvaluator::MINVALUE || 
+          value > HandEvaluator::MAXVALUE ||
+          evaluator.getHandType(value) != hand.getType())
+      {
+         throw exception("Hand value of the wrong type in Poker::runSelfTest");
+      }
+
+      ++typeCounts[hand.getType()];
+      ++numHands;
+
+      if (!hasValue[value])
+      {
+         valueHands[value] = hand;
+         hasValue[value]   = true;
+         ++numValues;
+      }
+      else if (ranker.compareHandsOfSameType(valueHands[value], hand) != 
+               HandRanker::TIE)
+      {
+         throw exception("Hand value of unequal hands in Poker::runSelfTest");
+      }
+
+      position = Hand::MAXCARDS - 1;
+
+      while (position >= 0 &&
+             indexes[position] == numCards - Hand::MAXCARDS + position)
+      {
+         --position;
+      }
+
+      if (position >= 0)
+      {
+         ++indexes[position];
+
+         for (int next = position + 1; next < Hand::MAXCARDS; ++next)
+         {
+            indexes[next] = indexes[next - 1] + 1;
+         }
+      }
+   }
+
+   if (numValues != HandEvaluator::MAXVALUE)
+   {
+      throw exception("Hand value without a hand in Poker::runSelfTest");
+   }
+
+   for (int type = Hand::HIGHCARD; type <= Hand::STRAIGHTFLUSH; ++type)
+   {
+      if (typeCounts[type] != TYPECOUNTS[type])
+      {
+         throw exception("Hands of the wrong type in Poker::runSelfTest");
+      }
+   }
+
+   for (int value = HandEvaluator::MINVALUE + 1; 
+        value <= HandEvaluator::MAXVALUE; 
+        ++value)
+   {
+      const Hand& lower  = valueHands[value - 1];
+      const Hand& higher = valueHands[value];
+
+      if (higher.getType() < lower.getType() ||
+          (higher.getType() == lower.getType() &&
+           ranker.compareHandsOfSameType(higher, lower) != 
+              HandRanker::FIRSTWINNER))
+      {
+         throw exception("Hand values out of order in Poker::runSelfTest");
+      }
+   }
+
+   cout << "Checked " << numHands << " hands and " << numValues 
+        << " hand values" << endl;
+}
+
+//***************************************************************************
+// Function : unpackHandFile
+// Process  : Open the hand file and write its hands to stdout as text
+// Notes    : Throws an exception if the file cannot be opened
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+//***************************************************************************
+void Poker::unpackHandFile(const _TCHAR* fileName) const
+{
+   HandFile hands;
+
+   hands.open(toFileName(fileName).c_str());
+   hands.toText(cout);
+   cout.flush();
+}
+
+//***************************************************************************
+// Function : unpackResultFile
+// Process  : Open the result file and write its results to stdout as text
+// Notes    : Throws an exception if the file cannot be opened
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 10.18.26       Donne Martin         Added function
+//***************************************************************************
+void Poker::unpackResultFile(const _TCHAR* fileName) const
+{
+   ResultFile results;
+
+   results.open(toFileName(fileName).c_str());
+   results.toText(cout);
+   cout.flush();
+}
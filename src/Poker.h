@@ -1,70 +1,162 @@
-//******************************************************************************
-//
-// File Name:     Poker.h
-//
-// File Overview: Represents Poker that generates and ranks hands
-//
-//******************************************************************************
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added class
-//******************************************************************************
-
-#ifndef Poker_h
-#define Poker_h
-
-#include "HandGenerator.h"
-#include "HandRanker.h"
-
-//******************************************************************************
-//
-// Class:    Poker
-//
-// Revision History:
-//
-// Date           Author               Description 
-// 6.12.11        Donne Martin         Added class
-//
-// Notes    : None
-//
-//******************************************************************************
-class Poker
-{
-public:
-
-   //***************************************************************************
-   // Function    : constructor                                   
-   // Description : Initializes data members to invalid values              
-   // Constraints : None
-   //***************************************************************************
-   Poker();
-
-   //***************************************************************************
-   // Function    : destructor                                   
-   // Description : Performs cleanup tasks              
-   // Constraints : None
-   //***************************************************************************
-   virtual ~Poker();   
-
-   //***************************************************************************
-   // Function    : runPoker                                   
-   // Description : Executes the poker program            
-   // Constraints : None
-   //***************************************************************************
-   void runPoker() const;
-   
-private:   
-   //***************************************************************************
-   // Function    : outputCardNumbers                                   
-   // Description : Called by runPoker.  Internal use only.            
-   // Constraints : None
-   //***************************************************************************
-   void outputCardNumbers() const;
-
-   // No data members
-
-}; // end class Poker
-   
+//******************************************************************************
+//
+// File Name:     Poker.h
+//
+// File Overview: Represents Poker that generates and ranks hands
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added class
+// 10.18.26       Donne Martin         Generate the state table
+// 10.18.26       Donne Martin         Generate the rank table
+// 10.18.26       Donne Martin         Generate the preflop matrix
+// 10.18.26       Donne Martin         Report through a text reporter
+// 10.18.26       Donne Martin         Rank hand files with -rank
+// 10.18.26       Donne Martin         Pack and rank binary hand files
+// 10.18.26       Donne Martin         Check the evaluator with -selftest
+//******************************************************************************
+
+#ifndef Poker_h
+#define Poker_h
+
+#include "BatchRanker.h"
+#include "HandGenerator.h"
+#include "HandRanker.h"
+#include "PreflopMatrix.h"
+#include "RankTable.h"
+#include "ResultReporter.h"
+#include "StateTable.h"
+
+//******************************************************************************
+//
+// Class:    Poker
+//
+// Revision History:
+//
+// Date           Author               Description 
+// 6.12.11        Donne Martin         Added class
+// 10.18.26       Donne Martin         Generate the state table
+// 10.18.26       Donne Martin         Generate the rank table
+// 10.18.26       Donne Martin         Generate the preflop matrix
+// 10.18.26       Donne Martin         Report through a text reporter
+// 10.18.26       Donne Martin         Rank hand files with -rank
+// 10.18.26       Donne Martin         Pack and rank binary hand files
+// 10.18.26       Donne Martin         Check the evaluator with -selftest
+//
+// Notes    : Run with -generate to write the lookup tables loaded by the
+//             evaluators instead of ranking the sample hands
+//             Run with -rank and hand files, or none for stdin, to write
+//             the rank of each line to stdout instead
+//             Run with -pack 5|7 text hands to write a binary hand file,
+//             -rankpacked hands results to rank it into a binary result
+//             file, and -unpack hands or -unpackresults results to write
+//             either back to stdout as text
+//             Run with -selftest to check the HandEvaluator against the
+//             reference ranking of every five card hand
+//
+//******************************************************************************
+class Poker
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor                                   
+   // Description : Initializes data members to invalid values              
+   // Constraints : None
+   //***************************************************************************
+   Poker();
+
+   //***************************************************************************
+   // Function    : destructor                                   
+   // Description : Performs cleanup tasks              
+   // Constraints : None
+   //***************************************************************************
+   virtual ~Poker();   
+
+   //***************************************************************************
+   // Function    : generateTables                                   
+   // Description : Writes the lookup table files and the source files of
+   //                the evaluator lookup tables to the working directory
+   // Constraints : Throws an exception if a file cannot be written
+   //***************************************************************************
+   void generateTables() const;
+
+   //***************************************************************************
+   // Function    : packHandFile
+   // Description : Writes the hand file of numCards cards per hand from the
+   //                lines of the text file
+   // Constraints : Throws an exception if numCards is not 5 or 7, or a file
+   //                cannot be read or written
+   //***************************************************************************
+   void packHandFile(
+      const int      numCards,
+      const _TCHAR*  textName,
+      const _TCHAR*  fileName) const;
+
+   //***************************************************************************
+   // Function    : rankHandFiles
+   // Description : Ranks each line of each file, or of stdin if there are
+   //                none, and writes the results to stdout in order
+   // Constraints : Throws an exception if a file cannot be opened or read,
+   //                or a line is too long
+   //***************************************************************************
+   void rankHandFiles(
+      const int   numFiles,
+      _TCHAR*     fileNames[]) const;
+
+   //***************************************************************************
+   // Function    : rankPackedFile
+   // Description : Ranks each hand of the hand file into the result file
+   // Constraints : Throws an exception if a file cannot be opened or created
+   //***************************************************************************
+   void rankPackedFile(
+      const _TCHAR*  handName,
+      const _TCHAR*  resultName) const;
+
+   //***************************************************************************
+   // Function    : runPoker                                   
+   // Description : Executes the poker program            
+   // Constraints : None
+   //***************************************************************************
+   void runPoker() const;
+
+   //***************************************************************************
+   // Function    : runSelfTest
+   // Description : Checks the HandEvaluator value of every five card hand
+   //                against rankHandReference, the hands of each type, and
+   //                the order of the hand values, and that the evaluator
+   //                lookup tables are up to date, and reports the result
+   // Constraints : Throws an exception if a check fails
+   //***************************************************************************
+   void runSelfTest() const;
+
+   //***************************************************************************
+   // Function    : unpackHandFile
+   // Description : Writes each hand of the hand file to stdout as text
+   // Constraints : Throws an exception if the file cannot be opened
+   //***************************************************************************
+   void unpackHandFile(const _TCHAR* fileName) const;
+
+   //***************************************************************************
+   // Function    : unpackResultFile
+   // Description : Writes each result of the result file to stdout as text
+   // Constraints : Throws an exception if the file cannot be opened
+   //***************************************************************************
+   void unpackResultFile(const _TCHAR* fileName) const;
+   
+private:   
+   //***************************************************************************
+   // Function    : outputCardNumbers                                   
+   // Description : Called by runPoker.  Internal use only.            
+   // Constraints : None
+   //***************************************************************************
+   void outputCardNumbers() const;
+
+   // No data members
+
+}; // end class Poker
+   
 #endif // Poker_h
\ No newline at end of file
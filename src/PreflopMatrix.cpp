@@ -0,0 +1,343 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     PreflopMatrix.cpp
+//
+// File Overview: Represents a precomputed table of the exact preflop equity
+//                of every heads-up matchup, mapped read-only from a file
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Share a thread pool over the matchups
+//******************************************************************************
+
+#include "stdafx.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "EquityCalculator.h"
+#include "HandRange.h"
+#include "PreflopMatrix.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// Cards in each group of the starting hand and the matchup indexers
+static const int HANDGROUPS[]    = { 2 };
+static const int MATCHUPGROUPS[] = { 2, 2 };
+
+// Suffixes of the partial file of an interrupted generate, and of the
+// temporary file each save writes before replacing it
+static const string PARTIALSUFFIX   = ".partial";
+static const string TEMPORARYSUFFIX = ".tmp";
+
+//******************************************************************************
+// Function : constructor
+// Process  : Build the starting hand and matchup indexers
+// Notes    : Need to load a matrix before looking up equities
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+PreflopMatrix::PreflopMatrix()
+   : handIndexer(HANDGROUPS, 1),
+     matchupIndexer(MATCHUPGROUPS, 2),
+     handEquities(NULL),
+     matchupCounts(NULL)
+{
+} // end PreflopMatrix::PreflopMatrix
+
+//******************************************************************************
+// Function : destructor
+// Process  : None, the mapped file unmaps the matrix
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+PreflopMatrix::~PreflopMatrix()
+{
+} // end PreflopMatrix::~PreflopMatrix
+
+//******************************************************************************
+// Function : generate
+// Process  : Read the counts of the partial file, else of its temporary
+//                file, if either holds counts of this layout
+//             Find the first pair of hole cards of each matchup
+//             Start a thread pool of numThreads for every matchup
+//             For each matchup not yet counted
+//                Enumerate every board of its hole cards
+//                Store the first player's wins and ties, and the second
+//                   player's wins and the ties at the reversed matchup
+//                Save the partial file every CHECKPOINTMATCHUPS matchups
+//             Average the equity of each pair of hole cards sharing no card
+//                into the equity of their starting hands
+//             Write the header, the starting hand equities, and the counts,
+//                and remove the partial file
+// Notes    : Throw an exception if a file cannot be written
+//             A save interrupted before replacing the partial file leaves
+//             the temporary file whole, so it is read if the partial file
+//             is missing
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Share a thread pool over the matchups
+//******************************************************************************
+void PreflopMatrix::generate(
+   const char*       fileName,
+   const StateTable* stateTable,
+   const int         numThreads)
+{
+   const int            header[HEADERSIZE] =
+                           { MAGIC, VERSION, NUMHANDS, NUMMATCHUPS };
+   const string         partialName = string(fileName) + PARTIALSUFFIX;
+   const string         savedNames[] =
+                           { partialName, partialName + TEMPORARYSUFFIX };
+   PreflopMatrix        matrix;           // Indexers, no matrix loaded
+   ThreadPool           pool(numThreads); // Shared by every matchup
+   EquityCalculator     calculator;
+   vector<unsigned int> counts(2 * NUMMATCHUPS,
+                               static_cast<unsigned int>(UNCOUNTED));
+   vector<int>          firstCombos(NUMMATCHUPS, -1);   // Hole cards of
+   vector<int>          secondCombos(NUMMATCHUPS, -1);  // each matchup
+   vector<double>       equitySums(NUMHANDS * NUMHANDS, 0.0);
+   vector<int>          numPairs(NUMHANDS * NUMHANDS, 0);
+   vector<float>        handEquities(NUMHANDS * NUMHANDS, 0.0f);
+   int                  numUnsaved = 0;   // Matchups counted since a save
+   ofstream             file;
+
+   for (int saved = 0; saved < 2; ++saved)
+   {
+      ifstream savedFile(savedNames[saved].c_str(), ios::in | ios::binary);
+      int      savedHeader[HEADERSIZE] = {};
+
+      savedFile.read(reinterpret_cast<char*>(savedHeader),
+                     sizeof(savedHeader));
+      savedFile.read(reinterpret_cast<char*>(&counts[0]),
+                     static_cast<streamsize>(counts.size() *
+                                             sizeof(unsigned int)));
+
+      if (savedFile && equal(header, header + HEADERSIZE, savedHeader))
+      {
+         break;
+      }
+
+      counts.assign(counts.size(), static_cast<unsigned int>(UNCOUNTED));
+   }
+
+   for (int firstCombo = 0; firstCombo < HandRange::NUMCOMBOS; ++firstCombo)
+   {
+      for (int secondCombo = 0;
+           secondCombo < HandRange::NUMCOMBOS;
+           ++secondCombo)
+      {
+         PackedCard           firstCards[2];
+         PackedCard           secondCards[2];
+         unsigned long long   matchup;
+
+         if (HandRange::getComboMask(firstCombo).intersects(
+                HandRange::getComboMask(secondCombo)))
+         {
+            continue;
+         }
+
+         HandRange::getComboCards(firstCombo, firstCards);
+         HandRange::getComboCards(secondCombo, secondCards);
+         matchup = matrix.getMatchupIndex(firstCards, secondCards);
+
+         if (firstCombos[matchup] < 0)
+         {
+            firstCombos[matchup]  = firstCombo;
+            secondCombos[matchup] = secondCombo;
+         }
+      }
+   }
+
+   calculator.setStateTable(stateTable);
+   calculator.setThreadPool(&pool);
+
+   for (int matchup = 0; matchup < NUMMATCHUPS; ++matchup)
+   {
+      PackedCard           firstCards[2];
+      PackedCard           secondCards[2];
+      unsigned long long   reversed;
+
+      if (counts[2 * matchup] != static_cast<unsigned int>(UNCOUNTED))
+      {
+         continue;
+      }
+
+      HandRange::getComboCards(firstCombos[matchup], firstCards);
+      HandRange::getComboCards(secondCombos[matchup], secondCards);
+
+      calculator.clear();
+      calculator.addPlayer(firstCards);
+      calculator.addPlayer(secondCards);
+      calculator.calculateExhaustive();
+
+      reversed = matrix.getMatchupIndex(secondCards, firstCards);
+
+      counts[2 * matchup]      = static_cast<unsigned int>(
+         calculator.getShowdownCount(HandRanker::FIRSTWINNER));
+      counts[2 * matchup + 1]  = static_cast<unsigned int>(
+         calculator.getShowdownCount(HandRanker::TIE));
+      counts[2 * reversed]     = static_cast<unsigned int>(
+         calculator.getShowdownCount(HandRanker::SECONDWINNER));
+      counts[2 * reversed + 1] = counts[2 * matchup + 1];
+
+      if (++numUnsaved == CHECKPOINTMATCHUPS)
+      {
+         PreflopMatrix::saveCounts(partialName.c_str(), &counts[0]);
+         numUnsaved = 0;
+      }
+   }
+
+   for (int firstCombo = 0; firstCombo < HandRange::NUMCOMBOS; ++firstCombo)
+   {
+      for (int secondCombo = 0;
+           secondCombo < HandRange::NUMCOMBOS;
+           ++secondCombo)
+      {
+         PackedCard           firstCards[2];
+         PackedCard           secondCards[2];
+         unsigned long long   matchup;
+         int                  pair;
+
+         if (HandRange::getComboMask(firstCombo).intersects(
+                HandRange::getComboMask(secondCombo)))
+         {
+            continue;
+         }
+
+         HandRange::getComboCards(firstCombo, firstCards);
+         HandRange::getComboCards(secondCombo, secondCards);
+         matchup = matrix.getMatchupIndex(firstCards, secondCards);
+         pair    = matrix.getHandIndex(firstCards) * NUMHANDS +
+                   matrix.getHandIndex(secondCards);
+
+         equitySums[pair] += (counts[2 * matchup] +
+                              counts[2 * matchup + 1] / 2.0) / NUMBOARDS;
+         numPairs[pair]++;
+      }
+   }
+
+   for (int pair = 0; pair < NUMHANDS * NUMHANDS; ++pair)
+   {
+      handEquities[pair] =
+         static_cast<float>(equitySums[pair] / numPairs[pair]);
+   }
+
+   file.open(fileName, ios::out | ios::binary | ios::trunc);
+   file.write(reinterpret_cast<const char*>(header), sizeof(header));
+   file.write(reinterpret_cast<const char*>(&handEquities[0]),
+              static_cast<streamsize>(handEquities.size() * sizeof(float)));
+   file.write(reinterpret_cast<const char*>(&counts[0]),
+              static_cast<streamsize>(counts.size() *
+                                      sizeof(unsigned int)));
+   file.close();
+
+   if (!file)
+   {
+      throw exception("Unable to write file in PreflopMatrix::generate");
+   }
+
+   remove(savedNames[0].c_str());
+   remove(savedNames[1].c_str());
+} // end PreflopMatrix::generate
+
+//******************************************************************************
+// Function : load
+// Process  : Map the file
+//             Check its size and header match this layout
+//             Point the equities and counts into the mapping
+// Notes    : Throw an exception if the file cannot be mapped or does not
+//             hold a matrix of this layout
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void PreflopMatrix::load(const char* fileName)
+{
+   const int* header = NULL;  // Header of the mapped file
+
+   this->handEquities  = NULL;
+   this->matchupCounts = NULL;
+
+   this->mappedFile.open(fileName);
+
+   header = static_cast<const int*>(this->mappedFile.getData());
+
+   if (this->mappedFile.getSize() != FILESIZE ||
+       header[0] != MAGIC ||
+       header[1] != VERSION ||
+       header[2] != NUMHANDS ||
+       header[3] != NUMMATCHUPS)
+   {
+      this->mappedFile.close();
+      throw exception("Unexpected matrix layout in PreflopMatrix::load");
+   }
+
+   this->handEquities  = reinterpret_cast<const float*>(header + HEADERSIZE);
+   this->matchupCounts = reinterpret_cast<const unsigned int*>(
+      this->handEquities + NUMHANDS * NUMHANDS);
+} // end PreflopMatrix::load
+
+//******************************************************************************
+// Function : saveCounts
+// Process  : Write the header and the counts to the temporary file
+//             Replace the file with the temporary file
+// Notes    : Throw an exception if the temporary file cannot be written or
+//             renamed
+//             The file is removed first, as renaming over a file fails on
+//             Windows
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void PreflopMatrix::saveCounts(
+   const char*          fileName,
+   const unsigned int   counts[])
+{
+   const int      header[HEADERSIZE] =
+                     { MAGIC, VERSION, NUMHANDS, NUMMATCHUPS };
+   const string   temporaryName = string(fileName) + TEMPORARYSUFFIX;
+   ofstream       file;
+
+   file.open(temporaryName.c_str(), ios::out | ios::binary | ios::trunc);
+   file.write(reinterpret_cast<const char*>(header), sizeof(header));
+   file.write(reinterpret_cast<const char*>(counts),
+              static_cast<streamsize>(2 * NUMMATCHUPS *
+                                      sizeof(unsigned int)));
+   file.close();
+
+   if (!file)
+   {
+      throw exception("Unable to write file in PreflopMatrix::saveCounts");
+   }
+
+   remove(fileName);
+
+   if (rename(temporaryName.c_str(), fileName) != 0)
+   {
+      throw exception("Unable to rename file in PreflopMatrix::saveCounts");
+   }
+} // end PreflopMatrix::saveCounts
@@ -0,0 +1,272 @@
+//******************************************************************************
+//
+// File Name:     PreflopMatrix.h
+//
+// File Overview: Represents a precomputed table of the exact preflop equity
+//                of every heads-up matchup, mapped read-only from a file
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef PreflopMatrix_h
+#define PreflopMatrix_h
+
+#include "HandIndexer.h"
+#include "MappedFile.h"
+#include "PackedCard.h"
+#include "StateTable.h"
+
+//******************************************************************************
+//
+// Class:    PreflopMatrix
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : A matchup is the hole cards of two players, up to a
+//             permutation of the suits, indexed by a HandIndexer of two
+//             groups of two cards: 93769 matchups, out of the 1326 x 1325
+//             ordered pairs of hole cards.  Each holds the boards the first
+//             player wins and ties of the NUMBOARDS boards, counted exactly
+//             by EquityCalculator::calculateExhaustive.  A starting hand is
+//             one of the 169 indexes of a HandIndexer of two cards, and
+//             each pair of starting hands holds the equity of the first
+//             averaged over their pairs of hole cards sharing no card.
+//             Both lookups are an index and a load.
+//             generate computes one of the two orders of each matchup and
+//             counts the other from it.  It saves the counts to a partial
+//             file every CHECKPOINTMATCHUPS matchups and resumes from it if
+//             interrupted.
+//             The file holds a header of native 32 bit integers, the float
+//             equities of the starting hands, then the 32 bit wins and ties
+//             of each matchup.
+//
+//******************************************************************************
+class PreflopMatrix
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, no matrix is loaded
+   // Constraints : Need to load a matrix before looking up equities
+   //***************************************************************************
+   PreflopMatrix();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks, unmaps the matrix
+   // Constraints : None
+   //***************************************************************************
+   virtual ~PreflopMatrix();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : generate
+   // Description : Enumerates every board of every matchup over numThreads
+   //                threads, or one per core if 0, and writes the matrix to
+   //                the file, resuming the partial file of an interrupted
+   //                run
+   // Constraints : Throws an exception if a file cannot be written
+   //                The state table, if not NULL, must be loaded
+   //***************************************************************************
+   static void generate(
+      const char*       fileName,
+      const StateTable* stateTable = NULL,
+      const int         numThreads = 0);
+
+   //***************************************************************************
+   // Function    : getEquity
+   // Description : Returns the exact equity of the first hole cards against
+   //                the second, from 0 to 1, a tie winning half
+   // Constraints : The matrix must be loaded, each must hold two cards, the
+   //                four cards must be valid and unique
+   //***************************************************************************
+   inline double getEquity(
+      const PackedCard  firstCards[],
+      const PackedCard  secondCards[]) const;
+
+   //***************************************************************************
+   // Function    : getHandEquity
+   // Description : Returns the equity of the first starting hand against
+   //                the second, averaged over their hole cards
+   // Constraints : The matrix must be loaded, the hands must be 0 to
+   //                NUMHANDS - 1, as returned by getHandIndex
+   //***************************************************************************
+   inline double getHandEquity(
+      const int firstHand,
+      const int secondHand) const;
+
+   //***************************************************************************
+   // Function    : getHandIndex
+   // Description : Returns the starting hand of the hole cards, from 0 to
+   //                NUMHANDS - 1, the same for every suit permutation
+   // Constraints : holeCards must hold two valid, different cards
+   //***************************************************************************
+   inline int getHandIndex(const PackedCard holeCards[]) const;
+
+   //***************************************************************************
+   // Function    : isLoaded
+   // Description : Returns whether a matrix is loaded
+   // Constraints : None
+   //***************************************************************************
+   inline bool isLoaded() const;
+
+   //***************************************************************************
+   // Function    : load
+   // Description : Maps the matrix written by generate
+   // Constraints : Throws an exception if the file cannot be mapped or does
+   //                not hold a matrix of this layout
+   //***************************************************************************
+   void load(const char* fileName);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the layout of the matrix file
+   enum PreflopMatrixLayout
+   {
+      MAGIC                = 0x50524546,  // "PREF"
+      VERSION              = 1,
+      NUMHANDS             = 169,
+      NUMMATCHUPS          = 93769,
+      NUMBOARDS            = 1712304,     // C(48, 5)
+      HEADERSIZE           = 4,           // Magic, version, hands, matchups
+      FILESIZE             = HEADERSIZE * 4 + NUMHANDS * NUMHANDS * 4 +
+                             NUMMATCHUPS * 2 * 4,
+      CHECKPOINTMATCHUPS   = 256,         // Matchups between saves
+      UNCOUNTED            = -1           // Wins of a matchup not yet counted
+   };
+
+private:
+
+   //***************************************************************************
+   // Function    : getMatchupIndex
+   // Description : Returns the matchup of the two players' hole cards
+   // Constraints : Private, each must hold two cards, the four cards must be
+   //                valid and unique
+   //***************************************************************************
+   inline unsigned long long getMatchupIndex(
+      const PackedCard  firstCards[],
+      const PackedCard  secondCards[]) const;
+
+   //***************************************************************************
+   // Function    : saveCounts
+   // Description : Writes the header and the counts of every matchup to the
+   //                file, through a temporary file replacing it once written
+   // Constraints : Private, throws an exception if the file cannot be
+   //                written
+   //***************************************************************************
+   static void saveCounts(
+      const char*          fileName,
+      const unsigned int   counts[]);
+
+   HandIndexer          handIndexer;      // Starting hand of two cards
+   HandIndexer          matchupIndexer;   // Matchup of two and two cards
+   MappedFile           mappedFile;       // Mapping of the matrix file
+   const float*         handEquities;     // Equity of each pair of starting
+                                          // hands, NULL if not loaded
+   const unsigned int*  matchupCounts;    // Wins then ties of each matchup
+
+}; // end class PreflopMatrix
+
+//******************************************************************************
+// Function : getEquity
+// Process  : Look up the matchup's wins and ties, a tie counting half
+// Notes    : The matrix must be loaded
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline double PreflopMatrix::getEquity(
+   const PackedCard  firstCards[],
+   const PackedCard  secondCards[]) const
+{
+   const unsigned int* counts = this->matchupCounts +
+      2 * this->getMatchupIndex(firstCards, secondCards);
+
+   return (counts[0] + counts[1] / 2.0) / NUMBOARDS;
+} // end PreflopMatrix::getEquity
+
+//******************************************************************************
+// Function : getHandEquity
+// Process  : Look up the equity of the pair of starting hands
+// Notes    : The matrix must be loaded
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline double PreflopMatrix::getHandEquity(
+   const int firstHand,
+   const int secondHand) const
+{
+   return this->handEquities[firstHand * NUMHANDS + secondHand];
+} // end PreflopMatrix::getHandEquity
+
+//******************************************************************************
+// Function : getHandIndex
+// Process  : Index the hole cards with the starting hand indexer
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int PreflopMatrix::getHandIndex(const PackedCard holeCards[]) const
+{
+   return static_cast<int>(this->handIndexer.getIndex(holeCards));
+} // end PreflopMatrix::getHandIndex
+
+//******************************************************************************
+// Function : getMatchupIndex
+// Process  : Index the first then the second hole cards with the matchup
+//             indexer
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long PreflopMatrix::getMatchupIndex(
+   const PackedCard  firstCards[],
+   const PackedCard  secondCards[]) const
+{
+   const PackedCard cards[4] =
+   {
+      firstCards[0], firstCards[1], secondCards[0], secondCards[1]
+   };
+
+   return this->matchupIndexer.getIndex(cards);
+} // end PreflopMatrix::getMatchupIndex
+
+//******************************************************************************
+// Function : isLoaded
+// Process  : Return whether the equities point at a mapped matrix
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline bool PreflopMatrix::isLoaded() const
+{
+   return this->handEquities != NULL;
+} // end PreflopMatrix::isLoaded
+
+#endif // PreflopMatrix_h
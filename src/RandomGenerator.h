@@ -0,0 +1,231 @@
+//******************************************************************************
+//
+// File Name:     RandomGenerator.h
+//
+// File Overview: Represents a fast pseudorandom number generator with
+//                independent streams for each thread
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef RandomGenerator_h
+#define RandomGenerator_h
+
+//******************************************************************************
+//
+// Class:    RandomGenerator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : xoshiro256** by Blackman and Vigna, 256 bits of state seeded
+//             from one 64 bit seed by SplitMix64
+//             jump advances the state by 2^128 numbers, so a generator
+//             copied and jumped once per thread gives each thread its own
+//             stream that never overlaps the others
+//             Not thread-safe, give each thread its own generator
+//
+//******************************************************************************
+class RandomGenerator
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Seeds the generator, the same seed gives the same numbers
+   // Constraints : None
+   //***************************************************************************
+   inline explicit RandomGenerator(const unsigned long long seed);
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : jump
+   // Description : Advances the generator by 2^128 numbers
+   // Constraints : None
+   //***************************************************************************
+   inline void jump();
+
+   //***************************************************************************
+   // Function    : next
+   // Description : Returns the next 64 random bits
+   // Constraints : None
+   //***************************************************************************
+   inline unsigned long long next();
+
+   //***************************************************************************
+   // Function    : nextBelow
+   // Description : Returns a uniform random number from 0 to bound - 1
+   // Constraints : bound must be positive
+   //***************************************************************************
+   inline unsigned int nextBelow(const unsigned int bound);
+
+private:
+
+   //***************************************************************************
+   // Function    : rotateLeft
+   // Description : Rotates the bits of the value left by count
+   // Constraints : Private, count must be 1 to 63
+   //***************************************************************************
+   static inline unsigned long long rotateLeft(
+      const unsigned long long   value,
+      const int                  count);
+
+   unsigned long long state[4];  // Never all zero
+
+}; // end class RandomGenerator
+
+//******************************************************************************
+// Function : constructor
+// Process  : Fill the state with four outputs of SplitMix64 from the seed
+// Notes    : SplitMix64 never outputs four zeros in a row
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline RandomGenerator::RandomGenerator(const unsigned long long seed)
+{
+   unsigned long long value = seed;
+
+   for (int word = 0; word < 4; ++word)
+   {
+      unsigned long long mixed = (value += 0x9E3779B97F4A7C15ULL);
+
+      mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+
+      this->state[word] = mixed ^ (mixed >> 31);
+   }
+} // end RandomGenerator::RandomGenerator
+
+//******************************************************************************
+// Function : jump
+// Process  : For each bit of the jump polynomial, xor the state into the
+//             jumped state if the bit is set, then step the generator
+// Notes    : Equivalent to 2^128 calls to next
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void RandomGenerator::jump()
+{
+   static const unsigned long long JUMP[] =
+   {
+      0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+      0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+   };
+
+   unsigned long long jumped[4] = { 0, 0, 0, 0 };
+
+   for (int word = 0; word < 4; ++word)
+   {
+      for (int bit = 0; bit < 64; ++bit)
+      {
+         if (JUMP[word] & (1ULL << bit))
+         {
+            jumped[0] ^= this->state[0];
+            jumped[1] ^= this->state[1];
+            jumped[2] ^= this->state[2];
+            jumped[3] ^= this->state[3];
+         }
+
+         this->next();
+      }
+   }
+
+   for (int word = 0; word < 4; ++word)
+   {
+      this->state[word] = jumped[word];
+   }
+} // end RandomGenerator::jump
+
+//******************************************************************************
+// Function : next
+// Process  : Scramble the second word for the output, then advance the
+//             state with shifts, xors, and a rotation
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long RandomGenerator::next()
+{
+   unsigned long long result =
+      RandomGenerator::rotateLeft(this->state[1] * 5, 7) * 9;
+   unsigned long long shifted = this->state[1] << 17;
+
+   this->state[2] ^= this->state[0];
+   this->state[3] ^= this->state[1];
+   this->state[1] ^= this->state[2];
+   this->state[0] ^= this->state[3];
+   this->state[2] ^= shifted;
+   this->state[3]  = RandomGenerator::rotateLeft(this->state[3], 45);
+
+   return result;
+} // end RandomGenerator::next
+
+//******************************************************************************
+// Function : nextBelow
+// Process  : Multiply 32 random bits by the bound, the high half is the
+//             number
+//             Reject the rare low halves below 2^32 mod bound, so every
+//             number is equally likely (Lemire)
+// Notes    : Divides only when a low half falls below the bound
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned int RandomGenerator::nextBelow(const unsigned int bound)
+{
+   unsigned long long product =
+      (this->next() >> 32) * static_cast<unsigned long long>(bound);
+   unsigned int       low     = static_cast<unsigned int>(product);
+
+   if (low < bound)
+   {
+      unsigned int threshold = (0u - bound) % bound;
+
+      while (low < threshold)
+      {
+         product = (this->next() >> 32) *
+                   static_cast<unsigned long long>(bound);
+         low     = static_cast<unsigned int>(product);
+      }
+   }
+
+   return static_cast<unsigned int>(product >> 32);
+} // end RandomGenerator::nextBelow
+
+//******************************************************************************
+// Function : rotateLeft
+// Process  : Shift left by count, or in the bits shifted out
+// Notes    : Compiles to one rotate instruction
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline unsigned long long RandomGenerator::rotateLeft(
+   const unsigned long long   value,
+   const int                  count)
+{
+   return (value << count) | (value >> (64 - count));
+} // end RandomGenerator::rotateLeft
+
+#endif // RandomGenerator_h
@@ -0,0 +1,741 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     RangeEquityCalculator.cpp
+//
+// File Overview: Represents a Range Equity Calculator to find the share of
+//                the pot each of two weighted hold'em ranges wins
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Run on a work-stealing thread pool
+//******************************************************************************
+
+#include "stdafx.h"
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include "RangeEquityCalculator.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : Find the cards and set of each combo
+//             Fill the binomials with Pascal's triangle
+// Notes    : Need to set the ranges before calculating
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         No thread pool by default
+//******************************************************************************
+RangeEquityCalculator::RangeEquityCalculator()
+   : numBoardCards(0),
+     stateTable(NULL),
+     threadPool(NULL)
+{
+   for (int combo = 0; combo < NUMCOMBOS; ++combo)
+   {
+      HandRange::getComboCards(combo, this->comboCards[combo]);
+      this->comboMasks[combo] = HandRange::getComboMask(combo);
+   }
+
+   for (int n = 0; n <= NUMCARDS; ++n)
+   {
+      this->binomials[n][0] = 1;
+
+      for (int k = 1; k <= NUMBOARDCARDS; ++k)
+      {
+         this->binomials[n][k] = n == 0 ? 0 :
+            this->binomials[n - 1][k - 1] + this->binomials[n - 1][k];
+      }
+   }
+} // end RangeEquityCalculator::RangeEquityCalculator
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+RangeEquityCalculator::~RangeEquityCalculator()
+{
+} // end RangeEquityCalculator::~RangeEquityCalculator
+
+//******************************************************************************
+// Function : addDeadCard
+// Process  : Mark the card as held, so it is never dealt or held by a combo
+// Notes    : Throw an exception if the card is invalid or already held
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RangeEquityCalculator::addDeadCard(const PackedCard card)
+{
+   this->addUsedCard(card);
+} // end RangeEquityCalculator::addDeadCard
+
+//******************************************************************************
+// Function : addUsedCard
+// Process  : Add the card to the used cards
+// Notes    : Throw an exception if the card is invalid or already used
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RangeEquityCalculator::addUsedCard(const PackedCard card)
+{
+   if (!card.isValid())
+   {
+      throw exception("Invalid card in RangeEquityCalculator");
+   }
+
+   if (this->usedCards.contains(card))
+   {
+      throw exception("Duplicate card in RangeEquityCalculator");
+   }
+
+   this->usedCards.add(card);
+} // end RangeEquityCalculator::addUsedCard
+
+//******************************************************************************
+// Function : calculateExhaustive
+// Process  : Check the threads and find the live combos
+//             Count the boards and the chunks of BOARDSPERCHUNK boards
+//             Use the thread pool if one is set, else start one of
+//                numThreads, at most one per chunk
+//             Run the chunks on the pool, each worker counting into its own
+//                results
+//             Merge the workers' results for each range
+// Notes    : Throw an exception if a range has no combo left or numThreads
+//             is negative
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Run the chunks on a thread pool
+//******************************************************************************
+void RangeEquityCalculator::calculateExhaustive(const int numThreads)
+{
+   PackedCard           deck[NUMCARDS];
+   int                  deckSize    = this->getDeck(deck);
+   unsigned long long   numBoards   =
+      this->binomials[deckSize][NUMBOARDCARDS - this->numBoardCards];
+   int                  numChunks   = static_cast<int>(
+      (numBoards + BOARDSPERCHUNK - 1) / BOARDSPERCHUNK);
+   vector<Result>       workerResults;    // NUMRANGES results per worker
+   int                  threadCount = numThreads;
+
+   if (numThreads < 0)
+   {
+      throw exception(
+         "Invalid threads in RangeEquityCalculator::calculateExhaustive");
+   }
+
+   this->findLiveCombos();
+
+   if (threadCount == 0)
+   {
+      threadCount = ThreadPool::getNumCores();
+   }
+
+   threadCount = threadCount < numChunks ? threadCount : numChunks;
+
+   ThreadPool  callPool(this->threadPool != NULL ? 1 : threadCount);
+   ThreadPool& pool = this->threadPool != NULL ? *this->threadPool :
+                                                 callPool;
+
+   workerResults.resize(pool.getNumThreads() * NUMRANGES);
+
+   pool.run(numChunks,
+            1,
+            bind(&RangeEquityCalculator::runChunks,
+                 this,
+                 placeholders::_1,
+                 placeholders::_2,
+                 placeholders::_3,
+                 &workerResults[0]));
+
+   for (int range = 0; range < NUMRANGES; ++range)
+   {
+      this->results[range] = Result();
+
+      for (int worker = 0; worker < pool.getNumThreads(); ++worker)
+      {
+         this->results[range].merge(
+            workerResults[worker * NUMRANGES + range]);
+      }
+   }
+} // end RangeEquityCalculator::calculateExhaustive
+
+//******************************************************************************
+// Function : calculateMonteCarlo
+// Process  : Check the threads and find the live combos
+//             Split the boards into chunks of BOARDSPERCHUNK
+//             Jump the seeded generator once per chunk and keep a copy for
+//                each chunk
+//             Use the thread pool if one is set, else start one of
+//                numThreads, at most one per chunk
+//             Run the chunks on the pool, each worker counting into its own
+//                results
+//             Merge the workers' results for each range
+// Notes    : Throw an exception if a range has no combo left, numThreads
+//             is negative, or there are too many chunks
+//             Each chunk has its own stream, so the boards dealt do not
+//             depend on the number of threads
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Run chunks of boards on a thread pool
+//******************************************************************************
+void RangeEquityCalculator::calculateMonteCarlo(
+   const unsigned long long   numBoards,
+   const int                  numThreads,
+   const unsigned long long   seed)
+{
+   RandomGenerator            random(seed);
+   unsigned long long         numChunks   =
+      (numBoards + BOARDSPERCHUNK - 1) / BOARDSPERCHUNK;
+   vector<RandomGenerator>    generators;       // Stream of each chunk
+   vector<Result>             workerResults;    // NUMRANGES results per
+                                                // worker
+   int                        threadCount = numThreads;
+
+   if (numThreads < 0)
+   {
+      throw exception(
+         "Invalid threads in RangeEquityCalculator::calculateMonteCarlo");
+   }
+
+   if (numChunks > static_cast<unsigned long long>(INT_MAX))
+   {
+      throw exception(
+         "Too many boards in RangeEquityCalculator::calculateMonteCarlo");
+   }
+
+   this->findLiveCombos();
+
+   generators.reserve(static_cast<size_t>(numChunks));
+
+   for (unsigned long long chunk = 0; chunk < numChunks; ++chunk)
+   {
+      random.jump();
+      generators.push_back(random);
+   }
+
+   if (threadCount == 0)
+   {
+      threadCount = ThreadPool::getNumCores();
+   }
+
+   if (static_cast<unsigned long long>(threadCount) > numChunks)
+   {
+      threadCount = numChunks > 0 ? static_cast<int>(numChunks) : 1;
+   }
+
+   ThreadPool  callPool(this->threadPool != NULL ? 1 : threadCount);
+   ThreadPool& pool = this->threadPool != NULL ? *this->threadPool :
+                                                 callPool;
+
+   workerResults.resize(pool.getNumThreads() * NUMRANGES);
+
+   pool.run(static_cast<int>(numChunks),
+            1,
+            bind(&RangeEquityCalculator::runTrials,
+                 this,
+                 placeholders::_1,
+                 placeholders::_2,
+                 placeholders::_3,
+                 numBoards,
+                 generators.data(),
+                 &workerResults[0]));
+
+   for (int range = 0; range < NUMRANGES; ++range)
+   {
+      this->results[range] = Result();
+
+      for (int worker = 0; worker < pool.getNumThreads(); ++worker)
+      {
+         this->results[range].merge(
+            workerResults[worker * NUMRANGES + range]);
+      }
+   }
+} // end RangeEquityCalculator::calculateMonteCarlo
+
+//******************************************************************************
+// Function : clear
+// Process  : Empty the ranges and remove the board, dead cards, and results
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RangeEquityCalculator::clear()
+{
+   for (int range = 0; range < NUMRANGES; ++range)
+   {
+      this->ranges[range].clear();
+      this->results[range] = Result();
+   }
+
+   this->numBoardCards = 0;
+   this->usedCards     = CardSet();
+   this->liveCombos.clear();
+} // end RangeEquityCalculator::clear
+
+//******************************************************************************
+// Function : countBoard
+// Process  : Evaluate each live combo that shares no card with the board,
+//                keyed by value then combo, and sum the weight of the
+//                second range in total and for each card
+//             Sort the keys and sweep each group of equal values
+//                Sum the weight of the second range in the group
+//                For each combo of the first range, find the weight of the
+//                   second range it beats, ties, and can meet, each total
+//                   less the weight holding either of its cards, and add
+//                   the wins, ties, and losses times its weight
+//                Move the group's weight below the next group
+// Notes    : A combo holding both cards of a combo is the combo itself, so
+//             adding its weight back once corrects removing it twice
+//             Only the tie and the compatible weight can hold the combo
+//             itself, the weight below never has its value
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RangeEquityCalculator::countBoard(
+   const PackedCard  dealt[],
+   Result            results[]) const
+{
+   const vector<double>&      firstWeights  = this->ranges[0].getWeights();
+   const vector<double>&      secondWeights = this->ranges[1].getWeights();
+   HandEvaluator::Accumulator boardHand;          // Board cards
+   StateTable::State          boardState;         // Board cards
+   StateTable::State          highState;          // Board and a high card
+   CardSet                    boardMask;          // Board cards
+   unsigned int               keys[NUMCOMBOS];    // Value, then combo
+   int                        numKeys        = 0;
+   int                        highCard       = -1;
+   double                     totalWeight    = 0.0;
+   double                     belowWeight    = 0.0;
+   double                     cardTotal[NUMCARDS] = {};
+   double                     cardBelow[NUMCARDS] = {};
+   double                     cardGroup[NUMCARDS] = {};
+
+   for (int card = 0; card < NUMBOARDCARDS; ++card)
+   {
+      boardMask.add(dealt[card]);
+
+      if (this->stateTable != NULL)
+      {
+         this->stateTable->addCard(boardState, dealt[card]);
+      }
+      else
+      {
+         boardHand.add(dealt[card]);
+      }
+   }
+
+   for (size_t live = 0; live < this->liveCombos.size(); ++live)
+   {
+      int               combo = this->liveCombos[live];
+      const PackedCard* cards = this->comboCards[combo];
+      int               value = 0;
+
+      if (this->comboMasks[combo].intersects(boardMask))
+      {
+         continue;
+      }
+
+      if (this->stateTable != NULL)
+      {
+         if (cards[0].getIndex() != highCard)
+         {
+            highCard  = cards[0].getIndex();
+            highState = boardState;
+            this->stateTable->addCard(highState, cards[0]);
+         }
+
+         value = this->stateTable->evaluate(highState, cards[1]);
+      }
+      else
+      {
+         HandEvaluator::Accumulator hand = boardHand;
+
+         hand.add(cards[0]);
+         hand.add(cards[1]);
+         value = this->evaluator.evaluate(hand);
+      }
+
+      keys[numKeys++] = (static_cast<unsigned int>(value) << COMBOBITS) |
+                        combo;
+      totalWeight += secondWeights[combo];
+      cardTotal[cards[0].getIndex()] += secondWeights[combo];
+      cardTotal[cards[1].getIndex()] += secondWeights[combo];
+   }
+
+   sort(keys, keys + numKeys);
+
+   for (int groupStart = 0, groupEnd = 0;
+        groupStart < numKeys;
+        groupStart = groupEnd)
+   {
+      unsigned int value       = keys[groupStart] >> COMBOBITS;
+      double       groupWeight = 0.0;
+
+      while (groupEnd < numKeys && (keys[groupEnd] >> COMBOBITS) == value)
+      {
+         int combo = keys[groupEnd] & ((1 << COMBOBITS) - 1);
+
+         groupWeight += secondWeights[combo];
+         cardGroup[this->comboCards[combo][0].getIndex()] +=
+            secondWeights[combo];
+         cardGroup[this->comboCards[combo][1].getIndex()] +=
+            secondWeights[combo];
+         groupEnd++;
+      }
+
+      for (int key = groupStart; key < groupEnd; ++key)
+      {
+         int    combo  = keys[key] & ((1 << COMBOBITS) - 1);
+         int    high   = this->comboCards[combo][0].getIndex();
+         int    low    = this->comboCards[combo][1].getIndex();
+         double weight = firstWeights[combo];
+         double wins;
+         double ties;
+         double losses;
+
+         if (weight <= 0.0)
+         {
+            continue;
+         }
+
+         wins   = belowWeight - cardBelow[high] - cardBelow[low];
+         ties   = groupWeight - cardGroup[high] - cardGroup[low] +
+                  secondWeights[combo];
+         losses = totalWeight - cardTotal[high] - cardTotal[low] +
+                  secondWeights[combo] - wins - ties;
+
+         results[0].addShowdowns(weight * wins,
+                                 weight * ties,
+                                 weight * losses);
+         results[1].addShowdowns(weight * losses,
+                                 weight * ties,
+                                 weight * wins);
+      }
+
+      for (int key = groupStart; key < groupEnd; ++key)
+      {
+         int combo = keys[key] & ((1 << COMBOBITS) - 1);
+         int high  = this->comboCards[combo][0].getIndex();
+         int low   = this->comboCards[combo][1].getIndex();
+
+         belowWeight     += secondWeights[combo];
+         cardBelow[high] += secondWeights[combo];
+         cardBelow[low]  += secondWeights[combo];
+         cardGroup[high]  = 0.0;
+         cardGroup[low]   = 0.0;
+      }
+   }
+} // end RangeEquityCalculator::countBoard
+
+//******************************************************************************
+// Function : findLiveCombos
+// Process  : Keep each combo with a weight in either range that shares no
+//             card with the board or dead cards, in combo order
+// Notes    : Throw an exception if a range has no combo kept
+//             Combo order groups the combos by high card, so a StateTable
+//             steps once per high card
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RangeEquityCalculator::findLiveCombos()
+{
+   int numLive[NUMRANGES] = {};   // Combos kept of each range
+
+   this->liveCombos.clear();
+
+   for (int combo = 0; combo < NUMCOMBOS; ++combo)
+   {
+      bool live = false;
+
+      if (this->comboMasks[combo].intersects(this->usedCards))
+      {
+         continue;
+      }
+
+      for (int range = 0; range < NUMRANGES; ++range)
+      {
+         if (this->ranges[range].getWeight(combo) > 0.0)
+         {
+            numLive[range]++;
+            live = true;
+         }
+      }
+
+      if (live)
+      {
+         this->liveCombos.push_back(combo);
+      }
+   }
+
+   if (numLive[0] == 0 || numLive[1] == 0)
+   {
+      throw exception("Empty range in RangeEquityCalculator");
+   }
+} // end RangeEquityCalculator::findLiveCombos
+
+//******************************************************************************
+// Function : getDeck
+// Process  : Add each card not used to the deck, in index order
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int RangeEquityCalculator::getDeck(PackedCard deck[]) const
+{
+   int deckSize = 0;
+
+   for (int cardIndex = 0; cardIndex < NUMCARDS; ++cardIndex)
+   {
+      PackedCard card = PackedCard::fromIndex(cardIndex);
+
+      if (!this->usedCards.contains(card))
+      {
+         deck[deckSize++] = card;
+      }
+   }
+
+   return deckSize;
+} // end RangeEquityCalculator::getDeck
+
+//******************************************************************************
+// Function : runChunks
+// Process  : Collect the cards left to deal and copy the known board
+//             For each chunk
+//                For each board of the chunk, unrank its colex index into
+//                   the cards dealt, highest first, and count the board
+//             Add the counts to the worker's results
+// Notes    : Unranks each board, which costs little beside evaluating
+//             every combo
+//             Counts into local results, as runTrials does
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Run the chunks the thread pool takes
+//******************************************************************************
+void RangeEquityCalculator::runChunks(
+   const int   firstChunk,
+   const int   lastChunk,
+   const int   worker,
+   Result      workerResults[]) const
+{
+   PackedCard           deck[NUMCARDS];          // Cards left to deal
+   int                  deckSize = this->getDeck(deck);
+   int                  numDealt = NUMBOARDCARDS - this->numBoardCards;
+   unsigned long long   numBoards = this->binomials[deckSize][numDealt];
+   PackedCard           dealt[NUMBOARDCARDS];    // Full board
+   Result               counts[NUMRANGES];       // Local results
+
+   for (int card = 0; card < this->numBoardCards; ++card)
+   {
+      dealt[card] = this->board[card];
+   }
+
+   for (int chunk = firstChunk; chunk < lastChunk; ++chunk)
+   {
+      unsigned long long first =
+         static_cast<unsigned long long>(chunk) * BOARDSPERCHUNK;
+      unsigned long long last  = min(first + BOARDSPERCHUNK, numBoards);
+
+      for (unsigned long long boardIndex = first;
+           boardIndex < last;
+           ++boardIndex)
+      {
+         unsigned long long remaining = boardIndex;
+         int                cardIndex = deckSize;
+
+         for (int left = numDealt; left > 0; --left)
+         {
+            do
+            {
+               cardIndex--;
+            } while (this->binomials[cardIndex][left] > remaining);
+
+            remaining -= this->binomials[cardIndex][left];
+            dealt[NUMBOARDCARDS - left] = deck[cardIndex];
+         }
+
+         this->countBoard(dealt, counts);
+      }
+   }
+
+   for (int range = 0; range < NUMRANGES; ++range)
+   {
+      workerResults[worker * NUMRANGES + range].merge(counts[range]);
+   }
+} // end RangeEquityCalculator::runChunks
+
+//******************************************************************************
+// Function : runTrials
+// Process  : Copy the known board
+//             For each chunk
+//                Collect the cards left to deal and copy the chunk's
+//                   generator
+//                For each board of the chunk, deal the missing cards with
+//                   a partial Fisher-Yates shuffle and count the board
+//             Add the counts to the worker's results
+// Notes    : Counts into local results, so workers writing their results
+//             side by side never share a cache line while running
+//             The deck is collected again for each chunk, so a chunk deals
+//             the same boards whichever worker runs it
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Run the chunks the thread pool takes
+//******************************************************************************
+void RangeEquityCalculator::runTrials(
+   const int                  firstChunk,
+   const int                  lastChunk,
+   const int                  worker,
+   const unsigned long long   numBoards,
+   const RandomGenerator      generators[],
+   Result                     workerResults[]) const
+{
+   PackedCard  deck[NUMCARDS];          // Cards left to deal
+   PackedCard  dealt[NUMBOARDCARDS];    // Full board
+   Result      counts[NUMRANGES];       // Local results
+
+   for (int card = 0; card < this->numBoardCards; ++card)
+   {
+      dealt[card] = this->board[card];
+   }
+
+   for (int chunk = firstChunk; chunk < lastChunk; ++chunk)
+   {
+      int                  deckSize    = this->getDeck(deck);
+      RandomGenerator      random      = generators[chunk];
+      unsigned long long   first       =
+         static_cast<unsigned long long>(chunk) * BOARDSPERCHUNK;
+      unsigned long long   chunkBoards = min(numBoards - first,
+         static_cast<unsigned long long>(BOARDSPERCHUNK));
+
+      for (unsigned long long trial = 0; trial < chunkBoards; ++trial)
+      {
+         for (int card = this->numBoardCards; card < NUMBOARDCARDS; ++card)
+         {
+            int        position = card - this->numBoardCards;
+            int        pick     = position +
+                                  random.nextBelow(deckSize - position);
+            PackedCard held     = deck[position];
+
+            deck[position] = deck[pick];
+            deck[pick]     = held;
+            dealt[card]    = deck[position];
+         }
+
+         this->countBoard(dealt, counts);
+      }
+   }
+
+   for (int range = 0; range < NUMRANGES; ++range)
+   {
+      workerResults[worker * NUMRANGES + range].merge(counts[range]);
+   }
+} // end RangeEquityCalculator::runTrials
+
+//******************************************************************************
+// Function : setBoard
+// Process  : Release the cards of the old board
+//             Mark each new board card as held and keep it
+// Notes    : Throw an exception if there are too many cards or a card is
+//             invalid or already held
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RangeEquityCalculator::setBoard(
+   const PackedCard  board[],
+   const int         numCards)
+{
+   if (numCards < 0 || numCards > NUMBOARDCARDS)
+   {
+      throw exception(
+         "Invalid board size in RangeEquityCalculator::setBoard");
+   }
+
+   for (int card = 0; card < this->numBoardCards; ++card)
+   {
+      this->usedCards.remove(this->board[card]);
+   }
+
+   this->numBoardCards = 0;
+
+   for (int card = 0; card < numCards; ++card)
+   {
+      this->addUsedCard(board[card]);
+      this->board[card] = board[card];
+      this->numBoardCards++;
+   }
+} // end RangeEquityCalculator::setBoard
+
+//******************************************************************************
+// Function : setRange
+// Process  : Copy the range of the player
+// Notes    : Throw an exception if the player is invalid
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RangeEquityCalculator::setRange(
+   const int         range,
+   const HandRange&  hands)
+{
+   if (range < 0 || range >= NUMRANGES)
+   {
+      throw exception("Invalid range in RangeEquityCalculator::setRange");
+   }
+
+   this->ranges[range] = hands;
+} // end RangeEquityCalculator::setRange
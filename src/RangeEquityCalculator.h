@@ -0,0 +1,512 @@
+//******************************************************************************
+//
+// File Name:     RangeEquityCalculator.h
+//
+// File Overview: Represents a Range Equity Calculator to find the share of
+//                the pot each of two weighted hold'em ranges wins
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Run on a work-stealing thread pool
+//******************************************************************************
+
+#ifndef RangeEquityCalculator_h
+#define RangeEquityCalculator_h
+
+#include <vector>
+#include "CardSet.h"
+#include "HandEvaluator.h"
+#include "HandRange.h"
+#include "PackedCard.h"
+#include "RandomGenerator.h"
+#include "StateTable.h"
+#include "ThreadPool.h"
+
+//******************************************************************************
+//
+// Class:    RangeEquityCalculator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Run on a work-stealing thread pool
+//
+// Notes    : Holds two ranges, a board of zero to five cards, and dead
+//             cards.  Each pair of combos, one from each range, that share
+//             no card plays each board that shares no card with either, and
+//             counts the product of their weights.
+//             Each board evaluates every combo left in either range once and
+//             sorts the combos by value.  A sweep from the lowest value
+//             keeps the weight of the second range below the current value,
+//             in total and for each card, so the weight a combo of the first
+//             range beats is the total below less the weight below holding
+//             either of its cards.  Ties and the compatible weight are found
+//             the same way, so pairs of combos sharing a card are removed
+//             without ever being enumerated.
+//             calculateExhaustive deals every board, split into chunks of
+//             BOARDSPERCHUNK consecutive colex indexes.  calculateMonteCarlo
+//             deals random boards in chunks of BOARDSPERCHUNK, each with its
+//             own RandomGenerator stream as in EquityCalculator.  Both run
+//             their chunks on a ThreadPool as EquityCalculator does.  With a
+//             StateTable set, each board steps once per high card and looks
+//             up each combo.
+//
+//******************************************************************************
+class RangeEquityCalculator
+{
+public:
+
+   class Result;
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, empty ranges, no board or dead cards
+   // Constraints : Need to set the ranges before calculating
+   //***************************************************************************
+   RangeEquityCalculator();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~RangeEquityCalculator();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : addDeadCard
+   // Description : Removes the card from the cards dealt and the combos
+   // Constraints : Throws an exception if the card is invalid or already
+   //                on the board or dead
+   //***************************************************************************
+   void addDeadCard(const PackedCard card);
+
+   //***************************************************************************
+   // Function    : calculateExhaustive
+   // Description : Deals every board from the cards left over numThreads
+   //                threads, or one per core if numThreads is 0, and sets
+   //                each range's result
+   //                Runs on the thread pool instead if one is set
+   // Constraints : Throws an exception if a range has no combo left or
+   //                numThreads is negative
+   //***************************************************************************
+   void calculateExhaustive(const int numThreads = 0);
+
+   //***************************************************************************
+   // Function    : calculateMonteCarlo
+   // Description : Deals numBoards random boards over numThreads threads,
+   //                or one per core if numThreads is 0, and sets each
+   //                range's result
+   //                Runs on the thread pool instead if one is set
+   // Constraints : Throws an exception if a range has no combo left,
+   //                numThreads is negative, or the boards need more chunks
+   //                than an int holds
+   //***************************************************************************
+   void calculateMonteCarlo(
+      const unsigned long long   numBoards,
+      const int                  numThreads = 0,
+      const unsigned long long   seed       = DEFAULTSEED);
+
+   //***************************************************************************
+   // Function    : clear
+   // Description : Empties the ranges and removes the board, dead cards, and
+   //                results
+   // Constraints : None
+   //***************************************************************************
+   void clear();
+
+   //***************************************************************************
+   // Function    : getResult
+   // Description : Returns the result of the range, 0 or 1, of the last
+   //                calculation
+   // Constraints : range must be 0 to NUMRANGES - 1
+   //***************************************************************************
+   inline const Result& getResult(const int range) const;
+
+   //***************************************************************************
+   // Function    : setBoard
+   // Description : Sets the known board cards, replacing any board
+   // Constraints : Throws an exception if there are more than NUMBOARDCARDS
+   //                cards or a card is invalid or already held
+   //***************************************************************************
+   void setBoard(
+      const PackedCard  board[],
+      const int         numCards);
+
+   //***************************************************************************
+   // Function    : setRange
+   // Description : Sets the range of the first or second player, 0 or 1
+   // Constraints : Throws an exception if range is not 0 to NUMRANGES - 1
+   //***************************************************************************
+   void setRange(
+      const int         range,
+      const HandRange&  hands);
+
+   //***************************************************************************
+   // Function    : setStateTable
+   // Description : Mutator for stateTable, the table each board steps
+   //                through, NULL to count each combo instead
+   // Constraints : The table must be loaded and outlive its use
+   //***************************************************************************
+   inline void setStateTable(const StateTable* stateTable);
+
+   //***************************************************************************
+   // Function    : setThreadPool
+   // Description : Mutator for threadPool, the pool the calculations run on,
+   //                NULL to start a pool of numThreads for each calculation
+   // Constraints : The pool must outlive its use
+   //***************************************************************************
+   inline void setThreadPool(ThreadPool* threadPool);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the limits of the calculator
+   enum RangeEquityCalculatorSize
+   {
+      NUMRANGES      = 2,
+      NUMBOARDCARDS  = HandEvaluator::NUMBOARDCARDS,
+      NUMCARDS       = PackedCard::NUMCARDS,
+      NUMCOMBOS      = HandRange::NUMCOMBOS,
+      COMBOBITS      = 11,    // Bits of a combo index in a sort key
+      BOARDSPERCHUNK = 64,    // Boards of each chunk of a calculation
+      DEFAULTSEED    = 1
+   };
+
+   //***************************************************************************
+   //
+   // Class:    Result
+   //
+   // Notes    : The weight of the showdowns a range won, tied, and lost,
+   //             each showdown weighted by the product of the weights of
+   //             its two combos
+   //
+   //***************************************************************************
+   class Result
+   {
+   public:
+
+      //************************************************************************
+      // Function    : constructor
+      // Description : Default constructor, no showdowns
+      // Constraints : None
+      //************************************************************************
+      inline Result();
+
+      // Member functions in alphabetical order
+
+      //************************************************************************
+      // Function    : addShowdowns
+      // Description : Adds the weight of showdowns won, tied, and lost
+      // Constraints : None
+      //************************************************************************
+      inline void addShowdowns(
+         const double   wins,
+         const double   ties,
+         const double   losses);
+
+      //************************************************************************
+      // Function    : getEquity
+      // Description : Returns the share of the pot won on average, from 0 to
+      //                1, a tie winning half
+      // Constraints : Returns 0 if there were no showdowns
+      //************************************************************************
+      inline double getEquity() const;
+
+      //************************************************************************
+      // Function    : getLosses
+      // Description : Accessor for losses
+      // Constraints : None
+      //************************************************************************
+      inline double getLosses() const;
+
+      //************************************************************************
+      // Function    : getTies
+      // Description : Accessor for ties
+      // Constraints : None
+      //************************************************************************
+      inline double getTies() const;
+
+      //************************************************************************
+      // Function    : getWins
+      // Description : Accessor for wins
+      // Constraints : None
+      //************************************************************************
+      inline double getWins() const;
+
+      //************************************************************************
+      // Function    : merge
+      // Description : Adds the weights of the input result
+      // Constraints : None
+      //************************************************************************
+      inline void merge(const Result& result);
+
+   private:
+
+      double wins;      // Weight of showdowns won
+      double ties;      // Weight of showdowns tied
+      double losses;    // Weight of showdowns lost
+
+   }; // end class Result
+
+private:
+
+   //***************************************************************************
+   // Function    : addUsedCard
+   // Description : Marks the card as held
+   // Constraints : Private, throws an exception if the card is invalid or
+   //                already held
+   //***************************************************************************
+   void addUsedCard(const PackedCard card);
+
+   //***************************************************************************
+   // Function    : countBoard
+   // Description : Evaluates every live combo with the full board and adds
+   //                the weight each range wins, ties, and loses to results
+   // Constraints : Private, dealt holds the NUMBOARDCARDS board cards,
+   //                results one per range
+   //***************************************************************************
+   void countBoard(
+      const PackedCard  dealt[],
+      Result            results[]) const;
+
+   //***************************************************************************
+   // Function    : findLiveCombos
+   // Description : Collects the combos in either range that share no card
+   //                with the board or dead cards
+   // Constraints : Private, throws an exception if a range has none
+   //***************************************************************************
+   void findLiveCombos();
+
+   //***************************************************************************
+   // Function    : getDeck
+   // Description : Writes the cards not on the board or dead and returns how
+   //                many
+   // Constraints : Private, deck must hold NUMCARDS cards
+   //***************************************************************************
+   int getDeck(PackedCard deck[]) const;
+
+   //***************************************************************************
+   // Function    : runChunks
+   // Description : Deals each board of the chunks firstChunk to
+   //                lastChunk - 1 and adds it to the worker's results,
+   //                NUMRANGES per worker
+   // Constraints : Private, the task calculateExhaustive runs on the pool
+   //***************************************************************************
+   void runChunks(
+      const int   firstChunk,
+      const int   lastChunk,
+      const int   worker,
+      Result      workerResults[]) const;
+
+   //***************************************************************************
+   // Function    : runTrials
+   // Description : Deals the random boards of the chunks firstChunk to
+   //                lastChunk - 1 of numBoards boards, each from its own
+   //                generator, and adds each to the worker's results,
+   //                NUMRANGES per worker
+   // Constraints : Private, the task calculateMonteCarlo runs on the pool
+   //***************************************************************************
+   void runTrials(
+      const int                  firstChunk,
+      const int                  lastChunk,
+      const int                  worker,
+      const unsigned long long   numBoards,
+      const RandomGenerator      generators[],
+      Result                     workerResults[]) const;
+
+   HandEvaluator        evaluator;              // Evaluates showdowns
+   HandRange            ranges[NUMRANGES];      // Range of each player
+   PackedCard           board[NUMBOARDCARDS];   // Known board cards
+   int                  numBoardCards;
+   CardSet              usedCards;              // Board and dead cards
+   vector<int>          liveCombos;             // Combos of either range
+   Result               results[NUMRANGES];     // Result of each range
+   const StateTable*    stateTable;             // NULL if none
+   ThreadPool*          threadPool;             // NULL if none
+
+   // Cards of each combo, highest index first, and the set of both
+   PackedCard           comboCards[NUMCOMBOS][2];
+   CardSet              comboMasks[NUMCOMBOS];
+
+   // Ways to choose k of n cards, for unranking boards
+   unsigned long long   binomials[NUMCARDS + 1][NUMBOARDCARDS + 1];
+
+}; // end class RangeEquityCalculator
+
+//******************************************************************************
+// Function : getResult
+// Process  : Accessor for the result of the range
+// Notes    : range must be 0 to NUMRANGES - 1
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline const RangeEquityCalculator::Result& RangeEquityCalculator::getResult(
+   const int range) const
+{
+   return this->results[range];
+} // end RangeEquityCalculator::getResult
+
+//******************************************************************************
+// Function : setStateTable
+// Process  : Mutator for stateTable
+// Notes    : NULL counts each combo in an Accumulator
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void RangeEquityCalculator::setStateTable(
+   const StateTable* stateTable)
+{
+   this->stateTable = stateTable;
+} // end RangeEquityCalculator::setStateTable
+
+//******************************************************************************
+// Function : setThreadPool
+// Process  : Mutator for threadPool
+// Notes    : NULL starts a pool for each calculation
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void RangeEquityCalculator::setThreadPool(ThreadPool* threadPool)
+{
+   this->threadPool = threadPool;
+} // end RangeEquityCalculator::setThreadPool
+
+//******************************************************************************
+// Function : constructor
+// Process  : Start every weight at zero
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline RangeEquityCalculator::Result::Result()
+   : wins(0.0),
+     ties(0.0),
+     losses(0.0)
+{
+} // end RangeEquityCalculator::Result::Result
+
+//******************************************************************************
+// Function : addShowdowns
+// Process  : Add each weight
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void RangeEquityCalculator::Result::addShowdowns(
+   const double   wins,
+   const double   ties,
+   const double   losses)
+{
+   this->wins   += wins;
+   this->ties   += ties;
+   this->losses += losses;
+} // end RangeEquityCalculator::Result::addShowdowns
+
+//******************************************************************************
+// Function : getEquity
+// Process  : Divide the wins and half the ties by all showdowns
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline double RangeEquityCalculator::Result::getEquity() const
+{
+   double total = this->wins + this->ties + this->losses;
+
+   if (total <= 0.0)
+   {
+      return 0.0;
+   }
+
+   return (this->wins + this->ties / 2.0) / total;
+} // end RangeEquityCalculator::Result::getEquity
+
+//******************************************************************************
+// Function : getLosses
+// Process  : Accessor for losses
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline double RangeEquityCalculator::Result::getLosses() const
+{
+   return this->losses;
+} // end RangeEquityCalculator::Result::getLosses
+
+//******************************************************************************
+// Function : getTies
+// Process  : Accessor for ties
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline double RangeEquityCalculator::Result::getTies() const
+{
+   return this->ties;
+} // end RangeEquityCalculator::Result::getTies
+
+//******************************************************************************
+// Function : getWins
+// Process  : Accessor for wins
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline double RangeEquityCalculator::Result::getWins() const
+{
+   return this->wins;
+} // end RangeEquityCalculator::Result::getWins
+
+//******************************************************************************
+// Function : merge
+// Process  : Add each weight of the input result
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void RangeEquityCalculator::Result::merge(const Result& result)
+{
+   this->wins   += result.wins;
+   this->ties   += result.ties;
+   this->losses += result.losses;
+} // end RangeEquityCalculator::Result::merge
+
+#endif // RangeEquityCalculator_h
@@ -0,0 +1,183 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     RankTable.cpp
+//
+// File Overview: Represents a precomputed table of the hand value of every
+//                five card hand, mapped read-only from a file
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#include "stdafx.h"
+#include <fstream>
+#include <vector>
+#include "HandRanker.h"
+#include "RankTable.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// Evaluated by the compiler into read-only data
+constexpr RankTable::Binomials RankTable::binomials = RankTable::Binomials();
+
+//******************************************************************************
+// Function : constructor
+// Process  : None, check the colex indexes are dense
+// Notes    : Need to load a table before evaluating
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+RankTable::RankTable()
+   : values(NULL)
+{
+   // The highest hand, the five highest cards, has the highest index
+   static_assert(RankTable::binomials.values[NUMCARDS - 1][5] +
+                 RankTable::binomials.values[NUMCARDS - 2][4] +
+                 RankTable::binomials.values[NUMCARDS - 3][3] +
+                 RankTable::binomials.values[NUMCARDS - 4][2] +
+                 RankTable::binomials.values[NUMCARDS - 5][1] ==
+                 NUMHANDS - 1,
+                 "The colex indexes must run from 0 to NUMHANDS - 1");
+} // end RankTable::RankTable
+
+//******************************************************************************
+// Function : destructor
+// Process  : None, the mapped file unmaps the table
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+RankTable::~RankTable()
+{
+} // end RankTable::~RankTable
+
+//******************************************************************************
+// Function : generate
+// Process  : For each five card hand, lowest card first
+//                Build the hand and rank it with HandRanker::rankHand
+//                Store its value at the colex index of its cards
+//             Write the header then the values
+// Notes    : Throw an exception if the file cannot be written
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RankTable::generate(const char* fileName)
+{
+   const int               header[HEADERSIZE] = { MAGIC, VERSION, NUMHANDS };
+   HandRanker              ranker;
+   Hand                    hand;
+   vector<unsigned short>  table(NUMHANDS, 0);
+   PackedCard              cards[Hand::MAXCARDS];
+   int                     indexes[Hand::MAXCARDS];   // Card indexes
+   int                     position = 0;              // Card being moved
+   ofstream                file;
+
+   // Start at 0 1 2 3 4, then move the highest card that can move up and
+   // reset the cards after it
+   for (position = 0; position < Hand::MAXCARDS; ++position)
+   {
+      indexes[position] = position;
+   }
+
+   while (position >= 0)
+   {
+      for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+      {
+         cards[cardIndex] = PackedCard::fromIndex(indexes[cardIndex]);
+      }
+
+      hand = Hand(cards[0].toCard(),
+                  cards[1].toCard(),
+                  cards[2].toCard(),
+                  cards[3].toCard(),
+                  cards[4].toCard());
+
+      ranker.rankHand(hand);
+
+      table[RankTable::getHandIndex(cards)] =
+         static_cast<unsigned short>(hand.getValue());
+
+      position = Hand::MAXCARDS - 1;
+
+      while (position >= 0 &&
+             indexes[position] == NUMCARDS - Hand::MAXCARDS + position)
+      {
+         --position;
+      }
+
+      if (position >= 0)
+      {
+         ++indexes[position];
+
+         for (int next = position + 1; next < Hand::MAXCARDS; ++next)
+         {
+            indexes[next] = indexes[next - 1] + 1;
+         }
+      }
+   }
+
+   file.open(fileName, ios::out | ios::binary | ios::trunc);
+   file.write(reinterpret_cast<const char*>(header), sizeof(header));
+   file.write(reinterpret_cast<const char*>(&table[0]),
+              static_cast<streamsize>(table.size() * sizeof(unsigned short)));
+
+   if (!file)
+   {
+      throw exception("Unable to write file in RankTable::generate");
+   }
+} // end RankTable::generate
+
+//******************************************************************************
+// Function : load
+// Process  : Map the file, with huge pages if asked
+//             Check its size and header match this layout
+//             Point the values into the mapping
+// Notes    : Throw an exception if the file cannot be mapped or does not
+//             hold a table of this layout
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void RankTable::load(
+   const char* fileName,
+   const bool  useHugePages)
+{
+   const int* header = NULL;  // Header of the mapped file
+
+   this->values = NULL;
+
+   this->mappedFile.open(fileName, useHugePages);
+
+   header = static_cast<const int*>(this->mappedFile.getData());
+
+   if (this->mappedFile.getSize() != FILESIZE ||
+       header[0] != MAGIC ||
+       header[1] != VERSION ||
+       header[2] != NUMHANDS)
+   {
+      this->mappedFile.close();
+      throw exception("Unexpected table layout in RankTable::load");
+   }
+
+   this->values = reinterpret_cast<const unsigned short*>(header + HEADERSIZE);
+} // end RankTable::load
@@ -0,0 +1,261 @@
+//******************************************************************************
+//
+// File Name:     RankTable.h
+//
+// File Overview: Represents a precomputed table of the hand value of every
+//                five card hand, mapped read-only from a file
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef RankTable_h
+#define RankTable_h
+
+#include "Hand.h"
+#include "MappedFile.h"
+#include "PackedCard.h"
+
+//******************************************************************************
+//
+// Class:    RankTable
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : Holds the HandRanker::rankHand value of each of the 2598960
+//             five card hands, indexed by the colex index of the hand: the
+//             sum of C(index, position + 1) over its five card indexes
+//             sorted low to high.  Evaluating a hand is a sort of five
+//             indexes and one lookup.
+//             The table is written by generate, offline, and mapped
+//             read-only and shared by load, so every worker process on a
+//             host reads the same page cache copy and starts with no reads
+//             up front.  The file holds a header of native 32 bit integers
+//             then a native 16 bit value for each hand.
+//
+//******************************************************************************
+class RankTable
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, no table is loaded
+   // Constraints : Need to load a table before evaluating
+   //***************************************************************************
+   RankTable();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks, unmaps the table
+   // Constraints : None
+   //***************************************************************************
+   virtual ~RankTable();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Looks up the hand value of the five packed cards
+   // Constraints : The table must be loaded, the cards must be valid and
+   //                unique, in any order, cards must hold five cards
+   //***************************************************************************
+   inline int evaluate(const PackedCard cards[]) const;
+
+   //***************************************************************************
+   // Function    : generate
+   // Description : Ranks every five card hand with HandRanker::rankHand and
+   //                writes the values to the file, to be loaded later
+   // Constraints : Throws an exception if the file cannot be written
+   //***************************************************************************
+   static void generate(const char* fileName);
+
+   //***************************************************************************
+   // Function    : getHandIndex
+   // Description : Returns the colex index of the five packed cards, from 0
+   //                to NUMHANDS - 1
+   // Constraints : The cards must be valid and unique, in any order, cards
+   //                must hold five cards
+   //***************************************************************************
+   static inline int getHandIndex(const PackedCard cards[]);
+
+   //***************************************************************************
+   // Function    : isLoaded
+   // Description : Returns whether a table is loaded
+   // Constraints : None
+   //***************************************************************************
+   inline bool isLoaded() const;
+
+   //***************************************************************************
+   // Function    : load
+   // Description : Maps the table written by generate, backed by huge pages
+   //                where the system supports it if useHugePages
+   // Constraints : Throws an exception if the file cannot be mapped or does
+   //                not hold a table of this layout
+   //***************************************************************************
+   void load(
+      const char* fileName,
+      const bool  useHugePages = false);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the layout of the table file
+   enum RankTableLayout
+   {
+      MAGIC       = 0x52414E4B,  // "RANK"
+      VERSION     = 1,
+      NUMCARDS    = PackedCard::NUMRANKS * PackedCard::NUMSUITS,
+      NUMHANDS    = 2598960,     // C(52, 5)
+      HEADERSIZE  = 4,           // Magic, version, hands, zero, 32 bits each
+      FILESIZE    = HEADERSIZE * 4 + NUMHANDS * 2
+   };
+
+private:
+
+   //***************************************************************************
+   //
+   // Class:    Binomials
+   //
+   // Notes    : Holds C(n, k) for each card index n and k up to five, built
+   //             by a constexpr constructor into read-only data
+   //             Private, read through RankTable::binomials
+   //
+   //***************************************************************************
+   class Binomials
+   {
+   public:
+
+      //************************************************************************
+      // Function    : constructor
+      // Description : Builds Pascal's triangle up to five
+      // Constraints : Evaluated by the compiler
+      //************************************************************************
+      inline constexpr Binomials();
+
+      // C(n, k), indexed by n and k
+      int values[NUMCARDS][Hand::MAXCARDS + 1];
+
+   }; // end class Binomials
+
+   // Binomials shared by every table, generated by the compiler
+   static const Binomials binomials;
+
+   MappedFile              mappedFile; // Mapping of the table file
+   const unsigned short*   values;     // Value of each hand, NULL if not
+                                       // loaded
+
+}; // end class RankTable
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Look up the value at the colex index of the cards
+// Notes    : The table must be loaded, the cards must be valid and unique
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int RankTable::evaluate(const PackedCard cards[]) const
+{
+   return this->values[RankTable::getHandIndex(cards)];
+} // end RankTable::evaluate
+
+//******************************************************************************
+// Function : getHandIndex
+// Process  : Sort the five card indexes with a sorting network
+//             Sum C(index, position + 1) over the sorted indexes
+// Notes    : The cards must be valid and unique, cards must hold five cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int RankTable::getHandIndex(const PackedCard cards[])
+{
+   // Pairs of positions compared by the five card sorting network
+   static const int SORTPAIRS[][2] =
+   {
+      { 0, 1 }, { 3, 4 }, { 2, 4 }, { 2, 3 }, { 0, 3 },
+      { 0, 2 }, { 1, 4 }, { 1, 3 }, { 1, 2 }
+   };
+
+   const int NUMPAIRS  = sizeof(SORTPAIRS) / sizeof(SORTPAIRS[0]);
+   int       indexes[Hand::MAXCARDS];   // Card indexes, sorted low to high
+   int       handIndex = 0;             // Colex index of the hand
+
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      indexes[cardIndex] = cards[cardIndex].getIndex();
+   }
+
+   for (int pair = 0; pair < NUMPAIRS; ++pair)
+   {
+      int low  = indexes[SORTPAIRS[pair][0]];
+      int high = indexes[SORTPAIRS[pair][1]];
+
+      indexes[SORTPAIRS[pair][0]] = low < high ? low : high;
+      indexes[SORTPAIRS[pair][1]] = low < high ? high : low;
+   }
+
+   for (int position = 0; position < Hand::MAXCARDS; ++position)
+   {
+      handIndex += RankTable::binomials.values[indexes[position]]
+                                              [position + 1];
+   }
+
+   return handIndex;
+} // end RankTable::getHandIndex
+
+//******************************************************************************
+// Function : isLoaded
+// Process  : Return whether values points at a mapped table
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline bool RankTable::isLoaded() const
+{
+   return this->values != NULL;
+} // end RankTable::isLoaded
+
+//******************************************************************************
+// Function : constructor
+// Process  : Build Pascal's triangle, C(n, 0) is 1, C(0, k) is 0 for k > 0
+//             C(n, k) is C(n - 1, k - 1) + C(n - 1, k)
+// Notes    : Evaluated by the compiler for RankTable::binomials
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr RankTable::Binomials::Binomials()
+   : values()
+{
+   for (int n = 0; n < NUMCARDS; ++n)
+   {
+      this->values[n][0] = 1;
+
+      for (int k = 1; k <= Hand::MAXCARDS && n > 0; ++k)
+      {
+         this->values[n][k] = this->values[n - 1][k - 1] +
+                              this->values[n - 1][k];
+      }
+   }
+} // end RankTable::Binomials::Binomials
+
+#endif // RankTable_h
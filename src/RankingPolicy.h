@@ -0,0 +1,142 @@
+//******************************************************************************
+//
+// File Name:     RankingPolicy.h
+//
+// File Overview: Represents the ranking rules of a poker deck, used as the
+//                compile-time policy of BasicHandEvaluator
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added classes
+//******************************************************************************
+
+#ifndef RankingPolicy_h
+#define RankingPolicy_h
+
+#include "Hand.h"
+
+//******************************************************************************
+//
+// Class:    StandardRanking
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : The 52 card deck, two to ace, hand types ranked in the order of
+//             Hand::HandType, A 5 4 3 2 is the lowest straight
+//             A ranking policy holds LOWESTRANK, the PackedCard rank of its
+//             lowest card number, NUMRANKS, its number of card numbers, and
+//             getTypeOrder, the position of each hand type from 1 for the
+//             weakest to STRAIGHTFLUSH for the strongest
+//
+//******************************************************************************
+class StandardRanking
+{
+public:
+
+   //***************************************************************************
+   // Function    : getTypeOrder
+   // Description : Returns the position of the hand type, from 1 for the
+   //                weakest, 0 for INVALIDHAND
+   // Constraints : None
+   //***************************************************************************
+   static inline constexpr int getTypeOrder(const Hand::HandType type);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the card numbers of the deck
+   enum RankingSize
+   {
+      LOWESTRANK  = Card::TWO - Card::TWO,
+      NUMRANKS    = Card::ACE - Card::TWO + 1
+   };
+
+}; // end class StandardRanking
+
+//******************************************************************************
+//
+// Class:    ShortDeckRanking
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : The 36 card short deck (6+), six to ace, a flush beats a full
+//             house, A 9 8 7 6 is the lowest straight
+//
+//******************************************************************************
+class ShortDeckRanking
+{
+public:
+
+   //***************************************************************************
+   // Function    : getTypeOrder
+   // Description : Returns the position of the hand type, from 1 for the
+   //                weakest, 0 for INVALIDHAND
+   //                The flush and the full house trade places
+   // Constraints : None
+   //***************************************************************************
+   static inline constexpr int getTypeOrder(const Hand::HandType type);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the card numbers of the deck
+   enum RankingSize
+   {
+      LOWESTRANK  = Card::SIX - Card::TWO,
+      NUMRANKS    = Card::ACE - Card::SIX + 1
+   };
+
+}; // end class ShortDeckRanking
+
+//******************************************************************************
+// Function : getTypeOrder
+// Process  : Return the position of the hand type, the order of HandType
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr int StandardRanking::getTypeOrder(const Hand::HandType type)
+{
+   return type - Hand::INVALIDHAND;
+} // end StandardRanking::getTypeOrder
+
+//******************************************************************************
+// Function : getTypeOrder
+// Process  : Return the position of the hand type, the order of HandType
+//             with the flush and the full house swapped
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline constexpr int ShortDeckRanking::getTypeOrder(const Hand::HandType type)
+{
+   if (type == Hand::FLUSH)
+   {
+      return Hand::FULLHOUSE - Hand::INVALIDHAND;
+   }
+   else if (type == Hand::FULLHOUSE)
+   {
+      return Hand::FLUSH - Hand::INVALIDHAND;
+   }
+
+   return type - Hand::INVALIDHAND;
+} // end ShortDeckRanking::getTypeOrder
+
+#endif // RankingPolicy_h
@@ -0,0 +1,629 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     ResultReporter.cpp
+//
+// File Overview: Represents the reporters of the hands generated and the
+//                results compared, kept out of the ranking hot path
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added classes
+// 10.18.26       Donne Martin         Use the hand type names
+//******************************************************************************
+
+#include "stdafx.h"
+#include "ResultReporter.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// Names of each HandRanker::CompareResult, by value
+static const char* const RESULTNAMES[] =
+{
+   "TIE",
+   "FIRSTWINNER",
+   "SECONDWINNER"
+};
+
+//******************************************************************************
+// Function : constructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+ResultReporter::ResultReporter()
+{
+} // end ResultReporter::ResultReporter
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+ResultReporter::~ResultReporter()
+{
+} // end ResultReporter::~ResultReporter
+
+//******************************************************************************
+// Function : flush
+// Process  : None, nothing is held back
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ResultReporter::flush()
+{
+} // end ResultReporter::flush
+
+//******************************************************************************
+// Function : isEnabled
+// Process  : Return true
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+bool ResultReporter::isEnabled() const
+{
+   return true;
+} // end ResultReporter::isEnabled
+
+//******************************************************************************
+// Function : constructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+NullReporter::NullReporter()
+{
+} // end NullReporter::NullReporter
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+NullReporter::~NullReporter()
+{
+} // end NullReporter::~NullReporter
+
+//******************************************************************************
+// Function : isEnabled
+// Process  : Return false
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+bool NullReporter::isEnabled() const
+{
+   return false;
+} // end NullReporter::isEnabled
+
+//******************************************************************************
+// Function : reportCardComparison
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void NullReporter::reportCardComparison(
+   const Card::CardNumber /*firstCardNumber*/,
+   const Card::CardNumber /*secondCardNumber*/)
+{
+} // end NullReporter::reportCardComparison
+
+//******************************************************************************
+// Function : reportComparison
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void NullReporter::reportComparison(
+   const Hand&                      /*firstHand*/,
+   const Hand&                      /*secondHand*/,
+   const HandRanker::CompareResult  /*result*/)
+{
+} // end NullReporter::reportComparison
+
+//******************************************************************************
+// Function : reportGeneratedHand
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void NullReporter::reportGeneratedHand(
+   const Hand& /*hand*/,
+   const int   /*handIndex*/)
+{
+} // end NullReporter::reportGeneratedHand
+
+//******************************************************************************
+// Function : reportSection
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void NullReporter::reportSection(const string& /*title*/)
+{
+} // end NullReporter::reportSection
+
+//******************************************************************************
+// Function : constructor
+// Process  : Initialize data members to input values
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+BufferedReporter::BufferedReporter(
+   ostream&       out,
+   const size_t   bufferSize)
+   : out(out),
+     bufferSize(bufferSize)
+{
+} // end BufferedReporter::BufferedReporter
+
+//******************************************************************************
+// Function : destructor
+// Process  : Write the events held back
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+BufferedReporter::~BufferedReporter()
+{
+   this->flush();
+} // end BufferedReporter::~BufferedReporter
+
+//******************************************************************************
+// Function : endEvent
+// Process  : Write the buffer once it holds bufferSize characters
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void BufferedReporter::endEvent()
+{
+   if (static_cast<size_t>(this->buffer.tellp()) >= this->bufferSize)
+   {
+      this->flush();
+   }
+} // end BufferedReporter::endEvent
+
+//******************************************************************************
+// Function : flush
+// Process  : Write the buffer to the stream in one write and empty it
+//             Flush the stream
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void BufferedReporter::flush()
+{
+   const string events = this->buffer.str();
+
+   this->out.write(events.data(), static_cast<streamsize>(events.size()));
+   this->out.flush();
+   this->buffer.str(string());
+} // end BufferedReporter::flush
+
+//******************************************************************************
+// Function : constructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+TextReporter::TextReporter(
+   ostream&       out,
+   const size_t   bufferSize)
+   : BufferedReporter(out, bufferSize)
+{
+} // end TextReporter::TextReporter
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+TextReporter::~TextReporter()
+{
+} // end TextReporter::~TextReporter
+
+//******************************************************************************
+// Function : printHandComparisonHeader
+// Process  : Format the header showing hand vs hand
+// Notes    : Moved from HandRanker
+//
+// Revision History:
+//
+// Date           Author               Description
+// 6.12.11        Donne Martin         Added function
+// 10.18.26       Donne Martin         Format into the buffer
+//******************************************************************************
+void TextReporter::printHandComparisonHeader(
+   const Hand& firstHand,
+   const Hand& secondHand)
+{
+   this->buffer << "---Comparing Hands---" << "\n";
+   firstHand.printHand(this->buffer);
+
+   this->buffer << "\n" << "vs" << "\n";
+
+   secondHand.printHand(this->buffer);
+   this->buffer << "\n" << "\n";
+} // end TextReporter::printHandComparisonHeader
+
+//******************************************************************************
+// Function : printWinningHand
+// Process  : Format the winning hand based on the result parameter
+// Notes    : Moved from HandRanker
+//
+// Revision History:
+//
+// Date           Author               Description
+// 6.12.11        Donne Martin         Added function
+// 10.18.26       Donne Martin         Format into the buffer
+//******************************************************************************
+void TextReporter::printWinningHand(
+   const Hand&                      firstHand,
+   const Hand&                      secondHand,
+   const HandRanker::CompareResult  result)
+{
+   switch (result)
+   {
+      case HandRanker::FIRSTWINNER:
+      {
+         this->buffer << "\n" << "Winner is the first hand: ";
+         firstHand.printHand(this->buffer);
+         break;
+      }
+      case HandRanker::SECONDWINNER:
+      {
+         this->buffer << "\n" << "Winner is the second hand: ";
+         secondHand.printHand(this->buffer);
+         break;
+      }
+      case HandRanker::TIE:
+      {
+         this->buffer << "\n" << "Result: Tie";
+         break;
+      }
+      case HandRanker::INVALIDRESULT:
+      default:
+      {
+         throw exception("Unexpected result in printWinningHand");
+         break;
+      }
+   }
+
+   this->buffer << "\n";
+} // end TextReporter::printWinningHand
+
+//******************************************************************************
+// Function : reportCardComparison
+// Process  : Format the card numbers about to be compared
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void TextReporter::reportCardComparison(
+   const Card::CardNumber firstCardNumber,
+   const Card::CardNumber secondCardNumber)
+{
+   this->buffer << "Comparing card number values "
+                << firstCardNumber << " and "
+                << secondCardNumber << "\n";
+
+   this->endEvent();
+} // end TextReporter::reportCardComparison
+
+//******************************************************************************
+// Function : reportComparison
+// Process  : Format the header, the winning hand, and a blank line
+// Notes    : Throw an exception if the result is invalid
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void TextReporter::reportComparison(
+   const Hand&                      firstHand,
+   const Hand&                      secondHand,
+   const HandRanker::CompareResult  result)
+{
+   this->printHandComparisonHeader(firstHand, secondHand);
+   this->printWinningHand(firstHand, secondHand, result);
+
+   this->buffer << "\n";
+
+   this->endEvent();
+} // end TextReporter::reportComparison
+
+//******************************************************************************
+// Function : reportGeneratedHand
+// Process  : Format each card of the hand
+//             Format "vs" after the first hand of a pair, else a blank line
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void TextReporter::reportGeneratedHand(
+   const Hand& hand,
+   const int   handIndex)
+{
+   Card card;  // Current card, used to iterate the hand and print each card
+
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      hand.getCard(cardIndex, card);
+      card.printCard(this->buffer);
+   }
+
+   this->buffer << "\n" << (handIndex % 2 == 0 ? "vs" : "") << "\n";
+
+   this->endEvent();
+} // end TextReporter::reportGeneratedHand
+
+//******************************************************************************
+// Function : reportSection
+// Process  : Format the title between dashes and a blank line
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void TextReporter::reportSection(const string& title)
+{
+   this->buffer << "---" << title << "---" << "\n" << "\n";
+
+   this->endEvent();
+} // end TextReporter::reportSection
+
+//******************************************************************************
+// Function : constructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+StructuredReporter::StructuredReporter(
+   ostream&       out,
+   const size_t   bufferSize)
+   : BufferedReporter(out, bufferSize)
+{
+} // end StructuredReporter::StructuredReporter
+
+//******************************************************************************
+// Function : destructor
+// Process  : None
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+StructuredReporter::~StructuredReporter()
+{
+} // end StructuredReporter::~StructuredReporter
+
+//******************************************************************************
+// Function : printCards
+// Process  : Format each card as its number and suit letter, such as "10c",
+//             in a JSON array
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void StructuredReporter::printCards(const Hand& hand)
+{
+   static const char SUITLETTERS[] = { '?', 'c', 's', 'h', 'd' };
+   Card              card;
+
+   this->buffer << "[";
+
+   for (int cardIndex = 0; cardIndex < Hand::MAXCARDS; ++cardIndex)
+   {
+      hand.getCard(cardIndex, card);
+
+      this->buffer << (cardIndex > 0 ? ",\"" : "\"");
+      card.printNumber(this->buffer);
+      this->buffer << SUITLETTERS[card.getSuit()] << "\"";
+   }
+
+   this->buffer << "]";
+} // end StructuredReporter::printCards
+
+//******************************************************************************
+// Function : printHand
+// Process  : Format the cards, the type name, and the hand value
+// Notes    : Throw an exception if the type is out of range
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+// 10.18.26       Donne Martin         Use the hand type names
+//******************************************************************************
+void StructuredReporter::printHand(const Hand& hand)
+{
+   this->buffer << "{\"cards\":";
+   this->printCards(hand);
+   this->buffer << ",\"type\":\"" << Hand::getTypeName(hand.getType())
+                << "\",\"value\":" << hand.getValue() << "}";
+} // end StructuredReporter::printHand
+
+//******************************************************************************
+// Function : reportCardComparison
+// Process  : Format a cardComparison line of the two numbers
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void StructuredReporter::reportCardComparison(
+   const Card::CardNumber firstCardNumber,
+   const Card::CardNumber secondCardNumber)
+{
+   this->buffer << "{\"event\":\"cardComparison\",\"first\":"
+                << firstCardNumber << ",\"second\":"
+                << secondCardNumber << "}\n";
+
+   this->endEvent();
+} // end StructuredReporter::reportCardComparison
+
+//******************************************************************************
+// Function : reportComparison
+// Process  : Format a comparison line of the two hands and the result name
+// Notes    : Throw an exception if the result is invalid
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void StructuredReporter::reportComparison(
+   const Hand&                      firstHand,
+   const Hand&                      secondHand,
+   const HandRanker::CompareResult  result)
+{
+   if (result != HandRanker::TIE &&
+       result != HandRanker::FIRSTWINNER &&
+       result != HandRanker::SECONDWINNER)
+   {
+      throw exception(
+         "Unexpected result in StructuredReporter::reportComparison");
+   }
+
+   this->buffer << "{\"event\":\"comparison\",\"first\":";
+   this->printHand(firstHand);
+   this->buffer << ",\"second\":";
+   this->printHand(secondHand);
+   this->buffer << ",\"result\":\"" << RESULTNAMES[result] << "\"}\n";
+
+   this->endEvent();
+} // end StructuredReporter::reportComparison
+
+//******************************************************************************
+// Function : reportGeneratedHand
+// Process  : Format a hand line of the index and the cards
+// Notes    : The hand is not ranked yet, so holds no type or value
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void StructuredReporter::reportGeneratedHand(
+   const Hand& hand,
+   const int   handIndex)
+{
+   this->buffer << "{\"event\":\"hand\",\"index\":" << handIndex
+                << ",\"cards\":";
+   this->printCards(hand);
+   this->buffer << "}\n";
+
+   this->endEvent();
+} // end StructuredReporter::reportGeneratedHand
+
+//******************************************************************************
+// Function : reportSection
+// Process  : Format a section line of the title
+// Notes    : The title is written as is, it must need no JSON escapes
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void StructuredReporter::reportSection(const string& title)
+{
+   this->buffer << "{\"event\":\"section\",\"title\":\"" << title << "\"}\n";
+
+   this->endEvent();
+} // end StructuredReporter::reportSection
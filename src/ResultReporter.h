@@ -0,0 +1,478 @@
+//******************************************************************************
+//
+// File Name:     ResultReporter.h
+//
+// File Overview: Represents the reporters of the hands generated and the
+//                results compared, kept out of the ranking hot path
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added classes
+//******************************************************************************
+
+#ifndef ResultReporter_h
+#define ResultReporter_h
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include "Card.h"
+#include "Hand.h"
+#include "HandRanker.h"
+
+//******************************************************************************
+//
+// Class:    ResultReporter
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : Receives the events HandGenerator and HandRanker used to print
+//             to cout, and decides whether and how to format them.  Each
+//             class takes a reporter with setReporter and keeps NULL when
+//             given a reporter that is not enabled, so with reporting off
+//             an event costs the test of a pointer and nothing is
+//             formatted.
+//             A reporter is not thread-safe, the events are reported on
+//             the thread calling the generator or the ranker, and
+//             compareAllHands reports its comparisons in order on the
+//             calling thread once the pool has compared them.
+//
+//******************************************************************************
+class ResultReporter
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : None
+   // Constraints : None
+   //***************************************************************************
+   ResultReporter();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~ResultReporter();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : flush
+   // Description : Writes any events held back, none by default
+   // Constraints : None
+   //***************************************************************************
+   virtual void flush();
+
+   //***************************************************************************
+   // Function    : isEnabled
+   // Description : Returns whether the reporter wants events, true by default
+   // Constraints : None
+   //***************************************************************************
+   virtual bool isEnabled() const;
+
+   //***************************************************************************
+   // Function    : reportCardComparison
+   // Description : Reports the two card numbers compared by
+   //                HandRanker::compareCardNumbers
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportCardComparison(
+      const Card::CardNumber firstCardNumber,
+      const Card::CardNumber secondCardNumber) = 0;
+
+   //***************************************************************************
+   // Function    : reportComparison
+   // Description : Reports the two hands compared and the result
+   // Constraints : The hands must be ranked
+   //***************************************************************************
+   virtual void reportComparison(
+      const Hand&                      firstHand,
+      const Hand&                      secondHand,
+      const HandRanker::CompareResult  result) = 0;
+
+   //***************************************************************************
+   // Function    : reportGeneratedHand
+   // Description : Reports the hand added by HandGenerator, the handIndex of
+   //                its hands, so even hands start a pair
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportGeneratedHand(
+      const Hand& hand,
+      const int   handIndex) = 0;
+
+   //***************************************************************************
+   // Function    : reportSection
+   // Description : Reports the start of a section of hands, such as
+   //                "Generate Flush"
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportSection(const string& title) = 0;
+
+private:
+
+   //***************************************************************************
+   // Function    : copy constructor
+   // Description : Not implemented, reporters are shared by pointer
+   // Constraints : Private
+   //***************************************************************************
+   ResultReporter(const ResultReporter& reporter);
+
+   //***************************************************************************
+   // Function    : operator=
+   // Description : Not implemented, reporters are shared by pointer
+   // Constraints : Private
+   //***************************************************************************
+   ResultReporter& operator=(const ResultReporter& reporter);
+
+}; // end class ResultReporter
+
+//******************************************************************************
+//
+// Class:    NullReporter
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : Not enabled, setReporter keeps NULL for it, so it turns
+//             reporting off explicitly
+//
+//******************************************************************************
+class NullReporter : public ResultReporter
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : None
+   // Constraints : None
+   //***************************************************************************
+   NullReporter();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~NullReporter();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : isEnabled
+   // Description : Returns false, the reporter wants no events
+   // Constraints : None
+   //***************************************************************************
+   virtual bool isEnabled() const;
+
+   //***************************************************************************
+   // Function    : reportCardComparison
+   // Description : Ignores the event
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportCardComparison(
+      const Card::CardNumber firstCardNumber,
+      const Card::CardNumber secondCardNumber);
+
+   //***************************************************************************
+   // Function    : reportComparison
+   // Description : Ignores the event
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportComparison(
+      const Hand&                      firstHand,
+      const Hand&                      secondHand,
+      const HandRanker::CompareResult  result);
+
+   //***************************************************************************
+   // Function    : reportGeneratedHand
+   // Description : Ignores the event
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportGeneratedHand(
+      const Hand& hand,
+      const int   handIndex);
+
+   //***************************************************************************
+   // Function    : reportSection
+   // Description : Ignores the event
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportSection(const string& title);
+
+}; // end class NullReporter
+
+//******************************************************************************
+//
+// Class:    BufferedReporter
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : Formats the events into a buffer and writes the buffer to the
+//             stream once it holds bufferSize characters, on flush, and on
+//             destruction, so a run of events is one write instead of a
+//             write per card
+//             The stream must outlive the reporter
+//
+//******************************************************************************
+class BufferedReporter : public ResultReporter
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Writes to the stream in writes of about bufferSize
+   //                characters
+   // Constraints : None
+   //***************************************************************************
+   explicit BufferedReporter(
+      ostream&       out,
+      const size_t   bufferSize = DEFAULTBUFFERSIZE);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks, writes the events held back
+   // Constraints : None
+   //***************************************************************************
+   virtual ~BufferedReporter();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : flush
+   // Description : Writes the events held back and flushes the stream
+   // Constraints : Call before writing to the stream directly, so the
+   //                output stays in order
+   //***************************************************************************
+   virtual void flush();
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the size of the buffer
+   enum BufferedReporterSize
+   {
+      DEFAULTBUFFERSIZE = 65536
+   };
+
+protected:
+
+   //***************************************************************************
+   // Function    : endEvent
+   // Description : Writes the buffer if it holds bufferSize characters
+   // Constraints : Protected, called after formatting each event
+   //***************************************************************************
+   void endEvent();
+
+   ostringstream buffer;   // Events formatted, not yet written
+
+private:
+
+   ostream&       out;           // Stream written to
+   size_t         bufferSize;    // Characters held back before a write
+
+}; // end class BufferedReporter
+
+//******************************************************************************
+//
+// Class:    TextReporter
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : Formats the events as the text the demo has always printed:
+//             the cards of each generated pair with "vs" between them, and
+//             the header, hands, and winner of each comparison
+//
+//******************************************************************************
+class TextReporter : public BufferedReporter
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Writes the text to the stream
+   // Constraints : None
+   //***************************************************************************
+   explicit TextReporter(
+      ostream&       out,
+      const size_t   bufferSize = DEFAULTBUFFERSIZE);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~TextReporter();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : reportCardComparison
+   // Description : Formats "Comparing card number values" and the numbers
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportCardComparison(
+      const Card::CardNumber firstCardNumber,
+      const Card::CardNumber secondCardNumber);
+
+   //***************************************************************************
+   // Function    : reportComparison
+   // Description : Formats the header showing hand vs hand, then the winner
+   // Constraints : Throws an exception if the result is invalid
+   //***************************************************************************
+   virtual void reportComparison(
+      const Hand&                      firstHand,
+      const Hand&                      secondHand,
+      const HandRanker::CompareResult  result);
+
+   //***************************************************************************
+   // Function    : reportGeneratedHand
+   // Description : Formats the cards, then "vs" after the first of a pair or
+   //                a blank line after the second
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportGeneratedHand(
+      const Hand& hand,
+      const int   handIndex);
+
+   //***************************************************************************
+   // Function    : reportSection
+   // Description : Formats the title as ---title---
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportSection(const string& title);
+
+private:
+
+   //***************************************************************************
+   // Function    : printHandComparisonHeader
+   // Description : Formats the header showing hand vs hand
+   // Constraints : Private
+   //***************************************************************************
+   void printHandComparisonHeader(
+      const Hand& firstHand,
+      const Hand& secondHand);
+
+   //***************************************************************************
+   // Function    : printWinningHand
+   // Description : Formats the winning hand based on the result parameter
+   // Constraints : Private, throws an exception if the result is invalid
+   //***************************************************************************
+   void printWinningHand(
+      const Hand&                      firstHand,
+      const Hand&                      secondHand,
+      const HandRanker::CompareResult  result);
+
+}; // end class TextReporter
+
+//******************************************************************************
+//
+// Class:    StructuredReporter
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : Formats each event as a line holding one JSON object, for
+//             tools reading the results, such as
+//             {"event":"comparison","first":{"cards":["Ac",...],
+//             "type":"FLUSH","value":1234},"second":{...},
+//             "result":"FIRSTWINNER"}
+//             The events are "section", "hand", "cardComparison", and
+//             "comparison"
+//
+//******************************************************************************
+class StructuredReporter : public BufferedReporter
+{
+public:
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Writes the lines to the stream
+   // Constraints : None
+   //***************************************************************************
+   explicit StructuredReporter(
+      ostream&       out,
+      const size_t   bufferSize = DEFAULTBUFFERSIZE);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks
+   // Constraints : None
+   //***************************************************************************
+   virtual ~StructuredReporter();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : reportCardComparison
+   // Description : Formats a cardComparison line of the two numbers
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportCardComparison(
+      const Card::CardNumber firstCardNumber,
+      const Card::CardNumber secondCardNumber);
+
+   //***************************************************************************
+   // Function    : reportComparison
+   // Description : Formats a comparison line of the two hands and the result
+   // Constraints : Throws an exception if the result is invalid
+   //***************************************************************************
+   virtual void reportComparison(
+      const Hand&                      firstHand,
+      const Hand&                      secondHand,
+      const HandRanker::CompareResult  result);
+
+   //***************************************************************************
+   // Function    : reportGeneratedHand
+   // Description : Formats a hand line of the index and the cards
+   // Constraints : None
+   //***************************************************************************
+   virtual void reportGeneratedHand(
+      const Hand& hand,
+      const int   handIndex);
+
+   //***************************************************************************
+   // Function    : reportSection
+   // Description : Formats a section line of the title
+   // Constraints : The title must need no JSON escapes
+   //***************************************************************************
+   virtual void reportSection(const string& title);
+
+private:
+
+   //***************************************************************************
+   // Function    : printCards
+   // Description : Formats the cards of the hand as a JSON array of strings
+   // Constraints : Private
+   //***************************************************************************
+   void printCards(const Hand& hand);
+
+   //***************************************************************************
+   // Function    : printHand
+   // Description : Formats the cards, type, and value of the hand as a JSON
+   //                object
+   // Constraints : Private, throws an exception if the type is out of range
+   //***************************************************************************
+   void printHand(const Hand& hand);
+
+}; // end class StructuredReporter
+
+#endif // ResultReporter_h
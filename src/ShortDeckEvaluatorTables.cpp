@@ -0,0 +1,3240 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     ShortDeckEvaluatorTables.cpp
+//
+// File Overview: Lookup tables of the ShortDeckEvaluator, written by
+//                ShortDeckEvaluator::generate, do not edit
+//
+//******************************************************************************
+
+#include "stdafx.h"
+#include "HandEvaluator.h"
+
+template <>
+const ShortDeckEvaluator::LookupTables ShortDeckEvaluator::tables =
+{
+   {
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 1400,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 1207,
+      0, 0, 0, 0, 0, 0, 0, 1208,
+      0, 0, 0, 1209, 0, 1210, 1401, 1401,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 1211,
+      0, 0, 0, 0, 0, 0, 0, 1212,
+      0, 0, 0, 1213, 0, 1214, 1215, 1400,
+      0, 0, 0, 0, 0, 0, 0, 1216,
+      0, 0, 0, 1217, 0, 1218, 1219, 1219,
+      0, 0, 0, 1220, 0, 1221, 1222, 1222,
+      0, 1223, 1224, 1224, 1402, 1402, 1402, 1402,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 1225,
+      0, 0, 0, 0, 0, 0, 0, 1226,
+      0, 0, 0, 1227, 0, 1228, 1229, 1400,
+      0, 0, 0, 0, 0, 0, 0, 1230,
+      0, 0, 0, 1231, 0, 1232, 1233, 1233,
+      0, 0, 0, 1234, 0, 1235, 1236, 1236,
+      0, 1237, 1238, 1238, 1239, 1239, 1401, 1401,
+      0, 0, 0, 0, 0, 0, 0, 1240,
+      0, 0, 0, 1241, 0, 1242, 1243, 1243,
+      0, 0, 0, 1244, 0, 1245, 1246, 1246,
+      0, 1247, 1248, 1248, 1249, 1249, 1249, 1400,
+      0, 0, 0, 1250, 0, 1251, 1252, 1252,
+      0, 1253, 1254, 1254, 1255, 1255, 1255, 1255,
+      0, 1256, 1257, 1257, 1258, 1258, 1258, 1258,
+      1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 1399,
+      0, 0, 0, 0, 0, 0, 0, 1259,
+      0, 0, 0, 1260, 0, 1261, 1262, 1400,
+      0, 0, 0, 0, 0, 0, 0, 1263,
+      0, 0, 0, 1264, 0, 1265, 1266, 1399,
+      0, 0, 0, 1267, 0, 1268, 1269, 1269,
+      0, 1270, 1271, 1271, 1272, 1272, 1401, 1401,
+      0, 0, 0, 0, 0, 0, 0, 1273,
+      0, 0, 0, 1274, 0, 1275, 1276, 1399,
+      0, 0, 0, 1277, 0, 1278, 1279, 1279,
+      0, 1280, 1281, 1281, 1282, 1282, 1282, 1400,
+      0, 0, 0, 1283, 0, 1284, 1285, 1285,
+      0, 1286, 1287, 1287, 1288, 1288, 1288, 1399,
+      0, 1289, 1290, 1290, 1291, 1291, 1291, 1291,
+      1292, 1292, 1292, 1292, 1402, 1402, 1402, 1402,
+      0, 0, 0, 0, 0, 0, 0, 1293,
+      0, 0, 0, 1294, 0, 1295, 1296, 1399,
+      0, 0, 0, 1297, 0, 1298, 1299, 1299,
+      0, 1300, 1301, 1301, 1302, 1302, 1302, 1400,
+      0, 0, 0, 1303, 0, 1304, 1305, 1305,
+      0, 1306, 1307, 1307, 1308, 1308, 1308, 1399,
+      0, 1309, 1310, 1310, 1311, 1311, 1311, 1311,
+      1312, 1312, 1312, 1312, 1312, 1312, 1401, 1401,
+      0, 0, 0, 1313, 0, 1314, 1315, 1315,
+      0, 1316, 1317, 1317, 1318, 1318, 1318, 1399,
+      0, 1319, 1320, 1320, 1321, 1321, 1321, 1321,
+      1322, 1322, 1322, 1322, 1322, 1322, 1322, 1400,
+      0, 1323, 1324, 1324, 1325, 1325, 1325, 1325,
+      1326, 1326, 1326, 1326, 1326, 1326, 1326, 1399,
+      1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404,
+      1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404
+   },
+   {
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 1130,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 1,
+      0, 0, 0, 0, 0, 0, 0, 2,
+      0, 0, 0, 3, 0, 4, 1131, 0,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 5,
+      0, 0, 0, 0, 0, 0, 0, 6,
+      0, 0, 0, 7, 0, 8, 9, 0,
+      0, 0, 0, 0, 0, 0, 0, 10,
+      0, 0, 0, 11, 0, 12, 13, 0,
+      0, 0, 0, 14, 0, 15, 16, 0,
+      0, 17, 18, 0, 1132, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 19,
+      0, 0, 0, 0, 0, 0, 0, 20,
+      0, 0, 0, 21, 0, 22, 23, 0,
+      0, 0, 0, 0, 0, 0, 0, 24,
+      0, 0, 0, 25, 0, 26, 27, 0,
+      0, 0, 0, 28, 0, 29, 30, 0,
+      0, 31, 32, 0, 33, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 34,
+      0, 0, 0, 35, 0, 36, 37, 0,
+      0, 0, 0, 38, 0, 39, 40, 0,
+      0, 41, 42, 0, 43, 0, 0, 0,
+      0, 0, 0, 44, 0, 45, 46, 0,
+      0, 47, 48, 0, 49, 0, 0, 0,
+      0, 50, 51, 0, 52, 0, 0, 0,
+      1133, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 1129,
+      0, 0, 0, 0, 0, 0, 0, 53,
+      0, 0, 0, 54, 0, 55, 56, 0,
+      0, 0, 0, 0, 0, 0, 0, 57,
+      0, 0, 0, 58, 0, 59, 60, 0,
+      0, 0, 0, 61, 0, 62, 63, 0,
+      0, 64, 65, 0, 66, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 67,
+      0, 0, 0, 68, 0, 69, 70, 0,
+      0, 0, 0, 71, 0, 72, 73, 0,
+      0, 74, 75, 0, 76, 0, 0, 0,
+      0, 0, 0, 77, 0, 78, 79, 0,
+      0, 80, 81, 0, 82, 0, 0, 0,
+      0, 83, 84, 0, 85, 0, 0, 0,
+      86, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 87,
+      0, 0, 0, 88, 0, 89, 90, 0,
+      0, 0, 0, 91, 0, 92, 93, 0,
+      0, 94, 95, 0, 96, 0, 0, 0,
+      0, 0, 0, 97, 0, 98, 99, 0,
+      0, 100, 101, 0, 102, 0, 0, 0,
+      0, 103, 104, 0, 105, 0, 0, 0,
+      106, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 107, 0, 108, 109, 0,
+      0, 110, 111, 0, 112, 0, 0, 0,
+      0, 113, 114, 0, 115, 0, 0, 0,
+      116, 0, 0, 0, 0, 0, 0, 0,
+      0, 117, 118, 0, 119, 0, 0, 0,
+      120, 0, 0, 0, 0, 0, 0, 0,
+      1134, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0
+   },
+   {
+      1398, 1206, 1198, 1390, 1397, 1128, 876, 1100,
+      1389, 1205, 869, 820, 1197, 1190, 1072, 1189,
+      1382, 1381, 1396, 1127, 875, 1099, 1388, 1121,
+      624, 568, 1093, 868, 512, 819, 1071, 1065,
+      1380, 1204, 862, 813, 1196, 861, 456, 812,
+      771, 770, 1188, 1182, 1044, 1181, 1043, 1037,
+      1180, 1374, 1373, 1372, 1395, 1126, 874, 1098,
+      1387, 1120, 623, 567, 1092, 867, 511, 818,
+      1070, 1064, 1379, 1115, 618, 562, 1087, 603,
+      1134, 547, 506, 491, 1059, 860, 455, 811,
+      450, 435, 769, 1042, 1036, 1031, 1371, 1203,
+      855, 806, 1195, 854, 400, 805, 764, 763,
+      1187, 853, 399, 804, 394, 379, 762, 729,
+      728, 727, 1179, 1174, 1016, 1173, 1015, 1009,
+      1172, 1014, 1008, 1003, 1171, 1366, 1365, 1364,
+      1363, 1394, 1125, 873, 1097, 1386, 1119, 622,
+      566, 1091, 866, 510, 817, 1069, 1063, 1378,
+      1114, 617, 561, 1086, 602, 120, 546, 505,
+      490, 1058, 859, 454, 810, 449, 434, 768,
+      1041, 1035, 1030, 1370, 1110, 613, 557, 1082,
+      598, 116, 542, 501, 486, 1054, 588, 106,
+      532, 86, 1133, 476, 445, 430, 420, 1026,
+      852, 398, 803, 393, 378, 761, 389, 374,
+      364, 726, 1013, 1007, 1002, 998, 1362, 1202,
+      848, 799, 1194, 847, 344, 798, 757, 756,
+      1186, 846, 343, 797, 338, 323, 755, 722,
+      721, 720, 1178, 845, 342, 796, 337, 322,
+      754, 333, 318, 308, 719, 694, 693, 692,
+      691, 1170, 1166, 988, 1165, 987, 981, 1164,
+      986, 980, 975, 1163, 985, 979, 974, 970,
+      1162, 1358, 1357, 1356, 1355, 1354, 1393, 1124,
+      872, 1096, 1385, 1118, 621, 565, 1090, 865,
+      509, 816, 1068, 1062, 1377, 1113, 616, 560,
+      1085, 601, 119, 545, 504, 489, 1057, 858,
+      453, 809, 448, 433, 767, 1040, 1034, 1029,
+      1369, 1109, 612, 556, 1081, 597, 115, 541,
+      500, 485, 1053, 587, 105, 531, 85, 52,
+      475, 444, 429, 419, 1025, 851, 397, 802,
+      392, 377, 760, 388, 373, 363, 725, 1012,
+      1006, 1001, 997, 1361, 1106, 609, 553, 1078,
+      594, 112, 538, 497, 482, 1050, 584, 102,
+      528, 82, 49, 472, 441, 426, 416, 1022,
+      578, 96, 522, 76, 43, 466, 66, 33,
+      1132, 410, 385, 370, 360, 354, 994, 844,
+      341, 795, 336, 321, 753, 332, 317, 307,
+      718, 329, 314, 304, 298, 690, 984, 978,
+      973, 969, 966, 1353, 1201, 841, 792, 1193,
+      840, 288, 791, 750, 749, 1185, 839, 287,
+      790, 282, 267, 748, 715, 714, 713, 1177,
+      838, 286, 789, 281, 266, 747, 277, 262,
+      252, 712, 687, 686, 685, 684, 1169, 837,
+      285, 788, 280, 265, 746, 276, 261, 251,
+      711, 273, 258, 248, 242, 683, 666, 665,
+      664, 663, 662, 1161, 1158, 960, 1157, 959,
+      953, 1156, 958, 952, 947, 1155, 957, 951,
+      946, 942, 1154, 956, 950, 945, 941, 938,
+      1153, 1350, 1349, 1348, 1347, 1346, 1345, 1392,
+      1123, 871, 1095, 1384, 1117, 620, 564, 1089,
+      864, 508, 815, 1067, 1061, 1376, 1112, 615,
+      559, 1084, 600, 118, 544, 503, 488, 1056,
+      857, 452, 808, 447, 432, 766, 1039, 1033,
+      1028, 1368, 1108, 611, 555, 1080, 596, 114,
+      540, 499, 484, 1052, 586, 104, 530, 84,
+      51, 474, 443, 428, 418, 1024, 850, 396,
+      801, 391, 376, 759, 387, 372, 362, 724,
+      1011, 1005, 1000, 996, 1360, 1105, 608, 552,
+      1077, 593, 111, 537, 496, 481, 1049, 583,
+      101, 527, 81, 48, 471, 440, 425, 415,
+      1021, 577, 95, 521, 75, 42, 465, 65,
+      32, 18, 409, 384, 369, 359, 353, 993,
+      843, 340, 794, 335, 320, 752, 331, 316,
+      306, 717, 328, 313, 303, 297, 689, 983,
+      977, 972, 968, 965, 1352, 1103, 606, 550,
+      1075, 591, 109, 535, 494, 479, 1047, 581,
+      99, 525, 79, 46, 469, 438, 423, 413,
+      1019, 575, 93, 519, 73, 40, 463, 63,
+      30, 16, 407, 382, 367, 357, 351, 991,
+      572, 90, 516, 70, 37, 460, 60, 27,
+      13, 404, 56, 23, 9, 1131, 348, 326,
+      311, 301, 295, 292, 963, 836, 284, 787,
+      279, 264, 745, 275, 260, 250, 710, 272,
+      257, 247, 241, 682, 270, 255, 245, 239,
+      236, 661, 955, 949, 944, 940, 937, 935,
+      1344, 1200, 834, 785, 1192, 833, 232, 784,
+      743, 742, 1184, 832, 231, 783, 226, 211,
+      741, 708, 707, 706, 1176, 831, 230, 782,
+      225, 210, 740, 221, 206, 196, 705, 680,
+      679, 678, 677, 1168, 830, 229, 781, 224,
+      209, 739, 220, 205, 195, 704, 217, 202,
+      192, 186, 676, 659, 658, 657, 656, 655,
+      1160, 829, 228, 780, 223, 208, 738, 219,
+      204, 194, 703, 216, 201, 191, 185, 675,
+      214, 199, 189, 183, 180, 654, 645, 644,
+      643, 642, 641, 640, 1152, 1150, 932, 1149,
+      931, 925, 1148, 930, 924, 919, 1147, 929,
+      923, 918, 914, 1146, 928, 922, 917, 913,
+      910, 1145, 927, 921, 916, 912, 909, 907,
+      1144, 1342, 1341, 1340, 1339, 1338, 1337, 1336,
+      1391, 1122, 870, 1094, 1383, 1116, 619, 563,
+      1088, 863, 507, 814, 1066, 1060, 1375, 1111,
+      614, 558, 1083, 599, 117, 543, 502, 487,
+      1055, 856, 451, 807, 446, 431, 765, 1038,
+      1032, 1027, 1367, 1107, 610, 554, 1079, 595,
+      113, 539, 498, 483, 1051, 585, 103, 529,
+      83, 50, 473, 442, 427, 417, 1023, 849,
+      395, 800, 390, 375, 758, 386, 371, 361,
+      723, 1010, 1004, 999, 995, 1359, 1104, 607,
+      551, 1076, 592, 110, 536, 495, 480, 1048,
+      582, 100, 526, 80, 47, 470, 439, 424,
+      414, 1020, 576, 94, 520, 74, 41, 464,
+      64, 31, 17, 408, 383, 368, 358, 352,
+      992, 842, 339, 793, 334, 319, 751, 330,
+      315, 305, 716, 327, 312, 302, 296, 688,
+      982, 976, 971, 967, 964, 1351, 1102, 605,
+      549, 1074, 590, 108, 534, 493, 478, 1046,
+      580, 98, 524, 78, 45, 468, 437, 422,
+      412, 1018, 574, 92, 518, 72, 39, 462,
+      62, 29, 15, 406, 381, 366, 356, 350,
+      990, 571, 89, 515, 69, 36, 459, 59,
+      26, 12, 403, 55, 22, 8, 4, 347,
+      325, 310, 300, 294, 291, 962, 835, 283,
+      786, 278, 263, 744, 274, 259, 249, 709,
+      271, 256, 246, 240, 681, 269, 254, 244,
+      238, 235, 660, 954, 948, 943, 939, 936,
+      934, 1343, 1101, 604, 548, 1073, 589, 107,
+      533, 492, 477, 1045, 579, 97, 523, 77,
+      44, 467, 436, 421, 411, 1017, 573, 91,
+      517, 71, 38, 461, 61, 28, 14, 405,
+      380, 365, 355, 349, 989, 570, 88, 514,
+      68, 35, 458, 58, 25, 11, 402, 54,
+      21, 7, 3, 346, 324, 309, 299, 293,
+      290, 961, 569, 87, 513, 67, 34, 457,
+      57, 24, 10, 401, 53, 20, 6, 2,
+      345, 1129, 19, 5, 1, 1130, 289, 268,
+      253, 243, 237, 234, 233, 933, 828, 227,
+      779, 222, 207, 737, 218, 203, 193, 702,
+      215, 200, 190, 184, 674, 213, 198, 188,
+      182, 179, 653, 212, 197, 187, 181, 178,
+      177, 639, 926, 920, 915, 911, 908, 906,
+      905, 1335, 1199, 827, 778, 1191, 826, 176,
+      777, 736, 735, 1183, 825, 175, 776, 170,
+      155, 734, 701, 700, 699, 1175, 824, 174,
+      775, 169, 154, 733, 165, 150, 140, 698,
+      673, 672, 671, 670, 1167, 823, 173, 774,
+      168, 153, 732, 164, 149, 139, 697, 161,
+      146, 136, 130, 669, 652, 651, 650, 649,
+      648, 1159, 822, 172, 773, 167, 152, 731,
+      163, 148, 138, 696, 160, 145, 135, 129,
+      668, 158, 143, 133, 127, 124, 647, 638,
+      637, 636, 635, 634, 633, 1151, 821, 171,
+      772, 166, 151, 730, 162, 147, 137, 695,
+      159, 144, 134, 128, 667, 157, 142, 132,
+      126, 123, 646, 156, 141, 131, 125, 122,
+      121, 632, 631, 630, 629, 628, 627, 626,
+      625, 1143, 1142, 904, 1141, 903, 897, 1140,
+      902, 896, 891, 1139, 901, 895, 890, 886,
+      1138, 900, 894, 889, 885, 882, 1137, 899,
+      893, 888, 884, 881, 879, 1136, 898, 892,
+      887, 883, 880, 878, 877, 1135, 1334, 1333,
+      1332, 1331, 1330, 1329, 1328, 1327, 1398, 1206,
+      1390, 1398, 1206, 1198, 1390, 1397, 1205, 876,
+      1197, 1389, 1205, 1190, 1189, 1197, 1382, 1382,
+      1381, 1398, 1206, 1198, 1390, 1397, 1128, 876,
+      1100, 1389, 1205, 869, 820, 1197, 1190, 1072,
+      1189, 1382, 1381, 1396, 1204, 875, 1196, 1388,
+      1204, 862, 813, 1196, 868, 771, 819, 1188,
+      1188, 1380, 1204, 1182, 1181, 1196, 1182, 1044,
+      1181, 1180, 1180, 1188, 1374, 1374, 1373, 1374,
+      1373, 1372, 1398, 1206, 1198, 1390, 1397, 1128,
+      876, 1100, 1389, 1205, 869, 820, 1197, 1190,
+      1072, 1189, 1382, 1381, 1396, 1127, 875, 1099,
+      1388, 1121, 1134, 1134, 1093, 868, 1134, 819,
+      1071, 1065, 1380, 1204, 862, 813, 1196, 861,
+      1134, 812, 771, 770, 1188, 1182, 1044, 1181,
+      1043, 1037, 1180, 1374, 1373, 1372, 1395, 1203,
+      874, 1195, 1387, 1203, 855, 806, 1195, 867,
+      764, 818, 1187, 1187, 1379, 1203, 855, 806,
+      1195, 854, 1134, 805, 764, 763, 1187, 860,
+      729, 811, 729, 728, 769, 1179, 1179, 1179,
+      1371, 1203, 1174, 1173, 1195, 1174, 1016, 1173,
+      1172, 1172, 1187, 1174, 1016, 1173, 1015, 1009,
+      1172, 1171, 1171, 1171, 1179, 1366, 1366, 1365,
+      1366, 1365, 1364, 1366, 1365, 1364, 1363, 1398,
+      1206, 1198, 1390, 1397, 1128, 876, 1100, 1389,
+      1205, 869, 820, 1197, 1190, 1072, 1189, 1382,
+      1381, 1396, 1127, 875, 1099, 1388, 1121, 624,
+      568, 1093, 868, 512, 819, 1071, 1065, 1380,
+      1204, 862, 813, 1196, 861, 456, 812, 771,
+      770, 1188, 1182, 1044, 1181, 1043, 1037, 1180,
+      1374, 1373, 1372, 1395, 1126, 874, 1098, 1387,
+      1120, 623, 567, 1092, 867, 511, 818, 1070,
+      1064, 1379, 1115, 618, 562, 1087, 603, 1134,
+      1133, 506, 1133, 1059, 860, 455, 811, 450,
+      1133, 769, 1042, 1036, 1031, 1371, 1203, 855,
+      806, 1195, 854, 400, 805, 764, 763, 1187,
+      853, 399, 804, 394, 1133, 762, 729, 728,
+      727, 1179, 1174, 1016, 1173, 1015, 1009, 1172,
+      1014, 1008, 1003, 1171, 1366, 1365, 1364, 1363,
+      1394, 1202, 873, 1194, 1386, 1202, 848, 799,
+      1194, 866, 757, 817, 1186, 1186, 1378, 1202,
+      848, 799, 1194, 847, 344, 798, 757, 756,
+      1186, 859, 722, 810, 722, 721, 768, 1178,
+      1178, 1178, 1370, 1202, 848, 799, 1194, 847,
+      344, 798, 757, 756, 1186, 846, 343, 797,
+      338, 1133, 755, 722, 721, 720, 1178, 852,
+      694, 803, 694, 693, 761, 694, 693, 692,
+      726, 1170, 1170, 1170, 1170, 1362, 1202, 1166,
+      1165, 1194, 1166, 988, 1165, 1164, 1164, 1186,
+      1166, 988, 1165, 987, 981, 1164, 1163, 1163,
+      1163, 1178, 1166, 988, 1165, 987, 981, 1164,
+      986, 980, 975, 1163, 1162, 1162, 1162, 1162,
+      1170, 1358, 1358, 1357, 1358, 1357, 1356, 1358,
+      1357, 1356, 1355, 1358, 1357, 1356, 1355, 1354,
+      1398, 1206, 1198, 1390, 1397, 1128, 876, 1100,
+      1389, 1205, 869, 820, 1197, 1190, 1072, 1189,
+      1382, 1381, 1396, 1127, 875, 1099, 1388, 1121,
+      624, 568, 1093, 868, 512, 819, 1071, 1065,
+      1380, 1204, 862, 813, 1196, 861, 456, 812,
+      771, 770, 1188, 1182, 1044, 1181, 1043, 1037,
+      1180, 1374, 1373, 1372, 1395, 1126, 874, 1098,
+      1387, 1120, 623, 567, 1092, 867, 511, 818,
+      1070, 1064, 1379, 1115, 618, 562, 1087, 603,
+      1134, 547, 506, 491, 1059, 860, 455, 811,
+      450, 435, 769, 1042, 1036, 1031, 1371, 1203,
+      855, 806, 1195, 854, 400, 805, 764, 763,
+      1187, 853, 399, 804, 394, 379, 762, 729,
+      728, 727, 1179, 1174, 1016, 1173, 1015, 1009,
+      1172, 1014, 1008, 1003, 1171, 1366, 1365, 1364,
+      1363, 1394, 1125, 873, 1097, 1386, 1119, 622,
+      566, 1091, 866, 510, 817, 1069, 1063, 1378,
+      1114, 617, 561, 1086, 602, 120, 546, 505,
+      490, 1058, 859, 454, 810, 449, 434, 768,
+      1041, 1035, 1030, 1370, 1110, 613, 557, 1082,
+      598, 116, 542, 501, 486, 1054, 588, 106,
+      532, 1132, 1133, 1132, 445, 430, 1132, 1026,
+      852, 398, 803, 393, 378, 761, 389, 374,
+      1132, 726, 1013, 1007, 1002, 998, 1362, 1202,
+      848, 799, 1194, 847, 344, 798, 757, 756,
+      1186, 846, 343, 797, 338, 323, 755, 722,
+      721, 720, 1178, 845, 342, 796, 337, 322,
+      754, 333, 318, 1132, 719, 694, 693, 692,
+      691, 1170, 1166, 988, 1165, 987, 981, 1164,
+      986, 980, 975, 1163, 985, 979, 974, 970,
+      1162, 1358, 1357, 1356, 1355, 1354, 1393, 1201,
+      872, 1193, 1385, 1201, 841, 792, 1193, 865,
+      750, 816, 1185, 1185, 1377, 1201, 841, 792,
+      1193, 840, 288, 791, 750, 749, 1185, 858,
+      715, 809, 715, 714, 767, 1177, 1177, 1177,
+      1369, 1201, 841, 792, 1193, 840, 288, 791,
+      750, 749, 1185, 839, 287, 790, 282, 267,
+      748, 715, 714, 713, 1177, 851, 687, 802,
+      687, 686, 760, 687, 686, 685, 725, 1169,
+      1169, 1169, 1169, 1361, 1201, 841, 792, 1193,
+      840, 288, 791, 750, 749, 1185, 839, 287,
+      790, 282, 267, 748, 715, 714, 713, 1177,
+      838, 286, 789, 281, 266, 747, 277, 262,
+      1132, 712, 687, 686, 685, 684, 1169, 844,
+      666, 795, 666, 665, 753, 666, 665, 664,
+      718, 666, 665, 664, 663, 690, 1161, 1161,
+      1161, 1161, 1161, 1353, 1201, 1158, 1157, 1193,
+      1158, 960, 1157, 1156, 1156, 1185, 1158, 960,
+      1157, 959, 953, 1156, 1155, 1155, 1155, 1177,
+      1158, 960, 1157, 959, 953, 1156, 958, 952,
+      947, 1155, 1154, 1154, 1154, 1154, 1169, 1158,
+      960, 1157, 959, 953, 1156, 958, 952, 947,
+      1155, 957, 951, 946, 942, 1154, 1153, 1153,
+      1153, 1153, 1153, 1161, 1350, 1350, 1349, 1350,
+      1349, 1348, 1350, 1349, 1348, 1347, 1350, 1349,
+      1348, 1347, 1346, 1350, 1349, 1348, 1347, 1346,
+      1345, 1398, 1206, 1198, 1390, 1397, 1128, 876,
+      1100, 1389, 1205, 869, 820, 1197, 1190, 1072,
+      1189, 1382, 1381, 1396, 1127, 875, 1099, 1388,
+      1121, 624, 568, 1093, 868, 512, 819, 1071,
+      1065, 1380, 1204, 862, 813, 1196, 861, 456,
+      812, 771, 770, 1188, 1182, 1044, 1181, 1043,
+      1037, 1180, 1374, 1373, 1372, 1395, 1126, 874,
+      1098, 1387, 1120, 623, 567, 1092, 867, 511,
+      818, 1070, 1064, 1379, 1115, 618, 562, 1087,
+      603, 1134, 547, 506, 491, 1059, 860, 455,
+      811, 450, 435, 769, 1042, 1036, 1031, 1371,
+      1203, 855, 806, 1195, 854, 400, 805, 764,
+      763, 1187, 853, 399, 804, 394, 379, 762,
+      729, 728, 727, 1179, 1174, 1016, 1173, 1015,
+      1009, 1172, 1014, 1008, 1003, 1171, 1366, 1365,
+      1364, 1363, 1394, 1125, 873, 1097, 1386, 1119,
+      622, 566, 1091, 866, 510, 817, 1069, 1063,
+      1378, 1114, 617, 561, 1086, 602, 120, 546,
+      505, 490, 1058, 859, 454, 810, 449, 434,
+      768, 1041, 1035, 1030, 1370, 1110, 613, 557,
+      1082, 598, 116, 542, 501, 486, 1054, 588,
+      106, 532, 86, 1133, 476, 445, 430, 420,
+      1026, 852, 398, 803, 393, 378, 761, 389,
+      374, 364, 726, 1013, 1007, 1002, 998, 1362,
+      1202, 848, 799, 1194, 847, 344, 798, 757,
+      756, 1186, 846, 343, 797, 338, 323, 755,
+      722, 721, 720, 1178, 845, 342, 796, 337,
+      322, 754, 333, 318, 308, 719, 694, 693,
+      692, 691, 1170, 1166, 988, 1165, 987, 981,
+      1164, 986, 980, 975, 1163, 985, 979, 974,
+      970, 1162, 1358, 1357, 1356, 1355, 1354, 1393,
+      1124, 872, 1096, 1385, 1118, 621, 565, 1090,
+      865, 509, 816, 1068, 1062, 1377, 1113, 616,
+      560, 1085, 601, 119, 545, 504, 489, 1057,
+      858, 453, 809, 448, 433, 767, 1040, 1034,
+      1029, 1369, 1109, 612, 556, 1081, 597, 115,
+      541, 500, 485, 1053, 587, 105, 531, 85,
+      52, 475, 444, 429, 419, 1025, 851, 397,
+      802, 392, 377, 760, 388, 373, 363, 725,
+      1012, 1006, 1001, 997, 1361, 1106, 609, 553,
+      1078, 594, 112, 538, 497, 482, 1050, 584,
+      102, 528, 82, 49, 472, 441, 426, 416,
+      1022, 578, 96, 522, 76, 43, 466, 1131,
+      1131, 1132, 1131, 385, 370, 360, 1131, 994,
+      844, 341, 795, 336, 321, 753, 332, 317,
+      307, 718, 329, 314, 304, 1131, 690, 984,
+      978, 973, 969, 966, 1353, 1201, 841, 792,
+      1193, 840, 288, 791, 750, 749, 1185, 839,
+      287, 790, 282, 267, 748, 715, 714, 713,
+      1177, 838, 286, 789, 281, 266, 747, 277,
+      262, 252, 712, 687, 686, 685, 684, 1169,
+      837, 285, 788, 280, 265, 746, 276, 261,
+      251, 711, 273, 258, 248, 1131, 683, 666,
+      665, 664, 663, 662, 1161, 1158, 960, 1157,
+      959, 953, 1156, 958, 952, 947, 1155, 957,
+      951, 946, 942, 1154, 956, 950, 945, 941,
+      938, 1153, 1350, 1349, 1348, 1347, 1346, 1345,
+      1392, 1200, 871, 1192, 1384, 1200, 834, 785,
+      1192, 864, 743, 815, 1184, 1184, 1376, 1200,
+      834, 785, 1192, 833, 232, 784, 743, 742,
+      1184, 857, 708, 808, 708, 707, 766, 1176,
+      1176, 1176, 1368, 1200, 834, 785, 1192, 833,
+      232, 784, 743, 742, 1184, 832, 231, 783,
+      226, 211, 741, 708, 707, 706, 1176, 850,
+      680, 801, 680, 679, 759, 680, 679, 678,
+      724, 1168, 1168, 1168, 1168, 1360, 1200, 834,
+      785, 1192, 833, 232, 784, 743, 742, 1184,
+      832, 231, 783, 226, 211, 741, 708, 707,
+      706, 1176, 831, 230, 782, 225, 210, 740,
+      221, 206, 196, 705, 680, 679, 678, 677,
+      1168, 843, 659, 794, 659, 658, 752, 659,
+      658, 657, 717, 659, 658, 657, 656, 689,
+      1160, 1160, 1160, 1160, 1160, 1352, 1200, 834,
+      785, 1192, 833, 232, 784, 743, 742, 1184,
+      832, 231, 783, 226, 211, 741, 708, 707,
+      706, 1176, 831, 230, 782, 225, 210, 740,
+      221, 206, 196, 705, 680, 679, 678, 677,
+      1168, 830, 229, 781, 224, 209, 739, 220,
+      205, 195, 704, 217, 202, 192, 1131, 676,
+      659, 658, 657, 656, 655, 1160, 836, 645,
+      787, 645, 644, 745, 645, 644, 643, 710,
+      645, 644, 643, 642, 682, 645, 644, 643,
+      642, 641, 661, 1152, 1152, 1152, 1152, 1152,
+      1152, 1344, 1200, 1150, 1149, 1192, 1150, 932,
+      1149, 1148, 1148, 1184, 1150, 932, 1149, 931,
+      925, 1148, 1147, 1147, 1147, 1176, 1150, 932,
+      1149, 931, 925, 1148, 930, 924, 919, 1147,
+      1146, 1146, 1146, 1146, 1168, 1150, 932, 1149,
+      931, 925, 1148, 930, 924, 919, 1147, 929,
+      923, 918, 914, 1146, 1145, 1145, 1145, 1145,
+      1145, 1160, 1150, 932, 1149, 931, 925, 1148,
+      930, 924, 919, 1147, 929, 923, 918, 914,
+      1146, 928, 922, 917, 913, 910, 1145, 1144,
+      1144, 1144, 1144, 1144, 1144, 1152, 1342, 1342,
+      1341, 1342, 1341, 1340, 1342, 1341, 1340, 1339,
+      1342, 1341, 1340, 1339, 1338, 1342, 1341, 1340,
+      1339, 1338, 1337, 1342, 1341, 1340, 1339, 1338,
+      1337, 1336, 1398, 1206, 1198, 1390, 1397, 1128,
+      876, 1100, 1389, 1205, 869, 820, 1197, 1190,
+      1072, 1189, 1382, 1381, 1396, 1127, 875, 1099,
+      1388, 1121, 624, 568, 1093, 868, 512, 819,
+      1071, 1065, 1380, 1204, 862, 813, 1196, 861,
+      456, 812, 771, 770, 1188, 1182, 1044, 1181,
+      1043, 1037, 1180, 1374, 1373, 1372, 1395, 1126,
+      874, 1098, 1387, 1120, 623, 567, 1092, 867,
+      511, 818, 1070, 1064, 1379, 1115, 618, 562,
+      1087, 603, 1134, 547, 506, 491, 1059, 860,
+      455, 811, 450, 435, 769, 1042, 1036, 1031,
+      1371, 1203, 855, 806, 1195, 854, 400, 805,
+      764, 763, 1187, 853, 399, 804, 394, 379,
+      762, 729, 728, 727, 1179, 1174, 1016, 1173,
+      1015, 1009, 1172, 1014, 1008, 1003, 1171, 1366,
+      1365, 1364, 1363, 1394, 1125, 873, 1097, 1386,
+      1119, 622, 566, 1091, 866, 510, 817, 1069,
+      1063, 1378, 1114, 617, 561, 1086, 602, 120,
+      546, 505, 490, 1058, 859, 454, 810, 449,
+      434, 768, 1041, 1035, 1030, 1370, 1110, 613,
+      557, 1082, 598, 116, 542, 501, 486, 1054,
+      588, 106, 532, 86, 1133, 476, 445, 430,
+      420, 1026, 852, 398, 803, 393, 378, 761,
+      389, 374, 364, 726, 1013, 1007, 1002, 998,
+      1362, 1202, 848, 799, 1194, 847, 344, 798,
+      757, 756, 1186, 846, 343, 797, 338, 323,
+      755, 722, 721, 720, 1178, 845, 342, 796,
+      337, 322, 754, 333, 318, 308, 719, 694,
+      693, 692, 691, 1170, 1166, 988, 1165, 987,
+      981, 1164, 986, 980, 975, 1163, 985, 979,
+      974, 970, 1162, 1358, 1357, 1356, 1355, 1354,
+      1393, 1124, 872, 1096, 1385, 1118, 621, 565,
+      1090, 865, 509, 816, 1068, 1062, 1377, 1113,
+      616, 560, 1085, 601, 119, 545, 504, 489,
+      1057, 858, 453, 809, 448, 433, 767, 1040,
+      1034, 1029, 1369, 1109, 612, 556, 1081, 597,
+      115, 541, 500, 485, 1053, 587, 105, 531,
+      85, 52, 475, 444, 429, 419, 1025, 851,
+      397, 802, 392, 377, 760, 388, 373, 363,
+      725, 1012, 1006, 1001, 997, 1361, 1106, 609,
+      553, 1078, 594, 112, 538, 497, 482, 1050,
+      584, 102, 528, 82, 49, 472, 441, 426,
+      416, 1022, 578, 96, 522, 76, 43, 466,
+      66, 33, 1132, 410, 385, 370, 360, 354,
+      994, 844, 341, 795, 336, 321, 753, 332,
+      317, 307, 718, 329, 314, 304, 298, 690,
+      984, 978, 973, 969, 966, 1353, 1201, 841,
+      792, 1193, 840, 288, 791, 750, 749, 1185,
+      839, 287, 790, 282, 267, 748, 715, 714,
+      713, 1177, 838, 286, 789, 281, 266, 747,
+      277, 262, 252, 712, 687, 686, 685, 684,
+      1169, 837, 285, 788, 280, 265, 746, 276,
+      261, 251, 711, 273, 258, 248, 242, 683,
+      666, 665, 664, 663, 662, 1161, 1158, 960,
+      1157, 959, 953, 1156, 958, 952, 947, 1155,
+      957, 951, 946, 942, 1154, 956, 950, 945,
+      941, 938, 1153, 1350, 1349, 1348, 1347, 1346,
+      1345, 1392, 1123, 871, 1095, 1384, 1117, 620,
+      564, 1089, 864, 508, 815, 1067, 1061, 1376,
+      1112, 615, 559, 1084, 600, 118, 544, 503,
+      488, 1056, 857, 452, 808, 447, 432, 766,
+      1039, 1033, 1028, 1368, 1108, 611, 555, 1080,
+      596, 114, 540, 499, 484, 1052, 586, 104,
+      530, 84, 51, 474, 443, 428, 418, 1024,
+      850, 396, 801, 391, 376, 759, 387, 372,
+      362, 724, 1011, 1005, 1000, 996, 1360, 1105,
+      608, 552, 1077, 593, 111, 537, 496, 481,
+      1049, 583, 101, 527, 81, 48, 471, 440,
+      425, 415, 1021, 577, 95, 521, 75, 42,
+      465, 65, 32, 18, 409, 384, 369, 359,
+      353, 993, 843, 340, 794, 335, 320, 752,
+      331, 316, 306, 717, 328, 313, 303, 297,
+      689, 983, 977, 972, 968, 965, 1352, 1103,
+      606, 550, 1075, 591, 109, 535, 494, 479,
+      1047, 581, 99, 525, 79, 46, 469, 438,
+      423, 413, 1019, 575, 93, 519, 73, 40,
+      463, 63, 30, 16, 407, 382, 367, 357,
+      351, 991, 1129, 1129, 516, 1129, 37, 460,
+      1129, 27, 13, 404, 1130, 1130, 1130, 1131,
+      1130, 1129, 311, 301, 295, 1130, 963, 836,
+      284, 787, 279, 264, 745, 275, 260, 250,
+      710, 272, 257, 247, 241, 682, 1129, 255,
+      245, 239, 1130, 661, 955, 949, 944, 940,
+      937, 935, 1344, 1200, 834, 785, 1192, 833,
+      232, 784, 743, 742, 1184, 832, 231, 783,
+      226, 211, 741, 708, 707, 706, 1176, 831,
+      230, 782, 225, 210, 740, 221, 206, 196,
+      705, 680, 679, 678, 677, 1168, 830, 229,
+      781, 224, 209, 739, 220, 205, 195, 704,
+      217, 202, 192, 186, 676, 659, 658, 657,
+      656, 655, 1160, 829, 228, 780, 223, 208,
+      738, 219, 204, 194, 703, 216, 201, 191,
+      185, 675, 1129, 199, 189, 183, 1130, 654,
+      645, 644, 643, 642, 641, 640, 1152, 1150,
+      932, 1149, 931, 925, 1148, 930, 924, 919,
+      1147, 929, 923, 918, 914, 1146, 928, 922,
+      917, 913, 910, 1145, 927, 921, 916, 912,
+      909, 907, 1144, 1342, 1341, 1340, 1339, 1338,
+      1337, 1336, 1391, 1199, 870, 1191, 1383, 1199,
+      827, 778, 1191, 863, 736, 814, 1183, 1183,
+      1375, 1199, 827, 778, 1191, 826, 176, 777,
+      736, 735, 1183, 856, 701, 807, 701, 700,
+      765, 1175, 1175, 1175, 1367, 1199, 827, 778,
+      1191, 826, 176, 777, 736, 735, 1183, 825,
+      175, 776, 170, 155, 734, 701, 700, 699,
+      1175, 849, 673, 800, 673, 672, 758, 673,
+      672, 671, 723, 1167, 1167, 1167, 1167, 1359,
+      1199, 827, 778, 1191, 826, 176, 777, 736,
+      735, 1183, 825, 175, 776, 170, 155, 734,
+      701, 700, 699, 1175, 824, 174, 775, 169,
+      154, 733, 165, 150, 140, 698, 673, 672,
+      671, 670, 1167, 842, 652, 793, 652, 651,
+      751, 652, 651, 650, 716, 652, 651, 650,
+      649, 688, 1159, 1159, 1159, 1159, 1159, 1351,
+      1199, 827, 778, 1191, 826, 176, 777, 736,
+      735, 1183, 825, 175, 776, 170, 155, 734,
+      701, 700, 699, 1175, 824, 174, 775, 169,
+      154, 733, 165, 150, 140, 698, 673, 672,
+      671, 670, 1167, 823, 173, 774, 168, 153,
+      732, 164, 149, 139, 697, 161, 146, 136,
+      130, 669, 652, 651, 650, 649, 648, 1159,
+      835, 638, 786, 638, 637, 744, 638, 637,
+      636, 709, 638, 637, 636, 635, 681, 638,
+      637, 636, 635, 634, 660, 1151, 1151, 1151,
+      1151, 1151, 1151, 1343, 1199, 827, 778, 1191,
+      826, 176, 777, 736, 735, 1183, 825, 175,
+      776, 170, 155, 734, 701, 700, 699, 1175,
+      824, 174, 775, 169, 154, 733, 165, 150,
+      140, 698, 673, 672, 671, 670, 1167, 823,
+      173, 774, 168, 153, 732, 164, 149, 139,
+      697, 161, 146, 136, 130, 669, 652, 651,
+      650, 649, 648, 1159, 822, 172, 773, 167,
+      152, 731, 163, 148, 138, 696, 160, 145,
+      135, 129, 668, 1129, 143, 133, 127, 1130,
+      647, 638, 637, 636, 635, 634, 633, 1151,
+      828, 631, 779, 631, 630, 737, 631, 630,
+      629, 702, 631, 630, 629, 628, 674, 631,
+      630, 629, 628, 627, 653, 631, 630, 629,
+      628, 627, 626, 639, 1143, 1143, 1143, 1143,
+      1143, 1143, 1143, 1335, 1199, 1142, 1141, 1191,
+      1142, 904, 1141, 1140, 1140, 1183, 1142, 904,
+      1141, 903, 897, 1140, 1139, 1139, 1139, 1175,
+      1142, 904, 1141, 903, 897, 1140, 902, 896,
+      891, 1139, 1138, 1138, 1138, 1138, 1167, 1142,
+      904, 1141, 903, 897, 1140, 902, 896, 891,
+      1139, 901, 895, 890, 886, 1138, 1137, 1137,
+      1137, 1137, 1137, 1159, 1142, 904, 1141, 903,
+      897, 1140, 902, 896, 891, 1139, 901, 895,
+      890, 886, 1138, 900, 894, 889, 885, 882,
+      1137, 1136, 1136, 1136, 1136, 1136, 1136, 1151,
+      1142, 904, 1141, 903, 897, 1140, 902, 896,
+      891, 1139, 901, 895, 890, 886, 1138, 900,
+      894, 889, 885, 882, 1137, 899, 893, 888,
+      884, 881, 879, 1136, 1135, 1135, 1135, 1135,
+      1135, 1135, 1135, 1143, 1334, 1334, 1333, 1334,
+      1333, 1332, 1334, 1333, 1332, 1331, 1334, 1333,
+      1332, 1331, 1330, 1334, 1333, 1332, 1331, 1330,
+      1329, 1334, 1333, 1332, 1331, 1330, 1329, 1328,
+      1334, 1333, 1332, 1331, 1330, 1329, 1328, 1327,
+      1398, 1390, 1398, 1206, 1390, 1398, 1206, 1198,
+      1390, 1397, 1205, 1190, 1197, 1389, 1382, 1382,
+      1382, 1381, 1398, 1206, 1390, 1398, 1206, 1198,
+      1390, 1397, 1205, 876, 1197, 1389, 1205, 1190,
+      1189, 1197, 1382, 1382, 1381, 1398, 1206, 1198,
+      1390, 1397, 1204, 876, 1196, 1389, 1205, 869,
+      820, 1197, 1190, 1188, 1189, 1382, 1381, 1396,
+      1204, 1182, 1196, 1388, 1204, 1182, 1181, 1196,
+      1182, 1180, 1181, 1188, 1188, 1380, 1374, 1374,
+      1374, 1373, 1374, 1374, 1373, 1374, 1373, 1372,
+      1398, 1206, 1390, 1398, 1206, 1198, 1390, 1397,
+      1205, 876, 1197, 1389, 1205, 1190, 1189, 1197,
+      1382, 1382, 1381, 1398, 1206, 1198, 1390, 1397,
+      1134, 1134, 1134, 1389, 1205, 1134, 1134, 1197,
+      1190, 1134, 1189, 1382, 1381, 1396, 1204, 875,
+      1196, 1388, 1204, 1134, 1134, 1196, 868, 1134,
+      819, 1188, 1188, 1380, 1204, 1182, 1181, 1196,
+      1182, 1134, 1181, 1180, 1180, 1188, 1374, 1374,
+      1373, 1374, 1373, 1372, 1398, 1206, 1198, 1390,
+      1397, 1203, 876, 1195, 1389, 1205, 869, 820,
+      1197, 1190, 1187, 1189, 1382, 1381, 1396, 1203,
+      875, 1195, 1388, 1203, 1134, 1134, 1195, 868,
+      1134, 819, 1187, 1187, 1380, 1204, 862, 813,
+      1196, 861, 1134, 812, 771, 770, 1188, 1182,
+      1179, 1181, 1179, 1179, 1180, 1374, 1373, 1372,
+      1395, 1203, 1174, 1195, 1387, 1203, 1174, 1173,
+      1195, 1174, 1172, 1173, 1187, 1187, 1379, 1203,
+      1174, 1173, 1195, 1174, 1134, 1173, 1172, 1172,
+      1187, 1174, 1171, 1173, 1171, 1171, 1172, 1179,
+      1179, 1179, 1371, 1366, 1366, 1366, 1365, 1366,
+      1366, 1365, 1366, 1365, 1364, 1366, 1366, 1365,
+      1366, 1365, 1364, 1366, 1365, 1364, 1363, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      876, 1197, 1389, 1205, 1190, 1189, 1197, 1382,
+      1382, 1381, 1398, 1206, 1198, 1390, 1397, 1128,
+      876, 1100, 1389, 1205, 869, 820, 1197, 1190,
+      1072, 1189, 1382, 1381, 1396, 1204, 875, 1196,
+      1388, 1204, 862, 813, 1196, 868, 771, 819,
+      1188, 1188, 1380, 1204, 1182, 1181, 1196, 1182,
+      1044, 1181, 1180, 1180, 1188, 1374, 1374, 1373,
+      1374, 1373, 1372, 1398, 1206, 1198, 1390, 1397,
+      1128, 876, 1100, 1389, 1205, 869, 820, 1197,
+      1190, 1072, 1189, 1382, 1381, 1396, 1127, 875,
+      1099, 1388, 1121, 1134, 1134, 1133, 868, 1134,
+      1133, 1071, 1133, 1380, 1204, 862, 813, 1196,
+      861, 1134, 1133, 771, 1133, 1188, 1182, 1044,
+      1181, 1043, 1133, 1180, 1374, 1373, 1372, 1395,
+      1203, 874, 1195, 1387, 1203, 855, 806, 1195,
+      867, 764, 818, 1187, 1187, 1379, 1203, 855,
+      806, 1195, 854, 1134, 1133, 764, 1133, 1187,
+      860, 729, 811, 729, 1133, 769, 1179, 1179,
+      1179, 1371, 1203, 1174, 1173, 1195, 1174, 1016,
+      1173, 1172, 1172, 1187, 1174, 1016, 1173, 1015,
+      1133, 1172, 1171, 1171, 1171, 1179, 1366, 1366,
+      1365, 1366, 1365, 1364, 1366, 1365, 1364, 1363,
+      1398, 1206, 1198, 1390, 1397, 1202, 876, 1194,
+      1389, 1205, 869, 820, 1197, 1190, 1186, 1189,
+      1382, 1381, 1396, 1202, 875, 1194, 1388, 1202,
+      848, 799, 1194, 868, 757, 819, 1186, 1186,
+      1380, 1204, 862, 813, 1196, 861, 722, 812,
+      771, 770, 1188, 1182, 1178, 1181, 1178, 1178,
+      1180, 1374, 1373, 1372, 1395, 1202, 874, 1194,
+      1387, 1202, 848, 799, 1194, 867, 757, 818,
+      1186, 1186, 1379, 1202, 848, 799, 1194, 847,
+      1134, 1133, 757, 1133, 1186, 860, 722, 811,
+      722, 1133, 769, 1178, 1178, 1178, 1371, 1203,
+      855, 806, 1195, 854, 694, 805, 764, 763,
+      1187, 853, 694, 804, 694, 1133, 762, 729,
+      728, 727, 1179, 1174, 1170, 1173, 1170, 1170,
+      1172, 1170, 1170, 1170, 1171, 1366, 1365, 1364,
+      1363, 1394, 1202, 1166, 1194, 1386, 1202, 1166,
+      1165, 1194, 1166, 1164, 1165, 1186, 1186, 1378,
+      1202, 1166, 1165, 1194, 1166, 988, 1165, 1164,
+      1164, 1186, 1166, 1163, 1165, 1163, 1163, 1164,
+      1178, 1178, 1178, 1370, 1202, 1166, 1165, 1194,
+      1166, 988, 1165, 1164, 1164, 1186, 1166, 988,
+      1165, 987, 1133, 1164, 1163, 1163, 1163, 1178,
+      1166, 1162, 1165, 1162, 1162, 1164, 1162, 1162,
+      1162, 1163, 1170, 1170, 1170, 1170, 1362, 1358,
+      1358, 1358, 1357, 1358, 1358, 1357, 1358, 1357,
+      1356, 1358, 1358, 1357, 1358, 1357, 1356, 1358,
+      1357, 1356, 1355, 1358, 1358, 1357, 1358, 1357,
+      1356, 1358, 1357, 1356, 1355, 1358, 1357, 1356,
+      1355, 1354, 1398, 1206, 1390, 1398, 1206, 1198,
+      1390, 1397, 1205, 876, 1197, 1389, 1205, 1190,
+      1189, 1197, 1382, 1382, 1381, 1398, 1206, 1198,
+      1390, 1397, 1128, 876, 1100, 1389, 1205, 869,
+      820, 1197, 1190, 1072, 1189, 1382, 1381, 1396,
+      1204, 875, 1196, 1388, 1204, 862, 813, 1196,
+      868, 771, 819, 1188, 1188, 1380, 1204, 1182,
+      1181, 1196, 1182, 1044, 1181, 1180, 1180, 1188,
+      1374, 1374, 1373, 1374, 1373, 1372, 1398, 1206,
+      1198, 1390, 1397, 1128, 876, 1100, 1389, 1205,
+      869, 820, 1197, 1190, 1072, 1189, 1382, 1381,
+      1396, 1127, 875, 1099, 1388, 1121, 1134, 1134,
+      1093, 868, 1134, 819, 1071, 1065, 1380, 1204,
+      862, 813, 1196, 861, 1134, 812, 771, 770,
+      1188, 1182, 1044, 1181, 1043, 1037, 1180, 1374,
+      1373, 1372, 1395, 1203, 874, 1195, 1387, 1203,
+      855, 806, 1195, 867, 764, 818, 1187, 1187,
+      1379, 1203, 855, 806, 1195, 854, 1134, 805,
+      764, 763, 1187, 860, 729, 811, 729, 728,
+      769, 1179, 1179, 1179, 1371, 1203, 1174, 1173,
+      1195, 1174, 1016, 1173, 1172, 1172, 1187, 1174,
+      1016, 1173, 1015, 1009, 1172, 1171, 1171, 1171,
+      1179, 1366, 1366, 1365, 1366, 1365, 1364, 1366,
+      1365, 1364, 1363, 1398, 1206, 1198, 1390, 1397,
+      1128, 876, 1100, 1389, 1205, 869, 820, 1197,
+      1190, 1072, 1189, 1382, 1381, 1396, 1127, 875,
+      1099, 1388, 1121, 624, 568, 1093, 868, 512,
+      819, 1071, 1065, 1380, 1204, 862, 813, 1196,
+      861, 456, 812, 771, 770, 1188, 1182, 1044,
+      1181, 1043, 1037, 1180, 1374, 1373, 1372, 1395,
+      1126, 874, 1098, 1387, 1120, 623, 567, 1092,
+      867, 511, 818, 1070, 1064, 1379, 1115, 618,
+      562, 1087, 1132, 1134, 1133, 1132, 1133, 1132,
+      860, 455, 811, 1132, 1133, 1132, 1042, 1036,
+      1132, 1371, 1203, 855, 806, 1195, 854, 400,
+      805, 764, 763, 1187, 853, 399, 804, 1132,
+      1133, 1132, 729, 728, 1132, 1179, 1174, 1016,
+      1173, 1015, 1009, 1172, 1014, 1008, 1132, 1171,
+      1366, 1365, 1364, 1363, 1394, 1202, 873, 1194,
+      1386, 1202, 848, 799, 1194, 866, 757, 817,
+      1186, 1186, 1378, 1202, 848, 799, 1194, 847,
+      344, 798, 757, 756, 1186, 859, 722, 810,
+      722, 721, 768, 1178, 1178, 1178, 1370, 1202,
+      848, 799, 1194, 847, 344, 798, 757, 756,
+      1186, 846, 343, 797, 1132, 1133, 1132, 722,
+      721, 1132, 1178, 852, 694, 803, 694, 693,
+      761, 694, 693, 1132, 726, 1170, 1170, 1170,
+      1170, 1362, 1202, 1166, 1165, 1194, 1166, 988,
+      1165, 1164, 1164, 1186, 1166, 988, 1165, 987,
+      981, 1164, 1163, 1163, 1163, 1178, 1166, 988,
+      1165, 987, 981, 1164, 986, 980, 1132, 1163,
+      1162, 1162, 1162, 1162, 1170, 1358, 1358, 1357,
+      1358, 1357, 1356, 1358, 1357, 1356, 1355, 1358,
+      1357, 1356, 1355, 1354, 1398, 1206, 1198, 1390,
+      1397, 1201, 876, 1193, 1389, 1205, 869, 820,
+      1197, 1190, 1185, 1189, 1382, 1381, 1396, 1201,
+      875, 1193, 1388, 1201, 841, 792, 1193, 868,
+      750, 819, 1185, 1185, 1380, 1204, 862, 813,
+      1196, 861, 715, 812, 771, 770, 1188, 1182,
+      1177, 1181, 1177, 1177, 1180, 1374, 1373, 1372,
+      1395, 1201, 874, 1193, 1387, 1201, 841, 792,
+      1193, 867, 750, 818, 1185, 1185, 1379, 1201,
+      841, 792, 1193, 840, 1134, 791, 750, 749,
+      1185, 860, 715, 811, 715, 714, 769, 1177,
+      1177, 1177, 1371, 1203, 855, 806, 1195, 854,
+      687, 805, 764, 763, 1187, 853, 687, 804,
+      687, 686, 762, 729, 728, 727, 1179, 1174,
+      1169, 1173, 1169, 1169, 1172, 1169, 1169, 1169,
+      1171, 1366, 1365, 1364, 1363, 1394, 1201, 873,
+      1193, 1386, 1201, 841, 792, 1193, 866, 750,
+      817, 1185, 1185, 1378, 1201, 841, 792, 1193,
+      840, 288, 791, 750, 749, 1185, 859, 715,
+      810, 715, 714, 768, 1177, 1177, 1177, 1370,
+      1201, 841, 792, 1193, 840, 288, 791, 750,
+      749, 1185, 839, 287, 790, 1132, 1133, 1132,
+      715, 714, 1132, 1177, 852, 687, 803, 687,
+      686, 761, 687, 686, 1132, 726, 1169, 1169,
+      1169, 1169, 1362, 1202, 848, 799, 1194, 847,
+      666, 798, 757, 756, 1186, 846, 666, 797,
+      666, 665, 755, 722, 721, 720, 1178, 845,
+      666, 796, 666, 665, 754, 666, 665, 1132,
+      719, 694, 693, 692, 691, 1170, 1166, 1161,
+      1165, 1161, 1161, 1164, 1161, 1161, 1161, 1163,
+      1161, 1161, 1161, 1161, 1162, 1358, 1357, 1356,
+      1355, 1354, 1393, 1201, 1158, 1193, 1385, 1201,
+      1158, 1157, 1193, 1158, 1156, 1157, 1185, 1185,
+      1377, 1201, 1158, 1157, 1193, 1158, 960, 1157,
+      1156, 1156, 1185, 1158, 1155, 1157, 1155, 1155,
+      1156, 1177, 1177, 1177, 1369, 1201, 1158, 1157,
+      1193, 1158, 960, 1157, 1156, 1156, 1185, 1158,
+      960, 1157, 959, 953, 1156, 1155, 1155, 1155,
+      1177, 1158, 1154, 1157, 1154, 1154, 1156, 1154,
+      1154, 1154, 1155, 1169, 1169, 1169, 1169, 1361,
+      1201, 1158, 1157, 1193, 1158, 960, 1157, 1156,
+      1156, 1185, 1158, 960, 1157, 959, 953, 1156,
+      1155, 1155, 1155, 1177, 1158, 960, 1157, 959,
+      953, 1156, 958, 952, 1132, 1155, 1154, 1154,
+      1154, 1154, 1169, 1158, 1153, 1157, 1153, 1153,
+      1156, 1153, 1153, 1153, 1155, 1153, 1153, 1153,
+      1153, 1154, 1161, 1161, 1161, 1161, 1161, 1353,
+      1350, 1350, 1350, 1349, 1350, 1350, 1349, 1350,
+      1349, 1348, 1350, 1350, 1349, 1350, 1349, 1348,
+      1350, 1349, 1348, 1347, 1350, 1350, 1349, 1350,
+      1349, 1348, 1350, 1349, 1348, 1347, 1350, 1349,
+      1348, 1347, 1346, 1350, 1350, 1349, 1350, 1349,
+      1348, 1350, 1349, 1348, 1347, 1350, 1349, 1348,
+      1347, 1346, 1350, 1349, 1348, 1347, 1346, 1345,
+      1398, 1206, 1390, 1398, 1206, 1198, 1390, 1397,
+      1205, 876, 1197, 1389, 1205, 1190, 1189, 1197,
+      1382, 1382, 1381, 1398, 1206, 1198, 1390, 1397,
+      1128, 876, 1100, 1389, 1205, 869, 820, 1197,
+      1190, 1072, 1189, 1382, 1381, 1396, 1204, 875,
+      1196, 1388, 1204, 862, 813, 1196, 868, 771,
+      819, 1188, 1188, 1380, 1204, 1182, 1181, 1196,
+      1182, 1044, 1181, 1180, 1180, 1188, 1374, 1374,
+      1373, 1374, 1373, 1372, 1398, 1206, 1198, 1390,
+      1397, 1128, 876, 1100, 1389, 1205, 869, 820,
+      1197, 1190, 1072, 1189, 1382, 1381, 1396, 1127,
+      875, 1099, 1388, 1121, 1134, 1134, 1093, 868,
+      1134, 819, 1071, 1065, 1380, 1204, 862, 813,
+      1196, 861, 1134, 812, 771, 770, 1188, 1182,
+      1044, 1181, 1043, 1037, 1180, 1374, 1373, 1372,
+      1395, 1203, 874, 1195, 1387, 1203, 855, 806,
+      1195, 867, 764, 818, 1187, 1187, 1379, 1203,
+      855, 806, 1195, 854, 1134, 805, 764, 763,
+      1187, 860, 729, 811, 729, 728, 769, 1179,
+      1179, 1179, 1371, 1203, 1174, 1173, 1195, 1174,
+      1016, 1173, 1172, 1172, 1187, 1174, 1016, 1173,
+      1015, 1009, 1172, 1171, 1171, 1171, 1179, 1366,
+      1366, 1365, 1366, 1365, 1364, 1366, 1365, 1364,
+      1363, 1398, 1206, 1198, 1390, 1397, 1128, 876,
+      1100, 1389, 1205, 869, 820, 1197, 1190, 1072,
+      1189, 1382, 1381, 1396, 1127, 875, 1099, 1388,
+      1121, 624, 568, 1093, 868, 512, 819, 1071,
+      1065, 1380, 1204, 862, 813, 1196, 861, 456,
+      812, 771, 770, 1188, 1182, 1044, 1181, 1043,
+      1037, 1180, 1374, 1373, 1372, 1395, 1126, 874,
+      1098, 1387, 1120, 623, 567, 1092, 867, 511,
+      818, 1070, 1064, 1379, 1115, 618, 562, 1087,
+      603, 1134, 1133, 506, 1133, 1059, 860, 455,
+      811, 450, 1133, 769, 1042, 1036, 1031, 1371,
+      1203, 855, 806, 1195, 854, 400, 805, 764,
+      763, 1187, 853, 399, 804, 394, 1133, 762,
+      729, 728, 727, 1179, 1174, 1016, 1173, 1015,
+      1009, 1172, 1014, 1008, 1003, 1171, 1366, 1365,
+      1364, 1363, 1394, 1202, 873, 1194, 1386, 1202,
+      848, 799, 1194, 866, 757, 817, 1186, 1186,
+      1378, 1202, 848, 799, 1194, 847, 344, 798,
+      757, 756, 1186, 859, 722, 810, 722, 721,
+      768, 1178, 1178, 1178, 1370, 1202, 848, 799,
+      1194, 847, 344, 798, 757, 756, 1186, 846,
+      343, 797, 338, 1133, 755, 722, 721, 720,
+      1178, 852, 694, 803, 694, 693, 761, 694,
+      693, 692, 726, 1170, 1170, 1170, 1170, 1362,
+      1202, 1166, 1165, 1194, 1166, 988, 1165, 1164,
+      1164, 1186, 1166, 988, 1165, 987, 981, 1164,
+      1163, 1163, 1163, 1178, 1166, 988, 1165, 987,
+      981, 1164, 986, 980, 975, 1163, 1162, 1162,
+      1162, 1162, 1170, 1358, 1358, 1357, 1358, 1357,
+      1356, 1358, 1357, 1356, 1355, 1358, 1357, 1356,
+      1355, 1354, 1398, 1206, 1198, 1390, 1397, 1128,
+      876, 1100, 1389, 1205, 869, 820, 1197, 1190,
+      1072, 1189, 1382, 1381, 1396, 1127, 875, 1099,
+      1388, 1121, 624, 568, 1093, 868, 512, 819,
+      1071, 1065, 1380, 1204, 862, 813, 1196, 861,
+      456, 812, 771, 770, 1188, 1182, 1044, 1181,
+      1043, 1037, 1180, 1374, 1373, 1372, 1395, 1126,
+      874, 1098, 1387, 1120, 623, 567, 1092, 867,
+      511, 818, 1070, 1064, 1379, 1115, 618, 562,
+      1087, 603, 1134, 547, 506, 491, 1059, 860,
+      455, 811, 450, 435, 769, 1042, 1036, 1031,
+      1371, 1203, 855, 806, 1195, 854, 400, 805,
+      764, 763, 1187, 853, 399, 804, 394, 379,
+      762, 729, 728, 727, 1179, 1174, 1016, 1173,
+      1015, 1009, 1172, 1014, 1008, 1003, 1171, 1366,
+      1365, 1364, 1363, 1394, 1125, 873, 1097, 1386,
+      1119, 622, 566, 1091, 866, 510, 817, 1069,
+      1063, 1378, 1114, 617, 561, 1086, 602, 120,
+      546, 505, 490, 1058, 859, 454, 810, 449,
+      434, 768, 1041, 1035, 1030, 1370, 1110, 613,
+      557, 1082, 598, 116, 542, 501, 486, 1054,
+      1131, 1131, 1131, 1132, 1133, 1132, 1131, 1131,
+      1132, 1131, 852, 398, 803, 393, 378, 761,
+      1131, 1131, 1132, 1131, 1013, 1007, 1002, 1131,
+      1362, 1202, 848, 799, 1194, 847, 344, 798,
+      757, 756, 1186, 846, 343, 797, 338, 323,
+      755, 722, 721, 720, 1178, 845, 342, 796,
+      337, 322, 754, 1131, 1131, 1132, 1131, 694,
+      693, 692, 1131, 1170, 1166, 988, 1165, 987,
+      981, 1164, 986, 980, 975, 1163, 985, 979,
+      974, 1131, 1162, 1358, 1357, 1356, 1355, 1354,
+      1393, 1201, 872, 1193, 1385, 1201, 841, 792,
+      1193, 865, 750, 816, 1185, 1185, 1377, 1201,
+      841, 792, 1193, 840, 288, 791, 750, 749,
+      1185, 858, 715, 809, 715, 714, 767, 1177,
+      1177, 1177, 1369, 1201, 841, 792, 1193, 840,
+      288, 791, 750, 749, 1185, 839, 287, 790,
+      282, 267, 748, 715, 714, 713, 1177, 851,
+      687, 802, 687, 686, 760, 687, 686, 685,
+      725, 1169, 1169, 1169, 1169, 1361, 1201, 841,
+      792, 1193, 840, 288, 791, 750, 749, 1185,
+      839, 287, 790, 282, 267, 748, 715, 714,
+      713, 1177, 838, 286, 789, 281, 266, 747,
+      1131, 1131, 1132, 1131, 687, 686, 685, 1131,
+      1169, 844, 666, 795, 666, 665, 753, 666,
+      665, 664, 718, 666, 665, 664, 1131, 690,
+      1161, 1161, 1161, 1161, 1161, 1353, 1201, 1158,
+      1157, 1193, 1158, 960, 1157, 1156, 1156, 1185,
+      1158, 960, 1157, 959, 953, 1156, 1155, 1155,
+      1155, 1177, 1158, 960, 1157, 959, 953, 1156,
+      958, 952, 947, 1155, 1154, 1154, 1154, 1154,
+      1169, 1158, 960, 1157, 959, 953, 1156, 958,
+      952, 947, 1155, 957, 951, 946, 1131, 1154,
+      1153, 1153, 1153, 1153, 1153, 1161, 1350, 1350,
+      1349, 1350, 1349, 1348, 1350, 1349, 1348, 1347,
+      1350, 1349, 1348, 1347, 1346, 1350, 1349, 1348,
+      1347, 1346, 1345, 1398, 1206, 1198, 1390, 1397,
+      1200, 876, 1192, 1389, 1205, 869, 820, 1197,
+      1190, 1184, 1189, 1382, 1381, 1396, 1200, 875,
+      1192, 1388, 1200, 834, 785, 1192, 868, 743,
+      819, 1184, 1184, 1380, 1204, 862, 813, 1196,
+      861, 708, 812, 771, 770, 1188, 1182, 1176,
+      1181, 1176, 1176, 1180, 1374, 1373, 1372, 1395,
+      1200, 874, 1192, 1387, 1200, 834, 785, 1192,
+      867, 743, 818, 1184, 1184, 1379, 1200, 834,
+      785, 1192, 833, 1134, 784, 743, 742, 1184,
+      860, 708, 811, 708, 707, 769, 1176, 1176,
+      1176, 1371, 1203, 855, 806, 1195, 854, 680,
+      805, 764, 763, 1187, 853, 680, 804, 680,
+      679, 762, 729, 728, 727, 1179, 1174, 1168,
+      1173, 1168, 1168, 1172, 1168, 1168, 1168, 1171,
+      1366, 1365, 1364, 1363, 1394, 1200, 873, 1192,
+      1386, 1200, 834, 785, 1192, 866, 743, 817,
+      1184, 1184, 1378, 1200, 834, 785, 1192, 833,
+      232, 784, 743, 742, 1184, 859, 708, 810,
+      708, 707, 768, 1176, 1176, 1176, 1370, 1200,
+      834, 785, 1192, 833, 232, 784, 743, 742,
+      1184, 832, 231, 783, 226, 1133, 741, 708,
+      707, 706, 1176, 852, 680, 803, 680, 679,
+      761, 680, 679, 678, 726, 1168, 1168, 1168,
+      1168, 1362, 1202, 848, 799, 1194, 847, 659,
+      798, 757, 756, 1186, 846, 659, 797, 659,
+      658, 755, 722, 721, 720, 1178, 845, 659,
+      796, 659, 658, 754, 659, 658, 657, 719,
+      694, 693, 692, 691, 1170, 1166, 1160, 1165,
+      1160, 1160, 1164, 1160, 1160, 1160, 1163, 1160,
+      1160, 1160, 1160, 1162, 1358, 1357, 1356, 1355,
+      1354, 1393, 1200, 872, 1192, 1385, 1200, 834,
+      785, 1192, 865, 743, 816, 1184, 1184, 1377,
+      1200, 834, 785, 1192, 833, 232, 784, 743,
+      742, 1184, 858, 708, 809, 708, 707, 767,
+      1176, 1176, 1176, 1369, 1200, 834, 785, 1192,
+      833, 232, 784, 743, 742, 1184, 832, 231,
+      783, 226, 211, 741, 708, 707, 706, 1176,
+      851, 680, 802, 680, 679, 760, 680, 679,
+      678, 725, 1168, 1168, 1168, 1168, 1361, 1200,
+      834, 785, 1192, 833, 232, 784, 743, 742,
+      1184, 832, 231, 783, 226, 211, 741, 708,
+      707, 706, 1176, 831, 230, 782, 225, 210,
+      740, 1131, 1131, 1132, 1131, 680, 679, 678,
+      1131, 1168, 844, 659, 795, 659, 658, 753,
+      659, 658, 657, 718, 659, 658, 657, 1131,
+      690, 1160, 1160, 1160, 1160, 1160, 1353, 1201,
+      841, 792, 1193, 840, 645, 791, 750, 749,
+      1185, 839, 645, 790, 645, 644, 748, 715,
+      714, 713, 1177, 838, 645, 789, 645, 644,
+      747, 645, 644, 643, 712, 687, 686, 685,
+      684, 1169, 837, 645, 788, 645, 644, 746,
+      645, 644, 643, 711, 645, 644, 643, 1131,
+      683, 666, 665, 664, 663, 662, 1161, 1158,
+      1152, 1157, 1152, 1152, 1156, 1152, 1152, 1152,
+      1155, 1152, 1152, 1152, 1152, 1154, 1152, 1152,
+      1152, 1152, 1152, 1153, 1350, 1349, 1348, 1347,
+      1346, 1345, 1392, 1200, 1150, 1192, 1384, 1200,
+      1150, 1149, 1192, 1150, 1148, 1149, 1184, 1184,
+      1376, 1200, 1150, 1149, 1192, 1150, 932, 1149,
+      1148, 1148, 1184, 1150, 1147, 1149, 1147, 1147,
+      1148, 1176, 1176, 1176, 1368, 1200, 1150, 1149,
+      1192, 1150, 932, 1149, 1148, 1148, 1184, 1150,
+      932, 1149, 931, 925, 1148, 1147, 1147, 1147,
+      1176, 1150, 1146, 1149, 1146, 1146, 1148, 1146,
+      1146, 1146, 1147, 1168, 1168, 1168, 1168, 1360,
+      1200, 1150, 1149, 1192, 1150, 932, 1149, 1148,
+      1148, 1184, 1150, 932, 1149, 931, 925, 1148,
+      1147, 1147, 1147, 1176, 1150, 932, 1149, 931,
+      925, 1148, 930, 924, 919, 1147, 1146, 1146,
+      1146, 1146, 1168, 1150, 1145, 1149, 1145, 1145,
+      1148, 1145, 1145, 1145, 1147, 1145, 1145, 1145,
+      1145, 1146, 1160, 1160, 1160, 1160, 1160, 1352,
+      1200, 1150, 1149, 1192, 1150, 932, 1149, 1148,
+      1148, 1184, 1150, 932, 1149, 931, 925, 1148,
+      1147, 1147, 1147, 1176, 1150, 932, 1149, 931,
+      925, 1148, 930, 924, 919, 1147, 1146, 1146,
+      1146, 1146, 1168, 1150, 932, 1149, 931, 925,
+      1148, 930, 924, 919, 1147, 929, 923, 918,
+      1131, 1146, 1145, 1145, 1145, 1145, 1145, 1160,
+      1150, 1144, 1149, 1144, 1144, 1148, 1144, 1144,
+      1144, 1147, 1144, 1144, 1144, 1144, 1146, 1144,
+      1144, 1144, 1144, 1144, 1145, 1152, 1152, 1152,
+      1152, 1152, 1152, 1344, 1342, 1342, 1342, 1341,
+      1342, 1342, 1341, 1342, 1341, 1340, 1342, 1342,
+      1341, 1342, 1341, 1340, 1342, 1341, 1340, 1339,
+      1342, 1342, 1341, 1342, 1341, 1340, 1342, 1341,
+      1340, 1339, 1342, 1341, 1340, 1339, 1338, 1342,
+      1342, 1341, 1342, 1341, 1340, 1342, 1341, 1340,
+      1339, 1342, 1341, 1340, 1339, 1338, 1342, 1341,
+      1340, 1339, 1338, 1337, 1342, 1342, 1341, 1342,
+      1341, 1340, 1342, 1341, 1340, 1339, 1342, 1341,
+      1340, 1339, 1338, 1342, 1341, 1340, 1339, 1338,
+      1337, 1342, 1341, 1340, 1339, 1338, 1337, 1336,
+      1398, 1206, 1390, 1398, 1206, 1198, 1390, 1397,
+      1205, 876, 1197, 1389, 1205, 1190, 1189, 1197,
+      1382, 1382, 1381, 1398, 1206, 1198, 1390, 1397,
+      1128, 876, 1100, 1389, 1205, 869, 820, 1197,
+      1190, 1072, 1189, 1382, 1381, 1396, 1204, 875,
+      1196, 1388, 1204, 862, 813, 1196, 868, 771,
+      819, 1188, 1188, 1380, 1204, 1182, 1181, 1196,
+      1182, 1044, 1181, 1180, 1180, 1188, 1374, 1374,
+      1373, 1374, 1373, 1372, 1398, 1206, 1198, 1390,
+      1397, 1128, 876, 1100, 1389, 1205, 869, 820,
+      1197, 1190, 1072, 1189, 1382, 1381, 1396, 1127,
+      875, 1099, 1388, 1121, 1134, 1134, 1093, 868,
+      1134, 819, 1071, 1065, 1380, 1204, 862, 813,
+      1196, 861, 1134, 812, 771, 770, 1188, 1182,
+      1044, 1181, 1043, 1037, 1180, 1374, 1373, 1372,
+      1395, 1203, 874, 1195, 1387, 1203, 855, 806,
+      1195, 867, 764, 818, 1187, 1187, 1379, 1203,
+      855, 806, 1195, 854, 1134, 805, 764, 763,
+      1187, 860, 729, 811, 729, 728, 769, 1179,
+      1179, 1179, 1371, 1203, 1174, 1173, 1195, 1174,
+      1016, 1173, 1172, 1172, 1187, 1174, 1016, 1173,
+      1015, 1009, 1172, 1171, 1171, 1171, 1179, 1366,
+      1366, 1365, 1366, 1365, 1364, 1366, 1365, 1364,
+      1363, 1398, 1206, 1198, 1390, 1397, 1128, 876,
+      1100, 1389, 1205, 869, 820, 1197, 1190, 1072,
+      1189, 1382, 1381, 1396, 1127, 875, 1099, 1388,
+      1121, 624, 568, 1093, 868, 512, 819, 1071,
+      1065, 1380, 1204, 862, 813, 1196, 861, 456,
+      812, 771, 770, 1188, 1182, 1044, 1181, 1043,
+      1037, 1180, 1374, 1373, 1372, 1395, 1126, 874,
+      1098, 1387, 1120, 623, 567, 1092, 867, 511,
+      818, 1070, 1064, 1379, 1115, 618, 562, 1087,
+      603, 1134, 1133, 506, 1133, 1059, 860, 455,
+      811, 450, 1133, 769, 1042, 1036, 1031, 1371,
+      1203, 855, 806, 1195, 854, 400, 805, 764,
+      763, 1187, 853, 399, 804, 394, 1133, 762,
+      729, 728, 727, 1179, 1174, 1016, 1173, 1015,
+      1009, 1172, 1014, 1008, 1003, 1171, 1366, 1365,
+      1364, 1363, 1394, 1202, 873, 1194, 1386, 1202,
+      848, 799, 1194, 866, 757, 817, 1186, 1186,
+      1378, 1202, 848, 799, 1194, 847, 344, 798,
+      757, 756, 1186, 859, 722, 810, 722, 721,
+      768, 1178, 1178, 1178, 1370, 1202, 848, 799,
+      1194, 847, 344, 798, 757, 756, 1186, 846,
+      343, 797, 338, 1133, 755, 722, 721, 720,
+      1178, 852, 694, 803, 694, 693, 761, 694,
+      693, 692, 726, 1170, 1170, 1170, 1170, 1362,
+      1202, 1166, 1165, 1194, 1166, 988, 1165, 1164,
+      1164, 1186, 1166, 988, 1165, 987, 981, 1164,
+      1163, 1163, 1163, 1178, 1166, 988, 1165, 987,
+      981, 1164, 986, 980, 975, 1163, 1162, 1162,
+      1162, 1162, 1170, 1358, 1358, 1357, 1358, 1357,
+      1356, 1358, 1357, 1356, 1355, 1358, 1357, 1356,
+      1355, 1354, 1398, 1206, 1198, 1390, 1397, 1128,
+      876, 1100, 1389, 1205, 869, 820, 1197, 1190,
+      1072, 1189, 1382, 1381, 1396, 1127, 875, 1099,
+      1388, 1121, 624, 568, 1093, 868, 512, 819,
+      1071, 1065, 1380, 1204, 862, 813, 1196, 861,
+      456, 812, 771, 770, 1188, 1182, 1044, 1181,
+      1043, 1037, 1180, 1374, 1373, 1372, 1395, 1126,
+      874, 1098, 1387, 1120, 623, 567, 1092, 867,
+      511, 818, 1070, 1064, 1379, 1115, 618, 562,
+      1087, 603, 1134, 547, 506, 491, 1059, 860,
+      455, 811, 450, 435, 769, 1042, 1036, 1031,
+      1371, 1203, 855, 806, 1195, 854, 400, 805,
+      764, 763, 1187, 853, 399, 804, 394, 379,
+      762, 729, 728, 727, 1179, 1174, 1016, 1173,
+      1015, 1009, 1172, 1014, 1008, 1003, 1171, 1366,
+      1365, 1364, 1363, 1394, 1125, 873, 1097, 1386,
+      1119, 622, 566, 1091, 866, 510, 817, 1069,
+      1063, 1378, 1114, 617, 561, 1086, 602, 120,
+      546, 505, 490, 1058, 859, 454, 810, 449,
+      434, 768, 1041, 1035, 1030, 1370, 1110, 613,
+      557, 1082, 598, 116, 542, 501, 486, 1054,
+      588, 106, 532, 1132, 1133, 1132, 445, 430,
+      1132, 1026, 852, 398, 803, 393, 378, 761,
+      389, 374, 1132, 726, 1013, 1007, 1002, 998,
+      1362, 1202, 848, 799, 1194, 847, 344, 798,
+      757, 756, 1186, 846, 343, 797, 338, 323,
+      755, 722, 721, 720, 1178, 845, 342, 796,
+      337, 322, 754, 333, 318, 1132, 719, 694,
+      693, 692, 691, 1170, 1166, 988, 1165, 987,
+      981, 1164, 986, 980, 975, 1163, 985, 979,
+      974, 970, 1162, 1358, 1357, 1356, 1355, 1354,
+      1393, 1201, 872, 1193, 1385, 1201, 841, 792,
+      1193, 865, 750, 816, 1185, 1185, 1377, 1201,
+      841, 792, 1193, 840, 288, 791, 750, 749,
+      1185, 858, 715, 809, 715, 714, 767, 1177,
+      1177, 1177, 1369, 1201, 841, 792, 1193, 840,
+      288, 791, 750, 749, 1185, 839, 287, 790,
+      282, 267, 748, 715, 714, 713, 1177, 851,
+      687, 802, 687, 686, 760, 687, 686, 685,
+      725, 1169, 1169, 1169, 1169, 1361, 1201, 841,
+      792, 1193, 840, 288, 791, 750, 749, 1185,
+      839, 287, 790, 282, 267, 748, 715, 714,
+      713, 1177, 838, 286, 789, 281, 266, 747,
+      277, 262, 1132, 712, 687, 686, 685, 684,
+      1169, 844, 666, 795, 666, 665, 753, 666,
+      665, 664, 718, 666, 665, 664, 663, 690,
+      1161, 1161, 1161, 1161, 1161, 1353, 1201, 1158,
+      1157, 1193, 1158, 960, 1157, 1156, 1156, 1185,
+      1158, 960, 1157, 959, 953, 1156, 1155, 1155,
+      1155, 1177, 1158, 960, 1157, 959, 953, 1156,
+      958, 952, 947, 1155, 1154, 1154, 1154, 1154,
+      1169, 1158, 960, 1157, 959, 953, 1156, 958,
+      952, 947, 1155, 957, 951, 946, 942, 1154,
+      1153, 1153, 1153, 1153, 1153, 1161, 1350, 1350,
+      1349, 1350, 1349, 1348, 1350, 1349, 1348, 1347,
+      1350, 1349, 1348, 1347, 1346, 1350, 1349, 1348,
+      1347, 1346, 1345, 1398, 1206, 1198, 1390, 1397,
+      1128, 876, 1100, 1389, 1205, 869, 820, 1197,
+      1190, 1072, 1189, 1382, 1381, 1396, 1127, 875,
+      1099, 1388, 1121, 624, 568, 1093, 868, 512,
+      819, 1071, 1065, 1380, 1204, 862, 813, 1196,
+      861, 456, 812, 771, 770, 1188, 1182, 1044,
+      1181, 1043, 1037, 1180, 1374, 1373, 1372, 1395,
+      1126, 874, 1098, 1387, 1120, 623, 567, 1092,
+      867, 511, 818, 1070, 1064, 1379, 1115, 618,
+      562, 1087, 603, 1134, 547, 506, 491, 1059,
+      860, 455, 811, 450, 435, 769, 1042, 1036,
+      1031, 1371, 1203, 855, 806, 1195, 854, 400,
+      805, 764, 763, 1187, 853, 399, 804, 394,
+      379, 762, 729, 728, 727, 1179, 1174, 1016,
+      1173, 1015, 1009, 1172, 1014, 1008, 1003, 1171,
+      1366, 1365, 1364, 1363, 1394, 1125, 873, 1097,
+      1386, 1119, 622, 566, 1091, 866, 510, 817,
+      1069, 1063, 1378, 1114, 617, 561, 1086, 602,
+      120, 546, 505, 490, 1058, 859, 454, 810,
+      449, 434, 768, 1041, 1035, 1030, 1370, 1110,
+      613, 557, 1082, 598, 116, 542, 501, 486,
+      1054, 588, 106, 532, 86, 1133, 476, 445,
+      430, 420, 1026, 852, 398, 803, 393, 378,
+      761, 389, 374, 364, 726, 1013, 1007, 1002,
+      998, 1362, 1202, 848, 799, 1194, 847, 344,
+      798, 757, 756, 1186, 846, 343, 797, 338,
+      323, 755, 722, 721, 720, 1178, 845, 342,
+      796, 337, 322, 754, 333, 318, 308, 719,
+      694, 693, 692, 691, 1170, 1166, 988, 1165,
+      987, 981, 1164, 986, 980, 975, 1163, 985,
+      979, 974, 970, 1162, 1358, 1357, 1356, 1355,
+      1354, 1393, 1124, 872, 1096, 1385, 1118, 621,
+      565, 1090, 865, 509, 816, 1068, 1062, 1377,
+      1113, 616, 560, 1085, 601, 119, 545, 504,
+      489, 1057, 858, 453, 809, 448, 433, 767,
+      1040, 1034, 1029, 1369, 1109, 612, 556, 1081,
+      597, 115, 541, 500, 485, 1053, 587, 105,
+      531, 85, 52, 475, 444, 429, 419, 1025,
+      851, 397, 802, 392, 377, 760, 388, 373,
+      363, 725, 1012, 1006, 1001, 997, 1361, 1129,
+      1129, 1129, 1078, 1129, 1129, 538, 1129, 482,
+      1050, 1129, 1129, 528, 1129, 49, 472, 1129,
+      426, 416, 1022, 1130, 1130, 1130, 1130, 1130,
+      1130, 1131, 1131, 1132, 1131, 1130, 1130, 1130,
+      1131, 1130, 1129, 1129, 795, 1129, 321, 753,
+      1129, 317, 307, 718, 1130, 1130, 1130, 1131,
+      1130, 1129, 978, 973, 969, 1130, 1353, 1201,
+      841, 792, 1193, 840, 288, 791, 750, 749,
+      1185, 839, 287, 790, 282, 267, 748, 715,
+      714, 713, 1177, 838, 286, 789, 281, 266,
+      747, 277, 262, 252, 712, 687, 686, 685,
+      684, 1169, 1129, 1129, 788, 1129, 265, 746,
+      1129, 261, 251, 711, 1130, 1130, 1130, 1131,
+      1130, 1129, 665, 664, 663, 1130, 1161, 1158,
+      960, 1157, 959, 953, 1156, 958, 952, 947,
+      1155, 957, 951, 946, 942, 1154, 1129, 950,
+      945, 941, 1130, 1153, 1350, 1349, 1348, 1347,
+      1346, 1345, 1392, 1200, 871, 1192, 1384, 1200,
+      834, 785, 1192, 864, 743, 815, 1184, 1184,
+      1376, 1200, 834, 785, 1192, 833, 232, 784,
+      743, 742, 1184, 857, 708, 808, 708, 707,
+      766, 1176, 1176, 1176, 1368, 1200, 834, 785,
+      1192, 833, 232, 784, 743, 742, 1184, 832,
+      231, 783, 226, 211, 741, 708, 707, 706,
+      1176, 850, 680, 801, 680, 679, 759, 680,
+      679, 678, 724, 1168, 1168, 1168, 1168, 1360,
+      1200, 834, 785, 1192, 833, 232, 784, 743,
+      742, 1184, 832, 231, 783, 226, 211, 741,
+      708, 707, 706, 1176, 831, 230, 782, 225,
+      210, 740, 221, 206, 196, 705, 680, 679,
+      678, 677, 1168, 843, 659, 794, 659, 658,
+      752, 659, 658, 657, 717, 659, 658, 657,
+      656, 689, 1160, 1160, 1160, 1160, 1160, 1352,
+      1200, 834, 785, 1192, 833, 232, 784, 743,
+      742, 1184, 832, 231, 783, 226, 211, 741,
+      708, 707, 706, 1176, 831, 230, 782, 225,
+      210, 740, 221, 206, 196, 705, 680, 679,
+      678, 677, 1168, 1129, 1129, 781, 1129, 209,
+      739, 1129, 205, 195, 704, 1130, 1130, 1130,
+      1131, 1130, 1129, 658, 657, 656, 1130, 1160,
+      836, 645, 787, 645, 644, 745, 645, 644,
+      643, 710, 645, 644, 643, 642, 682, 1129,
+      644, 643, 642, 1130, 661, 1152, 1152, 1152,
+      1152, 1152, 1152, 1344, 1200, 1150, 1149, 1192,
+      1150, 932, 1149, 1148, 1148, 1184, 1150, 932,
+      1149, 931, 925, 1148, 1147, 1147, 1147, 1176,
+      1150, 932, 1149, 931, 925, 1148, 930, 924,
+      919, 1147, 1146, 1146, 1146, 1146, 1168, 1150,
+      932, 1149, 931, 925, 1148, 930, 924, 919,
+      1147, 929, 923, 918, 914, 1146, 1145, 1145,
+      1145, 1145, 1145, 1160, 1150, 932, 1149, 931,
+      925, 1148, 930, 924, 919, 1147, 929, 923,
+      918, 914, 1146, 1129, 922, 917, 913, 1130,
+      1145, 1144, 1144, 1144, 1144, 1144, 1144, 1152,
+      1342, 1342, 1341, 1342, 1341, 1340, 1342, 1341,
+      1340, 1339, 1342, 1341, 1340, 1339, 1338, 1342,
+      1341, 1340, 1339, 1338, 1337, 1342, 1341, 1340,
+      1339, 1338, 1337, 1336, 1398, 1206, 1198, 1390,
+      1397, 1199, 876, 1191, 1389, 1205, 869, 820,
+      1197, 1190, 1183, 1189, 1382, 1381, 1396, 1199,
+      875, 1191, 1388, 1199, 827, 778, 1191, 868,
+      736, 819, 1183, 1183, 1380, 1204, 862, 813,
+      1196, 861, 701, 812, 771, 770, 1188, 1182,
+      1175, 1181, 1175, 1175, 1180, 1374, 1373, 1372,
+      1395, 1199, 874, 1191, 1387, 1199, 827, 778,
+      1191, 867, 736, 818, 1183, 1183, 1379, 1199,
+      827, 778, 1191, 826, 1134, 777, 736, 735,
+      1183, 860, 701, 811, 701, 700, 769, 1175,
+      1175, 1175, 1371, 1203, 855, 806, 1195, 854,
+      673, 805, 764, 763, 1187, 853, 673, 804,
+      673, 672, 762, 729, 728, 727, 1179, 1174,
+      1167, 1173, 1167, 1167, 1172, 1167, 1167, 1167,
+      1171, 1366, 1365, 1364, 1363, 1394, 1199, 873,
+      1191, 1386, 1199, 827, 778, 1191, 866, 736,
+      817, 1183, 1183, 1378, 1199, 827, 778, 1191,
+      826, 176, 777, 736, 735, 1183, 859, 701,
+      810, 701, 700, 768, 1175, 1175, 1175, 1370,
+      1199, 827, 778, 1191, 826, 176, 777, 736,
+      735, 1183, 825, 175, 776, 170, 1133, 734,
+      701, 700, 699, 1175, 852, 673, 803, 673,
+      672, 761, 673, 672, 671, 726, 1167, 1167,
+      1167, 1167, 1362, 1202, 848, 799, 1194, 847,
+      652, 798, 757, 756, 1186, 846, 652, 797,
+      652, 651, 755, 722, 721, 720, 1178, 845,
+      652, 796, 652, 651, 754, 652, 651, 650,
+      719, 694, 693, 692, 691, 1170, 1166, 1159,
+      1165, 1159, 1159, 1164, 1159, 1159, 1159, 1163,
+      1159, 1159, 1159, 1159, 1162, 1358, 1357, 1356,
+      1355, 1354, 1393, 1199, 872, 1191, 1385, 1199,
+      827, 778, 1191, 865, 736, 816, 1183, 1183,
+      1377, 1199, 827, 778, 1191, 826, 176, 777,
+      736, 735, 1183, 858, 701, 809, 701, 700,
+      767, 1175, 1175, 1175, 1369, 1199, 827, 778,
+      1191, 826, 176, 777, 736, 735, 1183, 825,
+      175, 776, 170, 155, 734, 701, 700, 699,
+      1175, 851, 673, 802, 673, 672, 760, 673,
+      672, 671, 725, 1167, 1167, 1167, 1167, 1361,
+      1199, 827, 778, 1191, 826, 176, 777, 736,
+      735, 1183, 825, 175, 776, 170, 155, 734,
+      701, 700, 699, 1175, 824, 174, 775, 169,
+      154, 733, 165, 150, 1132, 698, 673, 672,
+      671, 670, 1167, 844, 652, 795, 652, 651,
+      753, 652, 651, 650, 718, 652, 651, 650,
+      649, 690, 1159, 1159, 1159, 1159, 1159, 1353,
+      1201, 841, 792, 1193, 840, 638, 791, 750,
+      749, 1185, 839, 638, 790, 638, 637, 748,
+      715, 714, 713, 1177, 838, 638, 789, 638,
+      637, 747, 638, 637, 636, 712, 687, 686,
+      685, 684, 1169, 837, 638, 788, 638, 637,
+      746, 638, 637, 636, 711, 638, 637, 636,
+      635, 683, 666, 665, 664, 663, 662, 1161,
+      1158, 1151, 1157, 1151, 1151, 1156, 1151, 1151,
+      1151, 1155, 1151, 1151, 1151, 1151, 1154, 1151,
+      1151, 1151, 1151, 1151, 1153, 1350, 1349, 1348,
+      1347, 1346, 1345, 1392, 1199, 871, 1191, 1384,
+      1199, 827, 778, 1191, 864, 736, 815, 1183,
+      1183, 1376, 1199, 827, 778, 1191, 826, 176,
+      777, 736, 735, 1183, 857, 701, 808, 701,
+      700, 766, 1175, 1175, 1175, 1368, 1199, 827,
+      778, 1191, 826, 176, 777, 736, 735, 1183,
+      825, 175, 776, 170, 155, 734, 701, 700,
+      699, 1175, 850, 673, 801, 673, 672, 759,
+      673, 672, 671, 724, 1167, 1167, 1167, 1167,
+      1360, 1199, 827, 778, 1191, 826, 176, 777,
+      736, 735, 1183, 825, 175, 776, 170, 155,
+      734, 701, 700, 699, 1175, 824, 174, 775,
+      169, 154, 733, 165, 150, 140, 698, 673,
+      672, 671, 670, 1167, 843, 652, 794, 652,
+      651, 752, 652, 651, 650, 717, 652, 651,
+      650, 649, 689, 1159, 1159, 1159, 1159, 1159,
+      1352, 1199, 827, 778, 1191, 826, 176, 777,
+      736, 735, 1183, 825, 175, 776, 170, 155,
+      734, 701, 700, 699, 1175, 824, 174, 775,
+      169, 154, 733, 165, 150, 140, 698, 673,
+      672, 671, 670, 1167, 1129, 1129, 774, 1129,
+      153, 732, 1129, 149, 139, 697, 1130, 1130,
+      1130, 1131, 1130, 1129, 651, 650, 649, 1130,
+      1159, 836, 638, 787, 638, 637, 745, 638,
+      637, 636, 710, 638, 637, 636, 635, 682,
+      1129, 637, 636, 635, 1130, 661, 1151, 1151,
+      1151, 1151, 1151, 1151, 1344, 1200, 834, 785,
+      1192, 833, 631, 784, 743, 742, 1184, 832,
+      631, 783, 631, 630, 741, 708, 707, 706,
+      1176, 831, 631, 782, 631, 630, 740, 631,
+      630, 629, 705, 680, 679, 678, 677, 1168,
+      830, 631, 781, 631, 630, 739, 631, 630,
+      629, 704, 631, 630, 629, 628, 676, 659,
+      658, 657, 656, 655, 1160, 829, 631, 780,
+      631, 630, 738, 631, 630, 629, 703, 631,
+      630, 629, 628, 675, 1129, 630, 629, 628,
+      1130, 654, 645, 644, 643, 642, 641, 640,
+      1152, 1150, 1143, 1149, 1143, 1143, 1148, 1143,
+      1143, 1143, 1147, 1143, 1143, 1143, 1143, 1146,
+      1143, 1143, 1143, 1143, 1143, 1145, 1143, 1143,
+      1143, 1143, 1143, 1143, 1144, 1342, 1341, 1340,
+      1339, 1338, 1337, 1336, 1391, 1199, 1142, 1191,
+      1383, 1199, 1142, 1141, 1191, 1142, 1140, 1141,
+      1183, 1183, 1375, 1199, 1142, 1141, 1191, 1142,
+      904, 1141, 1140, 1140, 1183, 1142, 1139, 1141,
+      1139, 1139, 1140, 1175, 1175, 1175, 1367, 1199,
+      1142, 1141, 1191, 1142, 904, 1141, 1140, 1140,
+      1183, 1142, 904, 1141, 903, 897, 1140, 1139,
+      1139, 1139, 1175, 1142, 1138, 1141, 1138, 1138,
+      1140, 1138, 1138, 1138, 1139, 1167, 1167, 1167,
+      1167, 1359, 1199, 1142, 1141, 1191, 1142, 904,
+      1141, 1140, 1140, 1183, 1142, 904, 1141, 903,
+      897, 1140, 1139, 1139, 1139, 1175, 1142, 904,
+      1141, 903, 897, 1140, 902, 896, 891, 1139,
+      1138, 1138, 1138, 1138, 1167, 1142, 1137, 1141,
+      1137, 1137, 1140, 1137, 1137, 1137, 1139, 1137,
+      1137, 1137, 1137, 1138, 1159, 1159, 1159, 1159,
+      1159, 1351, 1199, 1142, 1141, 1191, 1142, 904,
+      1141, 1140, 1140, 1183, 1142, 904, 1141, 903,
+      897, 1140, 1139, 1139, 1139, 1175, 1142, 904,
+      1141, 903, 897, 1140, 902, 896, 891, 1139,
+      1138, 1138, 1138, 1138, 1167, 1142, 904, 1141,
+      903, 897, 1140, 902, 896, 891, 1139, 901,
+      895, 890, 886, 1138, 1137, 1137, 1137, 1137,
+      1137, 1159, 1142, 1136, 1141, 1136, 1136, 1140,
+      1136, 1136, 1136, 1139, 1136, 1136, 1136, 1136,
+      1138, 1136, 1136, 1136, 1136, 1136, 1137, 1151,
+      1151, 1151, 1151, 1151, 1151, 1343, 1199, 1142,
+      1141, 1191, 1142, 904, 1141, 1140, 1140, 1183,
+      1142, 904, 1141, 903, 897, 1140, 1139, 1139,
+      1139, 1175, 1142, 904, 1141, 903, 897, 1140,
+      902, 896, 891, 1139, 1138, 1138, 1138, 1138,
+      1167, 1142, 904, 1141, 903, 897, 1140, 902,
+      896, 891, 1139, 901, 895, 890, 886, 1138,
+      1137, 1137, 1137, 1137, 1137, 1159, 1142, 904,
+      1141, 903, 897, 1140, 902, 896, 891, 1139,
+      901, 895, 890, 886, 1138, 1129, 894, 889,
+      885, 1130, 1137, 1136, 1136, 1136, 1136, 1136,
+      1136, 1151, 1142, 1135, 1141, 1135, 1135, 1140,
+      1135, 1135, 1135, 1139, 1135, 1135, 1135, 1135,
+      1138, 1135, 1135, 1135, 1135, 1135, 1137, 1135,
+      1135, 1135, 1135, 1135, 1135, 1136, 1143, 1143,
+      1143, 1143, 1143, 1143, 1143, 1335, 1334, 1334,
+      1334, 1333, 1334, 1334, 1333, 1334, 1333, 1332,
+      1334, 1334, 1333, 1334, 1333, 1332, 1334, 1333,
+      1332, 1331, 1334, 1334, 1333, 1334, 1333, 1332,
+      1334, 1333, 1332, 1331, 1334, 1333, 1332, 1331,
+      1330, 1334, 1334, 1333, 1334, 1333, 1332, 1334,
+      1333, 1332, 1331, 1334, 1333, 1332, 1331, 1330,
+      1334, 1333, 1332, 1331, 1330, 1329, 1334, 1334,
+      1333, 1334, 1333, 1332, 1334, 1333, 1332, 1331,
+      1334, 1333, 1332, 1331, 1330, 1334, 1333, 1332,
+      1331, 1330, 1329, 1334, 1333, 1332, 1331, 1330,
+      1329, 1328, 1334, 1334, 1333, 1334, 1333, 1332,
+      1334, 1333, 1332, 1331, 1334, 1333, 1332, 1331,
+      1330, 1334, 1333, 1332, 1331, 1330, 1329, 1334,
+      1333, 1332, 1331, 1330, 1329, 1328, 1334, 1333,
+      1332, 1331, 1330, 1329, 1328, 1327, 1398, 1398,
+      1390, 1398, 1206, 1390, 1398, 1206, 1198, 1390,
+      1397, 1382, 1382, 1382, 1389, 1398, 1390, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      1190, 1197, 1389, 1382, 1382, 1382, 1381, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      876, 1197, 1389, 1205, 1190, 1189, 1197, 1382,
+      1382, 1381, 1398, 1206, 1198, 1390, 1397, 1204,
+      1182, 1196, 1389, 1205, 1182, 1181, 1197, 1190,
+      1188, 1189, 1382, 1381, 1396, 1374, 1374, 1374,
+      1388, 1374, 1374, 1374, 1373, 1374, 1374, 1373,
+      1374, 1373, 1380, 1398, 1390, 1398, 1206, 1390,
+      1398, 1206, 1198, 1390, 1397, 1205, 1190, 1197,
+      1389, 1382, 1382, 1382, 1381, 1398, 1206, 1390,
+      1398, 1206, 1198, 1390, 1397, 1205, 1134, 1197,
+      1389, 1205, 1190, 1189, 1197, 1382, 1382, 1381,
+      1398, 1206, 1198, 1390, 1397, 1204, 1134, 1196,
+      1389, 1205, 1134, 1134, 1197, 1190, 1188, 1189,
+      1382, 1381, 1396, 1204, 1182, 1196, 1388, 1204,
+      1182, 1181, 1196, 1182, 1180, 1181, 1188, 1188,
+      1380, 1374, 1374, 1374, 1373, 1374, 1374, 1373,
+      1374, 1373, 1372, 1398, 1206, 1390, 1398, 1206,
+      1198, 1390, 1397, 1205, 876, 1197, 1389, 1205,
+      1190, 1189, 1197, 1382, 1382, 1381, 1398, 1206,
+      1198, 1390, 1397, 1203, 1134, 1195, 1389, 1205,
+      1134, 1134, 1197, 1190, 1187, 1189, 1382, 1381,
+      1396, 1204, 875, 1196, 1388, 1204, 1134, 1134,
+      1196, 868, 1134, 819, 1188, 1188, 1380, 1204,
+      1182, 1181, 1196, 1182, 1179, 1181, 1180, 1180,
+      1188, 1374, 1374, 1373, 1374, 1373, 1372, 1398,
+      1206, 1198, 1390, 1397, 1203, 1174, 1195, 1389,
+      1205, 1174, 1173, 1197, 1190, 1187, 1189, 1382,
+      1381, 1396, 1203, 1174, 1195, 1388, 1203, 1174,
+      1173, 1195, 1174, 1172, 1173, 1187, 1187, 1380,
+      1204, 1174, 1173, 1196, 1174, 1171, 1173, 1172,
+      1172, 1188, 1182, 1179, 1181, 1179, 1179, 1180,
+      1374, 1373, 1372, 1395, 1366, 1366, 1366, 1387,
+      1366, 1366, 1366, 1365, 1366, 1366, 1365, 1366,
+      1365, 1379, 1366, 1366, 1366, 1365, 1366, 1366,
+      1365, 1366, 1365, 1364, 1366, 1366, 1365, 1366,
+      1365, 1364, 1366, 1365, 1364, 1371, 1398, 1390,
+      1398, 1206, 1390, 1398, 1206, 1198, 1390, 1397,
+      1205, 1190, 1197, 1389, 1382, 1382, 1382, 1381,
+      1398, 1206, 1390, 1398, 1206, 1198, 1390, 1397,
+      1205, 876, 1197, 1389, 1205, 1190, 1189, 1197,
+      1382, 1382, 1381, 1398, 1206, 1198, 1390, 1397,
+      1204, 876, 1196, 1389, 1205, 869, 820, 1197,
+      1190, 1188, 1189, 1382, 1381, 1396, 1204, 1182,
+      1196, 1388, 1204, 1182, 1181, 1196, 1182, 1180,
+      1181, 1188, 1188, 1380, 1374, 1374, 1374, 1373,
+      1374, 1374, 1373, 1374, 1373, 1372, 1398, 1206,
+      1390, 1398, 1206, 1198, 1390, 1397, 1205, 876,
+      1197, 1389, 1205, 1190, 1189, 1197, 1382, 1382,
+      1381, 1398, 1206, 1198, 1390, 1397, 1134, 1134,
+      1134, 1389, 1205, 1134, 1134, 1197, 1190, 1134,
+      1189, 1382, 1381, 1396, 1204, 875, 1196, 1388,
+      1204, 1134, 1134, 1196, 868, 1134, 1133, 1188,
+      1188, 1380, 1204, 1182, 1181, 1196, 1182, 1134,
+      1181, 1180, 1180, 1188, 1374, 1374, 1373, 1374,
+      1373, 1372, 1398, 1206, 1198, 1390, 1397, 1203,
+      876, 1195, 1389, 1205, 869, 820, 1197, 1190,
+      1187, 1189, 1382, 1381, 1396, 1203, 875, 1195,
+      1388, 1203, 1134, 1134, 1195, 868, 1134, 1133,
+      1187, 1187, 1380, 1204, 862, 813, 1196, 861,
+      1134, 1133, 771, 1133, 1188, 1182, 1179, 1181,
+      1179, 1179, 1180, 1374, 1373, 1372, 1395, 1203,
+      1174, 1195, 1387, 1203, 1174, 1173, 1195, 1174,
+      1172, 1173, 1187, 1187, 1379, 1203, 1174, 1173,
+      1195, 1174, 1134, 1173, 1172, 1172, 1187, 1174,
+      1171, 1173, 1171, 1171, 1172, 1179, 1179, 1179,
+      1371, 1366, 1366, 1366, 1365, 1366, 1366, 1365,
+      1366, 1365, 1364, 1366, 1366, 1365, 1366, 1365,
+      1364, 1366, 1365, 1364, 1363, 1398, 1206, 1390,
+      1398, 1206, 1198, 1390, 1397, 1205, 876, 1197,
+      1389, 1205, 1190, 1189, 1197, 1382, 1382, 1381,
+      1398, 1206, 1198, 1390, 1397, 1202, 876, 1194,
+      1389, 1205, 869, 820, 1197, 1190, 1186, 1189,
+      1382, 1381, 1396, 1204, 875, 1196, 1388, 1204,
+      862, 813, 1196, 868, 771, 819, 1188, 1188,
+      1380, 1204, 1182, 1181, 1196, 1182, 1178, 1181,
+      1180, 1180, 1188, 1374, 1374, 1373, 1374, 1373,
+      1372, 1398, 1206, 1198, 1390, 1397, 1202, 876,
+      1194, 1389, 1205, 869, 820, 1197, 1190, 1186,
+      1189, 1382, 1381, 1396, 1202, 875, 1194, 1388,
+      1202, 1134, 1134, 1194, 868, 1134, 1133, 1186,
+      1186, 1380, 1204, 862, 813, 1196, 861, 1134,
+      1133, 771, 1133, 1188, 1182, 1178, 1181, 1178,
+      1178, 1180, 1374, 1373, 1372, 1395, 1203, 874,
+      1195, 1387, 1203, 855, 806, 1195, 867, 764,
+      818, 1187, 1187, 1379, 1203, 855, 806, 1195,
+      854, 1134, 1133, 764, 1133, 1187, 860, 729,
+      811, 729, 1133, 769, 1179, 1179, 1179, 1371,
+      1203, 1174, 1173, 1195, 1174, 1170, 1173, 1172,
+      1172, 1187, 1174, 1170, 1173, 1170, 1170, 1172,
+      1171, 1171, 1171, 1179, 1366, 1366, 1365, 1366,
+      1365, 1364, 1366, 1365, 1364, 1363, 1398, 1206,
+      1198, 1390, 1397, 1202, 1166, 1194, 1389, 1205,
+      1166, 1165, 1197, 1190, 1186, 1189, 1382, 1381,
+      1396, 1202, 1166, 1194, 1388, 1202, 1166, 1165,
+      1194, 1166, 1164, 1165, 1186, 1186, 1380, 1204,
+      1166, 1165, 1196, 1166, 1163, 1165, 1164, 1164,
+      1188, 1182, 1178, 1181, 1178, 1178, 1180, 1374,
+      1373, 1372, 1395, 1202, 1166, 1194, 1387, 1202,
+      1166, 1165, 1194, 1166, 1164, 1165, 1186, 1186,
+      1379, 1202, 1166, 1165, 1194, 1166, 1134, 1165,
+      1164, 1164, 1186, 1166, 1163, 1165, 1163, 1163,
+      1164, 1178, 1178, 1178, 1371, 1203, 1166, 1165,
+      1195, 1166, 1162, 1165, 1164, 1164, 1187, 1166,
+      1162, 1165, 1162, 1162, 1164, 1163, 1163, 1163,
+      1179, 1174, 1170, 1173, 1170, 1170, 1172, 1170,
+      1170, 1170, 1171, 1366, 1365, 1364, 1363, 1394,
+      1358, 1358, 1358, 1386, 1358, 1358, 1358, 1357,
+      1358, 1358, 1357, 1358, 1357, 1378, 1358, 1358,
+      1358, 1357, 1358, 1358, 1357, 1358, 1357, 1356,
+      1358, 1358, 1357, 1358, 1357, 1356, 1358, 1357,
+      1356, 1370, 1358, 1358, 1358, 1357, 1358, 1358,
+      1357, 1358, 1357, 1356, 1358, 1358, 1357, 1358,
+      1357, 1356, 1358, 1357, 1356, 1355, 1358, 1358,
+      1357, 1358, 1357, 1356, 1358, 1357, 1356, 1355,
+      1358, 1357, 1356, 1355, 1362, 1398, 1390, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      1190, 1197, 1389, 1382, 1382, 1382, 1381, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      876, 1197, 1389, 1205, 1190, 1189, 1197, 1382,
+      1382, 1381, 1398, 1206, 1198, 1390, 1397, 1204,
+      876, 1196, 1389, 1205, 869, 820, 1197, 1190,
+      1188, 1189, 1382, 1381, 1396, 1204, 1182, 1196,
+      1388, 1204, 1182, 1181, 1196, 1182, 1180, 1181,
+      1188, 1188, 1380, 1374, 1374, 1374, 1373, 1374,
+      1374, 1373, 1374, 1373, 1372, 1398, 1206, 1390,
+      1398, 1206, 1198, 1390, 1397, 1205, 876, 1197,
+      1389, 1205, 1190, 1189, 1197, 1382, 1382, 1381,
+      1398, 1206, 1198, 1390, 1397, 1134, 1134, 1134,
+      1389, 1205, 1134, 1134, 1197, 1190, 1134, 1189,
+      1382, 1381, 1396, 1204, 875, 1196, 1388, 1204,
+      1134, 1134, 1196, 868, 1134, 819, 1188, 1188,
+      1380, 1204, 1182, 1181, 1196, 1182, 1134, 1181,
+      1180, 1180, 1188, 1374, 1374, 1373, 1374, 1373,
+      1372, 1398, 1206, 1198, 1390, 1397, 1203, 876,
+      1195, 1389, 1205, 869, 820, 1197, 1190, 1187,
+      1189, 1382, 1381, 1396, 1203, 875, 1195, 1388,
+      1203, 1134, 1134, 1195, 868, 1134, 819, 1187,
+      1187, 1380, 1204, 862, 813, 1196, 861, 1134,
+      812, 771, 770, 1188, 1182, 1179, 1181, 1179,
+      1179, 1180, 1374, 1373, 1372, 1395, 1203, 1174,
+      1195, 1387, 1203, 1174, 1173, 1195, 1174, 1172,
+      1173, 1187, 1187, 1379, 1203, 1174, 1173, 1195,
+      1174, 1134, 1173, 1172, 1172, 1187, 1174, 1171,
+      1173, 1171, 1171, 1172, 1179, 1179, 1179, 1371,
+      1366, 1366, 1366, 1365, 1366, 1366, 1365, 1366,
+      1365, 1364, 1366, 1366, 1365, 1366, 1365, 1364,
+      1366, 1365, 1364, 1363, 1398, 1206, 1390, 1398,
+      1206, 1198, 1390, 1397, 1205, 876, 1197, 1389,
+      1205, 1190, 1189, 1197, 1382, 1382, 1381, 1398,
+      1206, 1198, 1390, 1397, 1128, 876, 1100, 1389,
+      1205, 869, 820, 1197, 1190, 1072, 1189, 1382,
+      1381, 1396, 1204, 875, 1196, 1388, 1204, 862,
+      813, 1196, 868, 771, 819, 1188, 1188, 1380,
+      1204, 1182, 1181, 1196, 1182, 1044, 1181, 1180,
+      1180, 1188, 1374, 1374, 1373, 1374, 1373, 1372,
+      1398, 1206, 1198, 1390, 1397, 1128, 876, 1100,
+      1389, 1205, 869, 820, 1197, 1190, 1072, 1189,
+      1382, 1381, 1396, 1127, 875, 1099, 1388, 1132,
+      1134, 1134, 1133, 1132, 1134, 1133, 1132, 1133,
+      1380, 1204, 862, 813, 1196, 1132, 1134, 1133,
+      1132, 1133, 1188, 1182, 1044, 1181, 1132, 1133,
+      1180, 1374, 1373, 1372, 1395, 1203, 874, 1195,
+      1387, 1203, 855, 806, 1195, 867, 764, 818,
+      1187, 1187, 1379, 1203, 855, 806, 1195, 1132,
+      1134, 1133, 1132, 1133, 1187, 860, 729, 811,
+      1132, 1133, 1132, 1179, 1179, 1179, 1371, 1203,
+      1174, 1173, 1195, 1174, 1016, 1173, 1172, 1172,
+      1187, 1174, 1016, 1173, 1132, 1133, 1172, 1171,
+      1171, 1171, 1179, 1366, 1366, 1365, 1366, 1365,
+      1364, 1366, 1365, 1364, 1363, 1398, 1206, 1198,
+      1390, 1397, 1202, 876, 1194, 1389, 1205, 869,
+      820, 1197, 1190, 1186, 1189, 1382, 1381, 1396,
+      1202, 875, 1194, 1388, 1202, 848, 799, 1194,
+      868, 757, 819, 1186, 1186, 1380, 1204, 862,
+      813, 1196, 861, 722, 812, 771, 770, 1188,
+      1182, 1178, 1181, 1178, 1178, 1180, 1374, 1373,
+      1372, 1395, 1202, 874, 1194, 1387, 1202, 848,
+      799, 1194, 867, 757, 818, 1186, 1186, 1379,
+      1202, 848, 799, 1194, 1132, 1134, 1133, 1132,
+      1133, 1186, 860, 722, 811, 1132, 1133, 1132,
+      1178, 1178, 1178, 1371, 1203, 855, 806, 1195,
+      854, 694, 805, 764, 763, 1187, 853, 694,
+      804, 1132, 1133, 1132, 729, 728, 1132, 1179,
+      1174, 1170, 1173, 1170, 1170, 1172, 1170, 1170,
+      1170, 1171, 1366, 1365, 1364, 1363, 1394, 1202,
+      1166, 1194, 1386, 1202, 1166, 1165, 1194, 1166,
+      1164, 1165, 1186, 1186, 1378, 1202, 1166, 1165,
+      1194, 1166, 988, 1165, 1164, 1164, 1186, 1166,
+      1163, 1165, 1163, 1163, 1164, 1178, 1178, 1178,
+      1370, 1202, 1166, 1165, 1194, 1166, 988, 1165,
+      1164, 1164, 1186, 1166, 988, 1165, 1132, 1133,
+      1164, 1163, 1163, 1163, 1178, 1166, 1162, 1165,
+      1162, 1162, 1164, 1162, 1162, 1162, 1163, 1170,
+      1170, 1170, 1170, 1362, 1358, 1358, 1358, 1357,
+      1358, 1358, 1357, 1358, 1357, 1356, 1358, 1358,
+      1357, 1358, 1357, 1356, 1358, 1357, 1356, 1355,
+      1358, 1358, 1357, 1358, 1357, 1356, 1358, 1357,
+      1356, 1355, 1358, 1357, 1356, 1355, 1354, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      876, 1197, 1389, 1205, 1190, 1189, 1197, 1382,
+      1382, 1381, 1398, 1206, 1198, 1390, 1397, 1201,
+      876, 1193, 1389, 1205, 869, 820, 1197, 1190,
+      1185, 1189, 1382, 1381, 1396, 1204, 875, 1196,
+      1388, 1204, 862, 813, 1196, 868, 771, 819,
+      1188, 1188, 1380, 1204, 1182, 1181, 1196, 1182,
+      1177, 1181, 1180, 1180, 1188, 1374, 1374, 1373,
+      1374, 1373, 1372, 1398, 1206, 1198, 1390, 1397,
+      1201, 876, 1193, 1389, 1205, 869, 820, 1197,
+      1190, 1185, 1189, 1382, 1381, 1396, 1201, 875,
+      1193, 1388, 1201, 1134, 1134, 1193, 868, 1134,
+      819, 1185, 1185, 1380, 1204, 862, 813, 1196,
+      861, 1134, 812, 771, 770, 1188, 1182, 1177,
+      1181, 1177, 1177, 1180, 1374, 1373, 1372, 1395,
+      1203, 874, 1195, 1387, 1203, 855, 806, 1195,
+      867, 764, 818, 1187, 1187, 1379, 1203, 855,
+      806, 1195, 854, 1134, 805, 764, 763, 1187,
+      860, 729, 811, 729, 728, 769, 1179, 1179,
+      1179, 1371, 1203, 1174, 1173, 1195, 1174, 1169,
+      1173, 1172, 1172, 1187, 1174, 1169, 1173, 1169,
+      1169, 1172, 1171, 1171, 1171, 1179, 1366, 1366,
+      1365, 1366, 1365, 1364, 1366, 1365, 1364, 1363,
+      1398, 1206, 1198, 1390, 1397, 1201, 876, 1193,
+      1389, 1205, 869, 820, 1197, 1190, 1185, 1189,
+      1382, 1381, 1396, 1201, 875, 1193, 1388, 1201,
+      841, 792, 1193, 868, 750, 819, 1185, 1185,
+      1380, 1204, 862, 813, 1196, 861, 715, 812,
+      771, 770, 1188, 1182, 1177, 1181, 1177, 1177,
+      1180, 1374, 1373, 1372, 1395, 1201, 874, 1193,
+      1387, 1201, 841, 792, 1193, 867, 750, 818,
+      1185, 1185, 1379, 1201, 841, 792, 1193, 1132,
+      1134, 1133, 1132, 1133, 1185, 860, 715, 811,
+      1132, 1133, 1132, 1177, 1177, 1177, 1371, 1203,
+      855, 806, 1195, 854, 687, 805, 764, 763,
+      1187, 853, 687, 804, 1132, 1133, 1132, 729,
+      728, 1132, 1179, 1174, 1169, 1173, 1169, 1169,
+      1172, 1169, 1169, 1169, 1171, 1366, 1365, 1364,
+      1363, 1394, 1202, 873, 1194, 1386, 1202, 848,
+      799, 1194, 866, 757, 817, 1186, 1186, 1378,
+      1202, 848, 799, 1194, 847, 666, 798, 757,
+      756, 1186, 859, 722, 810, 722, 721, 768,
+      1178, 1178, 1178, 1370, 1202, 848, 799, 1194,
+      847, 666, 798, 757, 756, 1186, 846, 666,
+      797, 1132, 1133, 1132, 722, 721, 1132, 1178,
+      852, 694, 803, 694, 693, 761, 694, 693,
+      1132, 726, 1170, 1170, 1170, 1170, 1362, 1202,
+      1166, 1165, 1194, 1166, 1161, 1165, 1164, 1164,
+      1186, 1166, 1161, 1165, 1161, 1161, 1164, 1163,
+      1163, 1163, 1178, 1166, 1161, 1165, 1161, 1161,
+      1164, 1161, 1161, 1161, 1163, 1162, 1162, 1162,
+      1162, 1170, 1358, 1358, 1357, 1358, 1357, 1356,
+      1358, 1357, 1356, 1355, 1358, 1357, 1356, 1355,
+      1354, 1398, 1206, 1198, 1390, 1397, 1201, 1158,
+      1193, 1389, 1205, 1158, 1157, 1197, 1190, 1185,
+      1189, 1382, 1381, 1396, 1201, 1158, 1193, 1388,
+      1201, 1158, 1157, 1193, 1158, 1156, 1157, 1185,
+      1185, 1380, 1204, 1158, 1157, 1196, 1158, 1155,
+      1157, 1156, 1156, 1188, 1182, 1177, 1181, 1177,
+      1177, 1180, 1374, 1373, 1372, 1395, 1201, 1158,
+      1193, 1387, 1201, 1158, 1157, 1193, 1158, 1156,
+      1157, 1185, 1185, 1379, 1201, 1158, 1157, 1193,
+      1158, 1134, 1157, 1156, 1156, 1185, 1158, 1155,
+      1157, 1155, 1155, 1156, 1177, 1177, 1177, 1371,
+      1203, 1158, 1157, 1195, 1158, 1154, 1157, 1156,
+      1156, 1187, 1158, 1154, 1157, 1154, 1154, 1156,
+      1155, 1155, 1155, 1179, 1174, 1169, 1173, 1169,
+      1169, 1172, 1169, 1169, 1169, 1171, 1366, 1365,
+      1364, 1363, 1394, 1201, 1158, 1193, 1386, 1201,
+      1158, 1157, 1193, 1158, 1156, 1157, 1185, 1185,
+      1378, 1201, 1158, 1157, 1193, 1158, 960, 1157,
+      1156, 1156, 1185, 1158, 1155, 1157, 1155, 1155,
+      1156, 1177, 1177, 1177, 1370, 1201, 1158, 1157,
+      1193, 1158, 960, 1157, 1156, 1156, 1185, 1158,
+      960, 1157, 1132, 1133, 1156, 1155, 1155, 1155,
+      1177, 1158, 1154, 1157, 1154, 1154, 1156, 1154,
+      1154, 1154, 1155, 1169, 1169, 1169, 1169, 1362,
+      1202, 1158, 1157, 1194, 1158, 1153, 1157, 1156,
+      1156, 1186, 1158, 1153, 1157, 1153, 1153, 1156,
+      1155, 1155, 1155, 1178, 1158, 1153, 1157, 1153,
+      1153, 1156, 1153, 1153, 1153, 1155, 1154, 1154,
+      1154, 1154, 1170, 1166, 1161, 1165, 1161, 1161,
+      1164, 1161, 1161, 1161, 1163, 1161, 1161, 1161,
+      1161, 1162, 1358, 1357, 1356, 1355, 1354, 1393,
+      1350, 1350, 1350, 1385, 1350, 1350, 1350, 1349,
+      1350, 1350, 1349, 1350, 1349, 1377, 1350, 1350,
+      1350, 1349, 1350, 1350, 1349, 1350, 1349, 1348,
+      1350, 1350, 1349, 1350, 1349, 1348, 1350, 1349,
+      1348, 1369, 1350, 1350, 1350, 1349, 1350, 1350,
+      1349, 1350, 1349, 1348, 1350, 1350, 1349, 1350,
+      1349, 1348, 1350, 1349, 1348, 1347, 1350, 1350,
+      1349, 1350, 1349, 1348, 1350, 1349, 1348, 1347,
+      1350, 1349, 1348, 1347, 1361, 1350, 1350, 1350,
+      1349, 1350, 1350, 1349, 1350, 1349, 1348, 1350,
+      1350, 1349, 1350, 1349, 1348, 1350, 1349, 1348,
+      1347, 1350, 1350, 1349, 1350, 1349, 1348, 1350,
+      1349, 1348, 1347, 1350, 1349, 1348, 1347, 1346,
+      1350, 1350, 1349, 1350, 1349, 1348, 1350, 1349,
+      1348, 1347, 1350, 1349, 1348, 1347, 1346, 1350,
+      1349, 1348, 1347, 1346, 1353, 1398, 1390, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      1190, 1197, 1389, 1382, 1382, 1382, 1381, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      876, 1197, 1389, 1205, 1190, 1189, 1197, 1382,
+      1382, 1381, 1398, 1206, 1198, 1390, 1397, 1204,
+      876, 1196, 1389, 1205, 869, 820, 1197, 1190,
+      1188, 1189, 1382, 1381, 1396, 1204, 1182, 1196,
+      1388, 1204, 1182, 1181, 1196, 1182, 1180, 1181,
+      1188, 1188, 1380, 1374, 1374, 1374, 1373, 1374,
+      1374, 1373, 1374, 1373, 1372, 1398, 1206, 1390,
+      1398, 1206, 1198, 1390, 1397, 1205, 876, 1197,
+      1389, 1205, 1190, 1189, 1197, 1382, 1382, 1381,
+      1398, 1206, 1198, 1390, 1397, 1134, 1134, 1134,
+      1389, 1205, 1134, 1134, 1197, 1190, 1134, 1189,
+      1382, 1381, 1396, 1204, 875, 1196, 1388, 1204,
+      1134, 1134, 1196, 868, 1134, 819, 1188, 1188,
+      1380, 1204, 1182, 1181, 1196, 1182, 1134, 1181,
+      1180, 1180, 1188, 1374, 1374, 1373, 1374, 1373,
+      1372, 1398, 1206, 1198, 1390, 1397, 1203, 876,
+      1195, 1389, 1205, 869, 820, 1197, 1190, 1187,
+      1189, 1382, 1381, 1396, 1203, 875, 1195, 1388,
+      1203, 1134, 1134, 1195, 868, 1134, 819, 1187,
+      1187, 1380, 1204, 862, 813, 1196, 861, 1134,
+      812, 771, 770, 1188, 1182, 1179, 1181, 1179,
+      1179, 1180, 1374, 1373, 1372, 1395, 1203, 1174,
+      1195, 1387, 1203, 1174, 1173, 1195, 1174, 1172,
+      1173, 1187, 1187, 1379, 1203, 1174, 1173, 1195,
+      1174, 1134, 1173, 1172, 1172, 1187, 1174, 1171,
+      1173, 1171, 1171, 1172, 1179, 1179, 1179, 1371,
+      1366, 1366, 1366, 1365, 1366, 1366, 1365, 1366,
+      1365, 1364, 1366, 1366, 1365, 1366, 1365, 1364,
+      1366, 1365, 1364, 1363, 1398, 1206, 1390, 1398,
+      1206, 1198, 1390, 1397, 1205, 876, 1197, 1389,
+      1205, 1190, 1189, 1197, 1382, 1382, 1381, 1398,
+      1206, 1198, 1390, 1397, 1128, 876, 1100, 1389,
+      1205, 869, 820, 1197, 1190, 1072, 1189, 1382,
+      1381, 1396, 1204, 875, 1196, 1388, 1204, 862,
+      813, 1196, 868, 771, 819, 1188, 1188, 1380,
+      1204, 1182, 1181, 1196, 1182, 1044, 1181, 1180,
+      1180, 1188, 1374, 1374, 1373, 1374, 1373, 1372,
+      1398, 1206, 1198, 1390, 1397, 1128, 876, 1100,
+      1389, 1205, 869, 820, 1197, 1190, 1072, 1189,
+      1382, 1381, 1396, 1127, 875, 1099, 1388, 1121,
+      1134, 1134, 1133, 868, 1134, 1133, 1071, 1133,
+      1380, 1204, 862, 813, 1196, 861, 1134, 1133,
+      771, 1133, 1188, 1182, 1044, 1181, 1043, 1133,
+      1180, 1374, 1373, 1372, 1395, 1203, 874, 1195,
+      1387, 1203, 855, 806, 1195, 867, 764, 818,
+      1187, 1187, 1379, 1203, 855, 806, 1195, 854,
+      1134, 1133, 764, 1133, 1187, 860, 729, 811,
+      729, 1133, 769, 1179, 1179, 1179, 1371, 1203,
+      1174, 1173, 1195, 1174, 1016, 1173, 1172, 1172,
+      1187, 1174, 1016, 1173, 1015, 1133, 1172, 1171,
+      1171, 1171, 1179, 1366, 1366, 1365, 1366, 1365,
+      1364, 1366, 1365, 1364, 1363, 1398, 1206, 1198,
+      1390, 1397, 1202, 876, 1194, 1389, 1205, 869,
+      820, 1197, 1190, 1186, 1189, 1382, 1381, 1396,
+      1202, 875, 1194, 1388, 1202, 848, 799, 1194,
+      868, 757, 819, 1186, 1186, 1380, 1204, 862,
+      813, 1196, 861, 722, 812, 771, 770, 1188,
+      1182, 1178, 1181, 1178, 1178, 1180, 1374, 1373,
+      1372, 1395, 1202, 874, 1194, 1387, 1202, 848,
+      799, 1194, 867, 757, 818, 1186, 1186, 1379,
+      1202, 848, 799, 1194, 847, 1134, 1133, 757,
+      1133, 1186, 860, 722, 811, 722, 1133, 769,
+      1178, 1178, 1178, 1371, 1203, 855, 806, 1195,
+      854, 694, 805, 764, 763, 1187, 853, 694,
+      804, 694, 1133, 762, 729, 728, 727, 1179,
+      1174, 1170, 1173, 1170, 1170, 1172, 1170, 1170,
+      1170, 1171, 1366, 1365, 1364, 1363, 1394, 1202,
+      1166, 1194, 1386, 1202, 1166, 1165, 1194, 1166,
+      1164, 1165, 1186, 1186, 1378, 1202, 1166, 1165,
+      1194, 1166, 988, 1165, 1164, 1164, 1186, 1166,
+      1163, 1165, 1163, 1163, 1164, 1178, 1178, 1178,
+      1370, 1202, 1166, 1165, 1194, 1166, 988, 1165,
+      1164, 1164, 1186, 1166, 988, 1165, 987, 1133,
+      1164, 1163, 1163, 1163, 1178, 1166, 1162, 1165,
+      1162, 1162, 1164, 1162, 1162, 1162, 1163, 1170,
+      1170, 1170, 1170, 1362, 1358, 1358, 1358, 1357,
+      1358, 1358, 1357, 1358, 1357, 1356, 1358, 1358,
+      1357, 1358, 1357, 1356, 1358, 1357, 1356, 1355,
+      1358, 1358, 1357, 1358, 1357, 1356, 1358, 1357,
+      1356, 1355, 1358, 1357, 1356, 1355, 1354, 1398,
+      1206, 1390, 1398, 1206, 1198, 1390, 1397, 1205,
+      876, 1197, 1389, 1205, 1190, 1189, 1197, 1382,
+      1382, 1381, 1398, 1206, 1198, 1390, 1397, 1128,
+      876, 1100, 1389, 1205, 869, 820, 1197, 1190,
+      1072, 1189, 1382, 1381, 1396, 1204, 875, 1196,
+      1388, 1204, 862, 813, 1196, 868, 771, 819,
+      1188, 1188, 1380, 1204, 1182, 1181, 1196, 1182,
+      1044, 1181, 1180, 1180, 1188, 1374, 1374, 1373,
+      1374, 1373, 1372, 1398, 1206, 1198, 1390, 1397,
+      1128, 876, 1100, 1389, 1205, 869, 820, 1197,
+      1190, 1072, 1189, 1382, 1381, 1396, 1127, 875,
+      1099, 1388, 1121, 1134, 1134, 1093, 868, 1134,
+      819, 1071, 1065, 1380, 1204, 862, 813, 1196,
+      861, 1134, 812, 771, 770, 1188, 1182, 1044,
+      1181, 1043, 1037, 1180, 1374, 1373, 1372, 1395,
+      1203, 874, 1195, 1387, 1203, 855, 806, 1195,
+      867, 764, 818, 1187, 1187, 1379, 1203, 855,
+      806, 1195, 854, 1134, 805, 764, 763, 1187,
+      860, 729, 811, 729, 728, 769, 1179, 1179,
+      1179, 1371, 1203, 1174, 1173, 1195, 1174, 1016,
+      1173, 1172, 1172, 1187, 1174, 1016, 1173, 1015,
+      1009, 1172, 1171, 1171, 1171, 1179, 1366, 1366,
+      1365, 1366, 1365, 1364, 1366, 1365, 1364, 1363,
+      1398, 1206, 1198, 1390, 1397, 1128, 876, 1100,
+      1389, 1205, 869, 820, 1197, 1190, 1072, 1189,
+      1382, 1381, 1396, 1127, 875, 1099, 1388, 1121,
+      624, 568, 1093, 868, 512, 819, 1071, 1065,
+      1380, 1204, 862, 813, 1196, 861, 456, 812,
+      771, 770, 1188, 1182, 1044, 1181, 1043, 1037,
+      1180, 1374, 1373, 1372, 1395, 1126, 874, 1098,
+      1387, 1120, 623, 567, 1092, 867, 511, 818,
+      1070, 1064, 1379, 1131, 1131, 1131, 1131, 1132,
+      1134, 1133, 1132, 1133, 1132, 1131, 1131, 1131,
+      1132, 1133, 1132, 1131, 1131, 1132, 1371, 1203,
+      855, 806, 1195, 854, 400, 805, 764, 763,
+      1187, 1131, 1131, 1131, 1132, 1133, 1132, 1131,
+      1131, 1132, 1179, 1174, 1016, 1173, 1015, 1009,
+      1172, 1131, 1131, 1132, 1171, 1366, 1365, 1364,
+      1363, 1394, 1202, 873, 1194, 1386, 1202, 848,
+      799, 1194, 866, 757, 817, 1186, 1186, 1378,
+      1202, 848, 799, 1194, 847, 344, 798, 757,
+      756, 1186, 859, 722, 810, 722, 721, 768,
+      1178, 1178, 1178, 1370, 1202, 848, 799, 1194,
+      847, 344, 798, 757, 756, 1186, 1131, 1131,
+      1131, 1132, 1133, 1132, 1131, 1131, 1132, 1178,
+      852, 694, 803, 694, 693, 761, 1131, 1131,
+      1132, 1131, 1170, 1170, 1170, 1170, 1362, 1202,
+      1166, 1165, 1194, 1166, 988, 1165, 1164, 1164,
+      1186, 1166, 988, 1165, 987, 981, 1164, 1163,
+      1163, 1163, 1178, 1166, 988, 1165, 987, 981,
+      1164, 1131, 1131, 1132, 1163, 1162, 1162, 1162,
+      1162, 1170, 1358, 1358, 1357, 1358, 1357, 1356,
+      1358, 1357, 1356, 1355, 1358, 1357, 1356, 1355,
+      1354, 1398, 1206, 1198, 1390, 1397, 1201, 876,
+      1193, 1389, 1205, 869, 820, 1197, 1190, 1185,
+      1189, 1382, 1381, 1396, 1201, 875, 1193, 1388,
+      1201, 841, 792, 1193, 868, 750, 819, 1185,
+      1185, 1380, 1204, 862, 813, 1196, 861, 715,
+      812, 771, 770, 1188, 1182, 1177, 1181, 1177,
+      1177, 1180, 1374, 1373, 1372, 1395, 1201, 874,
+      1193, 1387, 1201, 841, 792, 1193, 867, 750,
+      818, 1185, 1185, 1379, 1201, 841, 792, 1193,
+      840, 1134, 791, 750, 749, 1185, 860, 715,
+      811, 715, 714, 769, 1177, 1177, 1177, 1371,
+      1203, 855, 806, 1195, 854, 687, 805, 764,
+      763, 1187, 853, 687, 804, 687, 686, 762,
+      729, 728, 727, 1179, 1174, 1169, 1173, 1169,
+      1169, 1172, 1169, 1169, 1169, 1171, 1366, 1365,
+      1364, 1363, 1394, 1201, 873, 1193, 1386, 1201,
+      841, 792, 1193, 866, 750, 817, 1185, 1185,
+      1378, 1201, 841, 792, 1193, 840, 288, 791,
+      750, 749, 1185, 859, 715, 810, 715, 714,
+      768, 1177, 1177, 1177, 1370, 1201, 841, 792,
+      1193, 840, 288, 791, 750, 749, 1185, 1131,
+      1131, 1131, 1132, 1133, 1132, 1131, 1131, 1132,
+      1177, 852, 687, 803, 687, 686, 761, 1131,
+      1131, 1132, 1131, 1169, 1169, 1169, 1169, 1362,
+      1202, 848, 799, 1194, 847, 666, 798, 757,
+      756, 1186, 846, 666, 797, 666, 665, 755,
+      722, 721, 720, 1178, 845, 666, 796, 666,
+      665, 754, 1131, 1131, 1132, 1131, 694, 693,
+      692, 1131, 1170, 1166, 1161, 1165, 1161, 1161,
+      1164, 1161, 1161, 1161, 1163, 1161, 1161, 1161,
+      1161, 1162, 1358, 1357, 1356, 1355, 1354, 1393,
+      1201, 1158, 1193, 1385, 1201, 1158, 1157, 1193,
+      1158, 1156, 1157, 1185, 1185, 1377, 1201, 1158,
+      1157, 1193, 1158, 960, 1157, 1156, 1156, 1185,
+      1158, 1155, 1157, 1155, 1155, 1156, 1177, 1177,
+      1177, 1369, 1201, 1158, 1157, 1193, 1158, 960,
+      1157, 1156, 1156, 1185, 1158, 960, 1157, 959,
+      953, 1156, 1155, 1155, 1155, 1177, 1158, 1154,
+      1157, 1154, 1154, 1156, 1154, 1154, 1154, 1155,
+      1169, 1169, 1169, 1169, 1361, 1201, 1158, 1157,
+      1193, 1158, 960, 1157, 1156, 1156, 1185, 1158,
+      960, 1157, 959, 953, 1156, 1155, 1155, 1155,
+      1177, 1158, 960, 1157, 959, 953, 1156, 1131,
+      1131, 1132, 1155, 1154, 1154, 1154, 1154, 1169,
+      1158, 1153, 1157, 1153, 1153, 1156, 1153, 1153,
+      1153, 1155, 1153, 1153, 1153, 1153, 1154, 1161,
+      1161, 1161, 1161, 1161, 1353, 1350, 1350, 1350,
+      1349, 1350, 1350, 1349, 1350, 1349, 1348, 1350,
+      1350, 1349, 1350, 1349, 1348, 1350, 1349, 1348,
+      1347, 1350, 1350, 1349, 1350, 1349, 1348, 1350,
+      1349, 1348, 1347, 1350, 1349, 1348, 1347, 1346,
+      1350, 1350, 1349, 1350, 1349, 1348, 1350, 1349,
+      1348, 1347, 1350, 1349, 1348, 1347, 1346, 1350,
+      1349, 1348, 1347, 1346, 1345, 1398, 1206, 1390,
+      1398, 1206, 1198, 1390, 1397, 1205, 876, 1197,
+      1389, 1205, 1190, 1189, 1197, 1382, 1382, 1381,
+      1398, 1206, 1198, 1390, 1397, 1200, 876, 1192,
+      1389, 1205, 869, 820, 1197, 1190, 1184, 1189,
+      1382, 1381, 1396, 1204, 875, 1196, 1388, 1204,
+      862, 813, 1196, 868, 771, 819, 1188, 1188,
+      1380, 1204, 1182, 1181, 1196, 1182, 1176, 1181,
+      1180, 1180, 1188, 1374, 1374, 1373, 1374, 1373,
+      1372, 1398, 1206, 1198, 1390, 1397, 1200, 876,
+      1192, 1389, 1205, 869, 820, 1197, 1190, 1184,
+      1189, 1382, 1381, 1396, 1200, 875, 1192, 1388,
+      1200, 1134, 1134, 1192, 868, 1134, 819, 1184,
+      1184, 1380, 1204, 862, 813, 1196, 861, 1134,
+      812, 771, 770, 1188, 1182, 1176, 1181, 1176,
+      1176, 1180, 1374, 1373, 1372, 1395, 1203, 874,
+      1195, 1387, 1203, 855, 806, 1195, 867, 764,
+      818, 1187, 1187, 1379, 1203, 855, 806, 1195,
+      854, 1134, 805, 764, 763, 1187, 860, 729,
+      811, 729, 728, 769, 1179, 1179, 1179, 1371,
+      1203, 1174, 1173, 1195, 1174, 1168, 1173, 1172,
+      1172, 1187, 1174, 1168, 1173, 1168, 1168, 1172,
+      1171, 1171, 1171, 1179, 1366, 1366, 1365, 1366,
+      1365, 1364, 1366, 1365, 1364, 1363, 1398, 1206,
+      1198, 1390, 1397, 1200, 876, 1192, 1389, 1205,
+      869, 820, 1197, 1190, 1184, 1189, 1382, 1381,
+      1396, 1200, 875, 1192, 1388, 1200, 834, 785,
+      1192, 868, 743, 819, 1184, 1184, 1380, 1204,
+      862, 813, 1196, 861, 708, 812, 771, 770,
+      1188, 1182, 1176, 1181, 1176, 1176, 1180, 1374,
+      1373, 1372, 1395, 1200, 874, 1192, 1387, 1200,
+      834, 785, 1192, 867, 743, 818, 1184, 1184,
+      1379, 1200, 834, 785, 1192, 833, 1134, 1133,
+      743, 1133, 1184, 860, 708, 811, 708, 1133,
+      769, 1176, 1176, 1176, 1371, 1203, 855, 806,
+      1195, 854, 680, 805, 764, 763, 1187, 853,
+      680, 804, 680, 1133, 762, 729, 728, 727,
+      1179, 1174, 1168, 1173, 1168, 1168, 1172, 1168,
+      1168, 1168, 1171, 1366, 1365, 1364, 1363, 1394,
+      1202, 873, 1194, 1386, 1202, 848, 799, 1194,
+      866, 757, 817, 1186, 1186, 1378, 1202, 848,
+      799, 1194, 847, 659, 798, 757, 756, 1186,
+      859, 722, 810, 722, 721, 768, 1178, 1178,
+      1178, 1370, 1202, 848, 799, 1194, 847, 659,
+      798, 757, 756, 1186, 846, 659, 797, 659,
+      1133, 755, 722, 721, 720, 1178, 852, 694,
+      803, 694, 693, 761, 694, 693, 692, 726,
+      1170, 1170, 1170, 1170, 1362, 1202, 1166, 1165,
+      1194, 1166, 1160, 1165, 1164, 1164, 1186, 1166,
+      1160, 1165, 1160, 1160, 1164, 1163, 1163, 1163,
+      1178, 1166, 1160, 1165, 1160, 1160, 1164, 1160,
+      1160, 1160, 1163, 1162, 1162, 1162, 1162, 1170,
+      1358, 1358, 1357, 1358, 1357, 1356, 1358, 1357,
+      1356, 1355, 1358, 1357, 1356, 1355, 1354, 1398,
+      1206, 1198, 1390, 1397, 1200, 876, 1192, 1389,
+      1205, 869, 820, 1197, 1190, 1184, 1189, 1382,
+      1381, 1396, 1200, 875, 1192, 1388, 1200, 834,
+      785, 1192, 868, 743, 819, 1184, 1184, 1380,
+      1204, 862, 813, 1196, 861, 708, 812, 771,
+      770, 1188, 1182, 1176, 1181, 1176, 1176, 1180,
+      1374, 1373, 1372, 1395, 1200, 874, 1192, 1387,
+      1200, 834, 785, 1192, 867, 743, 818, 1184,
+      1184, 1379, 1200, 834, 785, 1192, 833, 1134,
+      784, 743, 742, 1184, 860, 708, 811, 708,
+      707, 769, 1176, 1176, 1176, 1371, 1203, 855,
+      806, 1195, 854, 680, 805, 764, 763, 1187,
+      853, 680, 804, 680, 679, 762, 729, 728,
+      727, 1179, 1174, 1168, 1173, 1168, 1168, 1172,
+      1168, 1168, 1168, 1171, 1366, 1365, 1364, 1363,
+      1394, 1200, 873, 1192, 1386, 1200, 834, 785,
+      1192, 866, 743, 817, 1184, 1184, 1378, 1200,
+      834, 785, 1192, 833, 232, 784, 743, 742,
+      1184, 859, 708, 810, 708, 707, 768, 1176,
+      1176, 1176, 1370, 1200, 834, 785, 1192, 833,
+      232, 784, 743, 742, 1184, 1131, 1131, 1131,
+      1132, 1133, 1132, 1131, 1131, 1132, 1176, 852,
+      680, 803, 680, 679, 761, 1131, 1131, 1132,
+      1131, 1168, 1168, 1168, 1168, 1362, 1202, 848,
+      799, 1194, 847, 659, 798, 757, 756, 1186,
+      846, 659, 797, 659, 658, 755, 722, 721,
+      720, 1178, 845, 659, 796, 659, 658, 754,
+      1131, 1131, 1132, 1131, 694, 693, 692, 1131,
+      1170, 1166, 1160, 1165, 1160, 1160, 1164, 1160,
+      1160, 1160, 1163, 1160, 1160, 1160, 1160, 1162,
+      1358, 1357, 1356, 1355, 1354, 1393, 1201, 872,
+      1193, 1385, 1201, 841, 792, 1193, 865, 750,
+      816, 1185, 1185, 1377, 1201, 841, 792, 1193,
+      840, 645, 791, 750, 749, 1185, 858, 715,
+      809, 715, 714, 767, 1177, 1177, 1177, 1369,
+      1201, 841, 792, 1193, 840, 645, 791, 750,
+      749, 1185, 839, 645, 790, 645, 644, 748,
+      715, 714, 713, 1177, 851, 687, 802, 687,
+      686, 760, 687, 686, 685, 725, 1169, 1169,
+      1169, 1169, 1361, 1201, 841, 792, 1193, 840,
+      645, 791, 750, 749, 1185, 839, 645, 790,
+      645, 644, 748, 715, 714, 713, 1177, 838,
+      645, 789, 645, 644, 747, 1131, 1131, 1132,
+      1131, 687, 686, 685, 1131, 1169, 844, 666,
+      795, 666, 665, 753, 666, 665, 664, 718,
+      666, 665, 664, 1131, 690, 1161, 1161, 1161,
+      1161, 1161, 1353, 1201, 1158, 1157, 1193, 1158,
+      1152, 1157, 1156, 1156, 1185, 1158, 1152, 1157,
+      1152, 1152, 1156, 1155, 1155, 1155, 1177, 1158,
+      1152, 1157, 1152, 1152, 1156, 1152, 1152, 1152,
+      1155, 1154, 1154, 1154, 1154, 1169, 1158, 1152,
+      1157, 1152, 1152, 1156, 1152, 1152, 1152, 1155,
+      1152, 1152, 1152, 1152, 1154, 1153, 1153, 1153,
+      1153, 1153, 1161, 1350, 1350, 1349, 1350, 1349,
+      1348, 1350, 1349, 1348, 1347, 1350, 1349, 1348,
+      1347, 1346, 1350, 1349, 1348, 1347, 1346, 1345,
+      1398, 1206, 1198, 1390, 1397, 1200, 1150, 1192,
+      1389, 1205, 1150, 1149, 1197, 1190, 1184, 1189,
+      1382, 1381, 1396, 1200, 1150, 1192, 1388, 1200,
+      1150, 1149, 1192, 1150, 1148, 1149, 1184, 1184,
+      1380, 1204, 1150, 1149, 1196, 1150, 1147, 1149,
+      1148, 1148, 1188, 1182, 1176, 1181, 1176, 1176,
+      1180, 1374, 1373, 1372, 1395, 1200, 1150, 1192,
+      1387, 1200, 1150, 1149, 1192, 1150, 1148, 1149,
+      1184, 1184, 1379, 1200, 1150, 1149, 1192, 1150,
+      1134, 1149, 1148, 1148, 1184, 1150, 1147, 1149,
+      1147, 1147, 1148, 1176, 1176, 1176, 1371, 1203,
+      1150, 1149, 1195, 1150, 1146, 1149, 1148, 1148,
+      1187, 1150, 1146, 1149, 1146, 1146, 1148, 1147,
+      1147, 1147, 1179, 1174, 1168, 1173, 1168, 1168,
+      1172, 1168, 1168, 1168, 1171, 1366, 1365, 1364,
+      1363, 1394, 1200, 1150, 1192, 1386, 1200, 1150,
+      1149, 1192, 1150, 1148, 1149, 1184, 1184, 1378,
+      1200, 1150, 1149, 1192, 1150, 932, 1149, 1148,
+      1148, 1184, 1150, 1147, 1149, 1147, 1147, 1148,
+      1176, 1176, 1176, 1370, 1200, 1150, 1149, 1192,
+      1150, 932, 1149, 1148, 1148, 1184, 1150, 932,
+      1149, 931, 1133, 1148, 1147, 1147, 1147, 1176,
+      1150, 1146, 1149, 1146, 1146, 1148, 1146, 1146,
+      1146, 1147, 1168, 1168, 1168, 1168, 1362, 1202,
+      1150, 1149, 1194, 1150, 1145, 1149, 1148, 1148,
+      1186, 1150, 1145, 1149, 1145, 1145, 1148, 1147,
+      1147, 1147, 1178, 1150, 1145, 1149, 1145, 1145,
+      1148, 1145, 1145, 1145, 1147, 1146, 1146, 1146,
+      1146, 1170, 1166, 1160, 1165, 1160, 1160, 1164,
+      1160, 1160, 1160, 1163, 1160, 1160, 1160, 1160,
+      1162, 1358, 1357, 1356, 1355, 1354, 1393, 1200,
+      1150, 1192, 1385, 1200, 1150, 1149, 1192, 1150,
+      1148, 1149, 1184, 1184, 1377, 1200, 1150, 1149,
+      1192, 1150, 932, 1149, 1148, 1148, 1184, 1150,
+      1147, 1149, 1147, 1147, 1148, 1176, 1176, 1176,
+      1369, 1200, 1150, 1149, 1192, 1150, 932, 1149,
+      1148, 1148, 1184, 1150, 932, 1149, 931, 925,
+      1148, 1147, 1147, 1147, 1176, 1150, 1146, 1149,
+      1146, 1146, 1148, 1146, 1146, 1146, 1147, 1168,
+      1168, 1168, 1168, 1361, 1200, 1150, 1149, 1192,
+      1150, 932, 1149, 1148, 1148, 1184, 1150, 932,
+      1149, 931, 925, 1148, 1147, 1147, 1147, 1176,
+      1150, 932, 1149, 931, 925, 1148, 1131, 1131,
+      1132, 1147, 1146, 1146, 1146, 1146, 1168, 1150,
+      1145, 1149, 1145, 1145, 1148, 1145, 1145, 1145,
+      1147, 1145, 1145, 1145, 1145, 1146, 1160, 1160,
+      1160, 1160, 1160, 1353, 1201, 1150, 1149, 1193,
+      1150, 1144, 1149, 1148, 1148, 1185, 1150, 1144,
+      1149, 1144, 1144, 1148, 1147, 1147, 1147, 1177,
+      1150, 1144, 1149, 1144, 1144, 1148, 1144, 1144,
+      1144, 1147, 1146, 1146, 1146, 1146, 1169, 1150,
+      1144, 1149, 1144, 1144, 1148, 1144, 1144, 1144,
+      1147, 1144, 1144, 1144, 1144, 1146, 1145, 1145,
+      1145, 1145, 1145, 1161, 1158, 1152, 1157, 1152,
+      1152, 1156, 1152, 1152, 1152, 1155, 1152, 1152,
+      1152, 1152, 1154, 1152, 1152, 1152, 1152, 1152,
+      1153, 1350, 1349, 1348, 1347, 1346, 1345, 1392,
+      1342, 1342, 1342, 1384, 1342, 1342, 1342, 1341,
+      1342, 1342, 1341, 1342, 1341, 1376, 1342, 1342,
+      1342, 1341, 1342, 1342, 1341, 1342, 1341, 1340,
+      1342, 1342, 1341, 1342, 1341, 1340, 1342, 1341,
+      1340, 1368, 1342, 1342, 1342, 1341, 1342, 1342,
+      1341, 1342, 1341, 1340, 1342, 1342, 1341, 1342,
+      1341, 1340, 1342, 1341, 1340, 1339, 1342, 1342,
+      1341, 1342, 1341, 1340, 1342, 1341, 1340, 1339,
+      1342, 1341, 1340, 1339, 1360, 1342, 1342, 1342,
+      1341, 1342, 1342, 1341, 1342, 1341, 1340, 1342,
+      1342, 1341, 1342, 1341, 1340, 1342, 1341, 1340,
+      1339, 1342, 1342, 1341, 1342, 1341, 1340, 1342,
+      1341, 1340, 1339, 1342, 1341, 1340, 1339, 1338,
+      1342, 1342, 1341, 1342, 1341, 1340, 1342, 1341,
+      1340, 1339, 1342, 1341, 1340, 1339, 1338, 1342,
+      1341, 1340, 1339, 1338, 1352, 1342, 1342, 1342,
+      1341, 1342, 1342, 1341, 1342, 1341, 1340, 1342,
+      1342, 1341, 1342, 1341, 1340, 1342, 1341, 1340,
+      1339, 1342, 1342, 1341, 1342, 1341, 1340, 1342,
+      1341, 1340, 1339, 1342, 1341, 1340, 1339, 1338,
+      1342, 1342, 1341, 1342, 1341, 1340, 1342, 1341,
+      1340, 1339, 1342, 1341, 1340, 1339, 1338, 1342,
+      1341, 1340, 1339, 1338, 1337, 1342, 1342, 1341,
+      1342, 1341, 1340, 1342, 1341, 1340, 1339, 1342,
+      1341, 1340, 1339, 1338, 1342, 1341, 1340, 1339,
+      1338, 1337, 1342, 1341, 1340, 1339, 1338, 1337,
+      1344, 1398, 1390, 1398, 1206, 1390, 1398, 1206,
+      1198, 1390, 1397, 1205, 1190, 1197, 1389, 1382,
+      1382, 1382, 1381, 1398, 1206, 1390, 1398, 1206,
+      1198, 1390, 1397, 1205, 876, 1197, 1389, 1205,
+      1190, 1189, 1197, 1382, 1382, 1381, 1398, 1206,
+      1198, 1390, 1397, 1204, 876, 1196, 1389, 1205,
+      869, 820, 1197, 1190, 1188, 1189, 1382, 1381,
+      1396, 1204, 1182, 1196, 1388, 1204, 1182, 1181,
+      1196, 1182, 1180, 1181, 1188, 1188, 1380, 1374,
+      1374, 1374, 1373, 1374, 1374, 1373, 1374, 1373,
+      1372, 1398, 1206, 1390, 1398, 1206, 1198, 1390,
+      1397, 1205, 876, 1197, 1389, 1205, 1190, 1189,
+      1197, 1382, 1382, 1381, 1398, 1206, 1198, 1390,
+      1397, 1134, 1134, 1134, 1389, 1205, 1134, 1134,
+      1197, 1190, 1134, 1189, 1382, 1381, 1396, 1204,
+      875, 1196, 1388, 1204, 1134, 1134, 1196, 868,
+      1134, 819, 1188, 1188, 1380, 1204, 1182, 1181,
+      1196, 1182, 1134, 1181, 1180, 1180, 1188, 1374,
+      1374, 1373, 1374, 1373, 1372, 1398, 1206, 1198,
+      1390, 1397, 1203, 876, 1195, 1389, 1205, 869,
+      820, 1197, 1190, 1187, 1189, 1382, 1381, 1396,
+      1203, 875, 1195, 1388, 1203, 1134, 1134, 1195,
+      868, 1134, 819, 1187, 1187, 1380, 1204, 862,
+      813, 1196, 861, 1134, 812, 771, 770, 1188,
+      1182, 1179, 1181, 1179, 1179, 1180, 1374, 1373,
+      1372, 1395, 1203, 1174, 1195, 1387, 1203, 1174,
+      1173, 1195, 1174, 1172, 1173, 1187, 1187, 1379,
+      1203, 1174, 1173, 1195, 1174, 1134, 1173, 1172,
+      1172, 1187, 1174, 1171, 1173, 1171, 1171, 1172,
+      1179, 1179, 1179, 1371, 1366, 1366, 1366, 1365,
+      1366, 1366, 1365, 1366, 1365, 1364, 1366, 1366,
+      1365, 1366, 1365, 1364, 1366, 1365, 1364, 1363,
+      1398, 1206, 1390, 1398, 1206, 1198, 1390, 1397,
+      1205, 876, 1197, 1389, 1205, 1190, 1189, 1197,
+      1382, 1382, 1381, 1398, 1206, 1198, 1390, 1397,
+      1128, 876, 1100, 1389, 1205, 869, 820, 1197,
+      1190, 1072, 1189, 1382, 1381, 1396, 1204, 875,
+      1196, 1388, 1204, 862, 813, 1196, 868, 771,
+      819, 1188, 1188, 1380, 1204, 1182, 1181, 1196,
+      1182, 1044, 1181, 1180, 1180, 1188, 1374, 1374,
+      1373, 1374, 1373, 1372, 1398, 1206, 1198, 1390,
+      1397, 1128, 876, 1100, 1389, 1205, 869, 820,
+      1197, 1190, 1072, 1189, 1382, 1381, 1396, 1127,
+      875, 1099, 1388, 1121, 1134, 1134, 1133, 868,
+      1134, 1133, 1071, 1133, 1380, 1204, 862, 813,
+      1196, 861, 1134, 1133, 771, 1133, 1188, 1182,
+      1044, 1181, 1043, 1133, 1180, 1374, 1373, 1372,
+      1395, 1203, 874, 1195, 1387, 1203, 855, 806,
+      1195, 867, 764, 818, 1187, 1187, 1379, 1203,
+      855, 806, 1195, 854, 1134, 1133, 764, 1133,
+      1187, 860, 729, 811, 729, 1133, 769, 1179,
+      1179, 1179, 1371, 1203, 1174, 1173, 1195, 1174,
+      1016, 1173, 1172, 1172, 1187, 1174, 1016, 1173,
+      1015, 1133, 1172, 1171, 1171, 1171, 1179, 1366,
+      1366, 1365, 1366, 1365, 1364, 1366, 1365, 1364,
+      1363, 1398, 1206, 1198, 1390, 1397, 1202, 876,
+      1194, 1389, 1205, 869, 820, 1197, 1190, 1186,
+      1189, 1382, 1381, 1396, 1202, 875, 1194, 1388,
+      1202, 848, 799, 1194, 868, 757, 819, 1186,
+      1186, 1380, 1204, 862, 813, 1196, 861, 722,
+      812, 771, 770, 1188, 1182, 1178, 1181, 1178,
+      1178, 1180, 1374, 1373, 1372, 1395, 1202, 874,
+      1194, 1387, 1202, 848, 799, 1194, 867, 757,
+      818, 1186, 1186, 1379, 1202, 848, 799, 1194,
+      847, 1134, 1133, 757, 1133, 1186, 860, 722,
+      811, 722, 1133, 769, 1178, 1178, 1178, 1371,
+      1203, 855, 806, 1195, 854, 694, 805, 764,
+      763, 1187, 853, 694, 804, 694, 1133, 762,
+      729, 728, 727, 1179, 1174, 1170, 1173, 1170,
+      1170, 1172, 1170, 1170, 1170, 1171, 1366, 1365,
+      1364, 1363, 1394, 1202, 1166, 1194, 1386, 1202,
+      1166, 1165, 1194, 1166, 1164, 1165, 1186, 1186,
+      1378, 1202, 1166, 1165, 1194, 1166, 988, 1165,
+      1164, 1164, 1186, 1166, 1163, 1165, 1163, 1163,
+      1164, 1178, 1178, 1178, 1370, 1202, 1166, 1165,
+      1194, 1166, 988, 1165, 1164, 1164, 1186, 1166,
+      988, 1165, 987, 1133, 1164, 1163, 1163, 1163,
+      1178, 1166, 1162, 1165, 1162, 1162, 1164, 1162,
+      1162, 1162, 1163, 1170, 1170, 1170, 1170, 1362,
+      1358, 1358, 1358, 1357, 1358, 1358, 1357, 1358,
+      1357, 1356, 1358, 1358, 1357, 1358, 1357, 1356,
+      1358, 1357, 1356, 1355, 1358, 1358, 1357, 1358,
+      1357, 1356, 1358, 1357, 1356, 1355, 1358, 1357,
+      1356, 1355, 1354, 1398, 1206, 1390, 1398, 1206,
+      1198, 1390, 1397, 1205, 876, 1197, 1389, 1205,
+      1190, 1189, 1197, 1382, 1382, 1381, 1398, 1206,
+      1198, 1390, 1397, 1128, 876, 1100, 1389, 1205,
+      869, 820, 1197, 1190, 1072, 1189, 1382, 1381,
+      1396, 1204, 875, 1196, 1388, 1204, 862, 813,
+      1196, 868, 771, 819, 1188, 1188, 1380, 1204,
+      1182, 1181, 1196, 1182, 1044, 1181, 1180, 1180,
+      1188, 1374, 1374, 1373, 1374, 1373, 1372, 1398,
+      1206, 1198, 1390, 1397, 1128, 876, 1100, 1389,
+      1205, 869, 820, 1197, 1190, 1072, 1189, 1382,
+      1381, 1396, 1127, 875, 1099, 1388, 1121, 1134,
+      1134, 1093, 868, 1134, 819, 1071, 1065, 1380,
+      1204, 862, 813, 1196, 861, 1134, 812, 771,
+      770, 1188, 1182, 1044, 1181, 1043, 1037, 1180,
+      1374, 1373, 1372, 1395, 1203, 874, 1195, 1387,
+      1203, 855, 806, 1195, 867, 764, 818, 1187,
+      1187, 1379, 1203, 855, 806, 1195, 854, 1134,
+      805, 764, 763, 1187, 860, 729, 811, 729,
+      728, 769, 1179, 1179, 1179, 1371, 1203, 1174,
+      1173, 1195, 1174, 1016, 1173, 1172, 1172, 1187,
+      1174, 1016, 1173, 1015, 1009, 1172, 1171, 1171,
+      1171, 1179, 1366, 1366, 1365, 1366, 1365, 1364,
+      1366, 1365, 1364, 1363, 1398, 1206, 1198, 1390,
+      1397, 1128, 876, 1100, 1389, 1205, 869, 820,
+      1197, 1190, 1072, 1189, 1382, 1381, 1396, 1127,
+      875, 1099, 1388, 1121, 624, 568, 1093, 868,
+      512, 819, 1071, 1065, 1380, 1204, 862, 813,
+      1196, 861, 456, 812, 771, 770, 1188, 1182,
+      1044, 1181, 1043, 1037, 1180, 1374, 1373, 1372,
+      1395, 1126, 874, 1098, 1387, 1120, 623, 567,
+      1092, 867, 511, 818, 1070, 1064, 1379, 1115,
+      618, 562, 1087, 1132, 1134, 1133, 1132, 1133,
+      1132, 860, 455, 811, 1132, 1133, 1132, 1042,
+      1036, 1132, 1371, 1203, 855, 806, 1195, 854,
+      400, 805, 764, 763, 1187, 853, 399, 804,
+      1132, 1133, 1132, 729, 728, 1132, 1179, 1174,
+      1016, 1173, 1015, 1009, 1172, 1014, 1008, 1132,
+      1171, 1366, 1365, 1364, 1363, 1394, 1202, 873,
+      1194, 1386, 1202, 848, 799, 1194, 866, 757,
+      817, 1186, 1186, 1378, 1202, 848, 799, 1194,
+      847, 344, 798, 757, 756, 1186, 859, 722,
+      810, 722, 721, 768, 1178, 1178, 1178, 1370,
+      1202, 848, 799, 1194, 847, 344, 798, 757,
+      756, 1186, 846, 343, 797, 1132, 1133, 1132,
+      722, 721, 1132, 1178, 852, 694, 803, 694,
+      693, 761, 694, 693, 1132, 726, 1170, 1170,
+      1170, 1170, 1362, 1202, 1166, 1165, 1194, 1166,
+      988, 1165, 1164, 1164, 1186, 1166, 988, 1165,
+      987, 981, 1164, 1163, 1163, 1163, 1178, 1166,
+      988, 1165, 987, 981, 1164, 986, 980, 1132,
+      1163, 1162, 1162, 1162, 1162, 1170, 1358, 1358,
+      1357, 1358, 1357, 1356, 1358, 1357, 1356, 1355,
+      1358, 1357, 1356, 1355, 1354, 1398, 1206, 1198,
+      1390, 1397, 1201, 876, 1193, 1389, 1205, 869,
+      820, 1197, 1190, 1185, 1189, 1382, 1381, 1396,
+      1201, 875, 1193, 1388, 1201, 841, 792, 1193,
+      868, 750, 819, 1185, 1185, 1380, 1204, 862,
+      813, 1196, 861, 715, 812, 771, 770, 1188,
+      1182, 1177, 1181, 1177, 1177, 1180, 1374, 1373,
+      1372, 1395, 1201, 874, 1193, 1387, 1201, 841,
+      792, 1193, 867, 750, 818, 1185, 1185, 1379,
+      1201, 841, 792, 1193, 840, 1134, 791, 750,
+      749, 1185, 860, 715, 811, 715, 714, 769,
+      1177, 1177, 1177, 1371, 1203, 855, 806, 1195,
+      854, 687, 805, 764, 763, 1187, 853, 687,
+      804, 687, 686, 762, 729, 728, 727, 1179,
+      1174, 1169, 1173, 1169, 1169, 1172, 1169, 1169,
+      1169, 1171, 1366, 1365, 1364, 1363, 1394, 1201,
+      873, 1193, 1386, 1201, 841, 792, 1193, 866,
+      750, 817, 1185, 1185, 1378, 1201, 841, 792,
+      1193, 840, 288, 791, 750, 749, 1185, 859,
+      715, 810, 715, 714, 768, 1177, 1177, 1177,
+      1370, 1201, 841, 792, 1193, 840, 288, 791,
+      750, 749, 1185, 839, 287, 790, 1132, 1133,
+      1132, 715, 714, 1132, 1177, 852, 687, 803,
+      687, 686, 761, 687, 686, 1132, 726, 1169,
+      1169, 1169, 1169, 1362, 1202, 848, 799, 1194,
+      847, 666, 798, 757, 756, 1186, 846, 666,
+      797, 666, 665, 755, 722, 721, 720, 1178,
+      845, 666, 796, 666, 665, 754, 666, 665,
+      1132, 719, 694, 693, 692, 691, 1170, 1166,
+      1161, 1165, 1161, 1161, 1164, 1161, 1161, 1161,
+      1163, 1161, 1161, 1161, 1161, 1162, 1358, 1357,
+      1356, 1355, 1354, 1393, 1201, 1158, 1193, 1385,
+      1201, 1158, 1157, 1193, 1158, 1156, 1157, 1185,
+      1185, 1377, 1201, 1158, 1157, 1193, 1158, 960,
+      1157, 1156, 1156, 1185, 1158, 1155, 1157, 1155,
+      1155, 1156, 1177, 1177, 1177, 1369, 1201, 1158,
+      1157, 1193, 1158, 960, 1157, 1156, 1156, 1185,
+      1158, 960, 1157, 959, 953, 1156, 1155, 1155,
+      1155, 1177, 1158, 1154, 1157, 1154, 1154, 1156,
+      1154, 1154, 1154, 1155, 1169, 1169, 1169, 1169,
+      1361, 1201, 1158, 1157, 1193, 1158, 960, 1157,
+      1156, 1156, 1185, 1158, 960, 1157, 959, 953,
+      1156, 1155, 1155, 1155, 1177, 1158, 960, 1157,
+      959, 953, 1156, 958, 952, 1132, 1155, 1154,
+      1154, 1154, 1154, 1169, 1158, 1153, 1157, 1153,
+      1153, 1156, 1153, 1153, 1153, 1155, 1153, 1153,
+      1153, 1153, 1154, 1161, 1161, 1161, 1161, 1161,
+      1353, 1350, 1350, 1350, 1349, 1350, 1350, 1349,
+      1350, 1349, 1348, 1350, 1350, 1349, 1350, 1349,
+      1348, 1350, 1349, 1348, 1347, 1350, 1350, 1349,
+      1350, 1349, 1348, 1350, 1349, 1348, 1347, 1350,
+      1349, 1348, 1347, 1346, 1350, 1350, 1349, 1350,
+      1349, 1348, 1350, 1349, 1348, 1347, 1350, 1349,
+      1348, 1347, 1346, 1350, 1349, 1348, 1347, 1346,
+      1345, 1398, 1206, 1390, 1398, 1206, 1198, 1390,
+      1397, 1205, 876, 1197, 1389, 1205, 1190, 1189,
+      1197, 1382, 1382, 1381, 1398, 1206, 1198, 1390,
+      1397, 1128, 876, 1100, 1389, 1205, 869, 820,
+      1197, 1190, 1072, 1189, 1382, 1381, 1396, 1204,
+      875, 1196, 1388, 1204, 862, 813, 1196, 868,
+      771, 819, 1188, 1188, 1380, 1204, 1182, 1181,
+      1196, 1182, 1044, 1181, 1180, 1180, 1188, 1374,
+      1374, 1373, 1374, 1373, 1372, 1398, 1206, 1198,
+      1390, 1397, 1128, 876, 1100, 1389, 1205, 869,
+      820, 1197, 1190, 1072, 1189, 1382, 1381, 1396,
+      1127, 875, 1099, 1388, 1121, 1134, 1134, 1093,
+      868, 1134, 819, 1071, 1065, 1380, 1204, 862,
+      813, 1196, 861, 1134, 812, 771, 770, 1188,
+      1182, 1044, 1181, 1043, 1037, 1180, 1374, 1373,
+      1372, 1395, 1203, 874, 1195, 1387, 1203, 855,
+      806, 1195, 867, 764, 818, 1187, 1187, 1379,
+      1203, 855, 806, 1195, 854, 1134, 805, 764,
+      763, 1187, 860, 729, 811, 729, 728, 769,
+      1179, 1179, 1179, 1371, 1203, 1174, 1173, 1195,
+      1174, 1016, 1173, 1172, 1172, 1187, 1174, 1016,
+      1173, 1015, 1009, 1172, 1171, 1171, 1171, 1179,
+      1366, 1366, 1365, 1366, 1365, 1364, 1366, 1365,
+      1364, 1363, 1398, 1206, 1198, 1390, 1397, 1128,
+      876, 1100, 1389, 1205, 869, 820, 1197, 1190,
+      1072, 1189, 1382, 1381, 1396, 1127, 875, 1099,
+      1388, 1121, 624, 568, 1093, 868, 512, 819,
+      1071, 1065, 1380, 1204, 862, 813, 1196, 861,
+      456, 812, 771, 770, 1188, 1182, 1044, 1181,
+      1043, 1037, 1180, 1374, 1373, 1372, 1395, 1126,
+      874, 1098, 1387, 1120, 623, 567, 1092, 867,
+      511, 818, 1070, 1064, 1379, 1115, 618, 562,
+      1087, 603, 1134, 1133, 506, 1133, 1059, 860,
+      455, 811, 450, 1133, 769, 1042, 1036, 1031,
+      1371, 1203, 855, 806, 1195, 854, 400, 805,
+      764, 763, 1187, 853, 399, 804, 394, 1133,
+      762, 729, 728, 727, 1179, 1174, 1016, 1173,
+      1015, 1009, 1172, 1014, 1008, 1003, 1171, 1366,
+      1365, 1364, 1363, 1394, 1202, 873, 1194, 1386,
+      1202, 848, 799, 1194, 866, 757, 817, 1186,
+      1186, 1378, 1202, 848, 799, 1194, 847, 344,
+      798, 757, 756, 1186, 859, 722, 810, 722,
+      721, 768, 1178, 1178, 1178, 1370, 1202, 848,
+      799, 1194, 847, 344, 798, 757, 756, 1186,
+      846, 343, 797, 338, 1133, 755, 722, 721,
+      720, 1178, 852, 694, 803, 694, 693, 761,
+      694, 693, 692, 726, 1170, 1170, 1170, 1170,
+      1362, 1202, 1166, 1165, 1194, 1166, 988, 1165,
+      1164, 1164, 1186, 1166, 988, 1165, 987, 981,
+      1164, 1163, 1163, 1163, 1178, 1166, 988, 1165,
+      987, 981, 1164, 986, 980, 975, 1163, 1162,
+      1162, 1162, 1162, 1170, 1358, 1358, 1357, 1358,
+      1357, 1356, 1358, 1357, 1356, 1355, 1358, 1357,
+      1356, 1355, 1354, 1398, 1206, 1198, 1390, 1397,
+      1128, 876, 1100, 1389, 1205, 869, 820, 1197,
+      1190, 1072, 1189, 1382, 1381, 1396, 1127, 875,
+      1099, 1388, 1121, 624, 568, 1093, 868, 512,
+      819, 1071, 1065, 1380, 1204, 862, 813, 1196,
+      861, 456, 812, 771, 770, 1188, 1182, 1044,
+      1181, 1043, 1037, 1180, 1374, 1373, 1372, 1395,
+      1126, 874, 1098, 1387, 1120, 623, 567, 1092,
+      867, 511, 818, 1070, 1064, 1379, 1115, 618,
+      562, 1087, 603, 1134, 547, 506, 491, 1059,
+      860, 455, 811, 450, 435, 769, 1042, 1036,
+      1031, 1371, 1203, 855, 806, 1195, 854, 400,
+      805, 764, 763, 1187, 853, 399, 804, 394,
+      379, 762, 729, 728, 727, 1179, 1174, 1016,
+      1173, 1015, 1009, 1172, 1014, 1008, 1003, 1171,
+      1366, 1365, 1364, 1363, 1394, 1129, 1129, 1129,
+      1386, 1129, 1129, 1129, 1091, 1129, 1129, 817,
+      1129, 1063, 1378, 1129, 1129, 1129, 1086, 1129,
+      1129, 546, 1129, 490, 1058, 1129, 1129, 810,
+      1129, 434, 768, 1129, 1035, 1030, 1370, 1130,
+      1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130,
+      1130, 1131, 1131, 1131, 1132, 1133, 1132, 1131,
+      1131, 1132, 1131, 1130, 1130, 1130, 1130, 1130,
+      1130, 1131, 1131, 1132, 1131, 1130, 1130, 1130,
+      1131, 1362, 1202, 1129, 1129, 1194, 1129, 1129,
+      798, 1129, 756, 1186, 1129, 1129, 797, 1129,
+      323, 755, 1129, 721, 720, 1178, 1130, 1130,
+      1130, 1130, 1130, 1130, 1131, 1131, 1132, 1131,
+      1130, 1130, 1130, 1131, 1170, 1166, 1129, 1165,
+      1129, 981, 1164, 1129, 980, 975, 1163, 1130,
+      1130, 1130, 1131, 1162, 1358, 1357, 1356, 1355,
+      1354, 1393, 1201, 872, 1193, 1385, 1201, 841,
+      792, 1193, 865, 750, 816, 1185, 1185, 1377,
+      1201, 841, 792, 1193, 840, 288, 791, 750,
+      749, 1185, 858, 715, 809, 715, 714, 767,
+      1177, 1177, 1177, 1369, 1201, 841, 792, 1193,
+      840, 288, 791, 750, 749, 1185, 839, 287,
+      790, 282, 267, 748, 715, 714, 713, 1177,
+      851, 687, 802, 687, 686, 760, 687, 686,
+      685, 725, 1169, 1169, 1169, 1169, 1361, 1201,
+      1129, 1129, 1193, 1129, 1129, 791, 1129, 749,
+      1185, 1129, 1129, 790, 1129, 267, 748, 1129,
+      714, 713, 1177, 1130, 1130, 1130, 1130, 1130,
+      1130, 1131, 1131, 1132, 1131, 1130, 1130, 1130,
+      1131, 1169, 1129, 1129, 795, 1129, 665, 753,
+      1129, 665, 664, 718, 1130, 1130, 1130, 1131,
+      1130, 1161, 1161, 1161, 1161, 1161, 1353, 1201,
+      1158, 1157, 1193, 1158, 960, 1157, 1156, 1156,
+      1185, 1158, 960, 1157, 959, 953, 1156, 1155,
+      1155, 1155, 1177, 1158, 960, 1157, 959, 953,
+      1156, 958, 952, 947, 1155, 1154, 1154, 1154,
+      1154, 1169, 1158, 1129, 1157, 1129, 953, 1156,
+      1129, 952, 947, 1155, 1130, 1130, 1130, 1131,
+      1154, 1153, 1153, 1153, 1153, 1153, 1161, 1350,
+      1350, 1349, 1350, 1349, 1348, 1350, 1349, 1348,
+      1347, 1350, 1349, 1348, 1347, 1346, 1350, 1349,
+      1348, 1347, 1346, 1345, 1398, 1206, 1198, 1390,
+      1397, 1200, 876, 1192, 1389, 1205, 869, 820,
+      1197, 1190, 1184, 1189, 1382, 1381, 1396, 1200,
+      875, 1192, 1388, 1200, 834, 785, 1192, 868,
+      743, 819, 1184, 1184, 1380, 1204, 862, 813,
+      1196, 861, 708, 812, 771, 770, 1188, 1182,
+      1176, 1181, 1176, 1176, 1180, 1374, 1373, 1372,
+      1395, 1200, 874, 1192, 1387, 1200, 834, 785,
+      1192, 867, 743, 818, 1184, 1184, 1379, 1200,
+      834, 785, 1192, 833, 1134, 784, 743, 742,
+      1184, 860, 708, 811, 708, 707, 769, 1176,
+      1176, 1176, 1371, 1203, 855, 806, 1195, 854,
+      680, 805, 764, 763, 1187, 853, 680, 804,
+      680, 679, 762, 729, 728, 727, 1179, 1174,
+      1168, 1173, 1168, 1168, 1172, 1168, 1168, 1168,
+      1171, 1366, 1365, 1364, 1363, 1394, 1200, 873,
+      1192, 1386, 1200, 834, 785, 1192, 866, 743,
+      817, 1184, 1184, 1378, 1200, 834, 785, 1192,
+      833, 232, 784, 743, 742, 1184, 859, 708,
+      810, 708, 707, 768, 1176, 1176, 1176, 1370,
+      1200, 834, 785, 1192, 833, 232, 784, 743,
+      742, 1184, 832, 231, 783, 226, 1133, 741,
+      708, 707, 706, 1176, 852, 680, 803, 680,
+      679, 761, 680, 679, 678, 726, 1168, 1168,
+      1168, 1168, 1362, 1202, 848, 799, 1194, 847,
+      659, 798, 757, 756, 1186, 846, 659, 797,
+      659, 658, 755, 722, 721, 720, 1178, 845,
+      659, 796, 659, 658, 754, 659, 658, 657,
+      719, 694, 693, 692, 691, 1170, 1166, 1160,
+      1165, 1160, 1160, 1164, 1160, 1160, 1160, 1163,
+      1160, 1160, 1160, 1160, 1162, 1358, 1357, 1356,
+      1355, 1354, 1393, 1200, 872, 1192, 1385, 1200,
+      834, 785, 1192, 865, 743, 816, 1184, 1184,
+      1377, 1200, 834, 785, 1192, 833, 232, 784,
+      743, 742, 1184, 858, 708, 809, 708, 707,
+      767, 1176, 1176, 1176, 1369, 1200, 834, 785,
+      1192, 833, 232, 784, 743, 742, 1184, 832,
+      231, 783, 226, 211, 741, 708, 707, 706,
+      1176, 851, 680, 802, 680, 679, 760, 680,
+      679, 678, 725, 1168, 1168, 1168, 1168, 1361,
+      1200, 1129, 1129, 1192, 1129, 1129, 784, 1129,
+      742, 1184, 1129, 1129, 783, 1129, 211, 741,
+      1129, 707, 706, 1176, 1130, 1130, 1130, 1130,
+      1130, 1130, 1131, 1131, 1132, 1131, 1130, 1130,
+      1130, 1131, 1168, 1129, 1129, 795, 1129, 658,
+      753, 1129, 658, 657, 718, 1130, 1130, 1130,
+      1131, 1130, 1160, 1160, 1160, 1160, 1160, 1353,
+      1201, 841, 792, 1193, 840, 645, 791, 750,
+      749, 1185, 839, 645, 790, 645, 644, 748,
+      715, 714, 713, 1177, 838, 645, 789, 645,
+      644, 747, 645, 644, 643, 712, 687, 686,
+      685, 684, 1169, 1129, 1129, 788, 1129, 644,
+      746, 1129, 644, 643, 711, 1130, 1130, 1130,
+      1131, 1130, 1129, 665, 664, 663, 1130, 1161,
+      1158, 1152, 1157, 1152, 1152, 1156, 1152, 1152,
+      1152, 1155, 1152, 1152, 1152, 1152, 1154, 1152,
+      1152, 1152, 1152, 1152, 1153, 1350, 1349, 1348,
+      1347, 1346, 1345, 1392, 1200, 1150, 1192, 1384,
+      1200, 1150, 1149, 1192, 1150, 1148, 1149, 1184,
+      1184, 1376, 1200, 1150, 1149, 1192, 1150, 932,
+      1149, 1148, 1148, 1184, 1150, 1147, 1149, 1147,
+      1147, 1148, 1176, 1176, 1176, 1368, 1200, 1150,
+      1149, 1192, 1150, 932, 1149, 1148, 1148, 1184,
+      1150, 932, 1149, 931, 925, 1148, 1147, 1147,
+      1147, 1176, 1150, 1146, 1149, 1146, 1146, 1148,
+      1146, 1146, 1146, 1147, 1168, 1168, 1168, 1168,
+      1360, 1200, 1150, 1149, 1192, 1150, 932, 1149,
+      1148, 1148, 1184, 1150, 932, 1149, 931, 925,
+      1148, 1147, 1147, 1147, 1176, 1150, 932, 1149,
+      931, 925, 1148, 930, 924, 919, 1147, 1146,
+      1146, 1146, 1146, 1168, 1150, 1145, 1149, 1145,
+      1145, 1148, 1145, 1145, 1145, 1147, 1145, 1145,
+      1145, 1145, 1146, 1160, 1160, 1160, 1160, 1160,
+      1352, 1200, 1150, 1149, 1192, 1150, 932, 1149,
+      1148, 1148, 1184, 1150, 932, 1149, 931, 925,
+      1148, 1147, 1147, 1147, 1176, 1150, 932, 1149,
+      931, 925, 1148, 930, 924, 919, 1147, 1146,
+      1146, 1146, 1146, 1168, 1150, 1129, 1149, 1129,
+      925, 1148, 1129, 924, 919, 1147, 1130, 1130,
+      1130, 1131, 1146, 1145, 1145, 1145, 1145, 1145,
+      1160, 1150, 1144, 1149, 1144, 1144, 1148, 1144,
+      1144, 1144, 1147, 1144, 1144, 1144, 1144, 1146,
+      1144, 1144, 1144, 1144, 1144, 1145, 1152, 1152,
+      1152, 1152, 1152, 1152, 1344, 1342, 1342, 1342,
+      1341, 1342, 1342, 1341, 1342, 1341, 1340, 1342,
+      1342, 1341, 1342, 1341, 1340, 1342, 1341, 1340,
+      1339, 1342, 1342, 1341, 1342, 1341, 1340, 1342,
+      1341, 1340, 1339, 1342, 1341, 1340, 1339, 1338,
+      1342, 1342, 1341, 1342, 1341, 1340, 1342, 1341,
+      1340, 1339, 1342, 1341, 1340, 1339, 1338, 1342,
+      1341, 1340, 1339, 1338, 1337, 1342, 1342, 1341,
+      1342, 1341, 1340, 1342, 1341, 1340, 1339, 1342,
+      1341, 1340, 1339, 1338, 1342, 1341, 1340, 1339,
+      1338, 1337, 1342, 1341, 1340, 1339, 1338, 1337,
+      1336, 1398, 1206, 1390, 1398, 1206, 1198, 1390,
+      1397, 1205, 876, 1197, 1389, 1205, 1190, 1189,
+      1197, 1382, 1382, 1381, 1398, 1206, 1198, 1390,
+      1397, 1199, 876, 1191, 1389, 1205, 869, 820,
+      1197, 1190, 1183, 1189, 1382, 1381, 1396, 1204,
+      875, 1196, 1388, 1204, 862, 813, 1196, 868,
+      771, 819, 1188, 1188, 1380, 1204, 1182, 1181,
+      1196, 1182, 1175, 1181, 1180, 1180, 1188, 1374,
+      1374, 1373, 1374, 1373, 1372, 1398, 1206, 1198,
+      1390, 1397, 1199, 876, 1191, 1389, 1205, 869,
+      820, 1197, 1190, 1183, 1189, 1382, 1381, 1396,
+      1199, 875, 1191, 1388, 1199, 1134, 1134, 1191,
+      868, 1134, 819, 1183, 1183, 1380, 1204, 862,
+      813, 1196, 861, 1134, 812, 771, 770, 1188,
+      1182, 1175, 1181, 1175, 1175, 1180, 1374, 1373,
+      1372, 1395, 1203, 874, 1195, 1387, 1203, 855,
+      806, 1195, 867, 764, 818, 1187, 1187, 1379,
+      1203, 855, 806, 1195, 854, 1134, 805, 764,
+      763, 1187, 860, 729, 811, 729, 728, 769,
+      1179, 1179, 1179, 1371, 1203, 1174, 1173, 1195,
+      1174, 1167, 1173, 1172, 1172, 1187, 1174, 1167,
+      1173, 1167, 1167, 1172, 1171, 1171, 1171, 1179,
+      1366, 1366, 1365, 1366, 1365, 1364, 1366, 1365,
+      1364, 1363, 1398, 1206, 1198, 1390, 1397, 1199,
+      876, 1191, 1389, 1205, 869, 820, 1197, 1190,
+      1183, 1189, 1382, 1381, 1396, 1199, 875, 1191,
+      1388, 1199, 827, 778, 1191, 868, 736, 819,
+      1183, 1183, 1380, 1204, 862, 813, 1196, 861,
+      701, 812, 771, 770, 1188, 1182, 1175, 1181,
+      1175, 1175, 1180, 1374, 1373, 1372, 1395, 1199,
+      874, 1191, 1387, 1199, 827, 778, 1191, 867,
+      736, 818, 1183, 1183, 1379, 1199, 827, 778,
+      1191, 826, 1134, 1133, 736, 1133, 1183, 860,
+      701, 811, 701, 1133, 769, 1175, 1175, 1175,
+      1371, 1203, 855, 806, 1195, 854, 673, 805,
+      764, 763, 1187, 853, 673, 804, 673, 1133,
+      762, 729, 728, 727, 1179, 1174, 1167, 1173,
+      1167, 1167, 1172, 1167, 1167, 1167, 1171, 1366,
+      1365, 1364, 1363, 1394, 1202, 873, 1194, 1386,
+      1202, 848, 799, 1194, 866, 757, 817, 1186,
+      1186, 1378, 1202, 848, 799, 1194, 847, 652,
+      798, 757, 756, 1186, 859, 722, 810, 722,
+      721, 768, 1178, 1178, 1178, 1370, 1202, 848,
+      799, 1194, 847, 652, 798, 757, 756, 1186,
+      846, 652, 797, 652, 1133, 755, 722, 721,
+      720, 1178, 852, 694, 803, 694, 693, 761,
+      694, 693, 692, 726, 1170, 1170, 1170, 1170,
+      1362, 1202, 1166, 1165, 1194, 1166, 1159, 1165,
+      1164, 1164, 1186, 1166, 1159, 1165, 1159, 1159,
+      1164, 1163, 1163, 1163, 1178, 1166, 1159, 1165,
+      1159, 1159, 1164, 1159, 1159, 1159, 1163, 1162,
+      1162, 1162, 1162, 1170, 1358, 1358, 1357, 1358,
+      1357, 1356, 1358, 1357, 1356, 1355, 1358, 1357,
+      1356, 1355, 1354, 1398, 1206, 1198, 1390, 1397,
+      1199, 876, 1191, 1389, 1205, 869, 820, 1197,
+      1190, 1183, 1189, 1382, 1381, 1396, 1199, 875,
+      1191, 1388, 1199, 827, 778, 1191, 868, 736,
+      819, 1183, 1183, 1380, 1204, 862, 813, 1196,
+      861, 701, 812, 771, 770, 1188, 1182, 1175,
+      1181, 1175, 1175, 1180, 1374, 1373, 1372, 1395,
+      1199, 874, 1191, 1387, 1199, 827, 778, 1191,
+      867, 736, 818, 1183, 1183, 1379, 1199, 827,
+      778, 1191, 826, 1134, 777, 736, 735, 1183,
+      860, 701, 811, 701, 700, 769, 1175, 1175,
+      1175, 1371, 1203, 855, 806, 1195, 854, 673,
+      805, 764, 763, 1187, 853, 673, 804, 673,
+      672, 762, 729, 728, 727, 1179, 1174, 1167,
+      1173, 1167, 1167, 1172, 1167, 1167, 1167, 1171,
+      1366, 1365, 1364, 1363, 1394, 1199, 873, 1191,
+      1386, 1199, 827, 778, 1191, 866, 736, 817,
+      1183, 1183, 1378, 1199, 827, 778, 1191, 826,
+      176, 777, 736, 735, 1183, 859, 701, 810,
+      701, 700, 768, 1175, 1175, 1175, 1370, 1199,
+      827, 778, 1191, 826, 176, 777, 736, 735,
+      1183, 825, 175, 776, 1132, 1133, 1132, 701,
+      700, 1132, 1175, 852, 673, 803, 673, 672,
+      761, 673, 672, 1132, 726, 1167, 1167, 1167,
+      1167, 1362, 1202, 848, 799, 1194, 847, 652,
+      798, 757, 756, 1186, 846, 652, 797, 652,
+      651, 755, 722, 721, 720, 1178, 845, 652,
+      796, 652, 651, 754, 652, 651, 1132, 719,
+      694, 693, 692, 691, 1170, 1166, 1159, 1165,
+      1159, 1159, 1164, 1159, 1159, 1159, 1163, 1159,
+      1159, 1159, 1159, 1162, 1358, 1357, 1356, 1355,
+      1354, 1393, 1201, 872, 1193, 1385, 1201, 841,
+      792, 1193, 865, 750, 816, 1185, 1185, 1377,
+      1201, 841, 792, 1193, 840, 638, 791, 750,
+      749, 1185, 858, 715, 809, 715, 714, 767,
+      1177, 1177, 1177, 1369, 1201, 841, 792, 1193,
+      840, 638, 791, 750, 749, 1185, 839, 638,
+      790, 638, 637, 748, 715, 714, 713, 1177,
+      851, 687, 802, 687, 686, 760, 687, 686,
+      685, 725, 1169, 1169, 1169, 1169, 1361, 1201,
+      841, 792, 1193, 840, 638, 791, 750, 749,
+      1185, 839, 638, 790, 638, 637, 748, 715,
+      714, 713, 1177, 838, 638, 789, 638, 637,
+      747, 638, 637, 1132, 712, 687, 686, 685,
+      684, 1169, 844, 666, 795, 666, 665, 753,
+      666, 665, 664, 718, 666, 665, 664, 663,
+      690, 1161, 1161, 1161, 1161, 1161, 1353, 1201,
+      1158, 1157, 1193, 1158, 1151, 1157, 1156, 1156,
+      1185, 1158, 1151, 1157, 1151, 1151, 1156, 1155,
+      1155, 1155, 1177, 1158, 1151, 1157, 1151, 1151,
+      1156, 1151, 1151, 1151, 1155, 1154, 1154, 1154,
+      1154, 1169, 1158, 1151, 1157, 1151, 1151, 1156,
+      1151, 1151, 1151, 1155, 1151, 1151, 1151, 1151,
+      1154, 1153, 1153, 1153, 1153, 1153, 1161, 1350,
+      1350, 1349, 1350, 1349, 1348, 1350, 1349, 1348,
+      1347, 1350, 1349, 1348, 1347, 1346, 1350, 1349,
+      1348, 1347, 1346, 1345, 1398, 1206, 1198, 1390,
+      1397, 1199, 876, 1191, 1389, 1205, 869, 820,
+      1197, 1190, 1183, 1189, 1382, 1381, 1396, 1199,
+      875, 1191, 1388, 1199, 827, 778, 1191, 868,
+      736, 819, 1183, 1183, 1380, 1204, 862, 813,
+      1196, 861, 701, 812, 771, 770, 1188, 1182,
+      1175, 1181, 1175, 1175, 1180, 1374, 1373, 1372,
+      1395, 1199, 874, 1191, 1387, 1199, 827, 778,
+      1191, 867, 736, 818, 1183, 1183, 1379, 1199,
+      827, 778, 1191, 826, 1134, 777, 736, 735,
+      1183, 860, 701, 811, 701, 700, 769, 1175,
+      1175, 1175, 1371, 1203, 855, 806, 1195, 854,
+      673, 805, 764, 763, 1187, 853, 673, 804,
+      673, 672, 762, 729, 728, 727, 1179, 1174,
+      1167, 1173, 1167, 1167, 1172, 1167, 1167, 1167,
+      1171, 1366, 1365, 1364, 1363, 1394, 1199, 873,
+      1191, 1386, 1199, 827, 778, 1191, 866, 736,
+      817, 1183, 1183, 1378, 1199, 827, 778, 1191,
+      826, 176, 777, 736, 735, 1183, 859, 701,
+      810, 701, 700, 768, 1175, 1175, 1175, 1370,
+      1199, 827, 778, 1191, 826, 176, 777, 736,
+      735, 1183, 825, 175, 776, 170, 1133, 734,
+      701, 700, 699, 1175, 852, 673, 803, 673,
+      672, 761, 673, 672, 671, 726, 1167, 1167,
+      1167, 1167, 1362, 1202, 848, 799, 1194, 847,
+      652, 798, 757, 756, 1186, 846, 652, 797,
+      652, 651, 755, 722, 721, 720, 1178, 845,
+      652, 796, 652, 651, 754, 652, 651, 650,
+      719, 694, 693, 692, 691, 1170, 1166, 1159,
+      1165, 1159, 1159, 1164, 1159, 1159, 1159, 1163,
+      1159, 1159, 1159, 1159, 1162, 1358, 1357, 1356,
+      1355, 1354, 1393, 1199, 872, 1191, 1385, 1199,
+      827, 778, 1191, 865, 736, 816, 1183, 1183,
+      1377, 1199, 827, 778, 1191, 826, 176, 777,
+      736, 735, 1183, 858, 701, 809, 701, 700,
+      767, 1175, 1175, 1175, 1369, 1199, 827, 778,
+      1191, 826, 176, 777, 736, 735, 1183, 825,
+      175, 776, 170, 155, 734, 701, 700, 699,
+      1175, 851, 673, 802, 673, 672, 760, 673,
+      672, 671, 725, 1167, 1167, 1167, 1167, 1361,
+      1199, 1129, 1129, 1191, 1129, 1129, 777, 1129,
+      735, 1183, 1129, 1129, 776, 1129, 155, 734,
+      1129, 700, 699, 1175, 1130, 1130, 1130, 1130,
+      1130, 1130, 1131, 1131, 1132, 1131, 1130, 1130,
+      1130, 1131, 1167, 1129, 1129, 795, 1129, 651,
+      753, 1129, 651, 650, 718, 1130, 1130, 1130,
+      1131, 1130, 1159, 1159, 1159, 1159, 1159, 1353,
+      1201, 841, 792, 1193, 840, 638, 791, 750,
+      749, 1185, 839, 638, 790, 638, 637, 748,
+      715, 714, 713, 1177, 838, 638, 789, 638,
+      637, 747, 638, 637, 636, 712, 687, 686,
+      685, 684, 1169, 1129, 1129, 788, 1129, 637,
+      746, 1129, 637, 636, 711, 1130, 1130, 1130,
+      1131, 1130, 1129, 665, 664, 663, 1130, 1161,
+      1158, 1151, 1157, 1151, 1151, 1156, 1151, 1151,
+      1151, 1155, 1151, 1151, 1151, 1151, 1154, 1151,
+      1151, 1151, 1151, 1151, 1153, 1350, 1349, 1348,
+      1347, 1346, 1345, 1392, 1200, 871, 1192, 1384,
+      1200, 834, 785, 1192, 864, 743, 815, 1184,
+      1184, 1376, 1200, 834, 785, 1192, 833, 631,
+      784, 743, 742, 1184, 857, 708, 808, 708,
+      707, 766, 1176, 1176, 1176, 1368, 1200, 834,
+      785, 1192, 833, 631, 784, 743, 742, 1184,
+      832, 631, 783, 631, 630, 741, 708, 707,
+      706, 1176, 850, 680, 801, 680, 679, 759,
+      680, 679, 678, 724, 1168, 1168, 1168, 1168,
+      1360, 1200, 834, 785, 1192, 833, 631, 784,
+      743, 742, 1184, 832, 631, 783, 631, 630,
+      741, 708, 707, 706, 1176, 831, 631, 782,
+      631, 630, 740, 631, 630, 629, 705, 680,
+      679, 678, 677, 1168, 843, 659, 794, 659,
+      658, 752, 659, 658, 657, 717, 659, 658,
+      657, 656, 689, 1160, 1160, 1160, 1160, 1160,
+      1352, 1200, 834, 785, 1192, 833, 631, 784,
+      743, 742, 1184, 832, 631, 783, 631, 630,
+      741, 708, 707, 706, 1176, 831, 631, 782,
+      631, 630, 740, 631, 630, 629, 705, 680,
+      679, 678, 677, 1168, 1129, 1129, 781, 1129,
+      630, 739, 1129, 630, 629, 704, 1130, 1130,
+      1130, 1131, 1130, 1129, 658, 657, 656, 1130,
+      1160, 836, 645, 787, 645, 644, 745, 645,
+      644, 643, 710, 645, 644, 643, 642, 682,
+      1129, 644, 643, 642, 1130, 661, 1152, 1152,
+      1152, 1152, 1152, 1152, 1344, 1200, 1150, 1149,
+      1192, 1150, 1143, 1149, 1148, 1148, 1184, 1150,
+      1143, 1149, 1143, 1143, 1148, 1147, 1147, 1147,
+      1176, 1150, 1143, 1149, 1143, 1143, 1148, 1143,
+      1143, 1143, 1147, 1146, 1146, 1146, 1146, 1168,
+      1150, 1143, 1149, 1143, 1143, 1148, 1143, 1143,
+      1143, 1147, 1143, 1143, 1143, 1143, 1146, 1145,
+      1145, 1145, 1145, 1145, 1160, 1150, 1143, 1149,
+      1143, 1143, 1148, 1143, 1143, 1143, 1147, 1143,
+      1143, 1143, 1143, 1146, 1143, 1143, 1143, 1143,
+      1143, 1145, 1144, 1144, 1144, 1144, 1144, 1144,
+      1152, 1342, 1342, 1341, 1342, 1341, 1340, 1342,
+      1341, 1340, 1339, 1342, 1341, 1340, 1339, 1338,
+      1342, 1341, 1340, 1339, 1338, 1337, 1342, 1341,
+      1340, 1339, 1338, 1337, 1336, 1398, 1206, 1198,
+      1390, 1397, 1199, 1142, 1191, 1389, 1205, 1142,
+      1141, 1197, 1190, 1183, 1189, 1382, 1381, 1396,
+      1199, 1142, 1191, 1388, 1199, 1142, 1141, 1191,
+      1142, 1140, 1141, 1183, 1183, 1380, 1204, 1142,
+      1141, 1196, 1142, 1139, 1141, 1140, 1140, 1188,
+      1182, 1175, 1181, 1175, 1175, 1180, 1374, 1373,
+      1372, 1395, 1199, 1142, 1191, 1387, 1199, 1142,
+      1141, 1191, 1142, 1140, 1141, 1183, 1183, 1379,
+      1199, 1142, 1141, 1191, 1142, 1134, 1141, 1140,
+      1140, 1183, 1142, 1139, 1141, 1139, 1139, 1140,
+      1175, 1175, 1175, 1371, 1203, 1142, 1141, 1195,
+      1142, 1138, 1141, 1140, 1140, 1187, 1142, 1138,
+      1141, 1138, 1138, 1140, 1139, 1139, 1139, 1179,
+      1174, 1167, 1173, 1167, 1167, 1172, 1167, 1167,
+      1167, 1171, 1366, 1365, 1364, 1363, 1394, 1199,
+      1142, 1191, 1386, 1199, 1142, 1141, 1191, 1142,
+      1140, 1141, 1183, 1183, 1378, 1199, 1142, 1141,
+      1191, 1142, 904, 1141, 1140, 1140, 1183, 1142,
+      1139, 1141, 1139, 1139, 1140, 1175, 1175, 1175,
+      1370, 1199, 1142, 1141, 1191, 1142, 904, 1141,
+      1140, 1140, 1183, 1142, 904, 1141, 903, 1133,
+      1140, 1139, 1139, 1139, 1175, 1142, 1138, 1141,
+      1138, 1138, 1140, 1138, 1138, 1138, 1139, 1167,
+      1167, 1167, 1167, 1362, 1202, 1142, 1141, 1194,
+      1142, 1137, 1141, 1140, 1140, 1186, 1142, 1137,
+      1141, 1137, 1137, 1140, 1139, 1139, 1139, 1178,
+      1142, 1137, 1141, 1137, 1137, 1140, 1137, 1137,
+      1137, 1139, 1138, 1138, 1138, 1138, 1170, 1166,
+      1159, 1165, 1159, 1159, 1164, 1159, 1159, 1159,
+      1163, 1159, 1159, 1159, 1159, 1162, 1358, 1357,
+      1356, 1355, 1354, 1393, 1199, 1142, 1191, 1385,
+      1199, 1142, 1141, 1191, 1142, 1140, 1141, 1183,
+      1183, 1377, 1199, 1142, 1141, 1191, 1142, 904,
+      1141, 1140, 1140, 1183, 1142, 1139, 1141, 1139,
+      1139, 1140, 1175, 1175, 1175, 1369, 1199, 1142,
+      1141, 1191, 1142, 904, 1141, 1140, 1140, 1183,
+      1142, 904, 1141, 903, 897, 1140, 1139, 1139,
+      1139, 1175, 1142, 1138, 1141, 1138, 1138, 1140,
+      1138, 1138, 1138, 1139, 1167, 1167, 1167, 1167,
+      1361, 1199, 1142, 1141, 1191, 1142, 904, 1141,
+      1140, 1140, 1183, 1142, 904, 1141, 903, 897,
+      1140, 1139, 1139, 1139, 1175, 1142, 904, 1141,
+      903, 897, 1140, 902, 896, 1132, 1139, 1138,
+      1138, 1138, 1138, 1167, 1142, 1137, 1141, 1137,
+      1137, 1140, 1137, 1137, 1137, 1139, 1137, 1137,
+      1137, 1137, 1138, 1159, 1159, 1159, 1159, 1159,
+      1353, 1201, 1142, 1141, 1193, 1142, 1136, 1141,
+      1140, 1140, 1185, 1142, 1136, 1141, 1136, 1136,
+      1140, 1139, 1139, 1139, 1177, 1142, 1136, 1141,
+      1136, 1136, 1140, 1136, 1136, 1136, 1139, 1138,
+      1138, 1138, 1138, 1169, 1142, 1136, 1141, 1136,
+      1136, 1140, 1136, 1136, 1136, 1139, 1136, 1136,
+      1136, 1136, 1138, 1137, 1137, 1137, 1137, 1137,
+      1161, 1158, 1151, 1157, 1151, 1151, 1156, 1151,
+      1151, 1151, 1155, 1151, 1151, 1151, 1151, 1154,
+      1151, 1151, 1151, 1151, 1151, 1153, 1350, 1349,
+      1348, 1347, 1346, 1345, 1392, 1199, 1142, 1191,
+      1384, 1199, 1142, 1141, 1191, 1142, 1140, 1141,
+      1183, 1183, 1376, 1199, 1142, 1141, 1191, 1142,
+      904, 1141, 1140, 1140, 1183, 1142, 1139, 1141,
+      1139, 1139, 1140, 1175, 1175, 1175, 1368, 1199,
+      1142, 1141, 1191, 1142, 904, 1141, 1140, 1140,
+      1183, 1142, 904, 1141, 903, 897, 1140, 1139,
+      1139, 1139, 1175, 1142, 1138, 1141, 1138, 1138,
+      1140, 1138, 1138, 1138, 1139, 1167, 1167, 1167,
+      1167, 1360, 1199, 1142, 1141, 1191, 1142, 904,
+      1141, 1140, 1140, 1183, 1142, 904, 1141, 903,
+      897, 1140, 1139, 1139, 1139, 1175, 1142, 904,
+      1141, 903, 897, 1140, 902, 896, 891, 1139,
+      1138, 1138, 1138, 1138, 1167, 1142, 1137, 1141,
+      1137, 1137, 1140, 1137, 1137, 1137, 1139, 1137,
+      1137, 1137, 1137, 1138, 1159, 1159, 1159, 1159,
+      1159, 1352, 1199, 1142, 1141, 1191, 1142, 904,
+      1141, 1140, 1140, 1183, 1142, 904, 1141, 903,
+      897, 1140, 1139, 1139, 1139, 1175, 1142, 904,
+      1141, 903, 897, 1140, 902, 896, 891, 1139,
+      1138, 1138, 1138, 1138, 1167, 1142, 1129, 1141,
+      1129, 897, 1140, 1129, 896, 891, 1139, 1130,
+      1130, 1130, 1131, 1138, 1137, 1137, 1137, 1137,
+      1137, 1159, 1142, 1136, 1141, 1136, 1136, 1140,
+      1136, 1136, 1136, 1139, 1136, 1136, 1136, 1136,
+      1138, 1136, 1136, 1136, 1136, 1136, 1137, 1151,
+      1151, 1151, 1151, 1151, 1151, 1344, 1200, 1142,
+      1141, 1192, 1142, 1135, 1141, 1140, 1140, 1184,
+      1142, 1135, 1141, 1135, 1135, 1140, 1139, 1139,
+      1139, 1176, 1142, 1135, 1141, 1135, 1135, 1140,
+      1135, 1135, 1135, 1139, 1138, 1138, 1138, 1138,
+      1168, 1142, 1135, 1141, 1135, 1135, 1140, 1135,
+      1135, 1135, 1139, 1135, 1135, 1135, 1135, 1138,
+      1137, 1137, 1137, 1137, 1137, 1160, 1142, 1135,
+      1141, 1135, 1135, 1140, 1135, 1135, 1135, 1139,
+      1135, 1135, 1135, 1135, 1138, 1135, 1135, 1135,
+      1135, 1135, 1137, 1136, 1136, 1136, 1136, 1136,
+      1136, 1152, 1150, 1143, 1149, 1143, 1143, 1148,
+      1143, 1143, 1143, 1147, 1143, 1143, 1143, 1143,
+      1146, 1143, 1143, 1143, 1143, 1143, 1145, 1143,
+      1143, 1143, 1143, 1143, 1143, 1144, 1342, 1341,
+      1340, 1339, 1338, 1337, 1336, 1391, 1334, 1334,
+      1334, 1383, 1334, 1334, 1334, 1333, 1334, 1334,
+      1333, 1334, 1333, 1375, 1334, 1334, 1334, 1333,
+      1334, 1334, 1333, 1334, 1333, 1332, 1334, 1334,
+      1333, 1334, 1333, 1332, 1334, 1333, 1332, 1367,
+      1334, 1334, 1334, 1333, 1334, 1334, 1333, 1334,
+      1333, 1332, 1334, 1334, 1333, 1334, 1333, 1332,
+      1334, 1333, 1332, 1331, 1334, 1334, 1333, 1334,
+      1333, 1332, 1334, 1333, 1332, 1331, 1334, 1333,
+      1332, 1331, 1359, 1334, 1334, 1334, 1333, 1334,
+      1334, 1333, 1334, 1333, 1332, 1334, 1334, 1333,
+      1334, 1333, 1332, 1334, 1333, 1332, 1331, 1334,
+      1334, 1333, 1334, 1333, 1332, 1334, 1333, 1332,
+      1331, 1334, 1333, 1332, 1331, 1330, 1334, 1334,
+      1333, 1334, 1333, 1332, 1334, 1333, 1332, 1331,
+      1334, 1333, 1332, 1331, 1330, 1334, 1333, 1332,
+      1331, 1330, 1351, 1334, 1334, 1334, 1333, 1334,
+      1334, 1333, 1334, 1333, 1332, 1334, 1334, 1333,
+      1334, 1333, 1332, 1334, 1333, 1332, 1331, 1334,
+      1334, 1333, 1334, 1333, 1332, 1334, 1333, 1332,
+      1331, 1334, 1333, 1332, 1331, 1330, 1334, 1334,
+      1333, 1334, 1333, 1332, 1334, 1333, 1332, 1331,
+      1334, 1333, 1332, 1331, 1330, 1334, 1333, 1332,
+      1331, 1330, 1329, 1334, 1334, 1333, 1334, 1333,
+      1332, 1334, 1333, 1332, 1331, 1334, 1333, 1332,
+      1331, 1330, 1334, 1333, 1332, 1331, 1330, 1329,
+      1334, 1333, 1332, 1331, 1330, 1329, 1343, 1334,
+      1334, 1334, 1333, 1334, 1334, 1333, 1334, 1333,
+      1332, 1334, 1334, 1333, 1334, 1333, 1332, 1334,
+      1333, 1332, 1331, 1334, 1334, 1333, 1334, 1333,
+      1332, 1334, 1333, 1332, 1331, 1334, 1333, 1332,
+      1331, 1330, 1334, 1334, 1333, 1334, 1333, 1332,
+      1334, 1333, 1332, 1331, 1334, 1333, 1332, 1331,
+      1330, 1334, 1333, 1332, 1331, 1330, 1329, 1334,
+      1334, 1333, 1334, 1333, 1332, 1334, 1333, 1332,
+      1331, 1334, 1333, 1332, 1331, 1330, 1334, 1333,
+      1332, 1331, 1330, 1329, 1334, 1333, 1332, 1331,
+      1330, 1329, 1328, 1334, 1334, 1333, 1334, 1333,
+      1332, 1334, 1333, 1332, 1331, 1334, 1333, 1332,
+      1331, 1330, 1334, 1333, 1332, 1331, 1330, 1329,
+      1334, 1333, 1332, 1331, 1330, 1329, 1328, 1334,
+      1333, 1332, 1331, 1330, 1329, 1328, 1335
+   },
+   {
+      {
+         {
+            0, 0, 0, 0, 0, 0, 1278, 4200,
+            10230
+         },
+         {
+            1, 8, 36, 120, 330, 784, 2930, 7344,
+            15705
+         },
+         {
+            1, 9, 44, 156, 450, 1114, 3714, 8996,
+            18849
+         },
+         {
+            1, 9, 45, 164, 486, 1234, 4044, 9780,
+            20501
+         },
+         {
+            1, 9, 45, 165, 494, 1270, 4164, 10110,
+            21285
+         }
+      },
+      {
+         {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 7, 28, 84, 210, 455, 875, 1520,
+            2415
+         },
+         {
+            1, 8, 35, 112, 294, 665, 1330, 2395,
+            3935
+         },
+         {
+            1, 8, 36, 119, 322, 749, 1540, 2850,
+            4810
+         },
+         {
+            1, 8, 36, 120, 329, 777, 1624, 3060,
+            5265
+         }
+      },
+      {
+         {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 6, 21, 56, 126, 246, 426, 666,
+            951
+         },
+         {
+            1, 7, 27, 77, 182, 372, 672, 1092,
+            1617
+         },
+         {
+            1, 7, 28, 83, 203, 428, 798, 1338,
+            2043
+         },
+         {
+            1, 7, 28, 84, 209, 449, 854, 1464,
+            2289
+         }
+      },
+      {
+         {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 5, 15, 35, 70, 121, 185, 255,
+            320
+         },
+         {
+            1, 6, 20, 50, 105, 191, 306, 440,
+            575
+         },
+         {
+            1, 6, 21, 55, 120, 226, 376, 561,
+            760
+         },
+         {
+            1, 6, 21, 56, 125, 241, 411, 631,
+            881
+         }
+      },
+      {
+         {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 4, 10, 20, 35, 52, 68, 80,
+            85
+         },
+         {
+            1, 5, 14, 30, 55, 87, 120, 148,
+            165
+         },
+         {
+            1, 5, 15, 34, 65, 107, 155, 200,
+            233
+         },
+         {
+            1, 5, 15, 35, 69, 117, 175, 235,
+            285
+         }
+      },
+      {
+         {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 3, 6, 10, 15, 18, 19, 18,
+            15
+         },
+         {
+            1, 4, 9, 16, 25, 33, 37, 37,
+            33
+         },
+         {
+            1, 4, 10, 19, 31, 43, 52, 55,
+            52
+         },
+         {
+            1, 4, 10, 20, 34, 49, 62, 70,
+            70
+         }
+      },
+      {
+         {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 2, 3, 4, 5, 4, 3, 2,
+            1
+         },
+         {
+            1, 3, 5, 7, 9, 9, 7, 5,
+            3
+         },
+         {
+            1, 3, 6, 9, 12, 13, 12, 9,
+            6
+         },
+         {
+            1, 3, 6, 10, 14, 16, 16, 14,
+            10
+         }
+      },
+      {
+         {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 1, 1, 1, 1, 0, 0, 0,
+            0
+         },
+         {
+            1, 2, 2, 2, 2, 1, 0, 0,
+            0
+         },
+         {
+            1, 2, 3, 3, 3, 2, 1, 0,
+            0
+         },
+         {
+            1, 2, 3, 4, 4, 3, 2, 1,
+            0
+         }
+      },
+      {
+         {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 0, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 1, 0, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 1, 1, 0, 0, 0, 0, 0,
+            0
+         },
+         {
+            1, 1, 1, 1, 0, 0, 0, 0,
+            0
+         }
+      }
+   },
+   {
+      0, 1327, 1135, 1143, 1335, 0, 1328, 877,
+      625, 905, 1336, 1136, 632, 639, 1144, 1151,
+      933, 1152, 1343, 1344, 0, 1329, 878, 626,
+      906, 1337, 879, 121, 177, 907, 633, 233,
+      640, 934, 935, 1345, 1137, 646, 653, 1145,
+      647, 289, 654, 660, 661, 1153, 1159, 961,
+      1160, 962, 963, 1161, 1351, 1352, 1353, 0,
+      1330, 880, 627, 908, 1338, 881, 122, 178,
+      909, 634, 234, 641, 936, 937, 1346, 882,
+      123, 179, 910, 124, 1130, 180, 235, 236,
+      938, 648, 290, 655, 291, 292, 662, 964,
+      965, 966, 1354, 1138, 667, 674, 1146, 668,
+      345, 675, 681, 682, 1154, 669, 346, 676,
+      347, 348, 683, 688, 689, 690, 1162, 1167,
+      989, 1168, 990, 991, 1169, 992, 993, 994,
+      1170, 1359, 1360, 1361, 1362, 0, 1331, 883,
+      628, 911, 1339, 884, 125, 181, 912, 635,
+      237, 642, 939, 940, 1347, 885, 126, 182,
+      913, 127, 1, 183, 238, 239, 941, 649,
+      293, 656, 294, 295, 663, 967, 968, 969,
+      1355, 886, 128, 184, 914, 129, 2, 185,
+      240, 241, 942, 130, 3, 186, 4, 1131,
+      242, 296, 297, 298, 970, 670, 349, 677,
+      350, 351, 684, 352, 353, 354, 691, 995,
+      996, 997, 998, 1363, 1139, 695, 702, 1147,
+      696, 401, 703, 709, 710, 1155, 697, 402,
+      704, 403, 404, 711, 716, 717, 718, 1163,
+      698, 405, 705, 406, 407, 712, 408, 409,
+      410, 719, 723, 724, 725, 726, 1171, 1175,
+      1017, 1176, 1018, 1019, 1177, 1020, 1021, 1022,
+      1178, 1023, 1024, 1025, 1026, 1179, 1367, 1368,
+      1369, 1370, 1371, 0, 1332, 887, 629, 915,
+      1340, 888, 131, 187, 916, 636, 243, 643,
+      943, 944, 1348, 889, 132, 188, 917, 133,
+      5, 189, 244, 245, 945, 650, 299, 657,
+      300, 301, 664, 971, 972, 973, 1356, 890,
+      134, 190, 918, 135, 6, 191, 246, 247,
+      946, 136, 7, 192, 8, 9, 248, 302,
+      303, 304, 974, 671, 355, 678, 356, 357,
+      685, 358, 359, 360, 692, 999, 1000, 1001,
+      1002, 1364, 891, 137, 193, 919, 138, 10,
+      194, 249, 250, 947, 139, 11, 195, 12,
+      13, 251, 305, 306, 307, 975, 140, 14,
+      196, 15, 16, 252, 17, 18, 1132, 308,
+      361, 362, 363, 364, 1003, 699, 411, 706,
+      412, 413, 713, 414, 415, 416, 720, 417,
+      418, 419, 420, 727, 1027, 1028, 1029, 1030,
+      1031, 1372, 1140, 730, 737, 1148, 731, 457,
+      738, 744, 745, 1156, 732, 458, 739, 459,
+      460, 746, 751, 752, 753, 1164, 733, 461,
+      740, 462, 463, 747, 464, 465, 466, 754,
+      758, 759, 760, 761, 1172, 734, 467, 741,
+      468, 469, 748, 470, 471, 472, 755, 473,
+      474, 475, 476, 762, 765, 766, 767, 768,
+      769, 1180, 1183, 1045, 1184, 1046, 1047, 1185,
+      1048, 1049, 1050, 1186, 1051, 1052, 1053, 1054,
+      1187, 1055, 1056, 1057, 1058, 1059, 1188, 1375,
+      1376, 1377, 1378, 1379, 1380, 0, 1333, 892,
+      630, 920, 1341, 893, 141, 197, 921, 637,
+      253, 644, 948, 949, 1349, 894, 142, 198,
+      922, 143, 19, 199, 254, 255, 950, 651,
+      309, 658, 310, 311, 665, 976, 977, 978,
+      1357, 895, 144, 200, 923, 145, 20, 201,
+      256, 257, 951, 146, 21, 202, 22, 23,
+      258, 312, 313, 314, 979, 672, 365, 679,
+      366, 367, 686, 368, 369, 370, 693, 1004,
+      1005, 1006, 1007, 1365, 896, 147, 203, 924,
+      148, 24, 204, 259, 260, 952, 149, 25,
+      205, 26, 27, 261, 315, 316, 317, 980,
+      150, 28, 206, 29, 30, 262, 31, 32,
+      33, 318, 371, 372, 373, 374, 1008, 700,
+      421, 707, 422, 423, 714, 424, 425, 426,
+      721, 427, 428, 429, 430, 728, 1032, 1033,
+      1034, 1035, 1036, 1373, 897, 151, 207, 925,
+      152, 34, 208, 263, 264, 953, 153, 35,
+      209, 36, 37, 265, 319, 320, 321, 981,
+      154, 38, 210, 39, 40, 266, 41, 42,
+      43, 322, 375, 376, 377, 378, 1009, 155,
+      44, 211, 45, 46, 267, 47, 48, 49,
+      323, 50, 51, 52, 1133, 379, 431, 432,
+      433, 434, 435, 1037, 735, 477, 742, 478,
+      479, 749, 480, 481, 482, 756, 483, 484,
+      485, 486, 763, 487, 488, 489, 490, 491,
+      770, 1060, 1061, 1062, 1063, 1064, 1065, 1381,
+      1141, 772, 779, 1149, 773, 513, 780, 786,
+      787, 1157, 774, 514, 781, 515, 516, 788,
+      793, 794, 795, 1165, 775, 517, 782, 518,
+      519, 789, 520, 521, 522, 796, 800, 801,
+      802, 803, 1173, 776, 523, 783, 524, 525,
+      790, 526, 527, 528, 797, 529, 530, 531,
+      532, 804, 807, 808, 809, 810, 811, 1181,
+      777, 533, 784, 534, 535, 791, 536, 537,
+      538, 798, 539, 540, 541, 542, 805, 543,
+      544, 545, 546, 547, 812, 814, 815, 816,
+      817, 818, 819, 1189, 1191, 1073, 1192, 1074,
+      1075, 1193, 1076, 1077, 1078, 1194, 1079, 1080,
+      1081, 1082, 1195, 1083, 1084, 1085, 1086, 1087,
+      1196, 1088, 1089, 1090, 1091, 1092, 1093, 1197,
+      1383, 1384, 1385, 1386, 1387, 1388, 1389, 0,
+      1334, 898, 631, 926, 1342, 899, 156, 212,
+      927, 638, 268, 645, 954, 955, 1350, 900,
+      157, 213, 928, 158, 1129, 214, 269, 270,
+      956, 652, 324, 659, 325, 326, 666, 982,
+      983, 984, 1358, 901, 159, 215, 929, 160,
+      53, 216, 271, 272, 957, 161, 54, 217,
+      55, 56, 273, 327, 328, 329, 985, 673,
+      380, 680, 381, 382, 687, 383, 384, 385,
+      694, 1010, 1011, 1012, 1013, 1366, 902, 162,
+      218, 930, 163, 57, 219, 274, 275, 958,
+      164, 58, 220, 59, 60, 276, 330, 331,
+      332, 986, 165, 61, 221, 62, 63, 277,
+      64, 65, 66, 333, 386, 387, 388, 389,
+      1014, 701, 436, 708, 437, 438, 715, 439,
+      440, 441, 722, 442, 443, 444, 445, 729,
+      1038, 1039, 1040, 1041, 1042, 1374, 903, 166,
+      222, 931, 167, 67, 223, 278, 279, 959,
+      168, 68, 224, 69, 70, 280, 334, 335,
+      336, 987, 169, 71, 225, 72, 73, 281,
+      74, 75, 76, 337, 390, 391, 392, 393,
+      1015, 170, 77, 226, 78, 79, 282, 80,
+      81, 82, 338, 83, 84, 85, 86, 394,
+      446, 447, 448, 449, 450, 1043, 736, 492,
+      743, 493, 494, 750, 495, 496, 497, 757,
+      498, 499, 500, 501, 764, 502, 503, 504,
+      505, 506, 771, 1066, 1067, 1068, 1069, 1070,
+      1071, 1382, 904, 171, 227, 932, 172, 87,
+      228, 283, 284, 960, 173, 88, 229, 89,
+      90, 285, 339, 340, 341, 988, 174, 91,
+      230, 92, 93, 286, 94, 95, 96, 342,
+      395, 396, 397, 398, 1016, 175, 97, 231,
+      98, 99, 287, 100, 101, 102, 343, 103,
+      104, 105, 106, 399, 451, 452, 453, 454,
+      455, 1044, 176, 107, 232, 108, 109, 288,
+      110, 111, 112, 344, 113, 114, 115, 116,
+      400, 117, 118, 119, 120, 1134, 456, 507,
+      508, 509, 510, 511, 512, 1072, 778, 548,
+      785, 549, 550, 792, 551, 552, 553, 799,
+      554, 555, 556, 557, 806, 558, 559, 560,
+      561, 562, 813, 563, 564, 565, 566, 567,
+      568, 820, 1094, 1095, 1096, 1097, 1098, 1099,
+      1100, 1390, 1142, 821, 828, 1150, 822, 569,
+      829, 835, 836, 1158, 823, 570, 830, 571,
+      572, 837, 842, 843, 844, 1166, 824, 573,
+      831, 574, 575, 838, 576, 577, 578, 845,
+      849, 850, 851, 852, 1174, 825, 579, 832,
+      580, 581, 839, 582, 583, 584, 846, 585,
+      586, 587, 588, 853, 856, 857, 858, 859,
+      860, 1182, 826, 589, 833, 590, 591, 840,
+      592, 593, 594, 847, 595, 596, 597, 598,
+      854, 599, 600, 601, 602, 603, 861, 863,
+      864, 865, 866, 867, 868, 1190, 827, 604,
+      834, 605, 606, 841, 607, 608, 609, 848,
+      610, 611, 612, 613, 855, 614, 615, 616,
+      617, 618, 862, 619, 620, 621, 622, 623,
+      624, 869, 870, 871, 872, 873, 874, 875,
+      876, 1198, 1199, 1101, 1200, 1102, 1103, 1201,
+      1104, 1105, 1106, 1202, 1107, 1108, 1109, 1110,
+      1203, 1111, 1112, 1113, 1114, 1115, 1204, 1116,
+      1117, 1118, 1119, 1120, 1121, 1205, 1122, 1123,
+      1124, 1125, 1126, 1127, 1128, 1206, 1391, 1392,
+      1393, 1394, 1395, 1396, 1397, 1398, 0, 0
+   },
+   {
+      {
+         0, 1, 2, 3, 4, 5, 6, 7,
+         8
+      },
+      {
+         0, 1, 3, 6, 10, 15, 21, 28,
+         36
+      },
+      {
+         0, 1, 4, 10, 20, 35, 56, 84,
+         120
+      },
+      {
+         0, 1, 5, 15, 35, 70, 126, 210,
+         330
+      },
+      {
+         0, 1, 6, 21, 56, 126, 252, 462,
+         792
+      }
+   }
+};
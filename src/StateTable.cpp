@@ -0,0 +1,217 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     StateTable.cpp
+//
+// File Overview: Represents a precomputed card transition table to evaluate
+//                seven cards added one at a time, one step per card
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#include "stdafx.h"
+#include <fstream>
+#include <map>
+#include <vector>
+#include "HandEvaluator.h"
+#include "StateTable.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : None
+// Notes    : Need to load a table before adding cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+StateTable::StateTable()
+   : nodes(NULL),
+     flushValues(NULL)
+{
+} // end StateTable::StateTable
+
+//******************************************************************************
+// Function : destructor
+// Process  : None, the mapped file unmaps the table
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+StateTable::~StateTable()
+{
+} // end StateTable::~StateTable
+
+//******************************************************************************
+// Function : generate
+// Process  : Number the nodes breadth first from the root, no cards
+//             Each node is keyed by three bits of count per card number
+//             For each node, for each card number held fewer than four times
+//                If the card completes seven cards, store the hand value of
+//                   the seven card numbers, with the suits spread so there
+//                   is no flush
+//                Else, number the node of the counts with the card added,
+//                   if new, and store the offset of its first entry
+//             For each suit mask of five to seven card numbers, store the
+//                best flush, else INVALIDVALUE
+//             Write the header, the node entries, and the flush values
+// Notes    : Throw an exception if the file cannot be written
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void StateTable::generate(const char* fileName)
+{
+   const int                           COUNTBITS = 3;  // Bits of each count
+   const int                           COUNTMASK = (1 << COUNTBITS) - 1;
+   HandEvaluator                       evaluator;
+   vector<int>                         table(FILESIZE, 0);
+   vector<unsigned long long>          nodeKeys;       // Key of each node
+   map<unsigned long long, int>        nodeIndexes;    // Node of each key
+   PackedCard                          cards[NUMSTATECARDS];
+   CardSet                             flushCards;     // Cards of one suit
+   ofstream                            file;
+
+   table[0] = MAGIC;
+   table[1] = VERSION;
+   table[2] = NUMNODES;
+   table[3] = NUMFLUSHMASKS;
+
+   nodeKeys.push_back(0);
+   nodeIndexes[0] = 0;
+
+   for (int node = 0; node < static_cast<int>(nodeKeys.size()); ++node)
+   {
+      unsigned long long key      = nodeKeys[node];
+      int                numCards = 0;  // Cards held by the node
+
+      for (int rank = 0; rank < NUMRANKS; ++rank)
+      {
+         numCards += (key >> (rank * COUNTBITS)) & COUNTMASK;
+      }
+
+      for (int rank = 0; rank < NUMRANKS; ++rank)
+      {
+         unsigned long long nextKey   = key + (1ULL << (rank * COUNTBITS));
+         int                cardIndex = 0;
+
+         if (((key >> (rank * COUNTBITS)) & COUNTMASK) == Hand::QUADS)
+         {
+            continue;
+         }
+
+         if (numCards + 1 == NUMSTATECARDS)
+         {
+            for (int nextRank = 0; nextRank < NUMRANKS; ++nextRank)
+            {
+               int count = (nextKey >> (nextRank * COUNTBITS)) & COUNTMASK;
+
+               for (; count > 0; --count, ++cardIndex)
+               {
+                  cards[cardIndex] = PackedCard::fromIndex(
+                     nextRank * NUMSUITS + cardIndex % NUMSUITS);
+               }
+            }
+
+            table[NODESOFFSET + node * NUMRANKS + rank] =
+               evaluator.evaluateSeven(cards);
+         }
+         else
+         {
+            if (nodeIndexes.find(nextKey) == nodeIndexes.end())
+            {
+               nodeIndexes[nextKey] = static_cast<int>(nodeKeys.size());
+               nodeKeys.push_back(nextKey);
+            }
+
+            table[NODESOFFSET + node * NUMRANKS + rank] =
+               nodeIndexes[nextKey] * NUMRANKS;
+         }
+      }
+   }
+
+   if (nodeKeys.size() != NUMNODES)
+   {
+      throw exception("Unexpected number of nodes in StateTable::generate");
+   }
+
+   for (int suitMask = 0; suitMask < NUMFLUSHMASKS; ++suitMask)
+   {
+      int numCards = CardSet::popCount(suitMask);
+
+      table[FLUSHOFFSET + suitMask] = HandEvaluator::INVALIDVALUE;
+
+      if (numCards >= Hand::MAXCARDS && numCards <= NUMSTATECARDS)
+      {
+         flushCards = CardSet(static_cast<unsigned long long>(suitMask));
+
+         table[FLUSHOFFSET + suitMask] = evaluator.evaluate(flushCards);
+      }
+   }
+
+   file.open(fileName, ios::out | ios::binary | ios::trunc);
+   file.write(reinterpret_cast<const char*>(&table[0]),
+              static_cast<streamsize>(table.size() * sizeof(int)));
+
+   if (!file)
+   {
+      throw exception("Unable to write file in StateTable::generate");
+   }
+} // end StateTable::generate
+
+//******************************************************************************
+// Function : load
+// Process  : Map the file
+//             Check its size and header match this layout
+//             Point the nodes and the flush values into the mapping
+// Notes    : Throw an exception if the file cannot be mapped or does not
+//             hold a table of this layout
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void StateTable::load(const char* fileName)
+{
+   const int* table = NULL;   // Mapped file
+
+   this->nodes       = NULL;
+   this->flushValues = NULL;
+
+   this->mappedFile.open(fileName);
+
+   table = static_cast<const int*>(this->mappedFile.getData());
+
+   if (this->mappedFile.getSize() != FILESIZE * sizeof(int) ||
+       table[0] != MAGIC ||
+       table[1] != VERSION ||
+       table[2] != NUMNODES ||
+       table[3] != NUMFLUSHMASKS)
+   {
+      this->mappedFile.close();
+      throw exception("Unexpected table layout in StateTable::load");
+   }
+
+   this->nodes       = table + NODESOFFSET;
+   this->flushValues = table + FLUSHOFFSET;
+} // end StateTable::load
@@ -0,0 +1,334 @@
+//******************************************************************************
+//
+// File Name:     StateTable.h
+//
+// File Overview: Represents a precomputed card transition table to evaluate
+//                seven cards added one at a time, one step per card
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#ifndef StateTable_h
+#define StateTable_h
+
+#include "CardSet.h"
+#include "MappedFile.h"
+#include "PackedCard.h"
+
+//******************************************************************************
+//
+// Class:    StateTable
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : The table is a DAG of the counts of card numbers, one node for
+//             each count of up to six cards, with one entry per card number
+//             to the node of the counts with that card added.  The entries
+//             of a six card node hold the HandEvaluator value of the seven
+//             card hand without a flush.  Suits only matter for flushes, so
+//             a State carries the mask of card numbers of each suit beside
+//             its node and the best flush of a suit mask is a second table.
+//             Fixed cards, such as the hole cards and the flop, are added
+//             once, the State copied, and each turn and river is one step.
+//             The table is written by generate, offline, and mapped
+//             read-only by load, so every process shares one copy.
+//             The file holds native 32 bit integers: the header, the node
+//             entries, then the flush values.
+//
+//******************************************************************************
+class StateTable
+{
+public:
+
+   class State;
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Default constructor, no table is loaded
+   // Constraints : Need to load a table before adding cards
+   //***************************************************************************
+   StateTable();
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks, unmaps the table
+   // Constraints : None
+   //***************************************************************************
+   virtual ~StateTable();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : addCard
+   // Description : Steps the state to the node of its cards with the input
+   //                card added
+   // Constraints : The table must be loaded, the state must hold six cards
+   //                or fewer, the cards must be valid and unique
+   //***************************************************************************
+   inline void addCard(
+      State&            state,
+      const PackedCard  card) const;
+
+   //***************************************************************************
+   // Function    : evaluate
+   // Description : Adds the seventh card to the state and returns the
+   //                HandEvaluator value of the best five card hand
+   // Constraints : The table must be loaded, the state must hold six cards,
+   //                the cards must be valid and unique
+   //***************************************************************************
+   inline int evaluate(
+      const State&      state,
+      const PackedCard  lastCard) const;
+
+   //***************************************************************************
+   // Function    : generate
+   // Description : Builds the table with HandEvaluator and writes it to the
+   //                file, to be loaded later
+   // Constraints : Throws an exception if the file cannot be written
+   //***************************************************************************
+   static void generate(const char* fileName);
+
+   //***************************************************************************
+   // Function    : isLoaded
+   // Description : Returns whether a table is loaded
+   // Constraints : None
+   //***************************************************************************
+   inline bool isLoaded() const;
+
+   //***************************************************************************
+   // Function    : load
+   // Description : Maps the table written by generate
+   // Constraints : Throws an exception if the file cannot be mapped or does
+   //                not hold a table of this layout
+   //***************************************************************************
+   void load(const char* fileName);
+
+   //***************************************************************************
+   // public Class Attributes.
+   //***************************************************************************
+
+   // Represents the layout of the table file, in 32 bit integers
+   enum StateTableLayout
+   {
+      MAGIC          = 0x53544154,  // "STAT"
+      VERSION        = 1,
+      NUMSUITS       = PackedCard::NUMSUITS,
+      NUMRANKS       = PackedCard::NUMRANKS,
+      NUMSTATECARDS  = 7,
+
+      // Counts of zero to six card numbers, none held five times
+      NUMNODES       = 26950,
+      NUMFLUSHMASKS  = 1 << NUMRANKS,
+      HEADERSIZE     = 4,           // Magic, version, nodes, flush masks
+      NODESOFFSET    = HEADERSIZE,
+      FLUSHOFFSET    = NODESOFFSET + NUMNODES * NUMRANKS,
+      FILESIZE       = FLUSHOFFSET + NUMFLUSHMASKS
+   };
+
+   //***************************************************************************
+   //
+   // Class:    State
+   //
+   // Notes    : The node of the cards added so far, the offset of its
+   //             first entry, and the card numbers of each suit
+   //             Trivially copyable, copy it to branch on the next card
+   //
+   //***************************************************************************
+   class State
+   {
+   public:
+
+      //************************************************************************
+      // Function    : constructor
+      // Description : Default constructor, holds no cards
+      // Constraints : None
+      //************************************************************************
+      inline State();
+
+      // Member functions in alphabetical order
+
+      //************************************************************************
+      // Function    : getNode
+      // Description : Accessor for node
+      // Constraints : None
+      //************************************************************************
+      inline int getNode() const;
+
+      //************************************************************************
+      // Function    : getSuitMask
+      // Description : Returns the mask of card numbers of the suit, from bit
+      //                0 for a two
+      // Constraints : suitIndex must be 0 to 3
+      //************************************************************************
+      inline int getSuitMask(const int suitIndex) const;
+
+      //************************************************************************
+      // Function    : step
+      // Description : Moves to the input node and adds the card to the mask
+      //                of its suit
+      // Constraints : Called by StateTable::addCard
+      //************************************************************************
+      inline void step(
+         const int         nextNode,
+         const PackedCard  card);
+
+   private:
+
+      int node;                  // Offset of the first entry of the node
+      int suitMasks[NUMSUITS];   // Card numbers of each suit
+
+   }; // end class State
+
+private:
+
+   MappedFile  mappedFile;    // Mapping of the table file
+   const int*  nodes;         // Node entries, NULL if not loaded
+   const int*  flushValues;   // Best flush of each suit mask
+
+}; // end class StateTable
+
+//******************************************************************************
+// Function : addCard
+// Process  : Step to the entry of the card's number in the state's node
+// Notes    : The table must be loaded, the state must hold six cards or
+//             fewer
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void StateTable::addCard(
+   State&            state,
+   const PackedCard  card) const
+{
+   state.step(this->nodes[state.getNode() + card.getRank()], card);
+} // end StateTable::addCard
+
+//******************************************************************************
+// Function : evaluate
+// Process  : Add the last card to the mask of its suit
+//             If a suit holds five or more cards, return its best flush
+//                Seven cards cannot hold a flush and a better hand
+//             Else, return the entry of the card's number in the state's
+//                node, the seven card hand value
+// Notes    : The table must be loaded, the state must hold six cards
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int StateTable::evaluate(
+   const State&      state,
+   const PackedCard  lastCard) const
+{
+   int suitMask = 0;   // Card numbers of one suit
+
+   for (int suit = 0; suit < NUMSUITS; ++suit)
+   {
+      suitMask = state.getSuitMask(suit);
+
+      if (suit == lastCard.getSuitIndex())
+      {
+         suitMask |= 1 << lastCard.getRank();
+      }
+
+      if (CardSet::popCount(suitMask) >= Hand::MAXCARDS)
+      {
+         return this->flushValues[suitMask];
+      }
+   }
+
+   return this->nodes[state.getNode() + lastCard.getRank()];
+} // end StateTable::evaluate
+
+//******************************************************************************
+// Function : isLoaded
+// Process  : Return whether nodes points at a mapped table
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline bool StateTable::isLoaded() const
+{
+   return this->nodes != NULL;
+} // end StateTable::isLoaded
+
+//******************************************************************************
+// Function : constructor
+// Process  : Start at the root node, no card numbers in any suit
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline StateTable::State::State()
+   : node(0),
+     suitMasks()
+{
+} // end StateTable::State::State
+
+//******************************************************************************
+// Function : getNode
+// Process  : Accessor for node
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int StateTable::State::getNode() const
+{
+   return this->node;
+} // end StateTable::State::getNode
+
+//******************************************************************************
+// Function : getSuitMask
+// Process  : Accessor for the mask of card numbers of the suit
+// Notes    : suitIndex must be 0 to 3
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int StateTable::State::getSuitMask(const int suitIndex) const
+{
+   return this->suitMasks[suitIndex];
+} // end StateTable::State::getSuitMask
+
+//******************************************************************************
+// Function : step
+// Process  : Move to the next node and set the card's number in the mask of
+//             its suit
+// Notes    : Called by StateTable::addCard
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline void StateTable::State::step(
+   const int         nextNode,
+   const PackedCard  card)
+{
+   this->node = nextNode;
+   this->suitMasks[card.getSuitIndex()] |= 1 << card.getRank();
+} // end StateTable::State::step
+
+#endif // StateTable_h
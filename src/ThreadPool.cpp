@@ -0,0 +1,373 @@
+// COPYRIGHT © 2011, Donne Martin
+// All Rights Reserved.
+//
+//******************************************************************************
+//
+// File Name:     ThreadPool.cpp
+//
+// File Overview: Represents a Thread Pool that runs chunked ranges of work
+//                over a fixed set of threads, balanced by work stealing
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//******************************************************************************
+
+#include "stdafx.h"
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include "ThreadPool.h"
+
+//******************************************************************************
+// File scope (static) variable definitions
+//******************************************************************************
+
+// None
+
+//******************************************************************************
+// Function : constructor
+// Process  : Use one worker per core if numThreads is 0
+//             Create a queue per worker
+//             Start workers 1 to numThreads - 1, pinning each if asked
+// Notes    : Throw an exception if numThreads is negative
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+ThreadPool::ThreadPool(
+   const int   numThreads,
+   const bool  pinThreads)
+   : numThreads(numThreads),
+     queues(NULL),
+     task(NULL),
+     numItems(0),
+     chunkSize(1),
+     runNumber(0),
+     numRunning(0),
+     stopping(false),
+     failed(false)
+{
+   int numCores = ThreadPool::getNumCores();
+
+   if (numThreads < 0)
+   {
+      throw exception("Invalid threads in ThreadPool::ThreadPool");
+   }
+
+   if (this->numThreads == 0)
+   {
+      this->numThreads = numCores;
+   }
+
+   this->queues = new WorkQueue[this->numThreads];
+
+   for (int worker = 1; worker < this->numThreads; ++worker)
+   {
+      this->threads.push_back(thread(&ThreadPool::runWorker, this, worker));
+
+      if (pinThreads)
+      {
+         ThreadPool::pinThread(this->threads.back(), worker % numCores);
+      }
+   }
+} // end ThreadPool::ThreadPool
+
+//******************************************************************************
+// Function : destructor
+// Process  : Tell the workers to stop and join them
+//             Release the queues
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+ThreadPool::~ThreadPool()
+{
+   {
+      lock_guard<mutex> guard(this->stateLock);
+
+      this->stopping = true;
+   }
+
+   this->workReady.notify_all();
+
+   for (size_t worker = 0; worker < this->threads.size(); ++worker)
+   {
+      this->threads[worker].join();
+   }
+
+   delete [] this->queues;
+} // end ThreadPool::~ThreadPool
+
+//******************************************************************************
+// Function : getNumCores
+// Process  : Return the hardware threads, or 1 if unknown
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+int ThreadPool::getNumCores()
+{
+   int numCores = static_cast<int>(thread::hardware_concurrency());
+
+   return numCores > 0 ? numCores : 1;
+} // end ThreadPool::getNumCores
+
+//******************************************************************************
+// Function : pinThread
+// Process  : Set the affinity of the thread to the single core
+// Notes    : Does nothing where affinity is not supported
+//             A mask holds the first 64 cores on Windows
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ThreadPool::pinThread(
+   thread&     worker,
+   const int   core)
+{
+#if defined(_WIN32)
+   SetThreadAffinityMask(worker.native_handle(),
+                         static_cast<DWORD_PTR>(1) << (core % 64));
+#elif defined(__linux__)
+   cpu_set_t cores;
+
+   CPU_ZERO(&cores);
+   CPU_SET(core, &cores);
+   pthread_setaffinity_np(worker.native_handle(), sizeof(cores), &cores);
+#else
+   (void)worker;
+   (void)core;
+#endif
+} // end ThreadPool::pinThread
+
+//******************************************************************************
+// Function : run
+// Process  : Check the chunk size and wait for any other run to finish
+//             Deal the chunks evenly to the queues, each a contiguous range
+//             Publish the task and wake the started workers
+//             Run chunks as worker 0 until none are left
+//             Wait for the started workers to finish
+//             Rethrow the first exception thrown by the task
+// Notes    : Throw an exception if chunkSize is not positive
+//             The queues are dealt before the run is published under the
+//             state lock, so a worker woken by it sees the new queues
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ThreadPool::run(
+   const int   numItems,
+   const int   chunkSize,
+   const Task& task)
+{
+   int numChunks = 0;
+
+   if (chunkSize < 1)
+   {
+      throw exception("Invalid chunk size in ThreadPool::run");
+   }
+
+   if (numItems < 1)
+   {
+      return;
+   }
+
+   lock_guard<mutex> runGuard(this->runLock);
+
+   numChunks = (numItems - 1) / chunkSize + 1;
+
+   for (int worker = 0; worker < this->numThreads; ++worker)
+   {
+      lock_guard<mutex> queueGuard(this->queues[worker].lock);
+
+      this->queues[worker].front = static_cast<int>(
+         static_cast<long long>(numChunks) * worker / this->numThreads);
+      this->queues[worker].back  = static_cast<int>(
+         static_cast<long long>(numChunks) * (worker + 1) /
+         this->numThreads);
+   }
+
+   {
+      lock_guard<mutex> stateGuard(this->stateLock);
+
+      this->task       = &task;
+      this->numItems   = numItems;
+      this->chunkSize  = chunkSize;
+      this->numRunning = this->numThreads - 1;
+      this->failure    = exception_ptr();
+      this->failed     = false;
+      this->runNumber++;
+   }
+
+   this->workReady.notify_all();
+   this->runChunks(0);
+
+   {
+      unique_lock<mutex> stateGuard(this->stateLock);
+
+      while (this->numRunning > 0)
+      {
+         this->workDone.wait(stateGuard);
+      }
+
+      this->task = NULL;
+   }
+
+   if (this->failure)
+   {
+      rethrow_exception(this->failure);
+   }
+} // end ThreadPool::run
+
+//******************************************************************************
+// Function : runChunks
+// Process  : Until no chunk is left or a task has thrown
+//                Take or steal a chunk and call the task on its items
+//                Keep the first exception the task throws and stop the
+//                   chunks not yet taken
+// Notes    : The last chunk may hold fewer than chunkSize items
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ThreadPool::runChunks(const int worker)
+{
+   int chunk = 0;
+
+   while (!this->failed && this->takeChunk(worker, chunk))
+   {
+      int first = chunk * this->chunkSize;
+      int last  = first + (this->numItems - first < this->chunkSize ?
+                           this->numItems - first : this->chunkSize);
+
+      try
+      {
+         (*this->task)(first, last, worker);
+      }
+      catch (...)
+      {
+         lock_guard<mutex> stateGuard(this->stateLock);
+
+         if (!this->failure)
+         {
+            this->failure = current_exception();
+         }
+
+         this->failed = true;
+      }
+   }
+} // end ThreadPool::runChunks
+
+//******************************************************************************
+// Function : runWorker
+// Process  : Until the pool stops
+//                Wait for a run after the last one run
+//                Run its chunks
+//                Count the worker finished, the last one wakes run
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+void ThreadPool::runWorker(const int worker)
+{
+   unsigned long long lastRun = 0;   // Run this worker ran last
+
+   for (;;)
+   {
+      {
+         unique_lock<mutex> stateGuard(this->stateLock);
+
+         while (!this->stopping && this->runNumber == lastRun)
+         {
+            this->workReady.wait(stateGuard);
+         }
+
+         if (this->stopping)
+         {
+            return;
+         }
+
+         lastRun = this->runNumber;
+      }
+
+      this->runChunks(worker);
+
+      {
+         lock_guard<mutex> stateGuard(this->stateLock);
+
+         if (--this->numRunning == 0)
+         {
+            this->workDone.notify_one();
+         }
+      }
+   }
+} // end ThreadPool::runWorker
+
+//******************************************************************************
+// Function : takeChunk
+// Process  : Take the front chunk of the worker's own queue
+//             Else visit the other queues in turn from the next worker and
+//                steal the back chunk of the first one not empty
+// Notes    : The owner and the thieves take from opposite ends, so the
+//             owner keeps its chunks in order and a thief takes the chunks
+//             the owner would reach last
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+bool ThreadPool::takeChunk(
+   const int   worker,
+   int&        chunk)
+{
+   {
+      WorkQueue&        own = this->queues[worker];
+      lock_guard<mutex> queueGuard(own.lock);
+
+      if (own.front < own.back)
+      {
+         chunk = own.front++;
+         return true;
+      }
+   }
+
+   for (int offset = 1; offset < this->numThreads; ++offset)
+   {
+      WorkQueue&        victim =
+         this->queues[(worker + offset) % this->numThreads];
+      lock_guard<mutex> queueGuard(victim.lock);
+
+      if (victim.front < victim.back)
+      {
+         chunk = --victim.back;
+         return true;
+      }
+   }
+
+   return false;
+} // end ThreadPool::takeChunk
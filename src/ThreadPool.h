@@ -0,0 +1,244 @@
+//******************************************************************************
+//
+// File Name:     ThreadPool.h
+//
+// File Overview: Represents a Thread Pool that runs chunked ranges of work
+//                over a fixed set of threads, balanced by work stealing
+//
+//******************************************************************************
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+// 10.18.26       Donne Martin         Include what the pool uses
+//******************************************************************************
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+//******************************************************************************
+//
+// Class:    ThreadPool
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added class
+//
+// Notes    : run splits the items 0 to numItems - 1 into chunks of
+//             chunkSize items and calls the task once per chunk with the
+//             first item, the item past the last, and the worker running
+//             it, so the task can count into the worker's own results.
+//             Each worker has a queue of chunks, a contiguous range of
+//             chunk indexes dealt evenly at the start of a run.  A worker
+//             takes chunks from the front of its own queue, and once it is
+//             empty steals from the back of the other workers' queues, so
+//             workers whose chunks cost less take over the tail of the
+//             others instead of sitting idle.
+//             The thread calling run is worker 0, the pool starts the
+//             other numThreads - 1 workers once and they wait for each run.
+//             With pinThreads, worker n is pinned to core n, wrapping
+//             around, the calling thread is left where it is.
+//             A task must not call run on the same pool.  An exception
+//             thrown by a task stops the chunks not yet taken and is
+//             rethrown by run.
+//             Not copyable, the threads are joined by the destructor
+//
+//******************************************************************************
+class ThreadPool
+{
+public:
+
+   // Task run on each chunk: first item, item past the last, worker index
+   typedef function<void (const int, const int, const int)> Task;
+
+   //***************************************************************************
+   // Function    : constructor
+   // Description : Starts numThreads - 1 workers, or one per core less one
+   //                if numThreads is 0, pinned to a core each if pinThreads
+   // Constraints : Throws an exception if numThreads is negative
+   //***************************************************************************
+   explicit ThreadPool(
+      const int   numThreads = 0,
+      const bool  pinThreads = false);
+
+   //***************************************************************************
+   // Function    : destructor
+   // Description : Performs cleanup tasks, stops and joins the workers
+   // Constraints : No run may be in progress
+   //***************************************************************************
+   virtual ~ThreadPool();
+
+   // Member functions in alphabetical order
+
+   //***************************************************************************
+   // Function    : getNumCores
+   // Description : Returns the number of cores, at least 1
+   // Constraints : None
+   //***************************************************************************
+   static int getNumCores();
+
+   //***************************************************************************
+   // Function    : getNumThreads
+   // Description : Returns the number of workers, the calling thread
+   //                included, each task's worker is 0 to this less one
+   // Constraints : None
+   //***************************************************************************
+   inline int getNumThreads() const;
+
+   //***************************************************************************
+   // Function    : run
+   // Description : Calls the task on each chunk of chunkSize items of the
+   //                numItems items over every worker, and returns once all
+   //                are done
+   // Constraints : Throws an exception if chunkSize is not positive, or
+   //                rethrows the first exception thrown by the task
+   //                Runs from different threads take turns
+   //***************************************************************************
+   void run(
+      const int   numItems,
+      const int   chunkSize,
+      const Task& task);
+
+private:
+
+   //***************************************************************************
+   //
+   // Class:    WorkQueue
+   //
+   // Notes    : The chunks front to back - 1 left to a worker, taken by the
+   //             worker from the front and stolen from the back under the
+   //             lock
+   //             Aligned to a cache line, so the queues never share one
+   //             Private, used by ThreadPool only
+   //
+   //***************************************************************************
+   class alignas(64) WorkQueue
+   {
+   public:
+
+      //************************************************************************
+      // Function    : constructor
+      // Description : Initializes the queue to empty
+      // Constraints : None
+      //************************************************************************
+      inline WorkQueue();
+
+      mutex lock;    // Held by takes and steals
+      int   front;   // Next chunk of the worker
+      int   back;    // Chunk past the last
+
+   }; // end class WorkQueue
+
+   //***************************************************************************
+   // Function    : copy constructor
+   // Description : Not implemented, the pool owns its threads
+   // Constraints : Private
+   //***************************************************************************
+   ThreadPool(const ThreadPool& pool);
+
+   //***************************************************************************
+   // Function    : operator=
+   // Description : Not implemented, the pool owns its threads
+   // Constraints : Private
+   //***************************************************************************
+   ThreadPool& operator=(const ThreadPool& pool);
+
+   //***************************************************************************
+   // Function    : pinThread
+   // Description : Pins the thread to the core, where supported
+   // Constraints : Private
+   //***************************************************************************
+   static void pinThread(
+      thread&     worker,
+      const int   core);
+
+   //***************************************************************************
+   // Function    : runChunks
+   // Description : Takes or steals chunks of the current run and calls the
+   //                task on each until none are left
+   // Constraints : Private, run by every worker of each run
+   //***************************************************************************
+   void runChunks(const int worker);
+
+   //***************************************************************************
+   // Function    : runWorker
+   // Description : Waits for each run and runs its chunks until the pool
+   //                stops
+   // Constraints : Private, the body of each started thread
+   //***************************************************************************
+   void runWorker(const int worker);
+
+   //***************************************************************************
+   // Function    : takeChunk
+   // Description : Takes the front chunk of the worker's queue, else steals
+   //                the back chunk of another queue, and returns false if
+   //                every queue is empty
+   // Constraints : Private
+   //***************************************************************************
+   bool takeChunk(
+      const int   worker,
+      int&        chunk);
+
+   int                  numThreads;    // Workers, the calling thread too
+   WorkQueue*           queues;        // Queue of each worker
+   vector<thread>       threads;       // Workers 1 to numThreads - 1
+   mutex                runLock;       // Held by each run for its duration
+   mutex                stateLock;     // Guards the state of the run below
+   condition_variable   workReady;     // Signals a new run or a stop
+   condition_variable   workDone;      // Signals the last worker finished
+   const Task*          task;          // Task of the current run
+   int                  numItems;      // Items of the current run
+   int                  chunkSize;     // Items of each chunk
+   unsigned long long   runNumber;     // Runs started, workers wait for the
+                                       // next
+   int                  numRunning;    // Started workers still running
+   bool                 stopping;      // Set by the destructor
+   atomic<bool>         failed;        // A task threw, take no more chunks
+   exception_ptr        failure;       // First exception thrown by a task
+
+}; // end class ThreadPool
+
+//******************************************************************************
+// Function : getNumThreads
+// Process  : Accessor for numThreads
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline int ThreadPool::getNumThreads() const
+{
+   return this->numThreads;
+} // end ThreadPool::getNumThreads
+
+//******************************************************************************
+// Function : constructor
+// Process  : Start with no chunks
+// Notes    : None
+//
+// Revision History:
+//
+// Date           Author               Description
+// 10.18.26       Donne Martin         Added function
+//******************************************************************************
+inline ThreadPool::WorkQueue::WorkQueue()
+   : front(0),
+     back(0)
+{
+} // end ThreadPool::WorkQueue::WorkQueue
+
+#endif // ThreadPool_h